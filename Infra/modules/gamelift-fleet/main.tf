@@ -86,7 +86,7 @@ resource "aws_iam_role_policy" "fleet_s3" {
   })
 }
 
-# IAM policy: allow fleet instances to invoke the Session API /session-summary endpoint
+# IAM policy: allow fleet instances to invoke the Session API server endpoints
 resource "aws_iam_role_policy" "fleet_session_api" {
   count = var.session_api_execution_arn != "" ? 1 : 0
   name  = "session-api-invoke"
@@ -104,6 +104,21 @@ resource "aws_iam_role_policy" "fleet_session_api" {
         Effect   = "Allow"
         Action   = "execute-api:Invoke"
         Resource = "${var.session_api_execution_arn}/${var.environment}/POST/interaction-events"
+      },
+      {
+        Effect   = "Allow"
+        Action   = "execute-api:Invoke"
+        Resource = "${var.session_api_execution_arn}/${var.environment}/POST/player-rewards/batch"
+      },
+      {
+        Effect   = "Allow"
+        Action   = "execute-api:Invoke"
+        Resource = "${var.session_api_execution_arn}/${var.environment}/POST/player-rewards"
+      },
+      {
+        Effect   = "Allow"
+        Action   = "execute-api:Invoke"
+        Resource = "${var.session_api_execution_arn}/${var.environment}/GET/player-rewards/*"
       }
     ]
   })
@@ -0,0 +1,86 @@
+/**
+ * Get Player Rewards Lambda Function
+ * Returns the reward ids granted to a player; game servers prefetch this when the player joins.
+ */
+
+const { DynamoDBClient } = require('@aws-sdk/client-dynamodb');
+const { DynamoDBDocumentClient, QueryCommand } = require('@aws-sdk/lib-dynamodb');
+
+const client = new DynamoDBClient({ region: process.env.AWS_REGION });
+const dynamodb = DynamoDBDocumentClient.from(client);
+
+const PLAYER_REWARDS_TABLE = process.env.PLAYER_REWARDS_TABLE;
+const LOG_LEVEL = process.env.LOG_LEVEL || 'INFO';
+
+function log(level, message, data = {}) {
+    if (LOG_LEVEL === 'DEBUG' || level !== 'DEBUG') {
+        console.log(JSON.stringify({ level, message, ...data, timestamp: new Date().toISOString() }));
+    }
+}
+
+exports.handler = async (event) => {
+    log('DEBUG', 'Get player rewards request received', { event });
+
+    try {
+        const playerId = event.pathParameters && event.pathParameters.playerId
+            ? decodeURIComponent(event.pathParameters.playerId)
+            : '';
+
+        if (!playerId) {
+            return {
+                statusCode: 400,
+                headers: { 'Content-Type': 'application/json' },
+                body: JSON.stringify({
+                    error: 'INVALID_REQUEST',
+                    message: 'playerId is required'
+                })
+            };
+        }
+
+        // A player with nothing granted gets an empty list, not a 404
+        const rewards = [];
+        let exclusiveStartKey;
+        do {
+            const res = await dynamodb.send(new QueryCommand({
+                TableName: PLAYER_REWARDS_TABLE,
+                KeyConditionExpression: 'playerId = :playerId',
+                FilterExpression: 'granted = :true',
+                ExpressionAttributeValues: {
+                    ':playerId': playerId,
+                    ':true': true
+                },
+                ProjectionExpression: 'rewardId',
+                ExclusiveStartKey: exclusiveStartKey
+            }));
+            for (const item of res.Items || []) {
+                rewards.push(item.rewardId);
+            }
+            exclusiveStartKey = res.LastEvaluatedKey;
+        } while (exclusiveStartKey);
+
+        log('INFO', 'Player rewards read', { playerId, count: rewards.length });
+
+        return {
+            statusCode: 200,
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                playerId,
+                rewards
+            })
+        };
+    } catch (error) {
+        log('ERROR', 'Failed to read player rewards', {
+            error: error.message,
+            stack: error.stack
+        });
+
+        return {
+            statusCode: 500,
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                error: 'QUERY_FAILED',
+                message: error.message
+            })
+        };
+    }
+};
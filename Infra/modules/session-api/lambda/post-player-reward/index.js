@@ -0,0 +1,88 @@
+/**
+ * Post Player Reward Lambda Function
+ * Grants one reward to a player. Idempotent: the write is conditional on the reward not being
+ * granted yet, and a repeat grant succeeds with alreadyGranted set.
+ */
+
+const { DynamoDBClient } = require('@aws-sdk/client-dynamodb');
+const { DynamoDBDocumentClient, UpdateCommand } = require('@aws-sdk/lib-dynamodb');
+
+const client = new DynamoDBClient({ region: process.env.AWS_REGION });
+const dynamodb = DynamoDBDocumentClient.from(client);
+
+const PLAYER_REWARDS_TABLE = process.env.PLAYER_REWARDS_TABLE;
+const LOG_LEVEL = process.env.LOG_LEVEL || 'INFO';
+
+function log(level, message, data = {}) {
+    if (LOG_LEVEL === 'DEBUG' || level !== 'DEBUG') {
+        console.log(JSON.stringify({ level, message, ...data, timestamp: new Date().toISOString() }));
+    }
+}
+
+exports.handler = async (event) => {
+    log('DEBUG', 'Post player reward request received', { event });
+
+    try {
+        const body = JSON.parse(event.body || '{}');
+        const { playerId, rewardId, grantedAt } = body;
+
+        if (!playerId || !rewardId) {
+            return {
+                statusCode: 400,
+                headers: { 'Content-Type': 'application/json' },
+                body: JSON.stringify({
+                    error: 'INVALID_REQUEST',
+                    message: 'playerId and rewardId are required'
+                })
+            };
+        }
+
+        let alreadyGranted = false;
+        try {
+            await dynamodb.send(new UpdateCommand({
+                TableName: PLAYER_REWARDS_TABLE,
+                Key: {
+                    playerId,
+                    rewardId
+                },
+                UpdateExpression: 'SET granted = :true, grantedAt = :grantedAt',
+                ConditionExpression: 'attribute_not_exists(granted) OR granted <> :true',
+                ExpressionAttributeValues: {
+                    ':true': true,
+                    ':grantedAt': grantedAt || new Date().toISOString()
+                }
+            }));
+        } catch (error) {
+            if (error.name !== 'ConditionalCheckFailedException') {
+                throw error;
+            }
+            alreadyGranted = true;
+        }
+
+        log('INFO', 'Reward granted', { playerId, rewardId, alreadyGranted });
+
+        return {
+            statusCode: 200,
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                playerId,
+                rewardId,
+                alreadyGranted
+            })
+        };
+    } catch (error) {
+        log('ERROR', 'Failed to grant reward', {
+            error: error.message,
+            stack: error.stack
+        });
+
+        return {
+            statusCode: 500,
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                error: 'STORAGE_FAILED',
+                message: error.message
+            })
+        };
+    }
+};
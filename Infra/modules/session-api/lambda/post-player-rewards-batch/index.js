@@ -0,0 +1,129 @@
+/**
+ * Post Player Rewards Batch Lambda Function
+ * Applies a batch of reward grants from the server-side reward ledger. Each grant carries an
+ * idempotency key; a key already applied is acknowledged again but not re-applied, so a batch
+ * re-sent after a lost ack or a server restart never double-grants.
+ */
+
+const { DynamoDBClient } = require('@aws-sdk/client-dynamodb');
+const { DynamoDBDocumentClient, TransactWriteCommand } = require('@aws-sdk/lib-dynamodb');
+
+const client = new DynamoDBClient({ region: process.env.AWS_REGION });
+const dynamodb = DynamoDBDocumentClient.from(client);
+
+const PLAYER_REWARDS_TABLE = process.env.PLAYER_REWARDS_TABLE;
+const GRANT_KEYS_TABLE = process.env.GRANT_KEYS_TABLE;
+const GRANT_KEY_TTL_SECONDS = parseInt(process.env.GRANT_KEY_TTL_SECONDS || '604800', 10);
+const LOG_LEVEL = process.env.LOG_LEVEL || 'INFO';
+
+function log(level, message, data = {}) {
+    if (LOG_LEVEL === 'DEBUG' || level !== 'DEBUG') {
+        console.log(JSON.stringify({ level, message, ...data, timestamp: new Date().toISOString() }));
+    }
+}
+
+function badRequest(message) {
+    return {
+        statusCode: 400,
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify({
+            error: 'INVALID_REQUEST',
+            message
+        })
+    };
+}
+
+// True when the transaction was cancelled only because the idempotency key already exists
+function isDuplicateKey(error) {
+    return error.name === 'TransactionCanceledException'
+        && Array.isArray(error.CancellationReasons)
+        && error.CancellationReasons[0]
+        && error.CancellationReasons[0].Code === 'ConditionalCheckFailed';
+}
+
+exports.handler = async (event) => {
+    log('DEBUG', 'Post player rewards batch request received', { event });
+
+    try {
+        const body = JSON.parse(event.body || '{}');
+        const { grants } = body;
+
+        if (!Array.isArray(grants)) {
+            return badRequest('grants array is required');
+        }
+
+        // Validate the whole batch before writing anything so a 400 never leaves it half-applied
+        for (const grant of grants) {
+            if (!grant || !grant.idempotencyKey || !grant.playerId || !grant.rewardId) {
+                return badRequest('each grant needs idempotencyKey, playerId and rewardId');
+            }
+        }
+
+        const now = new Date().toISOString();
+        const ttl = Math.floor(Date.now() / 1000) + GRANT_KEY_TTL_SECONDS;
+        let accepted = 0;
+        let duplicates = 0;
+
+        // One transaction per grant: the key claim and the reward write land together or not at all
+        for (const { idempotencyKey, playerId, rewardId, grantedAt } of grants) {
+            const command = new TransactWriteCommand({
+                TransactItems: [
+                    {
+                        Put: {
+                            TableName: GRANT_KEYS_TABLE,
+                            Item: { idempotencyKey, playerId, rewardId, ttl },
+                            ConditionExpression: 'attribute_not_exists(idempotencyKey)'
+                        }
+                    },
+                    {
+                        Update: {
+                            TableName: PLAYER_REWARDS_TABLE,
+                            Key: { playerId, rewardId },
+                            UpdateExpression: 'SET granted = :true, grantedAt = :grantedAt',
+                            ExpressionAttributeValues: {
+                                ':true': true,
+                                ':grantedAt': grantedAt || now
+                            }
+                        }
+                    }
+                ]
+            });
+
+            try {
+                await dynamodb.send(command);
+                ++accepted;
+            } catch (error) {
+                if (!isDuplicateKey(error)) {
+                    throw error;
+                }
+                ++duplicates;
+            }
+        }
+
+        log('INFO', 'Reward batch applied', { accepted, duplicates });
+
+        return {
+            statusCode: 200,
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                accepted,
+                duplicates
+            })
+        };
+    } catch (error) {
+        log('ERROR', 'Failed to apply reward batch', {
+            error: error.message,
+            stack: error.stack
+        });
+
+        // 500 keeps the batch in the server ledger; keys already applied come back as duplicates on resend
+        return {
+            statusCode: 500,
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify({
+                error: 'STORAGE_FAILED',
+                message: error.message
+            })
+        };
+    }
+};
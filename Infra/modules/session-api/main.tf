@@ -130,6 +130,82 @@ resource "aws_api_gateway_integration" "post_session_summary" {
   uri                     = aws_lambda_function.post_session_summary.invoke_arn
 }
 
+# /player-rewards resource
+resource "aws_api_gateway_resource" "player_rewards" {
+  rest_api_id = aws_api_gateway_rest_api.session_api.id
+  parent_id   = aws_api_gateway_rest_api.session_api.root_resource_id
+  path_part   = "player-rewards"
+}
+
+# POST /player-rewards — single idempotent grant
+resource "aws_api_gateway_method" "post_player_reward" {
+  rest_api_id   = aws_api_gateway_rest_api.session_api.id
+  resource_id   = aws_api_gateway_resource.player_rewards.id
+  http_method   = "POST"
+  authorization = "AWS_IAM"
+}
+
+resource "aws_api_gateway_integration" "post_player_reward" {
+  rest_api_id             = aws_api_gateway_rest_api.session_api.id
+  resource_id             = aws_api_gateway_resource.player_rewards.id
+  http_method             = aws_api_gateway_method.post_player_reward.http_method
+  integration_http_method = "POST"
+  type                    = "AWS_PROXY"
+  uri                     = aws_lambda_function.post_player_reward.invoke_arn
+}
+
+# /player-rewards/{playerId} resource
+resource "aws_api_gateway_resource" "player_rewards_player" {
+  rest_api_id = aws_api_gateway_rest_api.session_api.id
+  parent_id   = aws_api_gateway_resource.player_rewards.id
+  path_part   = "{playerId}"
+}
+
+# GET /player-rewards/{playerId} — prefetched by the server when a player joins
+resource "aws_api_gateway_method" "get_player_rewards" {
+  rest_api_id   = aws_api_gateway_rest_api.session_api.id
+  resource_id   = aws_api_gateway_resource.player_rewards_player.id
+  http_method   = "GET"
+  authorization = "AWS_IAM"
+
+  request_parameters = {
+    "method.request.path.playerId" = true
+  }
+}
+
+resource "aws_api_gateway_integration" "get_player_rewards" {
+  rest_api_id             = aws_api_gateway_rest_api.session_api.id
+  resource_id             = aws_api_gateway_resource.player_rewards_player.id
+  http_method             = aws_api_gateway_method.get_player_rewards.http_method
+  integration_http_method = "POST"
+  type                    = "AWS_PROXY"
+  uri                     = aws_lambda_function.get_player_rewards.invoke_arn
+}
+
+# /player-rewards/batch resource — idempotent grant batches from the server reward ledger
+resource "aws_api_gateway_resource" "player_rewards_batch" {
+  rest_api_id = aws_api_gateway_rest_api.session_api.id
+  parent_id   = aws_api_gateway_resource.player_rewards.id
+  path_part   = "batch"
+}
+
+# POST /player-rewards/batch
+resource "aws_api_gateway_method" "post_player_rewards_batch" {
+  rest_api_id   = aws_api_gateway_rest_api.session_api.id
+  resource_id   = aws_api_gateway_resource.player_rewards_batch.id
+  http_method   = "POST"
+  authorization = "AWS_IAM"
+}
+
+resource "aws_api_gateway_integration" "post_player_rewards_batch" {
+  rest_api_id             = aws_api_gateway_rest_api.session_api.id
+  resource_id             = aws_api_gateway_resource.player_rewards_batch.id
+  http_method             = aws_api_gateway_method.post_player_rewards_batch.http_method
+  integration_http_method = "POST"
+  type                    = "AWS_PROXY"
+  uri                     = aws_lambda_function.post_player_rewards_batch.invoke_arn
+}
+
 # /scores resource — POST player high score (F6b, Cognito-authed)
 resource "aws_api_gateway_resource" "scores" {
   rest_api_id = aws_api_gateway_rest_api.session_api.id
@@ -203,6 +279,15 @@ resource "aws_api_gateway_deployment" "session_api" {
       aws_api_gateway_resource.leaderboard.id,
       aws_api_gateway_method.get_leaderboard.id,
       aws_api_gateway_integration.get_leaderboard.id,
+      aws_api_gateway_resource.player_rewards.id,
+      aws_api_gateway_method.post_player_reward.id,
+      aws_api_gateway_integration.post_player_reward.id,
+      aws_api_gateway_resource.player_rewards_player.id,
+      aws_api_gateway_method.get_player_rewards.id,
+      aws_api_gateway_integration.get_player_rewards.id,
+      aws_api_gateway_resource.player_rewards_batch.id,
+      aws_api_gateway_method.post_player_rewards_batch.id,
+      aws_api_gateway_integration.post_player_rewards_batch.id,
     ]))
   }
 
@@ -281,6 +366,36 @@ resource "aws_cloudwatch_log_group" "lambda_post_summary" {
   })
 }
 
+resource "aws_cloudwatch_log_group" "lambda_post_reward" {
+  name              = "/aws/lambda/${var.project_name}-post-player-reward-${var.environment}"
+  retention_in_days = var.log_retention_days
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-post-player-reward-logs"
+    Environment = var.environment
+  })
+}
+
+resource "aws_cloudwatch_log_group" "lambda_get_rewards" {
+  name              = "/aws/lambda/${var.project_name}-get-player-rewards-${var.environment}"
+  retention_in_days = var.log_retention_days
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-get-player-rewards-logs"
+    Environment = var.environment
+  })
+}
+
+resource "aws_cloudwatch_log_group" "lambda_post_rewards_batch" {
+  name              = "/aws/lambda/${var.project_name}-post-player-rewards-batch-${var.environment}"
+  retention_in_days = var.log_retention_days
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-post-player-rewards-batch-logs"
+    Environment = var.environment
+  })
+}
+
 resource "aws_cloudwatch_log_group" "lambda_post_score" {
   name              = "/aws/lambda/${var.project_name}-post-score-${var.environment}"
   retention_in_days = var.log_retention_days
@@ -413,6 +528,51 @@ resource "aws_iam_role_policy" "lambda_dynamodb" {
   })
 }
 
+# Idempotency keys for batched reward grants. The batch Lambda claims each key with a
+# conditional put in the same transaction as the reward write, so a re-sent batch is
+# acknowledged without being applied twice. Keys expire once no server can still resend them.
+resource "aws_dynamodb_table" "reward_grant_keys" {
+  name         = "${var.project_name}-reward-grant-keys-${var.environment}"
+  billing_mode = "PAY_PER_REQUEST"
+  hash_key     = "idempotencyKey"
+
+  attribute {
+    name = "idempotencyKey"
+    type = "S"
+  }
+
+  ttl {
+    attribute_name = "ttl"
+    enabled        = true
+  }
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-reward-grant-keys"
+    Environment = var.environment
+  })
+}
+
+# IAM policy for the reward grant transaction (key claim + reward write)
+resource "aws_iam_role_policy" "lambda_reward_grants" {
+  name = "reward-grants-access"
+  role = aws_iam_role.lambda.id
+
+  policy = jsonencode({
+    Version = "2012-10-17"
+    Statement = [
+      {
+        Effect = "Allow"
+        Action = [
+          "dynamodb:PutItem",
+          "dynamodb:UpdateItem",
+          "dynamodb:ConditionCheckItem"
+        ]
+        Resource = [aws_dynamodb_table.reward_grant_keys.arn]
+      }
+    ]
+  })
+}
+
 # Lambda function deployment packages
 data "archive_file" "start_matchmaking" {
   type        = "zip"
@@ -444,6 +604,24 @@ data "archive_file" "get_leaderboard" {
   output_path = "${path.module}/lambda/dist/get-leaderboard.zip"
 }
 
+data "archive_file" "post_player_reward" {
+  type        = "zip"
+  source_dir  = "${path.module}/lambda/post-player-reward"
+  output_path = "${path.module}/lambda/dist/post-player-reward.zip"
+}
+
+data "archive_file" "get_player_rewards" {
+  type        = "zip"
+  source_dir  = "${path.module}/lambda/get-player-rewards"
+  output_path = "${path.module}/lambda/dist/get-player-rewards.zip"
+}
+
+data "archive_file" "post_player_rewards_batch" {
+  type        = "zip"
+  source_dir  = "${path.module}/lambda/post-player-rewards-batch"
+  output_path = "${path.module}/lambda/dist/post-player-rewards-batch.zip"
+}
+
 # Lambda function: Start Matchmaking
 resource "aws_lambda_function" "start_matchmaking" {
   filename         = data.archive_file.start_matchmaking.output_path
@@ -545,6 +723,102 @@ resource "aws_lambda_function" "post_session_summary" {
   ]
 }
 
+# Lambda function: Post Player Reward
+resource "aws_lambda_function" "post_player_reward" {
+  filename         = data.archive_file.post_player_reward.output_path
+  function_name    = "${var.project_name}-post-player-reward-${var.environment}"
+  role             = aws_iam_role.lambda.arn
+  handler          = "index.handler"
+  source_code_hash = data.archive_file.post_player_reward.output_base64sha256
+  runtime          = "nodejs20.x"
+  timeout          = 30
+  memory_size      = 256
+
+  environment {
+    variables = {
+      PLAYER_REWARDS_TABLE = var.player_rewards_table_name
+      ENVIRONMENT          = var.environment
+      LOG_LEVEL            = var.lambda_log_level
+    }
+  }
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-post-player-reward"
+    Environment = var.environment
+  })
+
+  depends_on = [
+    aws_cloudwatch_log_group.lambda_post_reward,
+    aws_iam_role_policy.lambda_logs,
+    aws_iam_role_policy.lambda_dynamodb
+  ]
+}
+
+# Lambda function: Get Player Rewards
+resource "aws_lambda_function" "get_player_rewards" {
+  filename         = data.archive_file.get_player_rewards.output_path
+  function_name    = "${var.project_name}-get-player-rewards-${var.environment}"
+  role             = aws_iam_role.lambda.arn
+  handler          = "index.handler"
+  source_code_hash = data.archive_file.get_player_rewards.output_base64sha256
+  runtime          = "nodejs20.x"
+  timeout          = 30
+  memory_size      = 256
+
+  environment {
+    variables = {
+      PLAYER_REWARDS_TABLE = var.player_rewards_table_name
+      ENVIRONMENT          = var.environment
+      LOG_LEVEL            = var.lambda_log_level
+    }
+  }
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-get-player-rewards"
+    Environment = var.environment
+  })
+
+  depends_on = [
+    aws_cloudwatch_log_group.lambda_get_rewards,
+    aws_iam_role_policy.lambda_logs,
+    aws_iam_role_policy.lambda_dynamodb
+  ]
+}
+
+# Lambda function: Post Player Rewards Batch
+resource "aws_lambda_function" "post_player_rewards_batch" {
+  filename         = data.archive_file.post_player_rewards_batch.output_path
+  function_name    = "${var.project_name}-post-player-rewards-batch-${var.environment}"
+  role             = aws_iam_role.lambda.arn
+  handler          = "index.handler"
+  source_code_hash = data.archive_file.post_player_rewards_batch.output_base64sha256
+  runtime          = "nodejs20.x"
+  timeout          = 30
+  memory_size      = 256
+
+  environment {
+    variables = {
+      PLAYER_REWARDS_TABLE  = var.player_rewards_table_name
+      GRANT_KEYS_TABLE      = aws_dynamodb_table.reward_grant_keys.name
+      GRANT_KEY_TTL_SECONDS = tostring(var.reward_grant_key_ttl_seconds)
+      ENVIRONMENT           = var.environment
+      LOG_LEVEL             = var.lambda_log_level
+    }
+  }
+
+  tags = merge(var.tags, {
+    Name        = "${var.project_name}-post-player-rewards-batch"
+    Environment = var.environment
+  })
+
+  depends_on = [
+    aws_cloudwatch_log_group.lambda_post_rewards_batch,
+    aws_iam_role_policy.lambda_logs,
+    aws_iam_role_policy.lambda_dynamodb,
+    aws_iam_role_policy.lambda_reward_grants
+  ]
+}
+
 # Lambda function: Post Score (F6b — upsert player high score to the leaderboard)
 resource "aws_lambda_function" "post_score" {
   filename         = data.archive_file.post_score.output_path
@@ -632,6 +906,30 @@ resource "aws_lambda_permission" "post_session_summary" {
   source_arn    = "${aws_api_gateway_rest_api.session_api.execution_arn}/*/*"
 }
 
+resource "aws_lambda_permission" "post_player_reward" {
+  statement_id  = "AllowAPIGatewayInvoke"
+  action        = "lambda:InvokeFunction"
+  function_name = aws_lambda_function.post_player_reward.function_name
+  principal     = "apigateway.amazonaws.com"
+  source_arn    = "${aws_api_gateway_rest_api.session_api.execution_arn}/*/*"
+}
+
+resource "aws_lambda_permission" "get_player_rewards" {
+  statement_id  = "AllowAPIGatewayInvoke"
+  action        = "lambda:InvokeFunction"
+  function_name = aws_lambda_function.get_player_rewards.function_name
+  principal     = "apigateway.amazonaws.com"
+  source_arn    = "${aws_api_gateway_rest_api.session_api.execution_arn}/*/*"
+}
+
+resource "aws_lambda_permission" "post_player_rewards_batch" {
+  statement_id  = "AllowAPIGatewayInvoke"
+  action        = "lambda:InvokeFunction"
+  function_name = aws_lambda_function.post_player_rewards_batch.function_name
+  principal     = "apigateway.amazonaws.com"
+  source_arn    = "${aws_api_gateway_rest_api.session_api.execution_arn}/*/*"
+}
+
 resource "aws_lambda_permission" "post_score" {
   statement_id  = "AllowAPIGatewayInvoke"
   action        = "lambda:InvokeFunction"
@@ -69,3 +69,23 @@ output "cancel_matchmaking_function_arn" {
   description = "Cancel matchmaking Lambda function ARN"
   value       = aws_lambda_function.cancel_matchmaking.arn
 }
+
+output "post_player_rewards_batch_function_name" {
+  description = "Post player rewards batch Lambda function name"
+  value       = aws_lambda_function.post_player_rewards_batch.function_name
+}
+
+output "reward_grant_keys_table_name" {
+  description = "DynamoDB table holding reward grant idempotency keys"
+  value       = aws_dynamodb_table.reward_grant_keys.name
+}
+
+output "post_player_reward_function_name" {
+  description = "Post player reward Lambda function name"
+  value       = aws_lambda_function.post_player_reward.function_name
+}
+
+output "get_player_rewards_function_name" {
+  description = "Get player rewards Lambda function name"
+  value       = aws_lambda_function.get_player_rewards.function_name
+}
@@ -117,3 +117,9 @@ variable "matchmaking_tickets_table_arn" {
   type        = string
   default     = ""
 }
+
+variable "reward_grant_key_ttl_seconds" {
+  description = "How long a reward grant idempotency key is kept; must outlast the longest a server ledger can hold and resend a batch"
+  type        = number
+  default     = 604800
+}
@@ -1,7 +1,9 @@
 // Copyright 2026 HyperMage. All Rights Reserved.
 
 #include "AwsSigV4.h"
+#include "HMVRApiEndpoints.h"
 #include "Misc/DateTime.h"
+#include "Misc/Parse.h"
 // No OpenSSL or FSHA256Hasher — SHA-256 is implemented below to avoid
 // the ossl_typ.h 'UI' typedef conflict with UE5 Slate headers.
 
@@ -146,17 +148,58 @@ TArray<uint8> FAwsSigV4::ToBytes(const FString& Str)
 
 // ── Public API ───────────────────────────────────────────────────────────────
 
+bool FAwsSigV4::GetCredentials(FCredentials& OutCredentials)
+{
+	OutCredentials.AccessKeyId     = FPlatformMisc::GetEnvironmentVariable(TEXT("AWS_ACCESS_KEY_ID"));
+	OutCredentials.SecretAccessKey = FPlatformMisc::GetEnvironmentVariable(TEXT("AWS_SECRET_ACCESS_KEY"));
+	OutCredentials.SessionToken    = FPlatformMisc::GetEnvironmentVariable(TEXT("AWS_SESSION_TOKEN"));
+	if (!OutCredentials.AccessKeyId.IsEmpty() && !OutCredentials.SecretAccessKey.IsEmpty())
+	{
+		return true;
+	}
+
+#if WITH_HMVR_API_STUB
+	// Signer and stub agree on these, so signing bugs show up as 403s against the stub
+	if (FHMVRApiEndpoints::IsLocalStubRequested())
+	{
+		OutCredentials.AccessKeyId     = TEXT("HMVRLOCALSTUB");
+		OutCredentials.SecretAccessKey = TEXT("hmvr-local-stub-secret");
+		OutCredentials.SessionToken.Empty();
+		return true;
+	}
+#endif
+	return false;
+}
+
+FString FAwsSigV4::ComputeSignature(
+	const FString& CanonicalRequest,
+	const FString& DateTimeStr,
+	const FString& Region,
+	const FString& Service,
+	const FString& SecretAccessKey)
+{
+	const FString DateStr = DateTimeStr.Left(8);
+	FString CredScope = FString::Printf(TEXT("%s/%s/%s/aws4_request"), *DateStr, *Region, *Service);
+	FString StringToSign = FString::Printf(TEXT("AWS4-HMAC-SHA256\n%s\n%s\n%s"),
+		*DateTimeStr, *CredScope, *Sha256Hex(ToBytes(CanonicalRequest)));
+
+	TArray<uint8> SignKey = ToBytes(FString(TEXT("AWS4")) + SecretAccessKey);
+	SignKey = HmacSha256(SignKey, ToBytes(DateStr));
+	SignKey = HmacSha256(SignKey, ToBytes(Region));
+	SignKey = HmacSha256(SignKey, ToBytes(Service));
+	SignKey = HmacSha256(SignKey, ToBytes(TEXT("aws4_request")));
+
+	return ToHex(HmacSha256(SignKey, ToBytes(StringToSign)));
+}
+
 bool FAwsSigV4::SignRequest(
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request,
 	const TArray<uint8>& BodyBytes,
 	const FString& Region,
 	const FString& Service)
 {
-	FString AccessKeyId     = FPlatformMisc::GetEnvironmentVariable(TEXT("AWS_ACCESS_KEY_ID"));
-	FString SecretAccessKey = FPlatformMisc::GetEnvironmentVariable(TEXT("AWS_SECRET_ACCESS_KEY"));
-	FString SessionToken    = FPlatformMisc::GetEnvironmentVariable(TEXT("AWS_SESSION_TOKEN"));
-
-	if (AccessKeyId.IsEmpty() || SecretAccessKey.IsEmpty())
+	FCredentials Credentials;
+	if (!GetCredentials(Credentials))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("AwsSigV4: credentials not set — request unsigned"));
 		return false;
@@ -187,18 +230,21 @@ bool FAwsSigV4::SignRequest(
 
 	FString PayloadHash = Sha256Hex(BodyBytes);
 
+	// Sign only headers the request will carry: a bodiless GET has no Content-Type, and API
+	// Gateway rebuilds the canonical request from what actually arrives
 	FString SignedHeaders, CanonHeaders;
-	if (!SessionToken.IsEmpty())
+	const FString ContentType = Request->GetHeader(TEXT("Content-Type"));
+	if (!ContentType.IsEmpty())
 	{
-		CanonHeaders  = FString::Printf(TEXT("content-type:application/json\nhost:%s\nx-amz-date:%s\nx-amz-security-token:%s\n"),
-			*Host, *DateTimeStr, *SessionToken);
-		SignedHeaders = TEXT("content-type;host;x-amz-date;x-amz-security-token");
+		CanonHeaders  += FString::Printf(TEXT("content-type:%s\n"), *ContentType.TrimStartAndEnd());
+		SignedHeaders += TEXT("content-type;");
 	}
-	else
+	CanonHeaders  += FString::Printf(TEXT("host:%s\nx-amz-date:%s\n"), *Host, *DateTimeStr);
+	SignedHeaders += TEXT("host;x-amz-date");
+	if (!Credentials.SessionToken.IsEmpty())
 	{
-		CanonHeaders  = FString::Printf(TEXT("content-type:application/json\nhost:%s\nx-amz-date:%s\n"),
-			*Host, *DateTimeStr);
-		SignedHeaders = TEXT("content-type;host;x-amz-date");
+		CanonHeaders  += FString::Printf(TEXT("x-amz-security-token:%s\n"), *Credentials.SessionToken);
+		SignedHeaders += TEXT(";x-amz-security-token");
 	}
 
 	FString CanonRequest = FString::Printf(TEXT("%s\n%s\n%s\n%s\n%s\n%s"),
@@ -206,23 +252,85 @@ bool FAwsSigV4::SignRequest(
 		*CanonHeaders, *SignedHeaders, *PayloadHash);
 
 	FString CredScope = FString::Printf(TEXT("%s/%s/%s/aws4_request"), *DateStr, *Region, *Service);
-	FString StringToSign = FString::Printf(TEXT("AWS4-HMAC-SHA256\n%s\n%s\n%s"),
-		*DateTimeStr, *CredScope, *Sha256Hex(ToBytes(CanonRequest)));
-
-	TArray<uint8> SignKey = ToBytes(FString(TEXT("AWS4")) + SecretAccessKey);
-	SignKey = HmacSha256(SignKey, ToBytes(DateStr));
-	SignKey = HmacSha256(SignKey, ToBytes(Region));
-	SignKey = HmacSha256(SignKey, ToBytes(Service));
-	SignKey = HmacSha256(SignKey, ToBytes(TEXT("aws4_request")));
-
-	FString Sig = ToHex(HmacSha256(SignKey, ToBytes(StringToSign)));
+	FString Sig = ComputeSignature(CanonRequest, DateTimeStr, Region, Service, Credentials.SecretAccessKey);
 
 	Request->SetHeader(TEXT("x-amz-date"), DateTimeStr);
 	Request->SetHeader(TEXT("Authorization"),
 		FString::Printf(TEXT("AWS4-HMAC-SHA256 Credential=%s/%s, SignedHeaders=%s, Signature=%s"),
-			*AccessKeyId, *CredScope, *SignedHeaders, *Sig));
-	if (!SessionToken.IsEmpty())
-		Request->SetHeader(TEXT("x-amz-security-token"), SessionToken);
+			*Credentials.AccessKeyId, *CredScope, *SignedHeaders, *Sig));
+	if (!Credentials.SessionToken.IsEmpty())
+		Request->SetHeader(TEXT("x-amz-security-token"), Credentials.SessionToken);
 
 	return true;
 }
+
+bool FAwsSigV4::VerifyRequest(
+	const FString& Verb,
+	const FString& Path,
+	const FString& CanonicalQuery,
+	const TMap<FString, FString>& Headers,
+	const TArray<uint8>& BodyBytes,
+	const FString& Service,
+	FString& OutError)
+{
+	FCredentials Credentials;
+	if (!GetCredentials(Credentials))
+	{
+		OutError = TEXT("no credentials to verify against");
+		return false;
+	}
+
+	// AWS4-HMAC-SHA256 Credential=<key>/<date>/<region>/<service>/aws4_request, SignedHeaders=a;b, Signature=<hex>
+	const FString* Authorization = Headers.Find(TEXT("authorization"));
+	FString Credential, SignedHeaders, Signature;
+	if (!Authorization || !Authorization->StartsWith(TEXT("AWS4-HMAC-SHA256 "))
+		|| !FParse::Value(**Authorization, TEXT("Credential="), Credential)
+		|| !FParse::Value(**Authorization, TEXT("SignedHeaders="), SignedHeaders)
+		|| !FParse::Value(**Authorization, TEXT("Signature="), Signature))
+	{
+		OutError = TEXT("missing or malformed SigV4 Authorization header");
+		return false;
+	}
+
+	const FString* DateTimeStr = Headers.Find(TEXT("x-amz-date"));
+	if (!DateTimeStr)
+	{
+		OutError = TEXT("missing x-amz-date");
+		return false;
+	}
+
+	// <key>/<date>/<region>/<service>/aws4_request
+	TArray<FString> Scope;
+	Credential.ParseIntoArray(Scope, TEXT("/"));
+	if (Scope.Num() != 5 || Scope[0] != Credentials.AccessKeyId || Scope[1] != DateTimeStr->Left(8)
+		|| Scope[3] != Service || Scope[4] != TEXT("aws4_request"))
+	{
+		OutError = FString::Printf(TEXT("credential %s does not match %s/%s/<region>/%s/aws4_request"),
+			*Credential, *Credentials.AccessKeyId, *DateTimeStr->Left(8), *Service);
+		return false;
+	}
+	const FString& Region = Scope[2];
+
+	TArray<FString> Names;
+	SignedHeaders.ParseIntoArray(Names, TEXT(";"));
+	FString CanonHeaders;
+	for (const FString& Name : Names)
+	{
+		const FString* Value = Headers.Find(Name);
+		if (!Value)
+		{
+			OutError = FString::Printf(TEXT("signed header '%s' is not in the request"), *Name);
+			return false;
+		}
+		CanonHeaders += FString::Printf(TEXT("%s:%s\n"), *Name, *Value->TrimStartAndEnd());
+	}
+
+	const FString CanonRequest = FString::Printf(TEXT("%s\n%s\n%s\n%s\n%s\n%s"),
+		*Verb, *Path, *CanonicalQuery, *CanonHeaders, *SignedHeaders, *Sha256Hex(BodyBytes));
+	if (ComputeSignature(CanonRequest, *DateTimeStr, Region, Service, Credentials.SecretAccessKey) != Signature)
+	{
+		OutError = TEXT("signature does not match");
+		return false;
+	}
+	return true;
+}
@@ -15,6 +15,9 @@
  *
  *   FAwsSigV4::SignRequest(HttpRequest, BodyBytes, "eu-west-1", "execute-api");
  *
+ *   With -LocalApiStub and no credentials in the environment (development builds), fixed local
+ *   credentials are used instead, so FHMVRLocalApiStub can check signatures with VerifyRequest.
+ *
  * Implements: https://docs.aws.amazon.com/general/latest/gr/sigv4_signing.html
  */
 class HYPERMAGEVR_API FAwsSigV4
@@ -37,7 +40,42 @@ public:
 		const FString& Service
 	);
 
+	/**
+	 * Recompute the signature of a received request the way API Gateway does and compare it
+	 * with its Authorization header. Headers are keyed by lower-case name; the region is taken
+	 * from the credential scope.
+	 *
+	 * @return true if the signature matches; false with OutError otherwise
+	 */
+	static bool VerifyRequest(
+		const FString& Verb,
+		const FString& Path,
+		const FString& CanonicalQuery,
+		const TMap<FString, FString>& Headers,
+		const TArray<uint8>& BodyBytes,
+		const FString& Service,
+		FString& OutError
+	);
+
+	struct FCredentials
+	{
+		FString AccessKeyId;
+		FString SecretAccessKey;
+		FString SessionToken;
+	};
+
+	/** Credentials from the environment, or the local stub's fixed ones. False if neither applies. */
+	static bool GetCredentials(FCredentials& OutCredentials);
+
 private:
+	static FString ComputeSignature(
+		const FString& CanonicalRequest,
+		const FString& DateTimeStr,
+		const FString& Region,
+		const FString& Service,
+		const FString& SecretAccessKey
+	);
+
 	// Crypto primitives — self-contained SHA-256 (no OpenSSL or external headers)
 	static TArray<uint8> Sha256Bytes(const TArray<uint8>& Data);
 	static FString       Sha256Hex(const TArray<uint8>& Data);
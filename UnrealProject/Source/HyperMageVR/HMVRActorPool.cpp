@@ -0,0 +1,369 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRActorPool.h"
+#include "HMVRArtifact.h"
+#include "HMVRCreature.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarPoolMaxParkedPerClass(
+	TEXT("hmvr.Pool.MaxParkedPerClass"),
+	64,
+	TEXT("Released actors beyond this many parked per class are destroyed."));
+
+static TAutoConsoleVariable<float> CVarPoolPrewarmBudgetMs(
+	TEXT("hmvr.Pool.PrewarmBudgetMs"),
+	2.f,
+	TEXT("Game-thread time per frame spent spawning prewarmed pool actors."));
+
+static TAutoConsoleVariable<int32> CVarPoolPrewarmCreatures(
+	TEXT("hmvr.Pool.PrewarmCreatures"),
+	16,
+	TEXT("Creatures parked in the pool at level load."));
+
+static TAutoConsoleVariable<int32> CVarPoolPrewarmArtifacts(
+	TEXT("hmvr.Pool.PrewarmArtifacts"),
+	16,
+	TEXT("Artifacts parked in the pool at level load."));
+
+static FAutoConsoleCommandWithWorld CmdPoolStats(
+	TEXT("HMVR.Pool.Stats"),
+	TEXT("Log actor pool counters per class (parked, reused, spawned, released, destroyed, average acquire cost)."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UHMVRActorPoolSubsystem* Pool = World ? World->GetSubsystem<UHMVRActorPoolSubsystem>() : nullptr)
+		{
+			Pool->LogStats();
+		}
+	}));
+
+namespace
+{
+	// Prewarmed actors wait out of the way until first handed out
+	const FTransform ParkingTransform(FVector(0.f, 0.f, -20000.f));
+}
+
+void IHMVRPooledActor::SetActorParked(AActor* Actor, bool bParked)
+{
+	Actor->SetActorHiddenInGame(bParked);
+	Actor->SetActorEnableCollision(!bParked);
+	Actor->SetActorTickEnabled(!bParked && Actor->PrimaryActorTick.bStartWithTickEnabled);
+	TInlineComponentArray<UActorComponent*> Components(Actor);
+	for (UActorComponent* Component : Components)
+	{
+		if (Component->PrimaryComponentTick.bCanEverTick)
+		{
+			Component->SetComponentTickEnabled(!bParked && Component->PrimaryComponentTick.bStartWithTickEnabled);
+		}
+	}
+
+	// Dormancy still sends the hidden flag first; clients stop hearing about a parked actor after that
+	Actor->SetNetDormancy(bParked ? DORM_DormantAll : DORM_Awake);
+}
+
+void UHMVRActorPoolSubsystem::Deinitialize()
+{
+	if (PrewarmTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PrewarmTickerHandle);
+		PrewarmTickerHandle.Reset();
+	}
+	Pools.Reset();
+	LiveActors.Reset();
+	ParkedActors.Reset();
+	Super::Deinitialize();
+}
+
+void UHMVRActorPoolSubsystem::Prewarm(TSubclassOf<AActor> Class, int32 Count)
+{
+	if (!Class || Count <= 0 || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+	if (!Class->ImplementsInterface(UHMVRPooledActor::StaticClass()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRActorPool: %s is not poolable (no IHMVRPooledActor) - not prewarmed"), *Class->GetName());
+		return;
+	}
+
+	const int32 Index = PrewarmClasses.Find(Class.Get());
+	if (Index != INDEX_NONE)
+	{
+		PrewarmRemaining[Index] += Count;
+	}
+	else
+	{
+		PrewarmClasses.Add(Class.Get());
+		PrewarmRemaining.Add(Count);
+	}
+
+	if (!PrewarmTickerHandle.IsValid())
+	{
+		PrewarmTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UHMVRActorPoolSubsystem::PrewarmTick));
+	}
+}
+
+void UHMVRActorPoolSubsystem::PrewarmInteractables(TSubclassOf<AActor> CreatureClass, TSubclassOf<AActor> ArtifactClass)
+{
+	Prewarm(CreatureClass, CVarPoolPrewarmCreatures.GetValueOnGameThread());
+	Prewarm(ArtifactClass, CVarPoolPrewarmArtifacts.GetValueOnGameThread());
+}
+
+bool UHMVRActorPoolSubsystem::PrewarmTick(float /*DeltaTime*/)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->bIsTearingDown)
+	{
+		PrewarmTickerHandle.Reset();
+		return false;
+	}
+
+	// At least one per frame so a tiny budget still makes progress
+	const double Start = FPlatformTime::Seconds();
+	const double Budget = FMath::Max(0.1f, CVarPoolPrewarmBudgetMs.GetValueOnGameThread()) / 1000.0;
+	while (PrewarmClasses.Num() > 0)
+	{
+		UClass* Class = PrewarmClasses[0];
+		FClassPool& Pool = Pools.FindOrAdd(Class);
+		if (Class && --PrewarmRemaining[0] >= 0)
+		{
+			if (AActor* Actor = SpawnFresh(Class, ParkingTransform, [](AActor*) {}))
+			{
+				++Pool.Stats.Prewarmed;
+				Park(Actor, Pool);
+			}
+		}
+		if (!Class || PrewarmRemaining[0] <= 0)
+		{
+			PrewarmClasses.RemoveAt(0);
+			PrewarmRemaining.RemoveAt(0);
+			if (Class)
+			{
+				UE_LOG(LogTemp, Log, TEXT("HMVRActorPool: %d %s parked"), Pool.Parked.Num(), *Class->GetName());
+			}
+		}
+
+		if (FPlatformTime::Seconds() - Start >= Budget)
+		{
+			break;
+		}
+	}
+
+	if (PrewarmClasses.Num() == 0)
+	{
+		PrewarmTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+AActor* UHMVRActorPoolSubsystem::Acquire(TSubclassOf<AActor> Class, const FTransform& Transform)
+{
+	return Acquire(Class, Transform, [](AActor*) {});
+}
+
+AActor* UHMVRActorPoolSubsystem::Acquire(TSubclassOf<AActor> Class, const FTransform& Transform, TFunctionRef<void(AActor*)> Configure)
+{
+	if (!Class)
+	{
+		return nullptr;
+	}
+
+	const double Start = FPlatformTime::Seconds();
+	FClassPool& Pool = Pools.FindOrAdd(Class.Get());
+	while (Pool.Parked.Num() > 0)
+	{
+		AActor* Actor = Pool.Parked.Pop(EAllowShrinking::No).Get();
+		if (!IsValid(Actor))
+		{
+			continue; // destroyed while parked (level teardown, GM command)
+		}
+
+		ParkedActors.Remove(Actor);
+		LiveActors.Add(Actor);
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		Configure(Actor);
+		CastChecked<IHMVRPooledActor>(Actor)->OnAcquiredFromPool();
+
+		++Pool.Stats.Reused;
+		Pool.Stats.ReuseSeconds += FPlatformTime::Seconds() - Start;
+		return Actor;
+	}
+
+	AActor* Actor = SpawnFresh(Class, Transform, Configure);
+	if (Actor)
+	{
+		LiveActors.Add(Actor);
+		++Pool.Stats.Spawned;
+		Pool.Stats.SpawnSeconds += FPlatformTime::Seconds() - Start;
+	}
+	return Actor;
+}
+
+AActor* UHMVRActorPoolSubsystem::SpawnFresh(UClass* Class, const FTransform& Transform, TFunctionRef<void(AActor*)> Configure)
+{
+	AActor* Actor = GetWorld()->SpawnActorDeferred<AActor>(Class, Transform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!Actor)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRActorPool: could not spawn %s"), *Class->GetName());
+		return nullptr;
+	}
+	Configure(Actor);
+	Actor->FinishSpawning(Transform);
+	return Actor;
+}
+
+bool UHMVRActorPoolSubsystem::Release(AActor* Actor)
+{
+	if (!IsValid(Actor) || IsParked(Actor))
+	{
+		return false;
+	}
+
+	LiveActors.Remove(Actor);
+	FClassPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+	if (!Actor->Implements<UHMVRPooledActor>()
+		|| Pool.Parked.Num() >= FMath::Max(0, CVarPoolMaxParkedPerClass.GetValueOnGameThread()))
+	{
+		++Pool.Stats.Destroyed;
+		Actor->Destroy();
+		return false;
+	}
+
+	++Pool.Stats.Released;
+	Park(Actor, Pool);
+	return true;
+}
+
+int32 UHMVRActorPoolSubsystem::ReleaseAll()
+{
+	TArray<TObjectKey<AActor>> Live = LiveActors.Array();
+	int32 Released = 0;
+	for (const TObjectKey<AActor>& Key : Live)
+	{
+		Released += Release(Key.ResolveObjectPtr()) ? 1 : 0;
+	}
+	LiveActors.Reset();
+	return Released;
+}
+
+void UHMVRActorPoolSubsystem::Park(AActor* Actor, FClassPool& Pool)
+{
+	CastChecked<IHMVRPooledActor>(Actor)->OnReleasedToPool();
+	Pool.Parked.Add(Actor);
+	ParkedActors.Add(Actor);
+}
+
+int32 UHMVRActorPoolSubsystem::GetParkedCount(TSubclassOf<AActor> Class) const
+{
+	const FClassPool* Pool = Pools.Find(Class.Get());
+	return Pool ? Pool->Parked.Num() : 0;
+}
+
+void UHMVRActorPoolSubsystem::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("HMVRActorPool: %d live, %d parked across %d classes"), LiveActors.Num(), ParkedActors.Num(), Pools.Num());
+	for (const TPair<TObjectKey<UClass>, FClassPool>& Pair : Pools)
+	{
+		const UClass* Class = Pair.Key.ResolveObjectPtr();
+		const FClassStats& Stats = Pair.Value.Stats;
+		UE_LOG(LogTemp, Log,
+			TEXT("HMVRActorPool:   %-28s %d parked; %lld reused (%.1f us avg), %lld spawned (%.1f us avg), %lld prewarmed, %lld released, %lld destroyed"),
+			Class ? *Class->GetName() : TEXT("(unloaded)"), Pair.Value.Parked.Num(),
+			Stats.Reused, Stats.Reused > 0 ? Stats.ReuseSeconds * 1e6 / Stats.Reused : 0.0,
+			Stats.Spawned, Stats.Spawned > 0 ? Stats.SpawnSeconds * 1e6 / Stats.Spawned : 0.0,
+			Stats.Prewarmed, Stats.Released, Stats.Destroyed);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+// Per-actor game-thread cost of SpawnActor + Destroy against Acquire + Release from a warm pool,
+// for the native creature (character, movement, AI controller) or artifact. Runs in one frame.
+static FAutoConsoleCommandWithWorldAndArgs CmdPoolBench(
+	TEXT("HMVR.Pool.Bench"),
+	TEXT("HMVR.Pool.Bench [Count=100] [creature|artifact] — per-actor spawn/destroy cost with and without the actor pool."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UHMVRActorPoolSubsystem* Pool = World ? World->GetSubsystem<UHMVRActorPoolSubsystem>() : nullptr;
+		if (!Pool || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRActorPool: Bench needs a server or standalone game world"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const bool bArtifact = Args.Num() > 1 && Args[1].Equals(TEXT("artifact"), ESearchCase::IgnoreCase);
+		UClass* Class = bArtifact ? AHMVRArtifact::StaticClass() : AHMVRCreature::StaticClass();
+
+		FVector Origin = FVector::ZeroVector;
+		if (TActorIterator<APlayerStart> It(World); It)
+		{
+			Origin = It->GetActorLocation();
+		}
+		const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+		TArray<FTransform> Transforms;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Transforms.Add(FTransform(Origin + FVector((i % Side) * 300.f, (i / Side) * 300.f, 100.f)));
+		}
+
+		// Without the pool
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		TArray<AActor*> Actors;
+		double Start = FPlatformTime::Seconds();
+		for (const FTransform& Transform : Transforms)
+		{
+			Actors.Add(World->SpawnActor(Class, &Transform, Params));
+		}
+		const double SpawnSeconds = FPlatformTime::Seconds() - Start;
+		Start = FPlatformTime::Seconds();
+		for (AActor* Actor : Actors)
+		{
+			if (Actor)
+			{
+				Actor->Destroy();
+			}
+		}
+		const double DestroySeconds = FPlatformTime::Seconds() - Start;
+
+		// Warm the pool to Count, then time a full acquire/release round from it
+		const int32 SavedCap = CVarPoolMaxParkedPerClass.GetValueOnGameThread();
+		CVarPoolMaxParkedPerClass->Set(FMath::Max(SavedCap, Count), ECVF_SetByConsole);
+		Actors.Reset();
+		for (const FTransform& Transform : Transforms)
+		{
+			Actors.Add(Pool->Acquire(Class, Transform));
+		}
+		for (AActor* Actor : Actors)
+		{
+			Pool->Release(Actor);
+		}
+
+		Actors.Reset();
+		Start = FPlatformTime::Seconds();
+		for (const FTransform& Transform : Transforms)
+		{
+			Actors.Add(Pool->Acquire(Class, Transform));
+		}
+		const double AcquireSeconds = FPlatformTime::Seconds() - Start;
+		Start = FPlatformTime::Seconds();
+		for (AActor* Actor : Actors)
+		{
+			Pool->Release(Actor);
+		}
+		const double ReleaseSeconds = FPlatformTime::Seconds() - Start;
+		CVarPoolMaxParkedPerClass->Set(SavedCap, ECVF_SetByConsole);
+
+		UE_LOG(LogTemp, Log,
+			TEXT("HMVRActorPool: Bench %d %s — SpawnActor %.1f us + Destroy %.1f us per actor; pooled Acquire %.1f us + Release %.1f us per actor (%.1fx cheaper)"),
+			Count, *Class->GetName(), SpawnSeconds * 1e6 / Count, DestroySeconds * 1e6 / Count,
+			AcquireSeconds * 1e6 / Count, ReleaseSeconds * 1e6 / Count,
+			(SpawnSeconds + DestroySeconds) / FMath::Max(AcquireSeconds + ReleaseSeconds, 1e-9));
+		Pool->LogStats();
+	}));
+#endif
@@ -0,0 +1,119 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "UObject/ObjectKey.h"
+#include "HMVRActorPool.generated.h"
+
+UINTERFACE(MinimalAPI)
+class UHMVRPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/** An actor UHMVRActorPoolSubsystem can park and hand out again instead of destroying and spawning. */
+class HYPERMAGEVR_API IHMVRPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	// Server: taken from the pool and already moved to its new transform — restore authored
+	// values (health, sub-states, interactable state) and start ticking, moving and thinking.
+	virtual void OnAcquiredFromPool() {}
+
+	// Server: parked — stop timers, AI and movement, and go hidden, collisionless and dormant.
+	virtual void OnReleasedToPool() {}
+
+protected:
+	/** Hidden, no collision, no ticking (actor and components) and net-dormant — or back to authored defaults. */
+	static void SetActorParked(AActor* Actor, bool bParked);
+};
+
+/**
+ * Server-side pool of parked actors per class, so waves of creatures and artifacts reuse actors
+ * (and a creature's AI controller, which stays possessing it while parked) instead of paying
+ * for a spawn and a destroy each time.
+ *
+ * Acquire() takes a parked actor of exactly that class, moves it, runs Configure and then
+ * IHMVRPooledActor::OnAcquiredFromPool; with none parked it spawns one deferred, runs Configure
+ * before BeginPlay, and finishes spawning — so callers set per-instance fields the same way
+ * either way. Release() parks an actor (OnReleasedToPool) up to hmvr.Pool.MaxParkedPerClass
+ * and destroys beyond that; actors without the interface are destroyed. Prewarm() fills a
+ * class's pool in time-sliced batches (hmvr.Pool.PrewarmBudgetMs per frame) so level load
+ * takes the spawn cost instead of gameplay.
+ *
+ * Counters are printed with HMVR.Pool.Stats; HMVR.Pool.Bench compares per-actor spawn and
+ * destroy cost against acquire and release.
+ */
+UCLASS()
+class HYPERMAGEVR_API UHMVRActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Queue Count parked instances of Class (on top of any already parked), spawned a slice per frame. */
+	void Prewarm(TSubclassOf<AActor> Class, int32 Count);
+
+	/** Prewarm the creature and artifact classes to hmvr.Pool.PrewarmCreatures / PrewarmArtifacts. */
+	void PrewarmInteractables(TSubclassOf<AActor> CreatureClass, TSubclassOf<AActor> ArtifactClass);
+
+	/** Parked instance or a fresh spawn; Configure runs before it wakes (or before BeginPlay). Null if the spawn failed. */
+	AActor* Acquire(TSubclassOf<AActor> Class, const FTransform& Transform, TFunctionRef<void(AActor*)> Configure);
+	AActor* Acquire(TSubclassOf<AActor> Class, const FTransform& Transform);
+
+	template <typename ActorType>
+	ActorType* Acquire(TSubclassOf<ActorType> Class, const FTransform& Transform)
+	{
+		return Cast<ActorType>(Acquire(TSubclassOf<AActor>(Class.Get()), Transform));
+	}
+
+	/** Park Actor for reuse (or destroy it). Returns true if it was parked. */
+	bool Release(AActor* Actor);
+
+	/** Park every actor handed out by Acquire that is still live (end of a session). */
+	int32 ReleaseAll();
+
+	/** Handed out by Acquire and not released since */
+	bool IsLive(const AActor* Actor) const { return LiveActors.Contains(Actor); }
+	bool IsParked(const AActor* Actor) const { return ParkedActors.Contains(Actor); }
+	int32 GetParkedCount(TSubclassOf<AActor> Class) const;
+
+	struct FClassStats
+	{
+		int64 Reused = 0;
+		int64 Spawned = 0;      // acquires the pool could not serve
+		int64 Prewarmed = 0;
+		int64 Released = 0;
+		int64 Destroyed = 0;    // released over the per-class cap, or not poolable
+		double ReuseSeconds = 0.0;
+		double SpawnSeconds = 0.0;
+	};
+	void LogStats() const;
+
+private:
+	struct FClassPool
+	{
+		TArray<TWeakObjectPtr<AActor>> Parked;
+		FClassStats Stats;
+	};
+
+	AActor* SpawnFresh(UClass* Class, const FTransform& Transform, TFunctionRef<void(AActor*)> Configure);
+	void Park(AActor* Actor, FClassPool& Pool);
+	bool PrewarmTick(float DeltaTime);
+
+	TMap<TObjectKey<UClass>, FClassPool> Pools;
+	TSet<TObjectKey<AActor>> LiveActors;
+	TSet<TObjectKey<AActor>> ParkedActors;
+
+	// Pending prewarm: class and how many more to spawn
+	UPROPERTY()
+	TArray<TObjectPtr<UClass>> PrewarmClasses;
+	TArray<int32> PrewarmRemaining;
+	FTSTicker::FDelegateHandle PrewarmTickerHandle;
+};
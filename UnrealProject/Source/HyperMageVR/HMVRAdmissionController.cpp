@@ -0,0 +1,231 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRAdmissionController.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarAdmissionValidateTimeout(
+	TEXT("hmvr.Admission.ValidateTimeoutSeconds"),
+	5.f,
+	TEXT("Reject a join whose token / player session validation has not finished after this many seconds."));
+
+static TAutoConsoleVariable<float> CVarAdmissionReservationSeconds(
+	TEXT("hmvr.Admission.ReservationSeconds"),
+	60.f,
+	TEXT("How long an admitted join holds its slot waiting for PostLogin (covers the client's map load; extended while the connection is still loading)."));
+
+FHMVRAdmissionController::~FHMVRAdmissionController()
+{
+	if (ExpiryTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ExpiryTickerHandle);
+	}
+}
+
+void FHMVRAdmissionController::Start()
+{
+	if (!ExpiryTickerHandle.IsValid())
+	{
+		ExpiryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FHMVRAdmissionController::Expire), 0.25f);
+	}
+}
+
+int32 FHMVRAdmissionController::GetValidatingCount() const
+{
+	int32 Count = 0;
+	for (const TPair<uint32, FReservation>& Entry : Reservations)
+	{
+		Count += Entry.Value.Phase == EPhase::Validating ? 1 : 0;
+	}
+	return Count;
+}
+
+bool FHMVRAdmissionController::Begin(FHMVRAdmission&& Admission, int32 Limit, int32 Connected,
+	FValidateFn Validate, FCompleteFn Complete, FDoneFn OnDone)
+{
+	check(IsInGameThread());
+
+	if (Connected + Reservations.Num() >= Limit)
+	{
+		++Stats.RejectedFull;
+		OnDone(FString::Printf(TEXT("Server full. Maximum %d players allowed."), Limit), Admission);
+		return false;
+	}
+
+	const uint32 Ticket = NextTicket++;
+	const double Now = FPlatformTime::Seconds();
+
+	FReservation& Reservation = Reservations.Add(Ticket);
+	Reservation.Admission = Admission;
+	Reservation.StartTime = Now;
+	Reservation.Deadline = Now + FMath::Max(0.1f, CVarAdmissionValidateTimeout.GetValueOnGameThread());
+	Reservation.Complete = MoveTemp(Complete);
+	Reservation.OnDone = MoveTemp(OnDone);
+	Stats.PeakReserved = FMath::Max(Stats.PeakReserved, Reservations.Num());
+
+	TWeakPtr<FHMVRAdmissionController> WeakThis = AsShared();
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Ticket, Admission = MoveTemp(Admission), Validate = MoveTemp(Validate), Now]() mutable
+	{
+		FString Error;
+		const bool bValid = Validate(Admission, Error);
+		const double Seconds = FPlatformTime::Seconds() - Now;
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Ticket, Admission = MoveTemp(Admission), bValid, Error, Seconds]() mutable
+		{
+			if (TSharedPtr<FHMVRAdmissionController> This = WeakThis.Pin())
+			{
+				This->OnValidated(Ticket, MoveTemp(Admission), bValid, Error, Seconds);
+			}
+		});
+	});
+	return true;
+}
+
+void FHMVRAdmissionController::OnValidated(uint32 Ticket, FHMVRAdmission&& Validated, bool bValid, const FString& Error, double Seconds)
+{
+	FReservation* Reservation = Reservations.Find(Ticket);
+	if (!Reservation)
+	{
+		// Timed out while validating; the join was already rejected
+		return;
+	}
+
+	Stats.MaxValidateSeconds = FMath::Max(Stats.MaxValidateSeconds, Seconds);
+	Reservation->Admission = MoveTemp(Validated);
+
+	FString CompleteError = Error;
+	if (bValid && Reservation->Complete)
+	{
+		bValid = Reservation->Complete(Reservation->Admission, CompleteError);
+	}
+
+	FDoneFn OnDone = MoveTemp(Reservation->OnDone);
+	if (!bValid)
+	{
+		++Stats.RejectedInvalid;
+		const FHMVRAdmission Rejected = MoveTemp(Reservation->Admission);
+		Reservations.Remove(Ticket);
+		OnDone(CompleteError.IsEmpty() ? FString(TEXT("Admission failed")) : CompleteError, Rejected);
+		return;
+	}
+
+	++Stats.Admitted;
+	Reservation->Phase = EPhase::Admitted;
+	Reservation->Deadline = FPlatformTime::Seconds() + FMath::Max(1.f, CVarAdmissionReservationSeconds.GetValueOnGameThread());
+	Reservation->Complete = nullptr;
+	OnDone(FString(), Reservation->Admission);
+}
+
+bool FHMVRAdmissionController::Claim(const FString& PlayerId, FHMVRAdmission* OutAdmission)
+{
+	if (PlayerId.IsEmpty())
+	{
+		return false;
+	}
+
+	for (auto It = Reservations.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Phase == EPhase::Admitted && It.Value().Admission.PlayerId == PlayerId)
+		{
+			if (OutAdmission)
+			{
+				*OutAdmission = MoveTemp(It.Value().Admission);
+			}
+			It.RemoveCurrent();
+			++Stats.Claimed;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FHMVRAdmissionController::ClaimByAddress(const FString& Address, FHMVRAdmission* OutAdmission)
+{
+	if (Address.IsEmpty())
+	{
+		return false;
+	}
+
+	// Several joins behind one NAT share an address; tickets grow, so the lowest is the oldest
+	uint32 Oldest = 0;
+	for (const TPair<uint32, FReservation>& Pair : Reservations)
+	{
+		if (Pair.Value.Phase == EPhase::Admitted && Pair.Value.Admission.Address == Address && (Oldest == 0 || Pair.Key < Oldest))
+		{
+			Oldest = Pair.Key;
+		}
+	}
+	if (Oldest == 0)
+	{
+		return false;
+	}
+
+	FReservation Reservation;
+	Reservations.RemoveAndCopyValue(Oldest, Reservation);
+	if (OutAdmission)
+	{
+		*OutAdmission = MoveTemp(Reservation.Admission);
+	}
+	++Stats.Claimed;
+	return true;
+}
+
+bool FHMVRAdmissionController::Expire(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<FReservation> TimedOut;
+	TArray<FHMVRAdmission> Released;
+	for (auto It = Reservations.CreateIterator(); It; ++It)
+	{
+		if (Now < It.Value().Deadline)
+		{
+			continue;
+		}
+		if (It.Value().Phase == EPhase::Validating)
+		{
+			TimedOut.Add(MoveTemp(It.Value()));
+		}
+		else if (IsStillJoining && IsStillJoining(It.Value().Admission))
+		{
+			// Connected and still loading: the slot and the player session are theirs
+			++Stats.Extended;
+			It.Value().Deadline = Now + FMath::Max(1.f, CVarAdmissionReservationSeconds.GetValueOnGameThread());
+			UE_LOG(LogTemp, Log, TEXT("HMVRAdmissionController: Reservation for %s extended - still joining"), *It.Value().Admission.PlayerId);
+			continue;
+		}
+		else
+		{
+			Released.Add(MoveTemp(It.Value().Admission));
+		}
+		It.RemoveCurrent();
+	}
+
+	// Callbacks after the sweep — they may start new admissions
+	for (FReservation& Reservation : TimedOut)
+	{
+		++Stats.TimedOut;
+		UE_LOG(LogTemp, Warning, TEXT("HMVRAdmissionController: Validation for %s timed out after %.1f s"),
+			*Reservation.Admission.Address, Now - Reservation.StartTime);
+		Reservation.OnDone(TEXT("Admission timed out"), Reservation.Admission);
+	}
+	for (const FHMVRAdmission& Admission : Released)
+	{
+		++Stats.Expired;
+		UE_LOG(LogTemp, Log, TEXT("HMVRAdmissionController: Reservation for %s expired before PostLogin"), *Admission.PlayerId);
+		if (OnReservationExpired)
+		{
+			OnReservationExpired(Admission);
+		}
+	}
+	return true;
+}
+
+void FHMVRAdmissionController::LogStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRAdmissionController: %d reserved (%d validating, peak %d); admitted %d, claimed %d, full %d, invalid %d, timed out %d, expired %d, extended %d; slowest validation %.1f ms"),
+		Reservations.Num(), GetValidatingCount(), Stats.PeakReserved, Stats.Admitted, Stats.Claimed,
+		Stats.RejectedFull, Stats.RejectedInvalid, Stats.TimedOut, Stats.Expired, Stats.Extended, Stats.MaxValidateSeconds * 1000.0);
+}
@@ -0,0 +1,110 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/** One join attempt moving through admission. */
+struct FHMVRAdmission
+{
+	FString Address;
+	FString Token;
+	FString PlayerSessionId;
+
+	// Filled in by validation
+	FString PlayerId;
+	FString Username;
+};
+
+/**
+ * Admission stage behind AHMVRGameMode::PreLoginAsync.
+ *
+ * Begin() reserves a slot before anything slow happens: a join is only let through if
+ * connected players + outstanding reservations is below the limit, so a burst of simultaneous
+ * joiners cannot all pass a capacity check that only sees players who already finished
+ * PostLogin. All reservation bookkeeping is on the game thread, which is what makes the check
+ * and the reserve one step.
+ *
+ * Each admission then runs:
+ *   Validate — worker thread (token and player session checks; may block on I/O)
+ *   Complete — game thread (e.g. GameLift AcceptPlayerSession)
+ *   OnDone   — game thread, empty error = admitted
+ *
+ * A validation that has not finished within hmvr.Admission.ValidateTimeoutSeconds is
+ * rejected and its late result discarded. An admitted join holds its slot until the player
+ * reaches PostLogin (Claim) or hmvr.Admission.ReservationSeconds pass, whichever is first.
+ * A lapsing hold whose player IsStillJoining (connected, still loading the map) is extended by
+ * another ReservationSeconds; the rest are reported through OnReservationExpired so the
+ * caller can release them.
+ */
+class HYPERMAGEVR_API FHMVRAdmissionController : public TSharedFromThis<FHMVRAdmissionController>
+{
+public:
+	using FValidateFn = TFunction<bool(FHMVRAdmission& /*InOut*/, FString& /*OutError*/)>;
+	using FCompleteFn = TFunction<bool(FHMVRAdmission& /*InOut*/, FString& /*OutError*/)>;
+	using FDoneFn = TFunction<void(const FString& /*Error*/, const FHMVRAdmission&)>;
+
+	~FHMVRAdmissionController();
+
+	/** Call once after construction (needs a shared pointer to itself). */
+	void Start();
+
+	/**
+	 * Game thread: reserve a slot under Limit given Connected players and start admission.
+	 * Rejects immediately (OnDone with an error, returns false) when no slot is free.
+	 */
+	bool Begin(FHMVRAdmission&& Admission, int32 Limit, int32 Connected,
+		FValidateFn Validate, FCompleteFn Complete, FDoneFn OnDone);
+
+	/** Game thread: the player reached PostLogin; their reservation becomes a connected slot. */
+	bool Claim(const FString& PlayerId, FHMVRAdmission* OutAdmission = nullptr);
+
+	/** Game thread: Claim for a connection whose player id is not known; the oldest admitted join from Address. */
+	bool ClaimByAddress(const FString& Address, FHMVRAdmission* OutAdmission = nullptr);
+
+	/** Validating + admitted-but-not-yet-claimed. */
+	int32 GetReservedCount() const { return Reservations.Num(); }
+	int32 GetValidatingCount() const;
+
+	/** Game thread, during the expiry sweep: true keeps a lapsing hold for another period. Must not call back in. */
+	TFunction<bool(const FHMVRAdmission&)> IsStillJoining;
+
+	TFunction<void(const FHMVRAdmission&)> OnReservationExpired;
+
+	struct FStats
+	{
+		int32 Admitted = 0;
+		int32 Claimed = 0;
+		int32 RejectedFull = 0;
+		int32 RejectedInvalid = 0;
+		int32 TimedOut = 0;
+		int32 Expired = 0;
+		int32 Extended = 0;     // holds kept past their deadline for a player still joining
+		int32 PeakReserved = 0;
+		double MaxValidateSeconds = 0.0;
+	};
+	const FStats& GetStats() const { return Stats; }
+	void LogStats() const;
+
+private:
+	enum class EPhase : uint8 { Validating, Admitted };
+
+	struct FReservation
+	{
+		FHMVRAdmission Admission;
+		EPhase Phase = EPhase::Validating;
+		double StartTime = 0.0;
+		double Deadline = 0.0;
+		FCompleteFn Complete;
+		FDoneFn OnDone;
+	};
+
+	void OnValidated(uint32 Ticket, FHMVRAdmission&& Validated, bool bValid, const FString& Error, double Seconds);
+	bool Expire(float DeltaTime);
+
+	TMap<uint32, FReservation> Reservations;
+	uint32 NextTicket = 1;
+	FStats Stats;
+	FTSTicker::FDelegateHandle ExpiryTickerHandle;
+};
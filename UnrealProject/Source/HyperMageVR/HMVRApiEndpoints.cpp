@@ -0,0 +1,68 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRApiEndpoints.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+	const TCHAR* EndpointsConfigSection = TEXT("/Script/HyperMageVR.HMVRApiEndpoints");
+}
+
+FString FHMVRApiEndpoints::GetSessionApiUrl()
+{
+	return Resolve(TEXT("SessionApiUrl="), TEXT("SessionApiUrl"));
+}
+
+FString FHMVRApiEndpoints::GetWorldStateApiUrl()
+{
+	return Resolve(TEXT("WorldStateApiUrl="), TEXT("WorldStateApiUrl"));
+}
+
+FString FHMVRApiEndpoints::GetAwsRegion()
+{
+	FString Region;
+	if (FParse::Value(FCommandLine::Get(), TEXT("AwsRegion="), Region) && !Region.IsEmpty())
+	{
+		return Region;
+	}
+	if (GConfig && GConfig->GetString(EndpointsConfigSection, TEXT("AwsRegion"), Region, GGameIni) && !Region.IsEmpty())
+	{
+		return Region;
+	}
+	return TEXT("eu-west-1");
+}
+
+bool FHMVRApiEndpoints::IsLocalStubRequested()
+{
+	int32 Port = 0;
+	return FParse::Param(FCommandLine::Get(), TEXT("LocalApiStub"))
+		|| FParse::Value(FCommandLine::Get(), TEXT("LocalApiStub="), Port);
+}
+
+int32 FHMVRApiEndpoints::GetLocalStubPort()
+{
+	int32 Port = DefaultLocalStubPort;
+	FParse::Value(FCommandLine::Get(), TEXT("LocalApiStub="), Port);
+	return Port > 0 ? Port : DefaultLocalStubPort;
+}
+
+FString FHMVRApiEndpoints::Resolve(const TCHAR* CommandLineKey, const TCHAR* ConfigKey)
+{
+	FString Url;
+	if (!FParse::Value(FCommandLine::Get(), CommandLineKey, Url) || Url.IsEmpty())
+	{
+		if (IsLocalStubRequested())
+		{
+			Url = FString::Printf(TEXT("http://127.0.0.1:%d"), GetLocalStubPort());
+		}
+		else if (GConfig)
+		{
+			GConfig->GetString(EndpointsConfigSection, ConfigKey, Url, GGameIni);
+		}
+	}
+
+	Url.RemoveFromEnd(TEXT("/"));
+	return Url;
+}
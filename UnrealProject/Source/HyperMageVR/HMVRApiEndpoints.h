@@ -0,0 +1,41 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Outbound API endpoint configuration shared by USessionAPIClient,
+ * UHMVRInteractableComponent and the matchmaking flow in UHMVRGameInstance.
+ *
+ * Each base URL is resolved in priority order:
+ *   1. Command line:  -SessionApiUrl=<url>  -WorldStateApiUrl=<url>  -AwsRegion=<region>
+ *   2. -LocalApiStub[=<port>]  → every API points at http://127.0.0.1:<port> (see FHMVRLocalApiStub)
+ *   3. [/Script/HyperMageVR.HMVRApiEndpoints] in DefaultGame.ini
+ *
+ * Base URLs never carry a trailing slash; callers append "/session-summary" etc.
+ */
+class HYPERMAGEVR_API FHMVRApiEndpoints
+{
+public:
+	/** Session API base URL (session summaries, interaction events, matchmaking). */
+	static FString GetSessionApiUrl();
+
+	/** World-state API base URL (persistent interactable state). */
+	static FString GetWorldStateApiUrl();
+
+	/** AWS region used for SigV4 signing. */
+	static FString GetAwsRegion();
+
+	/** True when -LocalApiStub was passed and the in-process stub should serve all APIs. */
+	static bool IsLocalStubRequested();
+
+	/** Port the local stub listens on (-LocalApiStub=<port>, default 8787). */
+	static int32 GetLocalStubPort();
+
+	/** Default local stub port when -LocalApiStub has no value. */
+	static constexpr int32 DefaultLocalStubPort = 8787;
+
+private:
+	static FString Resolve(const TCHAR* CommandLineKey, const TCHAR* ConfigKey);
+};
@@ -1,6 +1,7 @@
 // Copyright 2026 HyperMage. All Rights Reserved.
 
 #include "HMVRArtifact.h"
+#include "HMVRServerPolicy.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/RotatingMovementComponent.h"
@@ -20,16 +21,31 @@ AHMVRArtifact::AHMVRArtifact()
 	PickupSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
 	PickupSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 
-	RotatingMovement = CreateDefaultSubobject<URotatingMovementComponent>(TEXT("RotatingMovement"));
-	RotatingMovement->RotationRate = FRotator(0.f, 45.f, 0.f);
+	// Spin is cosmetic and not replicated; each client runs its own
+#if !UE_SERVER
+	RotatingMovement = CreateOptionalDefaultSubobject<URotatingMovementComponent>(TEXT("RotatingMovement"));
+	if (RotatingMovement)
+	{
+		RotatingMovement->RotationRate = FRotator(0.f, 45.f, 0.f);
+	}
+#endif
 
 	Interactable = CreateDefaultSubobject<UHMVRInteractableComponent>(TEXT("Interactable"));
+	Interactable->StateMachine = TEXT("Artefact");
 }
 
 void AHMVRArtifact::BeginPlay()
 {
 	Super::BeginPlay();
-	RotatingMovement->SetActive(bRotates);
+	if (RotatingMovement && !HMVRServerPolicy::WantsCosmetics())
+	{
+		RotatingMovement->DestroyComponent();
+		RotatingMovement = nullptr;
+	}
+	if (RotatingMovement)
+	{
+		RotatingMovement->SetActive(bRotates);
+	}
 	Interactable->OnStateChanged.AddDynamic(this, &AHMVRArtifact::OnInteractableStateChanged);
 
 	if (HasAuthority())
@@ -41,8 +57,7 @@ void AHMVRArtifact::BeginPlay()
 void AHMVRArtifact::OnPlayerApproach(APlayerController* Player, float Distance)
 {
 	if (!HasAuthority()) return;
-	if (Interactable->GetState() == EInteractableState::Resolved) return;
-	Interactable->TransitionTo(EInteractableState::Alert);
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Approach);
 }
 
 void AHMVRArtifact::OnPlayerInteract(APlayerController* Player)
@@ -55,12 +70,62 @@ void AHMVRArtifact::OnCollected(APlayerController* Player)
 	if (!HasAuthority()) return;
 	if (Interactable->GetState() == EInteractableState::Resolved) return;
 
-	Interactable->TransitionTo(EInteractableState::Resolved);
+	if (!PendingCollector.IsValid())
+	{
+		PendingCollector = Player;
+	}
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Interact);
+}
+
+void AHMVRArtifact::OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState)
+{
+	if (Interactable->GetState() != EInteractableState::Resolved) return;
+
+	APlayerController* Player = PendingCollector.Get();
+	PendingCollector.Reset();
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 
 	OnArtifactCollected.Broadcast(this, Player);
 	BP_OnCollected(Player);
+
+	// A pooled artifact (generated waves) is parked for the next one rather than left hidden
+	UHMVRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UHMVRActorPoolSubsystem>();
+	if (Pool && Pool->IsLive(this))
+	{
+		Pool->Release(this);
+	}
+}
+
+void AHMVRArtifact::OnSessionReset()
+{
+	if (!HasAuthority()) return;
+	PendingCollector.Reset();
+	// A persistent artefact that was collected stays collected across sessions
+	if (Interactable->bPersistent && Interactable->GetState() == EInteractableState::Resolved) return;
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+}
+
+void AHMVRArtifact::OnAcquiredFromPool()
+{
+	SetActorParked(this, false);
+	if (RotatingMovement)
+	{
+		RotatingMovement->SetActive(bRotates);
+	}
+	Interactable->ResetForReuse();
+}
+
+void AHMVRArtifact::OnReleasedToPool()
+{
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	PendingCollector.Reset();
+	if (RotatingMovement)
+	{
+		RotatingMovement->SetActive(false);
+	}
+	SetActorParked(this, true);
 }
 
 void AHMVRArtifact::OnInteractableStateChanged(EInteractableState NewState)
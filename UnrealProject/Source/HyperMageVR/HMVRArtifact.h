@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "HMVRInteractable.h"
 #include "HMVRInteractableComponent.h"
+#include "HMVRActorPool.h"
 #include "HMVRArtifact.generated.h"
 
 class UStaticMeshComponent;
@@ -15,7 +16,7 @@ class URotatingMovementComponent;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnArtifactCollected, AActor*, Artifact, APlayerController*, Collector);
 
 UCLASS()
-class HYPERMAGEVR_API AHMVRArtifact : public AActor, public IHMVRInteractable
+class HYPERMAGEVR_API AHMVRArtifact : public AActor, public IHMVRInteractable, public IHMVRPooledActor
 {
 	GENERATED_BODY()
 
@@ -27,6 +28,12 @@ public:
 	virtual void OnPlayerInteract(APlayerController* Player) override;
 	virtual void OnDamageReceived(float Amount, AActor* Source) override {}
 	virtual void OnCollected(APlayerController* Player) override;
+	virtual void OnSessionReset() override;
+	virtual void OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState) override;
+
+	// IHMVRPooledActor
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
 
 	// Matches the asset_id in the DynamoDB asset catalogue (Phase 7).
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Artifact")
@@ -62,8 +69,9 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Interaction")
 	USphereComponent* PickupSphere;
 
+	// Not created in the server build; destroyed at BeginPlay on a -server game binary (HMVRServerPolicy::WantsCosmetics)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Movement")
-	URotatingMovementComponent* RotatingMovement;
+	URotatingMovementComponent* RotatingMovement = nullptr;
 
 protected:
 	virtual void BeginPlay() override;
@@ -71,4 +79,7 @@ protected:
 private:
 	UFUNCTION()
 	void OnInteractableStateChanged(EInteractableState NewState);
+
+	// Server — the first player to collect since the last pass, credited once the state machine applies it
+	TWeakObjectPtr<APlayerController> PendingCollector;
 };
@@ -0,0 +1,76 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-size Bloom filter over 64-bit hashes.
+ *
+ * MayContain never misses a key that was added; it answers true for a key that was not added
+ * with probability about (1 - e^(-kn/m))^k. Use it in front of an exact set so the common
+ * "never seen" case is answered without touching the set. The caller supplies a well-mixed
+ * 64-bit hash (e.g. CityHash64); the NumHashes probes are derived from its two halves.
+ * Bit count is rounded up to a power of two.
+ */
+class FHMVRBloomFilter
+{
+public:
+	explicit FHMVRBloomFilter(uint32 InNumBits = 1 << 16, uint32 InNumHashes = 7)
+		: Mask(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InNumBits, 64)) - 1)
+		, NumHashes(FMath::Max<uint32>(InNumHashes, 1))
+	{
+		Words.SetNumZeroed(static_cast<int32>((Mask + 1) / 64));
+	}
+
+	void Add(uint64 Hash)
+	{
+		const uint32 H1 = static_cast<uint32>(Hash);
+		const uint32 H2 = static_cast<uint32>(Hash >> 32) | 1;
+		for (uint32 i = 0; i < NumHashes; ++i)
+		{
+			const uint32 Bit = (H1 + i * H2) & Mask;
+			Words[Bit >> 6] |= uint64(1) << (Bit & 63);
+		}
+		++NumAdded;
+	}
+
+	bool MayContain(uint64 Hash) const
+	{
+		const uint32 H1 = static_cast<uint32>(Hash);
+		const uint32 H2 = static_cast<uint32>(Hash >> 32) | 1;
+		for (uint32 i = 0; i < NumHashes; ++i)
+		{
+			const uint32 Bit = (H1 + i * H2) & Mask;
+			if ((Words[Bit >> 6] & (uint64(1) << (Bit & 63))) == 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Reset()
+	{
+		FMemory::Memzero(Words.GetData(), Words.Num() * sizeof(uint64));
+		NumAdded = 0;
+	}
+
+	uint32 GetNumBits() const { return Mask + 1; }
+	int64 GetNumAdded() const { return NumAdded; }
+
+	/** Expected false-positive rate at the current fill. */
+	double EstimateFalsePositiveRate() const
+	{
+		const double Fill = 1.0 - FMath::Exp(-static_cast<double>(NumHashes) * NumAdded / GetNumBits());
+		return FMath::Pow(Fill, static_cast<double>(NumHashes));
+	}
+
+	SIZE_T GetAllocatedSize() const { return Words.GetAllocatedSize(); }
+
+private:
+	uint32 Mask;
+	uint32 NumHashes;
+	int64 NumAdded = 0;
+	TArray<uint64> Words;
+};
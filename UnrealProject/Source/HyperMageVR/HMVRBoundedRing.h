@@ -0,0 +1,114 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Fixed-capacity lock-free ring (bounded MPMC queue with per-cell sequence numbers).
+ *
+ * TryPush and TryPop never block and never allocate after construction: a full ring refuses
+ * the push and an empty one the pop, and the caller decides what that means (drop, retry
+ * later). Any number of threads may push and pop concurrently. Capacity is rounded up to a
+ * power of two.
+ */
+template<typename ItemType>
+class THMVRBoundedRing
+{
+public:
+	explicit THMVRBoundedRing(uint32 InCapacity)
+		: Mask(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2)) - 1)
+		, Cells(new FCell[Mask + 1])
+	{
+		for (uint64 i = 0; i <= Mask; ++i)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	THMVRBoundedRing(const THMVRBoundedRing&) = delete;
+	THMVRBoundedRing& operator=(const THMVRBoundedRing&) = delete;
+
+	/** False (Item untouched) when the ring is full. */
+	bool TryPush(ItemType&& Item)
+	{
+		uint64 Pos = Tail.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Pos & Mask];
+			const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+			if (Diff == 0)
+			{
+				if (Tail.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					Cell.Item = MoveTemp(Item);
+					Cell.Sequence.store(Pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = Tail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/** False when the ring is empty. */
+	bool TryPop(ItemType& OutItem)
+	{
+		uint64 Pos = Head.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FCell& Cell = Cells[Pos & Mask];
+			const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos + 1);
+			if (Diff == 0)
+			{
+				if (Head.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					OutItem = MoveTemp(Cell.Item);
+					Cell.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = Head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	uint32 GetCapacity() const { return static_cast<uint32>(Mask + 1); }
+
+	/** Snapshot only — exact when no push or pop is in progress. */
+	int32 ApproxNum() const
+	{
+		const uint64 H = Head.load(std::memory_order_relaxed);
+		const uint64 T = Tail.load(std::memory_order_relaxed);
+		return T > H ? static_cast<int32>(FMath::Min<uint64>(T - H, Mask + 1)) : 0;
+	}
+
+private:
+	struct FCell
+	{
+		std::atomic<uint64> Sequence { 0 };
+		ItemType Item;
+	};
+
+	const uint64 Mask;
+	TUniquePtr<FCell[]> Cells;
+
+	// Producers and the consumer each own a cache line
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Tail { 0 };
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Head { 0 };
+};
@@ -0,0 +1,231 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRCapacityController.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+
+static TAutoConsoleVariable<float> CVarCapacityTargetUtilization(
+	TEXT("hmvr.Capacity.TargetUtilization"),
+	0.75f,
+	TEXT("Fraction of the server tick budget (1 / NetServerMaxTickRate) the effective player limit is sized to."));
+
+static TAutoConsoleVariable<float> CVarCapacityOverloadUtilization(
+	TEXT("hmvr.Capacity.OverloadUtilization"),
+	1.25f,
+	TEXT("Game-thread work above this fraction of the tick budget counts as overload (no new players; not a health fault)."));
+
+static TAutoConsoleVariable<float> CVarCapacityReplicationUtilization(
+	TEXT("hmvr.Capacity.ReplicationUtilization"),
+	0.5f,
+	TEXT("Replication (net driver tick flush) above this fraction of the tick budget counts as overload."));
+
+static TAutoConsoleVariable<float> CVarCapacityOverloadSeconds(
+	TEXT("hmvr.Capacity.OverloadSeconds"),
+	20.f,
+	TEXT("Sustained overload needed before the shard stops taking players."));
+
+static TAutoConsoleVariable<float> CVarCapacityMemoryBudgetMB(
+	TEXT("hmvr.Capacity.MemoryBudgetMB"),
+	0.f,
+	TEXT("Used physical memory above which no more players are admitted. 0 = no memory limit."));
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<float> CVarCapacitySyntheticLoadMs(
+	TEXT("hmvr.Capacity.SyntheticLoadMs"),
+	0.f,
+	TEXT("Testing: burn this much game-thread time every frame."));
+
+static TAutoConsoleVariable<float> CVarCapacitySyntheticMsPerPlayer(
+	TEXT("hmvr.Capacity.SyntheticMsPerPlayer"),
+	0.f,
+	TEXT("Testing: burn this much game-thread time per connected player every frame."));
+#endif
+
+namespace
+{
+	// Per-frame smoothing; ~1 s time constant at 30 Hz
+	constexpr float SampleAlpha = 0.05f;
+	// Fallback per-player cost before there is anything to fit (ms)
+	constexpr float MinPerPlayerMs = 0.05f;
+}
+
+FHMVRCapacityController::~FHMVRCapacityController()
+{
+	Stop();
+}
+
+void FHMVRCapacityController::Start(UWorld* InWorld, int32 InMaxPlayers, TFunction<int32()> InGetPlayerCount)
+{
+	Stop();
+
+	World = InWorld;
+	MaxPlayers = InMaxPlayers;
+	GetPlayerCount = MoveTemp(InGetPlayerCount);
+	EffectiveLimit.store(MaxPlayers, std::memory_order_relaxed);
+	bOverloaded.store(false, std::memory_order_relaxed);
+	LastRecomputeTime = FPlatformTime::Seconds();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FHMVRCapacityController::Tick));
+
+	// Replication is the net driver's TickFlush, which UWorld::Tick runs after actor tick. Mark
+	// the start at post-actor-tick rather than on OnTickFlush itself: that multicast runs newest
+	// binding first, and the net driver binds in Listen, after the game mode is up.
+	if (InWorld)
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FHMVRCapacityController::OnPostActorTick);
+		PostTickFlushHandle = InWorld->OnPostTickFlush().AddRaw(this, &FHMVRCapacityController::OnPostTickFlush);
+	}
+}
+
+void FHMVRCapacityController::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	if (UWorld* W = World.Get())
+	{
+		W->OnPostTickFlush().Remove(PostTickFlushHandle);
+	}
+	PostActorTickHandle.Reset();
+	PostTickFlushHandle.Reset();
+	World.Reset();
+}
+
+void FHMVRCapacityController::OnPostActorTick(UWorld* InWorld, ELevelTick, float)
+{
+	if (InWorld == World.Get())
+	{
+		FlushStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void FHMVRCapacityController::OnPostTickFlush()
+{
+	if (FlushStartTime > 0.0)
+	{
+		const float Ms = static_cast<float>((FPlatformTime::Seconds() - FlushStartTime) * 1000.0);
+		ReplicationMs += (Ms - ReplicationMs) * SampleAlpha;
+		FlushStartTime = 0.0;
+	}
+}
+
+bool FHMVRCapacityController::Tick(float DeltaTime)
+{
+#if !UE_BUILD_SHIPPING
+	// Synthetic load first so it shows up in the next frame's work
+	const int32 Players = GetPlayerCount ? GetPlayerCount() : 0;
+	const float BurnMs = CVarCapacitySyntheticLoadMs.GetValueOnGameThread()
+		+ CVarCapacitySyntheticMsPerPlayer.GetValueOnGameThread() * Players;
+	if (BurnMs > 0.f)
+	{
+		const double Until = FPlatformTime::Seconds() + BurnMs / 1000.0;
+		while (FPlatformTime::Seconds() < Until)
+		{
+		}
+	}
+#endif
+
+	// Last frame's busy time: the server sleeps off whatever is left of its tick budget
+	const float FrameWorkMs = FMath::Max(0.f, static_cast<float>((FApp::GetDeltaTime() - FApp::GetIdleTime()) * 1000.0));
+	WorkMs += (FrameWorkMs - WorkMs) * SampleAlpha;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastRecomputeTime >= 1.0)
+	{
+		LastRecomputeTime = Now;
+		Recompute();
+	}
+	return true;
+}
+
+void FHMVRCapacityController::Recompute()
+{
+	const UWorld* W = World.Get();
+	const UNetDriver* NetDriver = W ? W->GetNetDriver() : nullptr;
+	const float TickRate = NetDriver ? FMath::Max(1.f, NetDriver->GetNetServerMaxTickRate()) : 30.f;
+
+	FSnapshot Next;
+	Next.TickBudgetMs = 1000.f / TickRate;
+	Next.WorkMs = WorkMs;
+	Next.ReplicationMs = ReplicationMs;
+	Next.Players = GetPlayerCount ? GetPlayerCount() : 0;
+	Next.UsedMemoryMB = static_cast<float>(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+
+	// What an empty shard costs (world tick, AI with no one to chase, idle net driver)
+	if (Next.Players == 0)
+	{
+		BaselineWorkMs = BaselineWorkMs < 0.f ? WorkMs : FMath::Lerp(BaselineWorkMs, WorkMs, 0.2f);
+	}
+	Next.BaselineWorkMs = FMath::Max(0.f, BaselineWorkMs);
+
+	// Fit the cost of one more player from what the current ones cost
+	const float Target = Next.TickBudgetMs * FMath::Clamp(CVarCapacityTargetUtilization.GetValueOnGameThread(), 0.1f, 1.f);
+	int32 Fit = MaxPlayers;
+	if (Next.Players > 0)
+	{
+		Next.PerPlayerMs = FMath::Max(MinPerPlayerMs, (WorkMs - Next.BaselineWorkMs) / Next.Players);
+		const float Headroom = Target - WorkMs;
+		Fit = Next.Players + FMath::FloorToInt(Headroom / Next.PerPlayerMs);
+	}
+	else if (WorkMs > Target)
+	{
+		// Over budget with nobody connected — don't add players to it
+		Fit = 0;
+	}
+
+	// Overload: sustained, not a single hitch. Replication counts on its own because it grows
+	// with players times relevant actors and the fitted per-player cost lags it.
+	const double Now = FPlatformTime::Seconds();
+	Next.bReplicationBound = ReplicationMs > Next.TickBudgetMs * CVarCapacityReplicationUtilization.GetValueOnGameThread();
+	if (WorkMs > Next.TickBudgetMs * CVarCapacityOverloadUtilization.GetValueOnGameThread() || Next.bReplicationBound)
+	{
+		OverBudgetSince = OverBudgetSince > 0.0 ? OverBudgetSince : Now;
+	}
+	else
+	{
+		OverBudgetSince = 0.0;
+	}
+	Next.bOverloaded = OverBudgetSince > 0.0 && Now - OverBudgetSince >= CVarCapacityOverloadSeconds.GetValueOnGameThread();
+
+	const float MemoryBudget = CVarCapacityMemoryBudgetMB.GetValueOnGameThread();
+	Next.bMemoryBound = MemoryBudget > 0.f && Next.UsedMemoryMB > MemoryBudget;
+	if (Next.bMemoryBound || Next.bOverloaded)
+	{
+		Fit = FMath::Min(Fit, Next.Players);
+	}
+
+	// Never below the players already here (nobody is kicked); drop at once, rise one at a time
+	const int32 Previous = EffectiveLimit.load(std::memory_order_relaxed);
+	Fit = FMath::Clamp(Fit, FMath::Min(Next.Players, MaxPlayers), MaxPlayers);
+	Next.EffectiveLimit = Fit < Previous ? Fit : FMath::Min(Fit, Previous + 1);
+
+	const bool bChanged = Next.EffectiveLimit != Previous || Next.bOverloaded != Snapshot.bOverloaded;
+	Snapshot = Next;
+	EffectiveLimit.store(Next.EffectiveLimit, std::memory_order_relaxed);
+	bOverloaded.store(Next.bOverloaded, std::memory_order_relaxed);
+
+	if (bChanged)
+	{
+		LogStatus();
+		if (OnCapacityChanged)
+		{
+			OnCapacityChanged();
+		}
+	}
+}
+
+void FHMVRCapacityController::LogStatus() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRCapacityController: limit %d/%d, %d players, %s — work %.2f ms (empty %.2f, %.3f/player) of %.2f ms, replication %.2f ms%s, memory %.0f MB%s"),
+		Snapshot.EffectiveLimit, MaxPlayers, Snapshot.Players, Snapshot.bOverloaded ? TEXT("OVERLOADED") : TEXT("within budget"),
+		Snapshot.WorkMs, Snapshot.BaselineWorkMs, Snapshot.PerPlayerMs, Snapshot.TickBudgetMs, Snapshot.ReplicationMs,
+		Snapshot.bReplicationBound ? TEXT(" (over budget)") : TEXT(""), Snapshot.UsedMemoryMB, Snapshot.bMemoryBound ? TEXT(" (over budget)") : TEXT(""));
+}
@@ -0,0 +1,90 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/EngineBaseTypes.h"
+
+class UWorld;
+
+/**
+ * Derives how many players this shard can take right now from what the server is actually
+ * spending, instead of the static MaxPlayers alone.
+ *
+ * Every frame it samples game-thread work (frame time minus idle), replication (the net
+ * driver's tick flush) and used physical memory, smoothed. Once a second it fits a per-player
+ * cost — (work - empty-shard baseline) / players — and sets the effective limit to the number
+ * of players that fit in hmvr.Capacity.TargetUtilization of the server tick budget, capped at
+ * MaxPlayers. The limit falls immediately and climbs one player per second. Over
+ * hmvr.Capacity.MemoryBudgetMB the limit is pinned to the current player count.
+ *
+ * The shard is overloaded once work has stayed above hmvr.Capacity.OverloadUtilization of the
+ * budget, or replication alone above hmvr.Capacity.ReplicationUtilization, for
+ * hmvr.Capacity.OverloadSeconds; the limit is then pinned to the current player count too.
+ * Overload only sheds new players (admission limit, player session creation policy) — it is
+ * not a health fault, since GameLift terminates a process that fails its health check and
+ * everyone in it. IsOverloaded and GetEffectiveLimit are safe to read from any thread.
+ *
+ * Headless testing: hmvr.Capacity.SyntheticLoadMs burns that much game-thread time per frame
+ * and hmvr.Capacity.SyntheticMsPerPlayer adds that much per connected player, so a -nullrhi
+ * server responds to load without clients or content (development builds).
+ */
+class HYPERMAGEVR_API FHMVRCapacityController
+{
+public:
+	~FHMVRCapacityController();
+
+	/** Begin sampling World. GetPlayerCount is polled once per recompute. */
+	void Start(UWorld* World, int32 InMaxPlayers, TFunction<int32()> InGetPlayerCount);
+	void Stop();
+
+	int32 GetEffectiveLimit() const { return EffectiveLimit.load(std::memory_order_relaxed); }
+	bool IsOverloaded() const { return bOverloaded.load(std::memory_order_relaxed); }
+
+	/** Game thread: the effective limit or overload state changed. */
+	TFunction<void()> OnCapacityChanged;
+
+	struct FSnapshot
+	{
+		float TickBudgetMs = 0.f;
+		float WorkMs = 0.f;
+		float ReplicationMs = 0.f;
+		float BaselineWorkMs = 0.f;
+		float PerPlayerMs = 0.f;
+		float UsedMemoryMB = 0.f;
+		int32 Players = 0;
+		int32 EffectiveLimit = 0;
+		bool bOverloaded = false;
+		bool bReplicationBound = false;
+		bool bMemoryBound = false;
+	};
+	FSnapshot GetSnapshot() const { return Snapshot; }
+	void LogStatus() const;
+
+private:
+	bool Tick(float DeltaTime);
+	void Recompute();
+	void OnPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void OnPostTickFlush();
+
+	TWeakObjectPtr<UWorld> World;
+	int32 MaxPlayers = 0;
+	TFunction<int32()> GetPlayerCount;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PostActorTickHandle;
+	FDelegateHandle PostTickFlushHandle;
+
+	// Smoothed per-frame samples (ms)
+	float WorkMs = 0.f;
+	float ReplicationMs = 0.f;
+	float BaselineWorkMs = -1.f; // learned while the shard is empty; < 0 = not yet
+	double FlushStartTime = 0.0;
+	double LastRecomputeTime = 0.0;
+	double OverBudgetSince = 0.0;
+
+	std::atomic<int32> EffectiveLimit { MAX_int32 }; // unbounded until Start
+	std::atomic<bool> bOverloaded { false };
+	FSnapshot Snapshot;
+};
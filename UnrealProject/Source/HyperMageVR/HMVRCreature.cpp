@@ -2,8 +2,9 @@
 
 #include "HMVRCreature.h"
 #include "HMVRCreatureAIController.h"
+#include "HMVRCreatureSignificance.h"
 #include "Components/SphereComponent.h"
-#include "Net/UnrealNetwork.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/PlayerController.h"
 
 AHMVRCreature::AHMVRCreature()
@@ -13,6 +14,7 @@ AHMVRCreature::AHMVRCreature()
 	AIControllerClass = AHMVRCreatureAIController::StaticClass();
 
 	Interactable = CreateDefaultSubobject<UHMVRInteractableComponent>(TEXT("Interactable"));
+	Interactable->StateMachine = TEXT("Creature");
 
 	DetectionSphere = CreateDefaultSubobject<USphereComponent>(TEXT("DetectionSphere"));
 	DetectionSphere->SetupAttachment(RootComponent);
@@ -30,18 +32,38 @@ void AHMVRCreature::BeginPlay()
 	DetectionSphere->OnComponentBeginOverlap.AddDynamic(this, &AHMVRCreature::OnDetectionOverlapBegin);
 	DetectionSphere->OnComponentEndOverlap.AddDynamic(this, &AHMVRCreature::OnDetectionOverlapEnd);
 	Interactable->OnStateChanged.AddDynamic(this, &AHMVRCreature::OnInteractableStateChanged);
+	Interactable->OnDetailChanged.AddUObject(this, &AHMVRCreature::OnInteractableDetailChanged);
 
-	if (bReplicates && HasAuthority())
+	if (HasAuthority())
 	{
-		Interactable->LoadState();
+		SpawnTransform = GetActorTransform();
+		Interactable->SetHealth(Health);
+		Interactable->SetSubState(static_cast<uint8>(CreatureSubState));
+		if (bReplicates)
+		{
+			Interactable->LoadState();
+		}
+
+		// Tick and AI rate follow distance to the nearest player
+		if (UHMVRCreatureSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UHMVRCreatureSignificanceSubsystem>())
+		{
+			Significance->RegisterCreature(this);
+		}
+	}
+	else if (Interactable->HasReplicatedState())
+	{
+		// Row may have arrived before we bound
+		OnInteractableDetailChanged(Interactable->GetSubState(), Interactable->GetHealth());
 	}
 }
 
-void AHMVRCreature::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void AHMVRCreature::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AHMVRCreature, Health);
-	DOREPLIFETIME(AHMVRCreature, CreatureSubState);
+	if (UHMVRCreatureSignificanceSubsystem* Significance = GetWorld() ? GetWorld()->GetSubsystem<UHMVRCreatureSignificanceSubsystem>() : nullptr)
+	{
+		Significance->UnregisterCreature(this);
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
 void AHMVRCreature::OnDetectionOverlapBegin(UPrimitiveComponent*, AActor* OtherActor,
@@ -59,11 +81,10 @@ void AHMVRCreature::OnDetectionOverlapEnd(UPrimitiveComponent*, AActor* OtherAct
                                            UPrimitiveComponent*, int32)
 {
 	if (!HasAuthority()) return;
-	// Return to patrol only if still alive
+	// Return to patrol only if still alive (the machine only leaves Alert)
 	if (Interactable->GetState() == EInteractableState::Alert)
 	{
-		Interactable->TransitionTo(EInteractableState::Idle);
-		SetCreatureSubState(ECreatureSubState::Patrol);
+		Interactable->RaiseEvent(EHMVRInteractableEvent::Leave);
 		if (AHMVRCreatureAIController* AI = Cast<AHMVRCreatureAIController>(GetController()))
 			AI->ClearChaseTarget();
 	}
@@ -74,8 +95,7 @@ void AHMVRCreature::OnPlayerApproach(APlayerController* Player, float Distance)
 	if (!HasAuthority()) return;
 	if (Interactable->GetState() == EInteractableState::Resolved) return;
 
-	Interactable->TransitionTo(EInteractableState::Alert);
-	SetCreatureSubState(Distance <= AttackRadius ? ECreatureSubState::Attack : ECreatureSubState::Chase);
+	Interactable->RaiseEvent(Distance <= AttackRadius ? EHMVRInteractableEvent::ApproachInRange : EHMVRInteractableEvent::Approach);
 
 	if (AHMVRCreatureAIController* AI = Cast<AHMVRCreatureAIController>(GetController()))
 	{
@@ -83,6 +103,13 @@ void AHMVRCreature::OnPlayerApproach(APlayerController* Player, float Distance)
 	}
 }
 
+void AHMVRCreature::OnGmHook(FName HookId, const FString& Argument)
+{
+	// Alerted by the GM: no player to chase, the AI keeps whatever target it has
+	if (!HasAuthority()) return;
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Approach);
+}
+
 void AHMVRCreature::OnPlayerInteract(APlayerController* Player)
 {
 	// Interacting with a creature triggers an attack from the creature's side
@@ -92,17 +119,117 @@ void AHMVRCreature::OnPlayerInteract(APlayerController* Player)
 void AHMVRCreature::OnDamageReceived(float Amount, AActor* Source)
 {
 	if (!HasAuthority()) return;
-	if (Interactable->GetState() == EInteractableState::Resolved) return;
+	// Already dead, or the killing blow is still queued for the next state machine pass
+	if (Interactable->GetState() == EInteractableState::Resolved || Health <= 0.f) return;
 
 	Health = FMath::Max(0.f, Health - Amount);
-	Interactable->TransitionTo(EInteractableState::Active);
-	SetCreatureSubState(ECreatureSubState::Attack);
-
+	Interactable->SetHealth(Health);
 	if (Health <= 0.f)
 	{
-		Interactable->TransitionTo(EInteractableState::Resolved);
-		BP_OnDeath(Source);
+		KilledBy = Source;
+		Interactable->RaiseEvent(EHMVRInteractableEvent::Killed);
+	}
+	else
+	{
+		Interactable->RaiseEvent(EHMVRInteractableEvent::Damage);
+	}
+}
+
+void AHMVRCreature::OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState)
+{
+	const ECreatureSubState NewSubState = static_cast<ECreatureSubState>(Interactable->GetSubState());
+	if (NewSubState != CreatureSubState)
+	{
+		CreatureSubState = NewSubState;
+		BP_OnSubStateChanged(NewSubState);
+	}
+
+	if (Interactable->GetState() != EInteractableState::Resolved || FromState == EInteractableState::Resolved)
+	{
+		return;
+	}
+	BP_OnDeath(KilledBy.Get());
+	KilledBy.Reset();
+
+	// Pooled wave creatures make room for the next wave instead of lying around
+	UHMVRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UHMVRActorPoolSubsystem>();
+	if (Pool && Pool->IsLive(this))
+	{
+		GetWorldTimerManager().SetTimer(ReturnToPoolTimer, FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			if (UHMVRActorPoolSubsystem* OwningPool = GetWorld()->GetSubsystem<UHMVRActorPoolSubsystem>())
+			{
+				OwningPool->Release(this);
+			}
+		}), FMath::Max(0.01f, ReturnToPoolDelay), false);
+	}
+}
+
+void AHMVRCreature::OnSessionReset()
+{
+	if (!HasAuthority()) return;
+	GetWorldTimerManager().ClearTimer(ReturnToPoolTimer);
+
+	if (AHMVRCreatureAIController* AI = Cast<AHMVRCreatureAIController>(GetController()))
+	{
+		AI->ClearChaseTarget();
+		AI->StopMovement();
 	}
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	Health = MaxHealth;
+	Interactable->SetHealth(Health);
+	SetCreatureSubState(ECreatureSubState::Patrol);
+}
+
+void AHMVRCreature::OnAcquiredFromPool()
+{
+	SetActorParked(this, false);
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetDefaultMovementMode();
+	}
+
+	// As BeginPlay would leave it, at the new transform
+	SpawnTransform = GetActorTransform();
+	DetectionSphere->SetSphereRadius(DetectionRadius);
+	Health = MaxHealth;
+	CreatureSubState = ECreatureSubState::Patrol;
+	Interactable->ResetForReuse();
+	Interactable->SetHealth(Health);
+	Interactable->SetSubState(static_cast<uint8>(CreatureSubState));
+
+	if (AHMVRCreatureAIController* AI = Cast<AHMVRCreatureAIController>(GetController()))
+	{
+		AI->ResetForReuse();
+	}
+	if (UHMVRCreatureSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UHMVRCreatureSignificanceSubsystem>())
+	{
+		Significance->RegisterCreature(this);
+	}
+}
+
+void AHMVRCreature::OnReleasedToPool()
+{
+	// Significance first: unregistering puts ticks back to their defaults, which parking then turns off
+	if (UHMVRCreatureSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UHMVRCreatureSignificanceSubsystem>())
+	{
+		Significance->UnregisterCreature(this);
+	}
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+
+	// The controller stays possessing the parked creature, asleep
+	if (AHMVRCreatureAIController* AI = Cast<AHMVRCreatureAIController>(GetController()))
+	{
+		AI->ClearChaseTarget();
+		AI->SetThinkingSuspended(true);
+	}
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+	}
+	SetActorParked(this, true);
 }
 
 float AHMVRCreature::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent,
@@ -117,6 +244,7 @@ void AHMVRCreature::SetCreatureSubState(ECreatureSubState NewSubState)
 {
 	if (CreatureSubState == NewSubState) return;
 	CreatureSubState = NewSubState;
+	Interactable->SetSubState(static_cast<uint8>(NewSubState));
 	BP_OnSubStateChanged(NewSubState);
 }
 
@@ -124,3 +252,9 @@ void AHMVRCreature::OnInteractableStateChanged(EInteractableState NewState)
 {
 	BP_OnStateChanged(NewState);
 }
+
+void AHMVRCreature::OnInteractableDetailChanged(uint8 SubState, float NewHealth)
+{
+	Health = NewHealth;
+	CreatureSubState = static_cast<ECreatureSubState>(SubState);
+}
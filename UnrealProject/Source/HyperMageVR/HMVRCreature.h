@@ -6,6 +6,7 @@
 #include "GameFramework/Character.h"
 #include "HMVRInteractable.h"
 #include "HMVRInteractableComponent.h"
+#include "HMVRActorPool.h"
 #include "HMVRCreature.generated.h"
 
 class USphereComponent;
@@ -20,7 +21,7 @@ enum class ECreatureSubState : uint8
 };
 
 UCLASS()
-class HYPERMAGEVR_API AHMVRCreature : public ACharacter, public IHMVRInteractable
+class HYPERMAGEVR_API AHMVRCreature : public ACharacter, public IHMVRInteractable, public IHMVRPooledActor
 {
 	GENERATED_BODY()
 
@@ -32,23 +33,33 @@ public:
 	virtual void OnPlayerInteract(APlayerController* Player) override;
 	virtual void OnDamageReceived(float Amount, AActor* Source) override;
 	virtual void OnCollected(APlayerController* Player) override {}
+	virtual void OnSessionReset() override;
+	virtual void OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState) override;
+	virtual void OnGmHook(FName HookId, const FString& Argument) override;
+
+	// IHMVRPooledActor
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
 
 	virtual float TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent,
 	                         AController* EventInstigator, AActor* DamageCauser) override;
 
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
-
 	// ── Combat ──────────────────────────────────────────────────────────────────
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Combat")
 	float MaxHealth = 100.f;
 
-	UPROPERTY(BlueprintReadOnly, Replicated, Category="Combat")
+	// Replicated through the interactable state registry
+	UPROPERTY(BlueprintReadOnly, Category="Combat")
 	float Health = 100.f;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Combat")
 	float AttackDamage = 15.f;
 
+	// A creature handed out by the actor pool goes back to it this long after dying (death animation)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Combat")
+	float ReturnToPoolDelay = 5.f;
+
 	// ── AI ──────────────────────────────────────────────────────────────────────
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="AI")
@@ -57,7 +68,12 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="AI")
 	float AttackRadius = 200.f;
 
-	UPROPERTY(BlueprintReadOnly, Replicated, Category="AI")
+	// Wander radius around the spawn point; 0 = half of DetectionRadius
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="AI")
+	float PatrolRadius = 0.f;
+
+	// Replicated through the interactable state registry
+	UPROPERTY(BlueprintReadOnly, Category="AI")
 	ECreatureSubState CreatureSubState = ECreatureSubState::Patrol;
 
 	void SetCreatureSubState(ECreatureSubState NewSubState);
@@ -83,6 +99,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	UFUNCTION()
@@ -96,4 +113,14 @@ private:
 
 	UFUNCTION()
 	void OnInteractableStateChanged(EInteractableState NewState);
+
+	void OnInteractableDetailChanged(uint8 SubState, float NewHealth);
+
+	// Server — where the creature stood at BeginPlay, restored by OnSessionReset
+	FTransform SpawnTransform;
+
+	FTimerHandle ReturnToPoolTimer;
+
+	// Server — what dealt the killing blow, for BP_OnDeath once the Killed event is applied
+	TWeakObjectPtr<AActor> KilledBy;
 };
@@ -7,6 +7,14 @@
 #include "Kismet/GameplayStatics.h"
 #include "Navigation/PathFollowingComponent.h"
 
+namespace
+{
+	const FName ThinkEvent(TEXT("Think"));
+
+	// Coarse enough to be cheap, fine enough for responsive chase
+	constexpr float ThinkInterval = 0.5f;
+}
+
 AHMVRCreatureAIController::AHMVRCreatureAIController()
 {
 	bWantsPlayerState = false;
@@ -17,18 +25,36 @@ void AHMVRCreatureAIController::OnPossess(APawn* InPawn)
 	Super::OnPossess(InPawn);
 
 	SpawnLocation = InPawn->GetActorLocation();
-
-	// 0.5s tick — coarse enough to be cheap, fine enough for responsive chase
-	GetWorldTimerManager().SetTimer(TickTimer, this,
-		&AHMVRCreatureAIController::AITick, 0.5f, true);
+	bThinkingSuspended = false;
+	ScheduleThink();
 }
 
 void AHMVRCreatureAIController::OnUnPossess()
 {
-	GetWorldTimerManager().ClearTimer(TickTimer);
+	if (UHMVRGameplayTimerSubsystem* Timers = GetWorld() ? GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>() : nullptr)
+	{
+		Timers->Cancel(TickTimer);
+	}
 	Super::OnUnPossess();
 }
 
+void AHMVRCreatureAIController::ScheduleThink()
+{
+	if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+	{
+		Timers->Cancel(TickTimer);
+		TickTimer = Timers->Schedule(this, ThinkEvent, ThinkInterval);
+	}
+}
+
+void AHMVRCreatureAIController::OnGameplayTimer(FName Event)
+{
+	if (Event != ThinkEvent) return;
+	TickTimer.Invalidate();
+	ScheduleThink();
+	AITick();
+}
+
 void AHMVRCreatureAIController::SetChaseTarget(APawn* Target)
 {
 	ChaseTarget = Target;
@@ -40,6 +66,39 @@ void AHMVRCreatureAIController::ClearChaseTarget()
 	StopMovement();
 }
 
+void AHMVRCreatureAIController::SetThinkingSuspended(bool bSuspended)
+{
+	if (bSuspended == bThinkingSuspended) return;
+	bThinkingSuspended = bSuspended;
+
+	UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>();
+	if (bSuspended)
+	{
+		StopMovement();
+		if (Timers)
+		{
+			Timers->Cancel(TickTimer);
+		}
+	}
+	else
+	{
+		// Think straight away on waking rather than up to one interval later
+		ScheduleThink();
+		AITick();
+	}
+}
+
+void AHMVRCreatureAIController::ResetForReuse()
+{
+	ChaseTarget = nullptr;
+	StopMovement();
+	if (const APawn* Creature = GetPawn())
+	{
+		SpawnLocation = Creature->GetActorLocation();
+	}
+	SetThinkingSuspended(false);
+}
+
 void AHMVRCreatureAIController::AITick()
 {
 	AHMVRCreature* Creature = Cast<AHMVRCreature>(GetPawn());
@@ -68,8 +127,9 @@ void AHMVRCreatureAIController::DoPatrol()
 	UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(GetWorld());
 	if (!NavSys || !Creature) return;
 
+	const float Radius = Creature->PatrolRadius > 0.f ? Creature->PatrolRadius : Creature->DetectionRadius * 0.5f;
 	FNavLocation NavLoc;
-	if (NavSys->GetRandomReachablePointInRadius(SpawnLocation, Creature->DetectionRadius * 0.5f, NavLoc))
+	if (NavSys->GetRandomReachablePointInRadius(SpawnLocation, Radius, NavLoc))
 	{
 		MoveToLocation(NavLoc.Location, 50.f);
 	}
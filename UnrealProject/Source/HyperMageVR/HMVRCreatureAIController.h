@@ -4,10 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "HMVRGameplayTimers.h"
 #include "HMVRCreatureAIController.generated.h"
 
 UCLASS()
-class HYPERMAGEVR_API AHMVRCreatureAIController : public AAIController
+class HYPERMAGEVR_API AHMVRCreatureAIController : public AAIController, public IHMVRGameplayTimerTarget
 {
 	GENERATED_BODY()
 
@@ -17,6 +18,15 @@ public:
 	void SetChaseTarget(APawn* Target);
 	void ClearChaseTarget();
 
+	/** Stop the think timer and any move in progress (creature significance: Dormant). */
+	void SetThinkingSuspended(bool bSuspended);
+
+	/** Actor pool: the creature was placed somewhere new — patrol around there, chasing no one. */
+	void ResetForReuse();
+
+	// IHMVRGameplayTimerTarget
+	virtual void OnGameplayTimer(FName Event) override;
+
 protected:
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void OnUnPossess() override;
@@ -26,7 +36,10 @@ private:
 	APawn* ChaseTarget = nullptr;
 
 	FVector SpawnLocation;
-	FTimerHandle TickTimer;
+	FHMVRGameplayTimerHandle TickTimer;
+	bool bThinkingSuspended = false;
+
+	void ScheduleThink();
 
 	void AITick();
 	void DoPatrol();
@@ -0,0 +1,463 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRCreatureSignificance.h"
+#include "HMVRCreature.h"
+#include "HMVRCreatureAIController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+static TAutoConsoleVariable<int32> CVarSignificanceEnabled(
+	TEXT("hmvr.Significance.Enabled"),
+	1,
+	TEXT("0 = every creature ticks at full rate regardless of distance to players."));
+
+static TAutoConsoleVariable<float> CVarSignificanceUpdateHz(
+	TEXT("hmvr.Significance.UpdateHz"),
+	4.f,
+	TEXT("How often creatures are re-scored against player positions."));
+
+static TAutoConsoleVariable<float> CVarSignificanceNearDistance(
+	TEXT("hmvr.Significance.NearDistance"),
+	2000.f,
+	TEXT("Creatures with a player within this distance (cm) tick at full rate."));
+
+static TAutoConsoleVariable<float> CVarSignificanceMidDistance(
+	TEXT("hmvr.Significance.MidDistance"),
+	4500.f,
+	TEXT("Creatures with a player within this distance (cm) are Medium; beyond it Low."));
+
+static TAutoConsoleVariable<float> CVarSignificanceFarDistance(
+	TEXT("hmvr.Significance.FarDistance"),
+	8000.f,
+	TEXT("Creatures with no player within this distance (cm) are suspended."));
+
+static TAutoConsoleVariable<float> CVarSignificanceHysteresis(
+	TEXT("hmvr.Significance.Hysteresis"),
+	0.15f,
+	TEXT("A creature drops to a less significant tier only once the nearest player is this fraction beyond the threshold."));
+
+static TAutoConsoleVariable<float> CVarSignificanceMediumTickInterval(
+	TEXT("hmvr.Significance.MediumTickInterval"),
+	1.f / 15.f,
+	TEXT("Actor, movement and component tick interval (s) for Medium creatures."));
+
+static TAutoConsoleVariable<float> CVarSignificanceLowTickInterval(
+	TEXT("hmvr.Significance.LowTickInterval"),
+	0.25f,
+	TEXT("Actor, movement and component tick interval (s) for Low creatures."));
+
+static FAutoConsoleCommandWithWorld CmdSignificanceStats(
+	TEXT("HMVR.Significance.Stats"),
+	TEXT("Log creatures per significance tier, tier changes and the cost of the last update."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UHMVRCreatureSignificanceSubsystem* Significance = World ? World->GetSubsystem<UHMVRCreatureSignificanceSubsystem>() : nullptr)
+		{
+			Significance->LogStats();
+		}
+	}));
+
+namespace
+{
+	const TCHAR* TierName(EHMVRSignificance Tier)
+	{
+		switch (Tier)
+		{
+		case EHMVRSignificance::High:    return TEXT("High");
+		case EHMVRSignificance::Medium:  return TEXT("Medium");
+		case EHMVRSignificance::Low:     return TEXT("Low");
+		case EHMVRSignificance::Dormant: return TEXT("Dormant");
+		}
+		return TEXT("?");
+	}
+
+	/** Tier for a nearest-player distance, with every threshold scaled by Scale. */
+	EHMVRSignificance TierForDistanceSq(float DistanceSq, float Scale)
+	{
+		const float Near = CVarSignificanceNearDistance.GetValueOnGameThread() * Scale;
+		const float Mid = CVarSignificanceMidDistance.GetValueOnGameThread() * Scale;
+		const float Far = CVarSignificanceFarDistance.GetValueOnGameThread() * Scale;
+		if (DistanceSq <= Near * Near) return EHMVRSignificance::High;
+		if (DistanceSq <= Mid * Mid)   return EHMVRSignificance::Medium;
+		if (DistanceSq <= Far * Far)   return EHMVRSignificance::Low;
+		return EHMVRSignificance::Dormant;
+	}
+
+	float TierTickInterval(EHMVRSignificance Tier)
+	{
+		switch (Tier)
+		{
+		case EHMVRSignificance::Medium: return FMath::Max(0.f, CVarSignificanceMediumTickInterval.GetValueOnGameThread());
+		case EHMVRSignificance::Low:    return FMath::Max(0.f, CVarSignificanceLowTickInterval.GetValueOnGameThread());
+		default:                        return 0.f;
+		}
+	}
+}
+
+bool UHMVRCreatureSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHMVRCreatureSignificanceSubsystem::Deinitialize()
+{
+	RestoreAll();
+	Tracked.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UHMVRCreatureSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHMVRCreatureSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UHMVRCreatureSignificanceSubsystem::RegisterCreature(AHMVRCreature* Creature)
+{
+	if (!Creature || Tracked.ContainsByPredicate([Creature](const FTrackedCreature& T) { return T.Creature == Creature; }))
+	{
+		return;
+	}
+
+	// Remember how everything ticked so High (and unregistering) puts it back exactly
+	FTrackedCreature& Entry = Tracked.AddDefaulted_GetRef();
+	Entry.Creature = Creature;
+	Entry.BaseActorInterval = Creature->GetActorTickInterval();
+	Entry.bBaseActorEnabled = Creature->IsActorTickEnabled();
+	if (USkeletalMeshComponent* Mesh = Creature->GetMesh())
+	{
+		Entry.BaseAnimTickOption = Mesh->VisibilityBasedAnimTickOption;
+	}
+
+	TInlineComponentArray<UActorComponent*> Components(Creature);
+	for (UActorComponent* Component : Components)
+	{
+		if (Component->PrimaryComponentTick.bCanEverTick)
+		{
+			Entry.Components.Add({ Component, Component->GetComponentTickInterval(), Component->IsComponentTickEnabled() });
+		}
+	}
+
+	// Everything starts at full rate; the next update places it
+	NextUpdateTime = 0.0;
+}
+
+void UHMVRCreatureSignificanceSubsystem::UnregisterCreature(AHMVRCreature* Creature)
+{
+	const int32 Index = Tracked.IndexOfByPredicate([Creature](const FTrackedCreature& T) { return T.Creature == Creature; });
+	if (Index != INDEX_NONE)
+	{
+		ApplyTier(Tracked[Index], EHMVRSignificance::High);
+		Tracked.RemoveAtSwap(Index);
+	}
+}
+
+EHMVRSignificance UHMVRCreatureSignificanceSubsystem::GetSignificance(const AHMVRCreature* Creature) const
+{
+	const FTrackedCreature* Entry = Tracked.FindByPredicate([Creature](const FTrackedCreature& T) { return T.Creature == Creature; });
+	return Entry ? Entry->Tier : EHMVRSignificance::High;
+}
+
+void UHMVRCreatureSignificanceSubsystem::Tick(float /*DeltaTime*/)
+{
+	const bool bEnabled = CVarSignificanceEnabled.GetValueOnGameThread() != 0;
+	if (!bEnabled)
+	{
+		if (bWasEnabled)
+		{
+			RestoreAll();
+			bWasEnabled = false;
+		}
+		return;
+	}
+	bWasEnabled = true;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now < NextUpdateTime)
+	{
+		return;
+	}
+	NextUpdateTime = Now + 1.0 / FMath::Max(0.1f, CVarSignificanceUpdateHz.GetValueOnGameThread());
+	UpdateSignificance();
+}
+
+EHMVRSignificance UHMVRCreatureSignificanceSubsystem::ChooseTier(EHMVRSignificance Current, float NearestDistanceSq)
+{
+	// Promote at the threshold, demote only past it by the hysteresis margin
+	const EHMVRSignificance Tier = TierForDistanceSq(NearestDistanceSq, 1.f);
+	if (Tier <= Current)
+	{
+		return Tier;
+	}
+	const float DemoteScale = 1.f / (1.f + FMath::Max(0.f, CVarSignificanceHysteresis.GetValueOnGameThread()));
+	return FMath::Max(Current, TierForDistanceSq(NearestDistanceSq * DemoteScale * DemoteScale, 1.f));
+}
+
+void UHMVRCreatureSignificanceSubsystem::UpdateSignificance()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	UWorld* World = GetWorld();
+
+	Viewpoints.Reset();
+	Viewpoints.Append(ExtraViewpoints);
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APawn* Pawn = It->IsValid() ? (*It)->GetPawn() : nullptr)
+		{
+			Viewpoints.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	FMemory::Memzero(Stats.ByTier);
+	for (int32 i = Tracked.Num() - 1; i >= 0; --i)
+	{
+		FTrackedCreature& Entry = Tracked[i];
+		const AHMVRCreature* Creature = Entry.Creature.Get();
+		if (!Creature)
+		{
+			Tracked.RemoveAtSwap(i);
+			continue;
+		}
+
+		const FVector Location = Creature->GetActorLocation();
+		float NearestSq = MAX_flt;
+		for (const FVector& Viewpoint : Viewpoints)
+		{
+			NearestSq = FMath::Min(NearestSq, FVector::DistSquared(Location, Viewpoint));
+		}
+
+		const EHMVRSignificance Tier = ChooseTier(Entry.Tier, NearestSq);
+		if (Tier != Entry.Tier)
+		{
+			++(Tier < Entry.Tier ? Stats.Promotions : Stats.Demotions);
+			ApplyTier(Entry, Tier);
+		}
+		++Stats.ByTier[static_cast<int32>(Entry.Tier)];
+	}
+
+	Stats.Tracked = Tracked.Num();
+	Stats.LastUpdateMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void UHMVRCreatureSignificanceSubsystem::ApplyTier(FTrackedCreature& Entry, EHMVRSignificance Tier)
+{
+	AHMVRCreature* Creature = Entry.Creature.Get();
+	Entry.Tier = Tier;
+	if (!Creature)
+	{
+		return;
+	}
+
+	const bool bDormant = Tier == EHMVRSignificance::Dormant;
+	const float Interval = TierTickInterval(Tier);
+
+	Creature->SetActorTickInterval(FMath::Max(Entry.BaseActorInterval, Interval));
+	Creature->SetActorTickEnabled(Entry.bBaseActorEnabled && !bDormant);
+	for (const FComponentTick& Tick : Entry.Components)
+	{
+		if (UActorComponent* Component = Tick.Component.Get())
+		{
+			Component->SetComponentTickInterval(FMath::Max(Tick.BaseInterval, Interval));
+			Component->SetComponentTickEnabled(Tick.bBaseEnabled && !bDormant);
+		}
+	}
+
+	// Low keeps montages (attacks) running but stops full pose evaluation; nothing is rendered here
+	if (USkeletalMeshComponent* Mesh = Creature->GetMesh())
+	{
+		Mesh->VisibilityBasedAnimTickOption = Tier >= EHMVRSignificance::Low
+			? EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered
+			: Entry.BaseAnimTickOption;
+	}
+
+	// A suspended creature stands still instead of carrying its last velocity into the wake-up frame
+	if (bDormant)
+	{
+		if (UCharacterMovementComponent* Movement = Creature->GetCharacterMovement())
+		{
+			Movement->StopMovementImmediately();
+		}
+	}
+	if (AHMVRCreatureAIController* AI = Cast<AHMVRCreatureAIController>(Creature->GetController()))
+	{
+		AI->SetThinkingSuspended(bDormant);
+	}
+}
+
+void UHMVRCreatureSignificanceSubsystem::RestoreAll()
+{
+	for (FTrackedCreature& Entry : Tracked)
+	{
+		if (Entry.Tier != EHMVRSignificance::High)
+		{
+			ApplyTier(Entry, EHMVRSignificance::High);
+		}
+	}
+	FMemory::Memzero(Stats.ByTier);
+	Stats.ByTier[static_cast<int32>(EHMVRSignificance::High)] = Tracked.Num();
+}
+
+void UHMVRCreatureSignificanceSubsystem::LogStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRCreatureSignificance: %d creatures — %s %d, %s %d, %s %d, %s %d; %lld promotions, %lld demotions; last update %.3f ms%s"),
+		Stats.Tracked,
+		TierName(EHMVRSignificance::High), Stats.ByTier[0], TierName(EHMVRSignificance::Medium), Stats.ByTier[1],
+		TierName(EHMVRSignificance::Low), Stats.ByTier[2], TierName(EHMVRSignificance::Dormant), Stats.ByTier[3],
+		Stats.Promotions, Stats.Demotions, Stats.LastUpdateMs,
+		CVarSignificanceEnabled.GetValueOnGameThread() != 0 ? TEXT("") : TEXT(" (disabled)"));
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	/** HMVR.Significance.Bench run: spawned creatures and per-phase frame work samples. */
+	struct FSignificanceBench
+	{
+		TWeakObjectPtr<UWorld> World;
+		TArray<TWeakObjectPtr<AHMVRCreature>> Spawned;
+		double PhaseSeconds = 10.0;
+		double PhaseEnd = 0.0;
+		int32 Phase = 0; // 0 warm-up, 1 full rate, 2 settle, 3 significance on
+		int32 PreviousEnabled = 1;
+
+		int32 Frames = 0;
+		double WorkMsSum = 0.0;
+		float WorkMsMax = 0.f;
+		float ResultAvgMs[2] = {};
+		float ResultMaxMs[2] = {};
+		int32 ResultFrames[2] = {};
+	};
+
+	bool bSignificanceBenchRunning = false;
+}
+
+// Headless: run on a -nullrhi dedicated server with no clients. Creatures are spread over a disc
+// 1.5x FarDistance around one synthetic viewpoint (a player start), then frame work — frame time
+// minus idle, as the capacity controller measures it — is averaged with significance off and on.
+static FAutoConsoleCommandWithWorldAndArgs CmdSignificanceBench(
+	TEXT("HMVR.Significance.Bench"),
+	TEXT("HMVR.Significance.Bench [Count=200] [Seconds=10] — server frame work with Count creatures at full rate vs. under significance."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UHMVRCreatureSignificanceSubsystem* Significance = World ? World->GetSubsystem<UHMVRCreatureSignificanceSubsystem>() : nullptr;
+		if (!Significance || bSignificanceBenchRunning)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRCreatureSignificance: Bench needs a game world and one run at a time"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 200;
+		TSharedRef<FSignificanceBench> Bench = MakeShared<FSignificanceBench>();
+		Bench->World = World;
+		Bench->PhaseSeconds = Args.Num() > 1 ? FMath::Max(1.0, FCString::Atod(*Args[1])) : 10.0;
+		Bench->PreviousEnabled = CVarSignificanceEnabled.GetValueOnGameThread();
+
+		FVector Origin = FVector::ZeroVector;
+		if (TActorIterator<APlayerStart> It(World); It)
+		{
+			Origin = It->GetActorLocation();
+		}
+		Significance->SetExtraViewpoints({ Origin });
+
+		FRandomStream Random(Count);
+		const float Radius = CVarSignificanceFarDistance.GetValueOnGameThread() * 1.5f;
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			// Uniform over the disc
+			const float R = Radius * FMath::Sqrt(Random.FRand());
+			const float Angle = Random.FRandRange(0.f, 2.f * PI);
+			const FVector Location = Origin + FVector(R * FMath::Cos(Angle), R * FMath::Sin(Angle), 0.f);
+			if (AHMVRCreature* Creature = World->SpawnActor<AHMVRCreature>(AHMVRCreature::StaticClass(), Location, FRotator::ZeroRotator, Params))
+			{
+				Bench->Spawned.Add(Creature);
+			}
+		}
+
+		CVarSignificanceEnabled->Set(0, ECVF_SetByConsole);
+		Bench->PhaseEnd = FPlatformTime::Seconds() + 2.0;
+		bSignificanceBenchRunning = true;
+		UE_LOG(LogTemp, Log, TEXT("HMVRCreatureSignificance: Bench spawned %d creatures within %.0f cm; measuring %.0f s at full rate, then %.0f s with significance"),
+			Bench->Spawned.Num(), Radius, Bench->PhaseSeconds, Bench->PhaseSeconds);
+
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Bench](float)
+		{
+			UWorld* BenchWorld = Bench->World.Get();
+			if (!BenchWorld)
+			{
+				bSignificanceBenchRunning = false;
+				return false;
+			}
+
+			if (Bench->Phase == 1 || Bench->Phase == 3)
+			{
+				const float WorkMs = FMath::Max(0.f, static_cast<float>((FApp::GetDeltaTime() - FApp::GetIdleTime()) * 1000.0));
+				++Bench->Frames;
+				Bench->WorkMsSum += WorkMs;
+				Bench->WorkMsMax = FMath::Max(Bench->WorkMsMax, WorkMs);
+			}
+
+			const double Now = FPlatformTime::Seconds();
+			if (Now < Bench->PhaseEnd)
+			{
+				return true;
+			}
+
+			if (Bench->Phase == 1 || Bench->Phase == 3)
+			{
+				const int32 Slot = Bench->Phase == 1 ? 0 : 1;
+				Bench->ResultFrames[Slot] = Bench->Frames;
+				Bench->ResultAvgMs[Slot] = Bench->Frames > 0 ? static_cast<float>(Bench->WorkMsSum / Bench->Frames) : 0.f;
+				Bench->ResultMaxMs[Slot] = Bench->WorkMsMax;
+				Bench->Frames = 0;
+				Bench->WorkMsSum = 0.0;
+				Bench->WorkMsMax = 0.f;
+			}
+
+			++Bench->Phase;
+			if (Bench->Phase == 2)
+			{
+				CVarSignificanceEnabled->Set(1, ECVF_SetByConsole);
+			}
+			if (Bench->Phase <= 3)
+			{
+				Bench->PhaseEnd = Now + (Bench->Phase == 2 ? 2.0 : Bench->PhaseSeconds);
+				return true;
+			}
+
+			UHMVRCreatureSignificanceSubsystem* Significance = BenchWorld->GetSubsystem<UHMVRCreatureSignificanceSubsystem>();
+			if (Significance)
+			{
+				Significance->LogStats();
+			}
+			UE_LOG(LogTemp, Log,
+				TEXT("HMVRCreatureSignificance: Bench %d creatures — full rate %.2f ms avg / %.2f ms max over %d frames; with significance %.2f ms avg / %.2f ms max over %d frames (%.0f%% of full-rate cost)"),
+				Bench->Spawned.Num(), Bench->ResultAvgMs[0], Bench->ResultMaxMs[0], Bench->ResultFrames[0],
+				Bench->ResultAvgMs[1], Bench->ResultMaxMs[1], Bench->ResultFrames[1],
+				Bench->ResultAvgMs[0] > 0.f ? 100.f * Bench->ResultAvgMs[1] / Bench->ResultAvgMs[0] : 0.f);
+
+			for (const TWeakObjectPtr<AHMVRCreature>& Creature : Bench->Spawned)
+			{
+				if (Creature.IsValid())
+				{
+					Creature->Destroy();
+				}
+			}
+			if (Significance)
+			{
+				Significance->SetExtraViewpoints({});
+			}
+			CVarSignificanceEnabled->Set(Bench->PreviousEnabled, ECVF_SetByConsole);
+			bSignificanceBenchRunning = false;
+			return false;
+		}));
+	}));
+#endif
@@ -0,0 +1,106 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "HMVRCreatureSignificance.generated.h"
+
+class AHMVRCreature;
+class UActorComponent;
+
+/** How much a creature matters to the players right now; lower values tick more often. */
+UENUM(BlueprintType)
+enum class EHMVRSignificance : uint8
+{
+	High     UMETA(DisplayName = "High"),     // full rate
+	Medium   UMETA(DisplayName = "Medium"),   // hmvr.Significance.MediumTickInterval
+	Low      UMETA(DisplayName = "Low"),      // hmvr.Significance.LowTickInterval, no pose ticking
+	Dormant  UMETA(DisplayName = "Dormant"),  // nothing ticks; the AI timer is paused
+};
+
+/**
+ * Server-side level of detail for creatures, by distance to the nearest player.
+ *
+ * Creatures register on BeginPlay (authority only). hmvr.Significance.UpdateHz times a second
+ * each one is scored against every player pawn and put in a tier: within NearDistance High,
+ * then Medium, Low, and beyond FarDistance Dormant. A tier sets the actor's and every ticking
+ * component's tick interval (the CharacterMovementComponent and skeletal mesh included), the
+ * mesh's pose ticking, and whether the AI controller's think timer runs. A creature moves to a
+ * more significant tier as soon as a player is inside the threshold and drops back only once
+ * the player is hmvr.Significance.Hysteresis beyond it, so a player on a boundary does not make
+ * it flap. Dormant creatures wake at FarDistance, well outside detection range, so they are
+ * back at full rate before anyone can see or reach them.
+ *
+ * hmvr.Significance.Enabled 0 puts every creature back to High. Counters are printed with
+ * HMVR.Significance.Stats; HMVR.Significance.Bench measures server tick cost with and without.
+ */
+UCLASS()
+class HYPERMAGEVR_API UHMVRCreatureSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterCreature(AHMVRCreature* Creature);
+	void UnregisterCreature(AHMVRCreature* Creature);
+
+	EHMVRSignificance GetSignificance(const AHMVRCreature* Creature) const;
+
+	/** Tier for a creature now in Current whose nearest player is sqrt(NearestDistanceSq) away, hysteresis applied. */
+	static EHMVRSignificance ChooseTier(EHMVRSignificance Current, float NearestDistanceSq);
+
+	/** Score against these points as well as player pawns (headless benchmarks, spectator cameras). */
+	void SetExtraViewpoints(const TArray<FVector>& InViewpoints) { ExtraViewpoints = InViewpoints; }
+
+	struct FStats
+	{
+		int32 Tracked = 0;
+		int32 ByTier[4] = {};
+		int64 Promotions = 0;
+		int64 Demotions = 0;
+		float LastUpdateMs = 0.f;
+	};
+	const FStats& GetStats() const { return Stats; }
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** A ticking component and how it ticked before the subsystem touched it. */
+	struct FComponentTick
+	{
+		TWeakObjectPtr<UActorComponent> Component;
+		float BaseInterval = 0.f;
+		bool bBaseEnabled = true;
+	};
+
+	struct FTrackedCreature
+	{
+		TWeakObjectPtr<AHMVRCreature> Creature;
+		EHMVRSignificance Tier = EHMVRSignificance::High;
+		float BaseActorInterval = 0.f;
+		bool bBaseActorEnabled = true;
+		EVisibilityBasedAnimTickOption BaseAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+		TArray<FComponentTick> Components;
+	};
+
+	void UpdateSignificance();
+	void ApplyTier(FTrackedCreature& Tracked, EHMVRSignificance Tier);
+	void RestoreAll();
+
+	TArray<FTrackedCreature> Tracked;
+	TArray<FVector> ExtraViewpoints;
+	TArray<FVector> Viewpoints; // scratch, per update
+	double NextUpdateTime = 0.0;
+	bool bWasEnabled = true;
+	FStats Stats;
+};
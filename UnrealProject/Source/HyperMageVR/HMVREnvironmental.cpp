@@ -4,6 +4,11 @@
 #include "Components/SphereComponent.h"
 #include "GameFramework/PlayerController.h"
 
+namespace
+{
+	const FName SequenceEvent(TEXT("SequenceComplete"));
+}
+
 AHMVREnvironmental::AHMVREnvironmental()
 {
 	bReplicates = true;
@@ -19,6 +24,7 @@ AHMVREnvironmental::AHMVREnvironmental()
 	TriggerSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 
 	Interactable = CreateDefaultSubobject<UHMVRInteractableComponent>(TEXT("Interactable"));
+	Interactable->StateMachine = TEXT("Environmental");
 }
 
 void AHMVREnvironmental::BeginPlay()
@@ -38,6 +44,13 @@ void AHMVREnvironmental::BeginPlay()
 	if (HasAuthority())
 	{
 		Interactable->LoadState();
+
+		// A previous process died mid-sequence: let it run out
+		if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+		{
+			SequenceTimerHandle = Timers->ResumePersisted(this, SequenceEvent, Interactable->ObjectId);
+			bTriggered = SequenceTimerHandle.IsValid();
+		}
 	}
 }
 
@@ -68,18 +81,67 @@ void AHMVREnvironmental::Trigger(AActor* TriggerSource)
 	if (Interactable->GetState() == EInteractableState::Resolved) return;
 
 	bTriggered = true;
-	Interactable->TransitionTo(EInteractableState::Active);
-	BP_OnTriggered(TriggerSource);
+	if (Interactable->GetState() == EInteractableState::Active)
+	{
+		// Re-triggered mid-sequence (not one-shot): no transition, the sequence starts over
+		BP_OnTriggered(TriggerSource);
+		StartSequence();
+		return;
+	}
+	if (!PendingTriggerSource.IsValid())
+	{
+		PendingTriggerSource = TriggerSource;
+	}
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Interact);
+}
+
+void AHMVREnvironmental::OnGmHook(FName HookId, const FString& Argument)
+{
+	Trigger(nullptr);
+}
+
+void AHMVREnvironmental::StartSequence()
+{
+	if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+	{
+		Timers->Cancel(SequenceTimerHandle);
+		SequenceTimerHandle = Timers->Schedule(this, SequenceEvent, EventSequenceDuration, Interactable->ObjectId);
+	}
+}
 
-	GetWorldTimerManager().SetTimer(SequenceTimerHandle, this,
-	                                &AHMVREnvironmental::OnSequenceComplete,
-	                                EventSequenceDuration, false);
+void AHMVREnvironmental::OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState)
+{
+	const EInteractableState NewState = Interactable->GetState();
+	if (NewState == EInteractableState::Active)
+	{
+		BP_OnTriggered(PendingTriggerSource.Get());
+		PendingTriggerSource.Reset();
+		StartSequence();
+	}
+	else if (NewState == EInteractableState::Resolved)
+	{
+		BP_OnResolved();
+	}
 }
 
-void AHMVREnvironmental::OnSequenceComplete()
+void AHMVREnvironmental::OnSessionReset()
 {
-	Interactable->TransitionTo(EInteractableState::Resolved);
-	BP_OnResolved();
+	if (!HasAuthority()) return;
+	if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+	{
+		Timers->Cancel(SequenceTimerHandle);
+	}
+	bTriggered = false;
+	PendingTriggerSource.Reset();
+}
+
+void AHMVREnvironmental::OnGameplayTimer(FName Event)
+{
+	if (Event == SequenceEvent)
+	{
+		SequenceTimerHandle.Invalidate();
+		Interactable->RaiseEvent(EHMVRInteractableEvent::TimerDone);
+	}
 }
 
 void AHMVREnvironmental::OnInteractableStateChanged(EInteractableState NewState)
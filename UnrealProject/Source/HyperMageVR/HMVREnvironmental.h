@@ -6,12 +6,13 @@
 #include "GameFramework/Actor.h"
 #include "HMVRInteractable.h"
 #include "HMVRInteractableComponent.h"
+#include "HMVRGameplayTimers.h"
 #include "HMVREnvironmental.generated.h"
 
 class USphereComponent;
 
 UCLASS()
-class HYPERMAGEVR_API AHMVREnvironmental : public AActor, public IHMVRInteractable
+class HYPERMAGEVR_API AHMVREnvironmental : public AActor, public IHMVRInteractable, public IHMVRGameplayTimerTarget
 {
 	GENERATED_BODY()
 
@@ -23,6 +24,12 @@ public:
 	virtual void OnPlayerInteract(APlayerController* Player) override;
 	virtual void OnDamageReceived(float Amount, AActor* Source) override {}
 	virtual void OnCollected(APlayerController* Player) override {}
+	virtual void OnSessionReset() override;
+	virtual void OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState) override;
+	virtual void OnGmHook(FName HookId, const FString& Argument) override;
+
+	// IHMVRGameplayTimerTarget
+	virtual void OnGameplayTimer(FName Event) override;
 
 	// Trigger the event sequence. Can be called externally (e.g. by a puzzle system).
 	UFUNCTION(BlueprintCallable, Category="Environmental")
@@ -64,16 +71,19 @@ protected:
 
 private:
 	bool bTriggered = false;
-	FTimerHandle SequenceTimerHandle;
+	// Keyed by the interactable ObjectId, so a sequence in progress survives a server restart
+	FHMVRGameplayTimerHandle SequenceTimerHandle;
+
+	// Server — who triggered, for BP_OnTriggered once the state machine applies it
+	TWeakObjectPtr<AActor> PendingTriggerSource;
+
+	void StartSequence();
 
 	UFUNCTION()
 	void OnTriggerOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
 	                           UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
 	                           bool bFromSweep, const FHitResult& SweepResult);
 
-	UFUNCTION()
-	void OnSequenceComplete();
-
 	UFUNCTION()
 	void OnInteractableStateChanged(EInteractableState NewState);
 };
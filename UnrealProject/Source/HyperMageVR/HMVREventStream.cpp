@@ -0,0 +1,233 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVREventStream.h"
+#include "SessionAPIClient.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarEventsRingCapacity(
+	TEXT("hmvr.Events.RingCapacity"),
+	4096,
+	TEXT("Interaction events buffered between TrackEvent and the sender (rounded up to a power of two; read at startup)."));
+
+static TAutoConsoleVariable<float> CVarEventsFlushInterval(
+	TEXT("hmvr.Events.FlushIntervalSeconds"),
+	0.25f,
+	TEXT("How often buffered interaction events are batched and sent."));
+
+static TAutoConsoleVariable<int32> CVarEventsBatchSize(
+	TEXT("hmvr.Events.BatchSize"),
+	100,
+	TEXT("Interaction events per POST /interaction-events."));
+
+static TAutoConsoleVariable<float> CVarEventsBatchTimeout(
+	TEXT("hmvr.Events.BatchTimeoutSeconds"),
+	60.f,
+	TEXT("A batch with no outcome after this long is counted failed and no longer holds an in-flight slot."));
+
+static TAutoConsoleVariable<int32> CVarEventsMaxInFlight(
+	TEXT("hmvr.Events.MaxInFlightBatches"),
+	4,
+	TEXT("Batches serialising or awaiting the Session API before the sender stops draining and the ring fills."));
+
+namespace
+{
+	constexpr int32 MaxTimedOutBatches = 64;
+}
+
+FHMVREventStream::FHMVREventStream()
+	: Ring(static_cast<uint32>(FMath::Max(2, CVarEventsRingCapacity.GetValueOnAnyThread())))
+{
+}
+
+FHMVREventStream::~FHMVREventStream()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+void FHMVREventStream::Start(FSendFn InSend)
+{
+	Send = MoveTemp(InSend);
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FHMVREventStream::Tick),
+			FMath::Max(0.01f, CVarEventsFlushInterval.GetValueOnGameThread()));
+	}
+}
+
+bool FHMVREventStream::Push(FInteractionEvent&& Event)
+{
+	if (!Ring.TryPush(MoveTemp(Event)))
+	{
+		DroppedFull.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	Pushed.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+bool FHMVREventStream::Tick(float /*DeltaTime*/)
+{
+	const double Now = FPlatformTime::Seconds();
+	TArray<uint32> Lapsed;
+	for (const TPair<uint32, FInFlightBatch>& Entry : InFlight)
+	{
+		if (Now >= Entry.Value.Deadline)
+		{
+			Lapsed.Add(Entry.Key);
+		}
+	}
+	for (uint32 BatchId : Lapsed)
+	{
+		TimedOut.Add(BatchId, InFlight[BatchId].NumEvents);
+		OnBatchDone(BatchId, false);
+	}
+
+	// Batch ids only grow, so the smallest is the oldest
+	while (TimedOut.Num() > MaxTimedOutBatches)
+	{
+		uint32 Oldest = MAX_uint32;
+		for (const TPair<uint32, int32>& Entry : TimedOut)
+		{
+			Oldest = FMath::Min(Oldest, Entry.Key);
+		}
+		TimedOut.Remove(Oldest);
+	}
+
+	Drain(false);
+	return true;
+}
+
+void FHMVREventStream::Flush()
+{
+	Drain(true);
+}
+
+void FHMVREventStream::FlushSync()
+{
+	Drain(true, /*bSynchronous=*/true);
+}
+
+void FHMVREventStream::Drain(bool bIgnoreInFlightCap, bool bSynchronous)
+{
+	check(IsInGameThread());
+	Stats.PeakDepth = FMath::Max(Stats.PeakDepth, Ring.ApproxNum());
+
+	const int32 BatchSize = FMath::Max(1, CVarEventsBatchSize.GetValueOnGameThread());
+	const int32 MaxInFlight = FMath::Max(1, CVarEventsMaxInFlight.GetValueOnGameThread());
+
+	while (bIgnoreInFlightCap || InFlight.Num() < MaxInFlight)
+	{
+		TArray<FInteractionEvent> Batch;
+		Batch.Reserve(BatchSize);
+		FInteractionEvent Event;
+		while (Batch.Num() < BatchSize && Ring.TryPop(Event))
+		{
+			Batch.Add(MoveTemp(Event));
+		}
+		if (Batch.Num() == 0)
+		{
+			return;
+		}
+
+		const uint32 BatchId = NextBatchId++;
+		FInFlightBatch& Entry = InFlight.Add(BatchId);
+		Entry.NumEvents = Batch.Num();
+		Entry.Deadline = FPlatformTime::Seconds() + FMath::Max(1.f, CVarEventsBatchTimeout.GetValueOnGameThread());
+		++Stats.Batches;
+
+		if (bSynchronous)
+		{
+			SendBatch(BatchId, USessionAPIClient::SerializeInteractionEvents(Batch), Batch.Num());
+			continue;
+		}
+
+		// JSON building is the expensive part; keep it off the game thread
+		TWeakPtr<FHMVREventStream> WeakThis = AsShared();
+		Async(EAsyncExecution::ThreadPool, [WeakThis, BatchId, Batch = MoveTemp(Batch)]()
+		{
+			FString Body = USessionAPIClient::SerializeInteractionEvents(Batch);
+			const int32 NumEvents = Batch.Num();
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, BatchId, Body = MoveTemp(Body), NumEvents]()
+			{
+				if (TSharedPtr<FHMVREventStream> This = WeakThis.Pin())
+				{
+					This->SendBatch(BatchId, Body, NumEvents);
+				}
+			});
+		});
+	}
+}
+
+void FHMVREventStream::SendBatch(uint32 BatchId, const FString& JsonBody, int32 NumEvents)
+{
+	if (!InFlight.Contains(BatchId))
+	{
+		TimedOut.Remove(BatchId); // timed out while serialising; never sent, so it stays failed
+		return;
+	}
+
+	TWeakPtr<FHMVREventStream> WeakThis = AsShared();
+	auto OnDone = [WeakThis, BatchId](bool bAccepted)
+	{
+		if (TSharedPtr<FHMVREventStream> This = WeakThis.Pin())
+		{
+			This->OnBatchDone(BatchId, bAccepted);
+		}
+	};
+
+	if (!Send || !Send(JsonBody, NumEvents, OnDone))
+	{
+		OnBatchDone(BatchId, false);
+	}
+}
+
+void FHMVREventStream::OnBatchDone(uint32 BatchId, bool bAccepted)
+{
+	FInFlightBatch Batch;
+	if (!InFlight.RemoveAndCopyValue(BatchId, Batch))
+	{
+		// Counted failed when it timed out; a late success moves its events back to sent
+		int32 LateEvents = 0;
+		if (TimedOut.RemoveAndCopyValue(BatchId, LateEvents) && bAccepted)
+		{
+			Stats.Failed -= LateEvents;
+			Stats.Sent += LateEvents;
+			Stats.LateSent += LateEvents;
+		}
+		return;
+	}
+
+	const int32 NumEvents = Batch.NumEvents;
+	if (bAccepted)
+	{
+		Stats.Sent += NumEvents;
+	}
+	else
+	{
+		Stats.Failed += NumEvents;
+		UE_LOG(LogTemp, Warning, TEXT("HMVREventStream: Batch of %d interaction events was not accepted — dropped"), NumEvents);
+	}
+}
+
+FHMVREventStream::FStats FHMVREventStream::GetStats() const
+{
+	FStats Out = Stats;
+	Out.InFlightBatches = InFlight.Num();
+	Out.Pushed = Pushed.load(std::memory_order_relaxed);
+	Out.DroppedFull = DroppedFull.load(std::memory_order_relaxed);
+	return Out;
+}
+
+void FHMVREventStream::LogStats() const
+{
+	const FStats Out = GetStats();
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVREventStream: %lld pushed, %lld sent (%lld after timing out), %lld failed, %lld dropped (ring full); %d buffered (peak %d of %u), %d batches in flight, %lld batches total"),
+		Out.Pushed, Out.Sent, Out.LateSent, Out.Failed, Out.DroppedFull, Ring.ApproxNum(), Out.PeakDepth, Ring.GetCapacity(),
+		Out.InFlightBatches, Out.Batches);
+}
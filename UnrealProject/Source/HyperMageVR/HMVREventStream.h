@@ -0,0 +1,94 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HMVRBoundedRing.h"
+#include "SessionManager.h"
+
+/**
+ * Streams interaction events to the Session API while the session runs, instead of holding
+ * them per session until logout.
+ *
+ * Push() appends to a fixed-size lock-free ring (hmvr.Events.RingCapacity, read at
+ * construction) from any thread. Every hmvr.Events.FlushIntervalSeconds a core ticker drains
+ * up to hmvr.Events.BatchSize events per batch; the batch is serialised on the thread pool and
+ * posted back on the game thread through the Send function, so memory held for events is the
+ * ring and the batches in flight, however long a session lasts.
+ *
+ * Back-pressure: at most hmvr.Events.MaxInFlightBatches batches are serialising or awaiting
+ * their HTTP outcome. Beyond that the ring is left to fill, and once it is full new events are
+ * dropped at Push and counted — the game thread never blocks on telemetry. A batch shed by the
+ * HTTP dispatcher's telemetry limit completes as not accepted and frees its slot at once; one
+ * with no outcome after hmvr.Events.BatchTimeoutSeconds is counted failed and frees it too,
+ * and is moved back to sent if the API accepts it afterwards.
+ */
+class HYPERMAGEVR_API FHMVREventStream : public TSharedFromThis<FHMVREventStream>
+{
+public:
+	/** Game thread: post one serialised batch; OnDone(true) once the API accepted it. */
+	using FSendFn = TFunction<bool(const FString& /*JsonBody*/, int32 /*NumEvents*/, TFunction<void(bool)> /*OnDone*/)>;
+
+	FHMVREventStream();
+	~FHMVREventStream();
+
+	/** Call once after construction (needs a shared pointer to itself). */
+	void Start(FSendFn InSend);
+
+	/** Any thread. False (event dropped and counted) when the ring is full. */
+	bool Push(FInteractionEvent&& Event);
+
+	/** Game thread: drain everything now regardless of the in-flight cap. */
+	void Flush();
+
+	/**
+	 * Game thread: as Flush, but serialise and hand every batch to Send before returning instead
+	 * of round-tripping through the thread pool and the game-thread queue, which may not run again
+	 * (session end, EndPlay).
+	 */
+	void FlushSync();
+
+	struct FStats
+	{
+		int64 Pushed = 0;
+		int64 DroppedFull = 0;
+		int64 Sent = 0;
+		int64 Failed = 0;
+		int64 LateSent = 0;    // included in Sent: accepted after the batch had timed out
+		int64 Batches = 0;
+		int32 InFlightBatches = 0;
+		int32 PeakDepth = 0;
+	};
+	FStats GetStats() const;
+	void LogStats() const;
+
+private:
+	bool Tick(float DeltaTime);
+	void Drain(bool bIgnoreInFlightCap, bool bSynchronous = false);
+	void SendBatch(uint32 BatchId, const FString& JsonBody, int32 NumEvents);
+	void OnBatchDone(uint32 BatchId, bool bAccepted);
+
+	struct FInFlightBatch
+	{
+		int32 NumEvents = 0;
+		double Deadline = 0.0;
+	};
+
+	THMVRBoundedRing<FInteractionEvent> Ring;
+	FSendFn Send;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	// Producer-side counters (any thread)
+	std::atomic<int64> Pushed { 0 };
+	std::atomic<int64> DroppedFull { 0 };
+
+	// Game thread
+	TMap<uint32, FInFlightBatch> InFlight;
+	uint32 NextBatchId = 1;
+
+	// Event counts of batches that timed out, by batch id, so a late success is reconciled.
+	// Oldest dropped past a fixed count: a completion that never fires must not pin entries.
+	TMap<uint32, int32> TimedOut;
+	FStats Stats;
+};
@@ -3,19 +3,21 @@
 #include "HMVRGameInstance.h"
 #include "HMVRLoginWidget.h"
 #include "HMVRSaveGame.h"
+#include "HMVRApiEndpoints.h"
+#include "HMVRLocalApiStub.h"
 #include "JWTValidator.h"
 #include "VoiceChatInterface.h"
 #include "MockVoiceProvider.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
-#if WITH_GAMELIFT
-#include "GameLiftServerSDK.h"
-#endif
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Components/StereoLayerComponent.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Slate/WidgetRenderer.h"
+#include "HMVRHttpDispatcher.h"
+#include "HMVRMatchmakingStatusClient.h"
+#include "HMVRJoinPrewarmer.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -31,16 +33,29 @@ void UHMVRGameInstance::Init()
 {
 	Super::Init();
 
+#if WITH_HMVR_API_STUB
+	// In-process stand-in for the Session / world-state APIs. Only the process that hosts the
+	// game serves it: a dedicated server here, a standalone or listen-server game from
+	// AHMVRGameMode::InitGame. A client joining with the same -LocalApiStub=<port> uses the
+	// host's stub instead of failing to bind the port a second time.
+	if (FHMVRApiEndpoints::IsLocalStubRequested() && IsRunningDedicatedServer())
+	{
+		FHMVRLocalApiStub::Get().Start(FHMVRApiEndpoints::GetLocalStubPort());
+	}
+#endif
+
+	SessionApiBaseUrl = FHMVRApiEndpoints::GetSessionApiUrl();
+
 	if (IsRunningDedicatedServer())
 	{
-#if WITH_GAMELIFT
 		InitializeGameLift();
-#endif
 		return;
 	}
 
 	TryAutoLogin();
 
+	JoinPrewarmer = NewObject<UHMVRJoinPrewarmer>(this);
+
 	// Initialize voice chat manager with mock provider
 	VoiceChatManager = NewObject<UVoiceChatManager>(this);
 	if (VoiceChatManager)
@@ -79,6 +94,11 @@ void UHMVRGameInstance::Shutdown()
 {
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Shutting down"));
 
+	if (MatchmakingStatusClient)
+	{
+		MatchmakingStatusClient->Stop();
+	}
+
 	if (VoiceChatManager)
 	{
 		VoiceChatManager->Shutdown();
@@ -90,63 +110,93 @@ void UHMVRGameInstance::Shutdown()
 
 void UHMVRGameInstance::InitializeGameLift()
 {
-#if !WITH_GAMELIFT
-	// No-op on client builds — GameLift SDK is server-only
-}
-#else
-	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Initializing GameLift SDK"));
-
-	GameLiftSdkModule = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
-
-	auto InitSDKOutcome = GameLiftSdkModule->InitSDK();
-	if (!InitSDKOutcome.IsSuccess())
+	// Real SDK on WITH_GAMELIFT builds, the in-process fake with -FakeGameLift, otherwise nothing
+	GameLiftBackend = IHMVRGameLiftBackend::Create();
+	if (!GameLiftBackend)
 	{
-		UE_LOG(LogTemp, Error, TEXT("HMVRGameInstance: GameLift InitSDK failed: %s"),
-			*InitSDKOutcome.GetError().m_errorMessage);
 		return;
 	}
 
-	FProcessParameters ProcessParams;
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Initializing GameLift (%s backend)"), GameLiftBackend->GetName());
 
-	ProcessParams.OnStartGameSession.BindLambda([this](Aws::GameLift::Server::Model::GameSession GameSession)
+	FString Error;
+	if (!GameLiftBackend->InitSDK(Error))
 	{
-		GameLiftSessionId = FString(GameSession.GetGameSessionId());
-		UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: GameLift game session started: %s"), *GameLiftSessionId);
-		GameLiftSdkModule->ActivateGameSession();
-	});
+		UE_LOG(LogTemp, Error, TEXT("HMVRGameInstance: GameLift InitSDK failed: %s"), *Error);
+		return;
+	}
 
-	ProcessParams.OnUpdateGameSession.BindLambda([](Aws::GameLift::Server::Model::UpdateGameSession)
+	CycleStartTime = GStartTime;
+	if (!ReportProcessReady())
 	{
-		// Backfill not supported
-	});
+		return;
+	}
+
+	bGameLiftInitialized = true;
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: GameLift SDK initialized and ProcessReady called"));
+}
 
-	ProcessParams.OnHealthCheck.BindLambda([]() { return true; });
+bool UHMVRGameInstance::ReportProcessReady()
+{
+	TWeakObjectPtr<UHMVRGameInstance> WeakThis(this);
 
-	ProcessParams.OnTerminate.BindLambda([this]()
+	FHMVRGameLiftProcessCallbacks Callbacks;
+	Callbacks.OnStartGameSession = [WeakThis](const FString& GameSessionId)
+	{
+		if (UHMVRGameInstance* This = WeakThis.Get())
+		{
+			This->HandleGameSessionStarted(GameSessionId);
+		}
+	};
+	Callbacks.OnHealthCheck = [Healthy = ServerHealthy]() { return Healthy->load(std::memory_order_relaxed); };
+	Callbacks.OnTerminate = [WeakThis]()
 	{
 		UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: GameLift process terminating"));
-		if (GameLiftSdkModule)
+		if (UHMVRGameInstance* This = WeakThis.Get())
 		{
-			GameLiftSdkModule->ProcessEnding();
+			FString Error;
+			if (This->GameLiftBackend)
+			{
+				This->GameLiftBackend->ProcessEnding(Error);
+			}
 		}
 		FGenericPlatformMisc::RequestExit(false);
-	});
+	};
+
+	FString Error;
+	if (!GameLiftBackend->ProcessReady(Callbacks, 7777, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRGameInstance: GameLift ProcessReady failed: %s"), *Error);
+		return false;
+	}
 
-	ProcessParams.port = 7777;
-	ProcessParams.logParameters.Add(TEXT("/local/game/logs/myserver.log"));
+	ProcessReadyTime = FPlatformTime::Seconds();
+	return true;
+}
+
+void UHMVRGameInstance::HandleGameSessionStarted(const FString& GameSessionId)
+{
+	GameLiftSessionId = GameSessionId;
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: GameLift game session started: %s"), *GameLiftSessionId);
 
-	auto ProcessReadyOutcome = GameLiftSdkModule->ProcessReady(ProcessParams);
-	if (!ProcessReadyOutcome.IsSuccess())
+	FString Error;
+	if (!GameLiftBackend->ActivateGameSession(Error))
 	{
-		UE_LOG(LogTemp, Error, TEXT("HMVRGameInstance: GameLift ProcessReady failed: %s"),
-			*ProcessReadyOutcome.GetError().m_errorMessage);
+		UE_LOG(LogTemp, Error, TEXT("HMVRGameInstance: ActivateGameSession failed: %s"), *Error);
 		return;
 	}
 
-	bGameLiftInitialized = true;
-	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: GameLift SDK initialized and ProcessReady called"));
+	// Ready = ProcessReady reported; the gap to activation is placement, which GameLift controls
+	const double Now = FPlatformTime::Seconds();
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRGameInstance: SessionStart: session %s — ready %.0f ms after process start, active %.0f ms after ready (%.0f ms total)"),
+		*GameLiftSessionId,
+		(ProcessReadyTime - CycleStartTime) * 1000.0,
+		(Now - ProcessReadyTime) * 1000.0,
+		(Now - CycleStartTime) * 1000.0);
+
+	OnGameLiftSessionStarted.Broadcast(GameLiftSessionId);
 }
-#endif // WITH_GAMELIFT
 
 // ── Auto-login (refresh token persistence) ────────────────────────────────────
 
@@ -209,7 +259,7 @@ void UHMVRGameInstance::TryAutoLogin()
 	Req->SetHeader(TEXT("X-Amz-Target"), TEXT("AWSCognitoIdentityProviderService.InitiateAuth"));
 	Req->SetContentAsString(BodyString);
 	Req->OnProcessRequestComplete().BindUObject(this, &UHMVRGameInstance::OnTokenRefreshResponse);
-	Req->ProcessRequest();
+	FHMVRHttpDispatcher::Get().Submit(Req, EHMVRHttpPriority::Critical);
 }
 
 void UHMVRGameInstance::OnTokenRefreshResponse(FHttpRequestPtr /*Request*/, FHttpResponsePtr Response, bool bConnectedSuccessfully)
@@ -321,7 +371,7 @@ void UHMVRGameInstance::Login(const FString& Username, const FString& Password)
 	Req->SetHeader(TEXT("X-Amz-Target"), TEXT("AWSCognitoIdentityProviderService.InitiateAuth"));
 	Req->SetContentAsString(BodyString);
 	Req->OnProcessRequestComplete().BindUObject(this, &UHMVRGameInstance::OnLoginResponse);
-	Req->ProcessRequest();
+	FHMVRHttpDispatcher::Get().Submit(Req, EHMVRHttpPriority::Critical);
 
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Login attempt for '%s'"), *Username);
 }
@@ -587,6 +637,12 @@ void UHMVRGameInstance::StartMatchmaking()
 	}
 	OnMatchmakingStatusChanged.Broadcast(TEXT("SEARCHING"));
 
+	// Overlap map/asset streaming with the queue time
+	if (JoinPrewarmer)
+	{
+		JoinPrewarmer->BeginPrewarm();
+	}
+
 	FString RequestPlayerId = PlayerId.IsEmpty() ? FGuid::NewGuid().ToString() : PlayerId;
 
 	TSharedRef<FJsonObject> RequestBody = MakeShared<FJsonObject>();
@@ -608,7 +664,7 @@ void UHMVRGameInstance::StartMatchmaking()
 	HttpRequest->SetHeader(TEXT("Authorization"), JWTToken);
 	HttpRequest->SetContentAsString(BodyString);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UHMVRGameInstance::OnStartMatchmakingResponse);
-	HttpRequest->ProcessRequest();
+	FHMVRHttpDispatcher::Get().Submit(HttpRequest, EHMVRHttpPriority::Critical);
 }
 
 void UHMVRGameInstance::OnStartMatchmakingResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
@@ -635,75 +691,26 @@ void UHMVRGameInstance::OnStartMatchmakingResponse(FHttpRequestPtr Request, FHtt
 	}
 
 	MatchmakingTicketId = JsonObject->GetStringField(TEXT("ticketId"));
-	MatchmakingPollAttempt = 0;
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Matchmaking started, ticket: %s"), *MatchmakingTicketId);
 
-	if (UWorld* World = GetWorld())
+	if (!MatchmakingStatusClient)
 	{
-		World->GetTimerManager().SetTimer(
-			MatchmakingPollTimerHandle,
-			this,
-			&UHMVRGameInstance::PollMatchmakingStatus,
-			3.0f,
-			true,
-			3.0f
-		);
+		MatchmakingStatusClient = NewObject<UHMVRMatchmakingStatusClient>(this);
+		MatchmakingStatusClient->OnStatus.BindUObject(this, &UHMVRGameInstance::OnMatchmakingStatusUpdate);
+		MatchmakingStatusClient->OnTimedOut.BindUObject(this, &UHMVRGameInstance::OnMatchmakingStatusTimedOut);
 	}
+	MatchmakingStatusClient->Start(SessionApiBaseUrl, MatchmakingTicketId, JWTToken, MatchmakingTimeoutSeconds);
 }
 
-void UHMVRGameInstance::PollMatchmakingStatus()
+void UHMVRGameInstance::OnMatchmakingStatusTimedOut()
 {
-	if (MatchmakingTicketId.IsEmpty())
-	{
-		return;
-	}
-
-	if (MatchmakingPollAttempt >= MaxMatchmakingPollAttempts)
-	{
-		if (UWorld* World = GetWorld())
-		{
-			World->GetTimerManager().ClearTimer(MatchmakingPollTimerHandle);
-		}
-		OnMatchmakingFailure(TEXT("Matchmaking timed out after 2 minutes"));
-		return;
-	}
-
-	++MatchmakingPollAttempt;
-
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetURL(FString::Printf(TEXT("%s/matchmaking/status/%s"), *SessionApiBaseUrl, *MatchmakingTicketId));
-	HttpRequest->SetVerb(TEXT("GET"));
-	HttpRequest->SetHeader(TEXT("Authorization"), JWTToken);
-	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UHMVRGameInstance::OnMatchmakingStatusResponse);
-	HttpRequest->ProcessRequest();
+	OnMatchmakingFailure(TEXT("Matchmaking timed out after 2 minutes"));
 }
 
-void UHMVRGameInstance::OnMatchmakingStatusResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+void UHMVRGameInstance::OnMatchmakingStatusUpdate(const FString& Status, const TSharedPtr<FJsonObject>& JsonObject)
 {
-	// Non-200 responses are non-fatal — keep polling on next timer tick
-	if (!bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() != 200)
-	{
-		return;
-	}
-
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-	{
-		return;
-	}
-
-	FString Status = JsonObject->GetStringField(TEXT("status"));
-	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Matchmaking status: %s (attempt %d/%d)"),
-		*Status, MatchmakingPollAttempt, MaxMatchmakingPollAttempts);
-
 	if (Status == TEXT("COMPLETED"))
 	{
-		if (UWorld* World = GetWorld())
-		{
-			World->GetTimerManager().ClearTimer(MatchmakingPollTimerHandle);
-		}
-
 		const TSharedPtr<FJsonObject>* ConnectionInfoObj;
 		if (!JsonObject->TryGetObjectField(TEXT("gameSessionConnectionInfo"), ConnectionInfoObj))
 		{
@@ -737,15 +744,11 @@ void UHMVRGameInstance::OnMatchmakingStatusResponse(FHttpRequestPtr Request, FHt
 	}
 	else if (Status == TEXT("FAILED") || Status == TEXT("TIMED_OUT") || Status == TEXT("CANCELLED"))
 	{
-		if (UWorld* World = GetWorld())
-		{
-			World->GetTimerManager().ClearTimer(MatchmakingPollTimerHandle);
-		}
 		FString Reason;
 		JsonObject->TryGetStringField(TEXT("statusReason"), Reason);
 		OnMatchmakingFailure(FString::Printf(TEXT("Matchmaking %s: %s"), *Status, *Reason));
 	}
-	// SEARCHING / PLACING / REQUIRES_ACCEPTANCE — keep polling via timer
+	// SEARCHING / PLACING / REQUIRES_ACCEPTANCE — status client keeps watching
 }
 
 void UHMVRGameInstance::CancelMatchmaking()
@@ -756,10 +759,10 @@ void UHMVRGameInstance::CancelMatchmaking()
 		return;
 	}
 
-	// Stop polling before sending cancel so we don't act on stale status responses
-	if (UWorld* World = GetWorld())
+	// Stop watching before sending cancel so we don't act on stale status responses
+	if (MatchmakingStatusClient)
 	{
-		World->GetTimerManager().ClearTimer(MatchmakingPollTimerHandle);
+		MatchmakingStatusClient->Stop();
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Cancelling matchmaking: %s"), *MatchmakingTicketId);
@@ -769,9 +772,13 @@ void UHMVRGameInstance::CancelMatchmaking()
 	HttpRequest->SetVerb(TEXT("DELETE"));
 	HttpRequest->SetHeader(TEXT("Authorization"), JWTToken);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UHMVRGameInstance::OnCancelMatchmakingResponse);
-	HttpRequest->ProcessRequest();
+	FHMVRHttpDispatcher::Get().Submit(HttpRequest, EHMVRHttpPriority::Critical);
 
 	MatchmakingTicketId.Empty();
+	if (JoinPrewarmer)
+	{
+		JoinPrewarmer->Release();
+	}
 
 	OnMatchmakingStatusChanged.Broadcast(TEXT("CANCELLED"));
 	if (ActiveStatusWidget && IsValid(ActiveStatusWidget))
@@ -801,6 +808,10 @@ void UHMVRGameInstance::ConnectToGameServer(const FString& ServerAddress, int32
 		TravelURL += FString::Printf(TEXT("?PlayerSessionId=%s"), *PlayerSessionId);
 	}
 
+	if (JoinPrewarmer)
+	{
+		JoinPrewarmer->OnTravelStarted();
+	}
 	UGameplayStatics::OpenLevel(this, FName(*TravelURL), true);
 }
 
@@ -815,6 +826,11 @@ void UHMVRGameInstance::OnMatchmakingSuccess(const FString& ServerAddress, int32
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameInstance: Matchmaking successful - Server: %s:%d, Session: %s"),
 		*ServerAddress, Port, *SessionId);
 
+	if (JoinPrewarmer)
+	{
+		JoinPrewarmer->OnMatchCompleted(ServerAddress);
+	}
+
 	OnMatchmakingStatusChanged.Broadcast(TEXT("COMPLETED"));
 
 	if (UHMVRStatusWidget* Widget = EnsureStatusWidget())
@@ -831,6 +847,10 @@ void UHMVRGameInstance::OnMatchmakingFailure(const FString& ErrorMessage)
 	UE_LOG(LogTemp, Error, TEXT("HMVRGameInstance: Matchmaking failed - %s"), *ErrorMessage);
 
 	MatchmakingTicketId.Empty();
+	if (JoinPrewarmer)
+	{
+		JoinPrewarmer->Release();
+	}
 
 	OnMatchmakingError.Broadcast(ErrorMessage);
 
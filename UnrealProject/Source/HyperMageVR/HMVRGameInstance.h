@@ -9,12 +9,15 @@
 #include "HMVRLoginWidget.h"
 #include "HMVRSaveGame.h"
 #include "Http.h"
+#include "HMVRGameLiftBackend.h"
 #include "HMVRGameInstance.generated.h"
 
-class FGameLiftServerSDKModule; // incomplete type; only used as pointer — no header needed
 class UStereoLayerComponent;
 class UTextureRenderTarget2D;
 class FWidgetRenderer;
+class FJsonObject;
+class UHMVRMatchmakingStatusClient;
+class UHMVRJoinPrewarmer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAutoLoginComplete, bool, bSuccess, const FString&, ErrorMessage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLoginResult,      bool, bSuccess, const FString&, ErrorMessage);
@@ -22,6 +25,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMatchmakingStatusChanged, const F
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMatchmakingError,         const FString&, ErrorMessage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnConnectionEstablished);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnConnectionError, const FString&, ErrorMessage);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnGameLiftSessionStarted, const FString& /*GameSessionId*/);
 
 /**
  * Game Instance for managing session state and authentication.
@@ -170,10 +174,10 @@ protected:
 	void OnMatchmakingSuccess(const FString& ServerAddress, int32 Port, const FString& SessionId);
 	void OnMatchmakingFailure(const FString& ErrorMessage);
 
-	// Matchmaking HTTP polling
-	void PollMatchmakingStatus();
+	// Matchmaking HTTP
 	void OnStartMatchmakingResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
-	void OnMatchmakingStatusResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
+	void OnMatchmakingStatusUpdate(const FString& Status, const TSharedPtr<FJsonObject>& JsonObject);
+	void OnMatchmakingStatusTimedOut();
 	void OnCancelMatchmakingResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
 
 	// Connection callbacks
@@ -191,19 +195,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voice Chat")
 	UVoiceChatManager* GetVoiceChatManager() const { return VoiceChatManager; }
 
-	// GameLift SDK access for game mode (server only; no-op on client builds)
-	FGameLiftServerSDKModule* GetGameLiftSdkModule() const { return GameLiftSdkModule; }
+	// GameLift access for game mode (dedicated server; null unless built WITH_GAMELIFT or run with -FakeGameLift)
+	IHMVRGameLiftBackend* GetGameLiftBackend() const { return GameLiftBackend.Get(); }
 	bool IsGameLiftInitialized() const { return bGameLiftInitialized; }
 	FString GetGameLiftSessionId() const { return GameLiftSessionId; }
 
+	// Game thread: GameLift placed a game session on this process and it has been activated
+	FOnGameLiftSessionStarted OnGameLiftSessionStarted;
+
+	// Answer for GameLift's health check (asked from the SDK thread). Clear it only for faults
+	// the process cannot recover from: GameLift terminates an unhealthy process with its
+	// players. Overload is shed through the player session creation policy instead.
+	void SetServerHealthy(bool bHealthy) { ServerHealthy->store(bHealthy, std::memory_order_relaxed); }
+
 protected:
 	void InitializeGameLift();
 
 private:
-	FGameLiftServerSDKModule* GameLiftSdkModule = nullptr;
+	bool ReportProcessReady();
+	void HandleGameSessionStarted(const FString& GameSessionId);
+
+	TUniquePtr<IHMVRGameLiftBackend> GameLiftBackend;
+	TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> ServerHealthy = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(true);
 	bool bGameLiftInitialized = false;
 	FString GameLiftSessionId;
 
+	// Session start latency (FPlatformTime::Seconds). A process hosts one game session: the
+	// SDK does not support ProcessReady again after ProcessEnding.
+	double CycleStartTime = 0.0;
+	double ProcessReadyTime = 0.0;
+
 	// Credential persistence
 	static const FString CredentialsSaveSlot;
 	FString CachedUsername;
@@ -215,10 +236,14 @@ private:
 	FString AutoLoginError;
 	bool bOnStartFired = false;
 
-	// Matchmaking HTTP polling state
-	FTimerHandle MatchmakingPollTimerHandle;
-	int32 MatchmakingPollAttempt = 0;
-	static constexpr int32 MaxMatchmakingPollAttempts = 40; // 2 min at 3s intervals
+	// Matchmaking status — long-poll with adaptive polling fallback
+	UPROPERTY()
+	UHMVRMatchmakingStatusClient* MatchmakingStatusClient = nullptr;
+	static constexpr float MatchmakingTimeoutSeconds = 120.f;
+
+	// Streams gameplay assets during the matchmaking wait and logs join timing
+	UPROPERTY()
+	UHMVRJoinPrewarmer* JoinPrewarmer = nullptr;
 
 	// Login widget retry — defers ShowLoginWidget until PlayerController is spawned
 	FTimerHandle ShowLoginWidgetRetryHandle;
@@ -235,5 +260,6 @@ private:
 	FTimerHandle LoginWidgetUpdateTimerHandle;
 
 	// Session API base URL (POST /matchmaking/start, GET /matchmaking/status/{id}, DELETE /matchmaking/cancel/{id})
-	const FString SessionApiBaseUrl = TEXT("https://fhjoxyk9x5.execute-api.eu-west-1.amazonaws.com/dev");
+	// Resolved in Init() from FHMVRApiEndpoints.
+	FString SessionApiBaseUrl;
 };
@@ -0,0 +1,264 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRGameLiftBackend.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#if WITH_GAMELIFT
+#include "GameLiftServerSDK.h"
+#endif
+
+static TAutoConsoleVariable<float> CVarFakeSessionDelay(
+	TEXT("hmvr.GameLift.FakeSessionDelay"),
+	1.0f,
+	TEXT("Fake GameLift: seconds between ProcessReady and the next OnStartGameSession (placement latency)."));
+
+#if WITH_GAMELIFT
+
+// ── GameLift Server SDK ──────────────────────────────────────────────────────
+
+namespace
+{
+	class FHMVRGameLiftSdkBackend : public IHMVRGameLiftBackend
+	{
+	public:
+		virtual const TCHAR* GetName() const override { return TEXT("sdk"); }
+
+		virtual bool InitSDK(FString& OutError) override
+		{
+			Sdk = &FModuleManager::LoadModuleChecked<FGameLiftServerSDKModule>(FName("GameLiftServerSDK"));
+			auto Outcome = Sdk->InitSDK();
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+		virtual bool ProcessReady(const FHMVRGameLiftProcessCallbacks& InCallbacks, int32 Port, FString& OutError) override
+		{
+			if (!Sdk)
+			{
+				OutError = TEXT("InitSDK not called");
+				return false;
+			}
+
+			// SDK callbacks arrive on its own thread; hop to the game thread with a copy of the callbacks
+			TSharedRef<FHMVRGameLiftProcessCallbacks> Callbacks = MakeShared<FHMVRGameLiftProcessCallbacks>(InCallbacks);
+
+			ProcessParams = MakeUnique<FProcessParameters>();
+			ProcessParams->OnStartGameSession.BindLambda([Callbacks](Aws::GameLift::Server::Model::GameSession GameSession)
+			{
+				const FString GameSessionId(GameSession.GetGameSessionId());
+				AsyncTask(ENamedThreads::GameThread, [Callbacks, GameSessionId]()
+				{
+					if (Callbacks->OnStartGameSession)
+					{
+						Callbacks->OnStartGameSession(GameSessionId);
+					}
+				});
+			});
+			ProcessParams->OnUpdateGameSession.BindLambda([](Aws::GameLift::Server::Model::UpdateGameSession)
+			{
+				// Backfill not supported
+			});
+			ProcessParams->OnHealthCheck.BindLambda([Callbacks]()
+			{
+				return Callbacks->OnHealthCheck ? Callbacks->OnHealthCheck() : true;
+			});
+			ProcessParams->OnTerminate.BindLambda([Callbacks]()
+			{
+				AsyncTask(ENamedThreads::GameThread, [Callbacks]()
+				{
+					if (Callbacks->OnTerminate)
+					{
+						Callbacks->OnTerminate();
+					}
+				});
+			});
+			ProcessParams->port = Port;
+			ProcessParams->logParameters.Add(TEXT("/local/game/logs/myserver.log"));
+
+			auto Outcome = Sdk->ProcessReady(*ProcessParams);
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+		virtual bool ActivateGameSession(FString& OutError) override
+		{
+			auto Outcome = Sdk->ActivateGameSession();
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+		virtual bool AcceptPlayerSession(const FString& PlayerSessionId, FString& OutError) override
+		{
+			auto Outcome = Sdk->AcceptPlayerSession(PlayerSessionId);
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+		virtual bool RemovePlayerSession(const FString& PlayerSessionId, FString& OutError) override
+		{
+			auto Outcome = Sdk->RemovePlayerSession(PlayerSessionId);
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+		virtual bool UpdatePlayerSessionCreationPolicy(bool bAcceptAll, FString& OutError) override
+		{
+			auto Outcome = Sdk->UpdatePlayerSessionCreationPolicy(
+				bAcceptAll ? EPlayerSessionCreationPolicy::ACCEPT_ALL : EPlayerSessionCreationPolicy::DENY_ALL);
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+		virtual bool ProcessEnding(FString& OutError) override
+		{
+			auto Outcome = Sdk->ProcessEnding();
+			return Check(Outcome.IsSuccess(), Outcome, OutError);
+		}
+
+	private:
+		template <typename OutcomeType>
+		static bool Check(bool bSuccess, const OutcomeType& Outcome, FString& OutError)
+		{
+			if (!bSuccess)
+			{
+				OutError = Outcome.GetError().m_errorMessage;
+			}
+			return bSuccess;
+		}
+
+		FGameLiftServerSDKModule* Sdk = nullptr;
+		TUniquePtr<FProcessParameters> ProcessParams;
+	};
+}
+
+#endif // WITH_GAMELIFT
+
+TUniquePtr<IHMVRGameLiftBackend> IHMVRGameLiftBackend::Create()
+{
+	const bool bFake = FParse::Param(FCommandLine::Get(), TEXT("FakeGameLift"));
+#if WITH_GAMELIFT
+	if (!bFake)
+	{
+		return MakeUnique<FHMVRGameLiftSdkBackend>();
+	}
+#endif
+	if (bFake)
+	{
+		return MakeUnique<FHMVRFakeGameLiftBackend>();
+	}
+	return nullptr;
+}
+
+// ── Fake ─────────────────────────────────────────────────────────────────────
+
+FHMVRFakeGameLiftBackend::~FHMVRFakeGameLiftBackend()
+{
+	CancelPendingSession();
+}
+
+void FHMVRFakeGameLiftBackend::CancelPendingSession()
+{
+	if (PendingSessionHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PendingSessionHandle);
+		PendingSessionHandle.Reset();
+	}
+}
+
+bool FHMVRFakeGameLiftBackend::InitSDK(FString& OutError)
+{
+	State = EState::Initialized;
+	UE_LOG(LogTemp, Log, TEXT("HMVRFakeGameLift: InitSDK"));
+	return true;
+}
+
+bool FHMVRFakeGameLiftBackend::ProcessReady(const FHMVRGameLiftProcessCallbacks& InCallbacks, int32 Port, FString& OutError)
+{
+	// Like the SDK: once per process, never after ProcessEnding
+	if (State != EState::Initialized)
+	{
+		OutError = FString::Printf(TEXT("ProcessReady in state %d"), static_cast<int32>(State));
+		return false;
+	}
+
+	Callbacks = InCallbacks;
+	State = EState::SessionPending;
+	AcceptedPlayerSessions.Reset();
+
+	const float Delay = FMath::Max(0.f, CVarFakeSessionDelay.GetValueOnGameThread());
+	UE_LOG(LogTemp, Log, TEXT("HMVRFakeGameLift: ProcessReady on port %d — placing a session in %.2f s"), Port, Delay);
+
+	CancelPendingSession();
+	PendingSessionHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float)
+	{
+		PendingSessionHandle.Reset();
+		const FString GameSessionId = FString::Printf(TEXT("fake-gsess-%d-%s"), ++SessionCounter,
+			*FGuid::NewGuid().ToString(EGuidFormats::Short));
+		UE_LOG(LogTemp, Log, TEXT("HMVRFakeGameLift: OnStartGameSession %s"), *GameSessionId);
+		if (Callbacks.OnStartGameSession)
+		{
+			Callbacks.OnStartGameSession(GameSessionId);
+		}
+		return false;
+	}), Delay);
+	return true;
+}
+
+bool FHMVRFakeGameLiftBackend::ActivateGameSession(FString& OutError)
+{
+	if (State != EState::SessionPending)
+	{
+		OutError = TEXT("no game session to activate");
+		return false;
+	}
+	State = EState::SessionActive;
+	return true;
+}
+
+bool FHMVRFakeGameLiftBackend::AcceptPlayerSession(const FString& PlayerSessionId, FString& OutError)
+{
+	if (State != EState::SessionActive)
+	{
+		OutError = TEXT("no active game session");
+		return false;
+	}
+	if (PlayerSessionId.IsEmpty())
+	{
+		OutError = TEXT("player session id is empty");
+		return false;
+	}
+	bool bAlreadyAccepted = false;
+	AcceptedPlayerSessions.Add(PlayerSessionId, &bAlreadyAccepted);
+	if (bAlreadyAccepted)
+	{
+		OutError = TEXT("player session already accepted");
+		return false;
+	}
+	return true;
+}
+
+bool FHMVRFakeGameLiftBackend::RemovePlayerSession(const FString& PlayerSessionId, FString& OutError)
+{
+	if (AcceptedPlayerSessions.Remove(PlayerSessionId) == 0)
+	{
+		OutError = TEXT("player session not accepted");
+		return false;
+	}
+	return true;
+}
+
+bool FHMVRFakeGameLiftBackend::UpdatePlayerSessionCreationPolicy(bool bAcceptAll, FString& OutError)
+{
+	if (State != EState::SessionActive)
+	{
+		OutError = TEXT("no active game session");
+		return false;
+	}
+	UE_LOG(LogTemp, Log, TEXT("HMVRFakeGameLift: Player session creation policy %s"), bAcceptAll ? TEXT("ACCEPT_ALL") : TEXT("DENY_ALL"));
+	return true;
+}
+
+bool FHMVRFakeGameLiftBackend::ProcessEnding(FString& OutError)
+{
+	CancelPendingSession();
+	AcceptedPlayerSessions.Reset();
+	State = EState::Ended;
+	UE_LOG(LogTemp, Log, TEXT("HMVRFakeGameLift: ProcessEnding"));
+	return true;
+}
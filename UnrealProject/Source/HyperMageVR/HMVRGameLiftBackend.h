@@ -0,0 +1,81 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Callbacks a backend raises after ProcessReady. OnStartGameSession and OnTerminate are
+ * delivered on the game thread; OnHealthCheck may be asked from the SDK's own thread.
+ */
+struct FHMVRGameLiftProcessCallbacks
+{
+	TFunction<void(const FString& /*GameSessionId*/)> OnStartGameSession;
+	TFunction<void()> OnTerminate;
+	TFunction<bool()> OnHealthCheck;
+};
+
+/**
+ * The GameLift server calls the game uses, behind one interface so the session lifecycle —
+ * including recycling a warm process — can run locally without a fleet.
+ *
+ *   FHMVRGameLiftSdkBackend   GameLiftServerSDK (WITH_GAMELIFT builds)
+ *   FHMVRFakeGameLiftBackend  in-process stand-in selected with -FakeGameLift; starts a game
+ *                             session hmvr.GameLift.FakeSessionDelay seconds after each
+ *                             ProcessReady and accepts any non-empty player session id
+ *
+ * Calls return false and set OutError on failure.
+ */
+class HYPERMAGEVR_API IHMVRGameLiftBackend
+{
+public:
+	virtual ~IHMVRGameLiftBackend() = default;
+
+	virtual const TCHAR* GetName() const = 0;
+
+	virtual bool InitSDK(FString& OutError) = 0;
+
+	/** Report the process as able to host a session. Once per process: not valid again after ProcessEnding. */
+	virtual bool ProcessReady(const FHMVRGameLiftProcessCallbacks& Callbacks, int32 Port, FString& OutError) = 0;
+
+	virtual bool ActivateGameSession(FString& OutError) = 0;
+	virtual bool AcceptPlayerSession(const FString& PlayerSessionId, FString& OutError) = 0;
+	virtual bool RemovePlayerSession(const FString& PlayerSessionId, FString& OutError) = 0;
+
+	/** Whether GameLift may place new player sessions on the active game session (ACCEPT_ALL / DENY_ALL). */
+	virtual bool UpdatePlayerSessionCreationPolicy(bool bAcceptAll, FString& OutError) = 0;
+
+	/** End the current game session (and, for a process that will exit, the process). */
+	virtual bool ProcessEnding(FString& OutError) = 0;
+
+	/** The SDK backend when built WITH_GAMELIFT and -FakeGameLift is absent, else the fake if requested, else null. */
+	static TUniquePtr<IHMVRGameLiftBackend> Create();
+};
+
+/** Local stand-in for GameLift; see IHMVRGameLiftBackend. */
+class HYPERMAGEVR_API FHMVRFakeGameLiftBackend : public IHMVRGameLiftBackend
+{
+public:
+	virtual ~FHMVRFakeGameLiftBackend() override;
+
+	virtual const TCHAR* GetName() const override { return TEXT("fake"); }
+	virtual bool InitSDK(FString& OutError) override;
+	virtual bool ProcessReady(const FHMVRGameLiftProcessCallbacks& Callbacks, int32 Port, FString& OutError) override;
+	virtual bool ActivateGameSession(FString& OutError) override;
+	virtual bool AcceptPlayerSession(const FString& PlayerSessionId, FString& OutError) override;
+	virtual bool RemovePlayerSession(const FString& PlayerSessionId, FString& OutError) override;
+	virtual bool UpdatePlayerSessionCreationPolicy(bool bAcceptAll, FString& OutError) override;
+	virtual bool ProcessEnding(FString& OutError) override;
+
+private:
+	enum class EState : uint8 { Uninitialized, Initialized, Ready, SessionPending, SessionActive, Ended };
+
+	void CancelPendingSession();
+
+	EState State = EState::Uninitialized;
+	FHMVRGameLiftProcessCallbacks Callbacks;
+	TSet<FString> AcceptedPlayerSessions;
+	FTSTicker::FDelegateHandle PendingSessionHandle;
+	int32 SessionCounter = 0;
+};
@@ -7,21 +7,218 @@
 #include "SessionAPIClient.h"
 #include "HMVRPlayerState.h"
 #include "HMVRInteractableComponent.h"
+#include "HMVRActorPool.h"
+#include "HMVRArtifact.h"
+#include "HMVRCreature.h"
+#include "HMVRGameplayTimers.h"
+#include "HMVRGmEvents.h"
+#include "HMVRApiEndpoints.h"
+#include "HMVRLocalApiStub.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
+#include "GameFramework/GameSession.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
-#include "Engine/StaticMeshActor.h"
-#include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "HMVRPropBatch.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
 #include "Engine/DirectionalLight.h"
 #include "Engine/SkyLight.h"
 #include "EngineUtils.h"
 #include "TimerManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 
-#if WITH_GAMELIFT
-#include "GameLiftServerSDK.h"
-#endif
 #include "HMVRGameInstance.h"
+#include "HMVRGameLiftBackend.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarRecycleSessions(
+	TEXT("hmvr.GameLift.RecycleSessions"),
+	1,
+	TEXT("When the last player leaves a GameLift session: 1 = reset the world in place and keep the session open for hmvr.GameLift.EmptySessionSeconds, 0 = ProcessEnding and exit."));
+
+static TAutoConsoleVariable<float> CVarEmptySessionSeconds(
+	TEXT("hmvr.GameLift.EmptySessionSeconds"),
+	300.f,
+	TEXT("How long a recycled, empty game session stays open for new player sessions before ProcessEnding and exit."));
+
+#if !UE_BUILD_SHIPPING
+// Drive the recycle path without clients, e.g. against -FakeGameLift to time warm session starts
+static FAutoConsoleCommandWithWorld CmdGameLiftRecycle(
+	TEXT("HMVR.GameLift.Recycle"),
+	TEXT("Reset the world in place as if the last player had left the GameLift session (server, no players connected)."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr)
+		{
+			GameMode->RecycleSession();
+		}
+	}));
+
+// Check the load-derived limit headless, e.g. -nullrhi with hmvr.Capacity.SyntheticLoadMs /
+// hmvr.Capacity.SyntheticMsPerPlayer set
+static FAutoConsoleCommandWithWorld CmdCapacityStatus(
+	TEXT("HMVR.Capacity.Status"),
+	TEXT("Log the capacity controller's load samples, effective admission limit and health."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr)
+		{
+			GameMode->GetCapacityController().LogStatus();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdEventsStats(
+	TEXT("HMVR.Events.Stats"),
+	TEXT("Log interaction event streaming counters (pushed, sent, failed, dropped, ring depth, batches in flight)."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr)
+		{
+			if (const FHMVREventStream* Stream = GameMode->GetEventStream())
+			{
+				Stream->LogStats();
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdSnapshotStats(
+	TEXT("HMVR.Snapshot.Stats"),
+	TEXT("Log crash snapshot cost (game thread collect per tick, off-thread write), size and recovery time."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr)
+		{
+			if (const FHMVRSessionSnapshot* Snapshot = GameMode->GetSessionSnapshot())
+			{
+				Snapshot->LogStats();
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdLedgerStats(
+	TEXT("HMVR.Ledger.Stats"),
+	TEXT("Log reward ledger counters (appended, acknowledged, pending, duplicates refused, bloom hit rate, upload bytes per grant)."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr)
+		{
+			if (const FHMVRRewardLedger* Ledger = GameMode->GetRewardLedger())
+			{
+				Ledger->LogStats();
+			}
+		}
+	}));
+
+// Load test for the admission stage: Count joins arrive in the same frame against the admission limit;
+// validation is simulated (ValidateMs on a worker) so the run needs no tokens or clients
+static FAutoConsoleCommandWithWorldAndArgs CmdAdmissionBurst(
+	TEXT("HMVR.Admission.Burst"),
+	TEXT("HMVR.Admission.Burst [Count=50] [ValidateMs=20] — simultaneous join attempts through the admission stage; checks the shard is never overfilled."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr;
+		FHMVRAdmissionController* Admission = GameMode ? GameMode->GetAdmissionController() : nullptr;
+		if (!Admission)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Admission burst needs a server world with an HMVRGameMode"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 50;
+		const float ValidateMs = Args.Num() > 1 ? FMath::Max(0.f, FCString::Atof(*Args[1])) : 20.f;
+		const int32 Limit = GameMode->GetAdmissionLimit();
+		const int32 Connected = GameMode->GetCurrentPlayerCount();
+		const int32 ReservedBefore = Admission->GetReservedCount();
+
+		struct FBurst
+		{
+			int32 Outstanding = 0;
+			int32 Admitted = 0;
+			int32 RejectedFull = 0;
+			int32 RejectedOther = 0;
+			int32 PeakReserved = 0;
+			double StartTime = 0.0;
+			TArray<FString> AdmittedIds;
+		};
+		TSharedRef<FBurst> Burst = MakeShared<FBurst>();
+		Burst->Outstanding = Count;
+		Burst->StartTime = FPlatformTime::Seconds();
+
+		TWeakObjectPtr<AHMVRGameMode> WeakGameMode(GameMode);
+		auto OnDone = [Burst, WeakGameMode, Count, Limit, Connected, ReservedBefore](const FString& Error, const FHMVRAdmission& Result)
+		{
+			if (Error.IsEmpty())
+			{
+				++Burst->Admitted;
+				Burst->AdmittedIds.Add(Result.PlayerId);
+			}
+			else if (Error.StartsWith(TEXT("Server full")))
+			{
+				++Burst->RejectedFull;
+			}
+			else
+			{
+				++Burst->RejectedOther;
+			}
+
+			FHMVRAdmissionController* Controller = WeakGameMode.IsValid() ? WeakGameMode->GetAdmissionController() : nullptr;
+			if (Controller)
+			{
+				Burst->PeakReserved = FMath::Max(Burst->PeakReserved, Controller->GetReservedCount());
+			}
+			if (--Burst->Outstanding > 0)
+			{
+				return;
+			}
+
+			const int32 Free = FMath::Max(0, Limit - Connected - ReservedBefore);
+			const bool bOverfilled = Connected + ReservedBefore + Burst->Admitted > Limit;
+			const FString Summary = FString::Printf(
+				TEXT("%d attempts, %d admitted (%d free slots of %d), %d rejected full, %d rejected other, peak %d reserved, %.1f ms to settle"),
+				Count, Burst->Admitted, Free, Limit, Burst->RejectedFull, Burst->RejectedOther, Burst->PeakReserved,
+				(FPlatformTime::Seconds() - Burst->StartTime) * 1000.0);
+			if (bOverfilled)
+			{
+				UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: Admission burst OVERFILLED the shard: %s"), *Summary);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Admission burst: %s"), *Summary);
+			}
+
+			// Synthetic players never arrive; hand their slots straight back
+			if (Controller)
+			{
+				for (const FString& PlayerId : Burst->AdmittedIds)
+				{
+					Controller->Claim(PlayerId);
+				}
+				Controller->LogStats();
+			}
+		};
+
+		const double BeginStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FHMVRAdmission Attempt;
+			Attempt.Address = FString::Printf(TEXT("burst-%d"), i);
+			Admission->Begin(MoveTemp(Attempt), Limit, Connected,
+				[ValidateMs, i](FHMVRAdmission& InOut, FString&)
+				{
+					FPlatformProcess::Sleep(ValidateMs * FMath::FRandRange(0.5f, 1.5f) / 1000.f);
+					InOut.PlayerId = FString::Printf(TEXT("burst-player-%d"), i);
+					return true;
+				},
+				nullptr, OnDone);
+		}
+		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Admission burst queued %d attempts in %.2f ms of game thread"),
+			Count, (FPlatformTime::Seconds() - BeginStart) * 1000.0);
+	}));
+#endif
 
 AHMVRGameMode::AHMVRGameMode()
 {
@@ -46,6 +243,9 @@ AHMVRGameMode::AHMVRGameMode()
 
 	// Create Session API client
 	SessionAPIClient = CreateDefaultSubobject<USessionAPIClient>(TEXT("SessionAPIClient"));
+
+	// Create ScenePlan loader
+	ScenePlanLoader = CreateDefaultSubobject<UHMVRScenePlanLoader>(TEXT("ScenePlanLoader"));
 }
 
 void AHMVRGameMode::BeginPlay()
@@ -59,10 +259,9 @@ void AHMVRGameMode::BeginPlay()
 	{
 		if (UHMVRInteractableComponent* Comp = It->FindComponentByClass<UHMVRInteractableComponent>())
 		{
-			RegisteredInteractables.Add(Comp);
+			RegisterInteractable(Comp);
 			if (Comp->bPersistent)
 			{
-				Comp->LoadState();
 				++PersistentCount;
 			}
 		}
@@ -85,56 +284,85 @@ void AHMVRGameMode::BeginPlay()
 		FRotator::ZeroRotator
 	);
 
+	// Spawn the world from a ScenePlan when one is configured. Interactables it spawns are
+	// registered as they land; the level scan above only sees hand-placed ones.
+	FString ScenePlanPath = UGameplayStatics::ParseOption(OptionsString, TEXT("ScenePlan"));
+	if (ScenePlanPath.IsEmpty() && !FParse::Value(FCommandLine::Get(), TEXT("ScenePlan="), ScenePlanPath))
+	{
+		ScenePlanPath = ScenePlanLoader->ScenePlanPath;
+	}
+
+	ScenePlanLoader->OnInteractableSpawned.AddUObject(this, &AHMVRGameMode::RegisterInteractable);
+	ScenePlanLoader->OnLoaded.AddUObject(this, &AHMVRGameMode::OnScenePlanLoaded);
+	if (ScenePlanPath.IsEmpty() || !ScenePlanLoader->Load(GetWorld(), ScenePlanPath))
+	{
+		SpawnDefaultGeometry();
+
+		// The ScenePlan loader prewarms once its classes are loaded; without one, the native classes
+		if (UHMVRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UHMVRActorPoolSubsystem>())
+		{
+			Pool->PrewarmInteractables(AHMVRCreature::StaticClass(), AHMVRArtifact::StaticClass());
+		}
+	}
+}
+
+void AHMVRGameMode::OnScenePlanLoaded(bool bSuccess)
+{
+	// Hook effects name interactables by ObjectId, so the table is built once they have all landed
+	UHMVRGmEventSubsystem* GmEvents = GetWorld()->GetSubsystem<UHMVRGmEventSubsystem>();
+	if (bSuccess && GmEvents)
+	{
+		GmEvents->BuildHookTable(ScenePlanLoader->GetPlan(), RegisteredInteractables);
+	}
+}
+
+void AHMVRGameMode::RegisterInteractable(UHMVRInteractableComponent* Interactable)
+{
+	if (!Interactable)
+	{
+		return;
+	}
+
+	RegisteredInteractables.Add(Interactable);
+	if (Interactable->bPersistent)
+	{
+		Interactable->LoadState();
+	}
+}
+
+void AHMVRGameMode::SpawnDefaultGeometry()
+{
+	// Static props go through the batcher: one instanced, Static-mobility component per
+	// mesh/material instead of a Movable AStaticMeshActor each, replicated to clients.
+	FHMVRPropBatcher Batcher;
+
 	// Spawn a floor plane so VR player has visible geometry and spatial orientation
 	UStaticMesh* PlaneMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Floor mesh load: %s"), PlaneMesh ? TEXT("OK") : TEXT("NOT COOKED"));
 	if (PlaneMesh)
 	{
-		FActorSpawnParameters FloorSpawnParams;
-		FloorSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		AStaticMeshActor* Floor = GetWorld()->SpawnActor<AStaticMeshActor>(
-			AStaticMeshActor::StaticClass(),
-			FVector::ZeroVector,
-			FRotator::ZeroRotator,
-			FloorSpawnParams
-		);
-		if (Floor)
-		{
-			Floor->GetStaticMeshComponent()->SetStaticMesh(PlaneMesh);
-			Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
-			Floor->SetActorScale3D(FVector(20.f, 20.f, 1.f));
-			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Floor plane spawned at origin, scale 20x20m"));
-		}
+		FHMVRPropDesc Floor;
+		Floor.Mesh = PlaneMesh;
+		Floor.Transform = FTransform(FRotator::ZeroRotator, FVector::ZeroVector, FVector(20.f, 20.f, 1.f));
+		Floor.Id = TEXT("floor");
+		Batcher.Add(Floor);
 	}
 
 	// Pink vase — proof that code-authored geometry works end-to-end
 	UStaticMesh* SphereMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
 	if (SphereMesh)
 	{
-		FActorSpawnParameters VaseParams;
-		VaseParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		AStaticMeshActor* PinkVase = GetWorld()->SpawnActor<AStaticMeshActor>(
-			AStaticMeshActor::StaticClass(),
-			FVector(0.f, 200.f, 50.f),
-			FRotator::ZeroRotator,
-			VaseParams
-		);
-		if (PinkVase)
-		{
-			PinkVase->GetStaticMeshComponent()->SetStaticMesh(SphereMesh);
-			PinkVase->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
-			UMaterialInterface* BaseMat = LoadObject<UMaterialInterface>(nullptr,
-				TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-			if (BaseMat)
-			{
-				UMaterialInstanceDynamic* PinkMat = UMaterialInstanceDynamic::Create(BaseMat, PinkVase);
-				PinkMat->SetVectorParameterValue(FName("Color"), FLinearColor(1.f, 0.f, 0.5f, 1.f));
-				PinkVase->GetStaticMeshComponent()->SetMaterial(0, PinkMat);
-			}
-			PinkVase->SetActorScale3D(FVector(0.5f));
-			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Pink vase spawned at (0, 200, 50)"));
-		}
+		FHMVRPropDesc PinkVase;
+		PinkVase.Mesh = SphereMesh;
+		PinkVase.Material = LoadObject<UMaterialInterface>(nullptr,
+			TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
+		PinkVase.Tint = FLinearColor(1.f, 0.f, 0.5f, 1.f);
+		PinkVase.Transform = FTransform(FRotator::ZeroRotator, FVector(0.f, 200.f, 50.f), FVector(0.5f));
+		PinkVase.Id = TEXT("pink_vase");
+		Batcher.Add(PinkVase);
 	}
+
+	Batcher.Build(GetWorld());
 }
 
 void AHMVRGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
@@ -143,95 +371,289 @@ void AHMVRGameMode::InitGame(const FString& MapName, const FString& Options, FSt
 
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Initializing game on map %s"), *MapName);
 
-	// Configure Session API client endpoint (hardcoded to live Session API)
+#if WITH_HMVR_API_STUB
+	// Game modes only exist where the game is hosted (standalone, listen server, PIE), never on
+	// a joining client; the dedicated server started the stub in UHMVRGameInstance::Init. A
+	// standalone client about to matchmake into a local server finds the server's stub on the port.
+	if (FHMVRApiEndpoints::IsLocalStubRequested() && !FHMVRLocalApiStub::Get().IsRunning())
+	{
+		const int32 StubPort = FHMVRApiEndpoints::GetLocalStubPort();
+		if (FHMVRLocalApiStub::IsPortTaken(StubPort))
+		{
+			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Local API stub port %d is served by another process — using it"), StubPort);
+		}
+		else
+		{
+			FHMVRLocalApiStub::Get().Start(StubPort);
+		}
+	}
+#endif
+
+	// Configure Session API client endpoint (DefaultGame.ini, overridable on the command line)
 	if (SessionAPIClient)
 	{
-		SessionAPIClient->SetEndpointURL(TEXT("https://fhjoxyk9x5.execute-api.eu-west-1.amazonaws.com/dev"));
-		SessionAPIClient->SetAwsRegion(TEXT("eu-west-1"));
+		SessionAPIClient->SetEndpointURL(FHMVRApiEndpoints::GetSessionApiUrl());
+		SessionAPIClient->SetAwsRegion(FHMVRApiEndpoints::GetAwsRegion());
 	}
 
 	// Configure world-state API for persistent interactable objects (Phase 20)
-	UHMVRInteractableComponent::WorldStateApiUrl = TEXT("https://hnhmoxjhmd.execute-api.eu-west-1.amazonaws.com/dev");
+	UHMVRInteractableComponent::WorldStateApiUrl = FHMVRApiEndpoints::GetWorldStateApiUrl();
 
 	// Initialize reward system
 	if (RewardSystem && !RewardSystem->Initialize())
 	{
 		UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: Failed to initialize reward system"));
 	}
+	if (RewardSystem)
+	{
+		RewardSystem->SetApiClient(SessionAPIClient); // inventory prefetch and grant write-through
+	}
+
+	// Join admission; an admitted player who never reaches PostLogin gives their GameLift
+	// player session back when the reservation lapses. One still loading the map keeps it.
+	AdmissionController = MakeShared<FHMVRAdmissionController>();
+	AdmissionController->Start();
+	TWeakObjectPtr<AHMVRGameMode> WeakThis(this);
+	AdmissionController->IsStillJoining = [WeakThis](const FHMVRAdmission& Lapsed)
+	{
+		return WeakThis.IsValid() && WeakThis->IsJoinInProgress(Lapsed);
+	};
+	AdmissionController->OnReservationExpired = [WeakThis](const FHMVRAdmission& Lapsed)
+	{
+		AHMVRGameMode* This = WeakThis.Get();
+		if (!This)
+		{
+			return;
+		}
+		// Claimed under another path (a reconnect, a fallback id): the session is in use
+		if (!Lapsed.PlayerSessionId.IsEmpty() && This->Players.FindByPlayerSessionId(Lapsed.PlayerSessionId).IsSet())
+		{
+			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Reservation for %s lapsed but its player session is connected - kept"), *Lapsed.PlayerId);
+			return;
+		}
+		This->RemovePlayerSession(Lapsed.PlayerSessionId);
+	};
+
+	// Capacity follows measured tick, replication and memory cost rather than MaxPlayers alone
+	Capacity.Start(GetWorld(), MaxPlayers, [WeakThis]()
+	{
+		return WeakThis.IsValid() ? WeakThis->GetCurrentPlayerCount() : 0;
+	});
+	Capacity.OnCapacityChanged = [WeakThis]()
+	{
+		if (AHMVRGameMode* This = WeakThis.Get())
+		{
+			This->ApplyCapacity();
+		}
+	};
+
+	// Interaction events stream to the Session API as they happen
+	EventStream = MakeShared<FHMVREventStream>();
+	TWeakObjectPtr<USessionAPIClient> WeakClient(SessionAPIClient);
+	EventStream->Start([WeakClient](const FString& JsonBody, int32 NumEvents, TFunction<void(bool)> OnDone)
+	{
+		return WeakClient.IsValid() && WeakClient->SendInteractionEventBatch(JsonBody, NumEvents, MoveTemp(OnDone));
+	});
+	if (SessionManager)
+	{
+		SessionManager->SetEventStream(EventStream);
+
+		// Summaries the Session API has not acknowledged are re-sent until the session expires
+		SessionManager->OnSummaryResend = [WeakThis](const FPlayerSessionSummary& Summary)
+		{
+			if (AHMVRGameMode* This = WeakThis.Get())
+			{
+				This->SendSessionSummary(Summary);
+			}
+		};
+	}
 
-	// Initialize GameLift if running on AWS
-#if WITH_GAMELIFT
+	// Reward grants go through a local ledger so each reaches the backend exactly once, including
+	// grants the previous process on this port appended but never had acknowledged
+	RewardLedger = MakeShared<FHMVRRewardLedger>(FHMVRRewardLedger::GetDefaultDirectory(GetWorld()->URL.Port));
+	FString LedgerError;
+	if (RewardLedger->Open(LedgerError))
+	{
+		RewardLedger->Start([WeakClient](const FString& JsonBody, int32 NumGrants, TFunction<void(FHMVRRewardLedger::EBatchOutcome)> OnDone)
+		{
+			return WeakClient.IsValid() && WeakClient->SendRewardGrantBatch(JsonBody, NumGrants,
+				[OnDone = MoveTemp(OnDone)](bool bAcknowledged, bool bRejected)
+				{
+					OnDone(bAcknowledged ? FHMVRRewardLedger::EBatchOutcome::Accepted
+						: bRejected ? FHMVRRewardLedger::EBatchOutcome::Rejected
+						: FHMVRRewardLedger::EBatchOutcome::Failed);
+				});
+		});
+		if (RewardSystem)
+		{
+			RewardSystem->SetRewardLedger(RewardLedger);
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: Reward ledger unavailable (%s) - grants are written through one request each"), *LedgerError);
+		RewardLedger.Reset();
+	}
+
+	// Sessions and rewards survive a crash: pick up what the previous process on this port had
+	// not had acknowledged, then keep snapshotting ours
+	if (FHMVRSessionSnapshot::IsEnabled())
+	{
+		const FString SnapshotDirectory = FHMVRSessionSnapshot::GetDefaultDirectory(GetWorld()->URL.Port);
+		SessionSnapshot = MakeShared<FHMVRSessionSnapshot>(SnapshotDirectory);
+		FHMVRSessionSnapshot::FRecovered Recovered;
+		FString RecoverError;
+		const bool bRecovered = SessionSnapshot->Recover(Recovered, RecoverError);
+		SessionSnapshot->Start(SessionManager, RewardSystem);
+		if (bRecovered)
+		{
+			RestoreRecoveredSessions(Recovered);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Nothing to recover (%s)"), *RecoverError);
+		}
+	}
+
+	// Unlocks and sequences the previous process had in flight resume as their actors begin play.
+	// Switched separately from the session snapshot; the file shares its per-port directory.
+	if (UHMVRGameplayTimerSubsystem::IsPersistenceEnabled())
+	{
+		if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+		{
+			const FString SnapshotDirectory = FHMVRSessionSnapshot::GetDefaultDirectory(GetWorld()->URL.Port);
+			FString TimersError;
+			if (!Timers->RestorePersisted(FPaths::Combine(SnapshotDirectory, TEXT("GameplayTimers.bin")), TimersError))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Gameplay timers not restored (%s)"), *TimersError);
+			}
+		}
+	}
+
+	// Initialize GameLift if running on AWS (or against the local fake)
 	if (GetWorld()->GetNetMode() == NM_DedicatedServer)
 	{
 		InitializeGameLift();
 	}
-#endif
 
-	// Generate session ID
-	CurrentSessionId = FGuid::NewGuid().ToString();
+	// Outside GameLift (or before it places a session) the shard id is local
+	if (CurrentSessionId.IsEmpty())
+	{
+		CurrentSessionId = FGuid::NewGuid().ToString();
+	}
 	SessionStartTime = FDateTime::UtcNow();
 
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Session ID: %s"), *CurrentSessionId);
 }
 
-void AHMVRGameMode::PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage)
+void AHMVRGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::PreLogin(Options, Address, UniqueId, ErrorMessage);
+	// Buffered interaction events go out now: a deferred batch would come back to a game thread
+	// queue that is not pumped again once the world is torn down. Unsent grants stay in the
+	// ledger and are replayed by the next process.
+	if (EventStream)
+	{
+		EventStream->FlushSync();
+	}
+	if (RewardLedger)
+	{
+		RewardLedger->Flush();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
-	// Check player capacity (Requirement 2.2)
-	if (!CanAcceptNewPlayer())
+void AHMVRGameMode::PreLoginAsync(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, const FOnPreLoginCompleteDelegate& OnComplete)
+{
+	// Engine checks (GameSession ApproveLogin, bans) are cheap and stay synchronous
+	FString ErrorMessage;
+	Super::PreLogin(Options, Address, UniqueId, ErrorMessage);
+	if (!ErrorMessage.IsEmpty())
 	{
-		ErrorMessage = FString::Printf(TEXT("Server full. Maximum %d players allowed."), MaxPlayers);
-		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection - server full (%d/%d)"), 
-			GetCurrentPlayerCount(), MaxPlayers);
+		OnComplete.ExecuteIfBound(ErrorMessage);
 		return;
 	}
 
+	FHMVRAdmission Admission;
+	Admission.Address = Address;
+
 	// Extract JWT token from options (Requirement 3.1-3.4)
-	FString JWTToken = UGameplayStatics::ParseOption(Options, TEXT("Token"));
-	if (JWTToken.IsEmpty())
+	Admission.Token = UGameplayStatics::ParseOption(Options, TEXT("Token"));
+	if (Admission.Token.IsEmpty())
 	{
-		ErrorMessage = TEXT("Authentication failed: No JWT token provided");
 		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection - no JWT token"));
+		OnComplete.ExecuteIfBound(TEXT("Authentication failed: No JWT token provided"));
 		return;
 	}
 
-	// Validate JWT token
-	FString PlayerId;
-	if (!ValidateJWTToken(JWTToken, PlayerId, ErrorMessage))
+	// GameLift player session required when running on AWS
+	const bool bRequirePlayerSession = bGameLiftInitialized && bGameLiftProcessReady;
+	Admission.PlayerSessionId = UGameplayStatics::ParseOption(Options, TEXT("PlayerSessionId"));
+	if (bRequirePlayerSession && Admission.PlayerSessionId.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection - invalid JWT token: %s"), *ErrorMessage);
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection - no player session ID"));
+		OnComplete.ExecuteIfBound(TEXT("GameLift player session ID required"));
 		return;
 	}
 
-#if WITH_GAMELIFT
-	// Validate GameLift player session if running on AWS
-	if (bGameLiftInitialized)
+	if (!AdmissionController)
 	{
-		FString PlayerSessionId = UGameplayStatics::ParseOption(Options, TEXT("PlayerSessionId"));
-		if (!PlayerSessionId.IsEmpty())
+		OnComplete.ExecuteIfBound(TEXT("Server not ready"));
+		return;
+	}
+
+	// Capacity (Requirement 2.2): a slot is reserved now, before validation, so joins that are
+	// still validating count against the admission limit
+	TWeakObjectPtr<AHMVRGameMode> WeakThis(this);
+	AdmissionController->Begin(MoveTemp(Admission), GetAdmissionLimit(), GetCurrentPlayerCount(),
+		// Worker thread
+		[bRequirePlayerSession](FHMVRAdmission& InOut, FString& OutError)
 		{
-			FString ValidationError;
-			if (!ValidatePlayerSession(PlayerSessionId, ValidationError))
+			if (!ValidateJWTToken(InOut.Token, InOut.PlayerId, OutError))
 			{
-				ErrorMessage = FString::Printf(TEXT("GameLift validation failed: %s"), *ValidationError);
-				UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection - GameLift validation failed: %s"), *ValidationError);
-				return;
+				OutError = FString::Printf(TEXT("Authentication failed: %s"), *OutError);
+				return false;
 			}
-
-			// Accept the player session with GameLift
-			AcceptPlayerSession(PlayerSessionId);
-		}
-		else
+			if (bRequirePlayerSession && !ValidatePlayerSession(InOut.PlayerSessionId, OutError))
+			{
+				OutError = FString::Printf(TEXT("GameLift validation failed: %s"), *OutError);
+				return false;
+			}
+			return true;
+		},
+		// Game thread
+		[WeakThis, bRequirePlayerSession](FHMVRAdmission& InOut, FString& OutError)
 		{
-			ErrorMessage = TEXT("GameLift player session ID required");
-			UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection - no player session ID"));
-			return;
-		}
-	}
-#endif
+			AHMVRGameMode* This = WeakThis.Get();
+			if (!This)
+			{
+				OutError = TEXT("Server shutting down");
+				return false;
+			}
+			if (bRequirePlayerSession && !This->AcceptPlayerSession(InOut.PlayerSessionId, OutError))
+			{
+				return false;
+			}
 
-	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: PreLogin successful for player %s"), *PlayerId);
+			// The token is good: load the player's reward inventory while they travel and load the map
+			if (This->RewardSystem)
+			{
+				This->RewardSystem->PrefetchPlayerRewards(InOut.PlayerId);
+			}
+			return true;
+		},
+		[OnComplete](const FString& Error, const FHMVRAdmission& Result)
+		{
+			if (Error.IsEmpty())
+			{
+				UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: PreLogin successful for player %s"), *Result.PlayerId);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Rejected connection from %s - %s"), *Result.Address, *Error);
+			}
+			OnComplete.ExecuteIfBound(Error);
+		});
 }
 
 APlayerController* AHMVRGameMode::Login(UPlayer* NewPlayer, ENetRole InRemoteRole, const FString& Portal, const FString& Options, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage)
@@ -267,9 +689,95 @@ void AHMVRGameMode::PostLogin(APlayerController* NewPlayer)
 
 	if (NewPlayer)
 	{
-		// Add to connected players list
-		ConnectedPlayers.Add(NewPlayer);
-		OnPlayerJoined(NewPlayer);
+		// PostLogin again for a controller that is already registered: nothing to do
+		if (Players.FindByController(NewPlayer).IsSet())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: PostLogin — controller %s is already registered"), *GetNameSafe(NewPlayer));
+			return;
+		}
+
+		// PlayerId set in Login() from the JWT sub claim
+		FString PlayerId;
+		if (const AHMVRPlayerState* PS = NewPlayer->GetPlayerState<AHMVRPlayerState>())
+		{
+			PlayerId = PS->CognitoPlayerId;
+		}
+
+		// The admission reservation becomes a connected slot and hands over the GameLift player
+		// session it accepted. Without an id from Login, find it by connection address instead
+		// (PreLogin validated the token, so it has the id) — an unclaimed reservation would
+		// expire and release the player session of a player who is connected.
+		FHMVRAdmission Admission;
+		bool bClaimed = false;
+		if (PlayerId.IsEmpty())
+		{
+			bClaimed = AdmissionController && AdmissionController->ClaimByAddress(NewPlayer->GetPlayerNetworkAddress(), &Admission);
+			PlayerId = Admission.PlayerId;
+			if (AHMVRPlayerState* PS = NewPlayer->GetPlayerState<AHMVRPlayerState>(); PS && !PlayerId.IsEmpty())
+			{
+				PS->CognitoPlayerId = PlayerId;
+			}
+		}
+		if (PlayerId.IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: PostLogin — PlayerId not on PlayerState, using fallback GUID"));
+			PlayerId = FGuid::NewGuid().ToString();
+		}
+		if (!bClaimed && AdmissionController)
+		{
+			bClaimed = AdmissionController->Claim(PlayerId, &Admission);
+		}
+
+		FHMVRPlayerHandle Handle = Players.Add(NewPlayer, PlayerId);
+		if (!Handle.IsSet())
+		{
+			// Same Cognito id on a new connection (a reconnect before the old one timed out):
+			// the new controller takes over and the stale one is logged out and kicked. The
+			// stale player leaves after the new one is registered so the count never reaches
+			// zero and the GameLift session is not ended under them.
+			const FHMVRPlayerHandle StaleHandle = Players.FindByCognitoId(PlayerId);
+			const FHMVRPlayerRecord* Found = Players.Get(StaleHandle);
+			TOptional<FHMVRPlayerRecord> Stale;
+			if (Found)
+			{
+				Stale = *Found;
+				Players.Remove(StaleHandle);
+				Handle = Players.Add(NewPlayer, PlayerId);
+			}
+			if (!Handle.IsSet())
+			{
+				UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: PostLogin — could not register %s, rejecting"), *PlayerId);
+				RemovePlayerSession(Admission.PlayerSessionId);
+				if (Stale.IsSet())
+				{
+					RemovePlayerSession(Stale->PlayerSessionId);
+					OnPlayerLeft(Stale.GetValue());
+				}
+				if (GameSession)
+				{
+					GameSession->KickPlayer(NewPlayer, NSLOCTEXT("HMVR", "LoginRejected", "Could not join the session"));
+				}
+				return;
+			}
+
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: PostLogin — player %s reconnected, replacing the stale connection"), *PlayerId);
+			RemovePlayerSession(Stale->PlayerSessionId);
+			OnPlayerLeft(Stale.GetValue());
+			if (APlayerController* StaleController = Stale->Controller.Get())
+			{
+				if (GameSession)
+				{
+					GameSession->KickPlayer(StaleController, NSLOCTEXT("HMVR", "ReplacedByReconnect", "Signed in from another connection"));
+				}
+			}
+		}
+		if (bClaimed)
+		{
+			Players.SetPlayerSessionId(Handle, Admission.PlayerSessionId);
+		}
+
+		OnPlayerJoined(Handle);
+		ApplyCapacity();
 
 		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: PostLogin - Player count: %d/%d"), 
 			GetCurrentPlayerCount(), MaxPlayers);
@@ -278,22 +786,17 @@ void AHMVRGameMode::PostLogin(APlayerController* NewPlayer)
 
 void AHMVRGameMode::Logout(AController* Exiting)
 {
-	if (APlayerController* ExitingPlayer = Cast<APlayerController>(Exiting))
+	const FHMVRPlayerHandle Handle = Players.FindByController(Exiting);
+	if (const FHMVRPlayerRecord* Found = Players.Get(Handle))
 	{
-#if WITH_GAMELIFT
-		// Find and remove player session from GameLift
-		for (const auto& Entry : PlayerSessionMap)
-		{
-			// In production, match player session to the exiting player
-			// For now, remove the first matching session
-			RemovePlayerSession(Entry.Key);
-			break;
-		}
-#endif
+		const FHMVRPlayerRecord Player = *Found;
+		Players.Remove(Handle);
+
+		// Give this player's session back to GameLift
+		RemovePlayerSession(Player.PlayerSessionId);
 
-		// Remove from connected players list
-		ConnectedPlayers.Remove(ExitingPlayer);
-		OnPlayerLeft(Exiting);
+		OnPlayerLeft(Player);
+		ApplyCapacity();
 
 		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Player logged out - Player count: %d/%d"), 
 			GetCurrentPlayerCount(), MaxPlayers);
@@ -304,21 +807,18 @@ void AHMVRGameMode::Logout(AController* Exiting)
 
 int32 AHMVRGameMode::GetCurrentPlayerCount() const
 {
-	// Clean up invalid weak pointers
-	int32 ValidPlayerCount = 0;
-	for (const TWeakObjectPtr<APlayerController>& PlayerPtr : ConnectedPlayers)
-	{
-		if (PlayerPtr.IsValid())
-		{
-			ValidPlayerCount++;
-		}
-	}
-	return ValidPlayerCount;
+	return Players.Num();
 }
 
 bool AHMVRGameMode::CanAcceptNewPlayer() const
 {
-	return GetCurrentPlayerCount() < MaxPlayers;
+	const int32 Reserved = AdmissionController ? AdmissionController->GetReservedCount() : 0;
+	return GetCurrentPlayerCount() + Reserved < GetAdmissionLimit();
+}
+
+int32 AHMVRGameMode::GetAdmissionLimit() const
+{
+	return FMath::Min(MaxPlayers, Capacity.GetEffectiveLimit());
 }
 
 bool AHMVRGameMode::ValidateJWTToken(const FString& Token, FString& OutPlayerId, FString& OutErrorMessage)
@@ -356,16 +856,6 @@ bool AHMVRGameMode::ValidateJWTToken(const FString& Token, FString& OutPlayerId,
 	return true;
 }
 
-#if !WITH_GAMELIFT
-void AHMVRGameMode::InitializeGameLift()
-{
-	// No-op on client builds
-}
-void AHMVRGameMode::ReportServerHealth() {}
-bool AHMVRGameMode::ValidatePlayerSession(const FString&, FString& OutErrorMessage) { OutErrorMessage = TEXT("GameLift not available"); return false; }
-void AHMVRGameMode::AcceptPlayerSession(const FString&) {}
-void AHMVRGameMode::RemovePlayerSession(const FString&) {}
-#else
 void AHMVRGameMode::InitializeGameLift()
 {
 	UHMVRGameInstance* GameInstance = Cast<UHMVRGameInstance>(GetGameInstance());
@@ -375,11 +865,16 @@ void AHMVRGameMode::InitializeGameLift()
 		return;
 	}
 
-	GameLiftSdkModule = GameInstance->GetGameLiftSdkModule();
+	GameLiftBackend = GameInstance->GetGameLiftBackend();
 	CurrentSessionId = GameInstance->GetGameLiftSessionId();
 	bGameLiftInitialized = true;
 	bGameLiftProcessReady = true;
 
+	// The first session may be placed before or after the map finishes loading; later ones
+	// arrive after each recycle
+	GameLiftSessionStartedHandle = GameInstance->OnGameLiftSessionStarted.AddUObject(
+		this, &AHMVRGameMode::HandleGameLiftSessionStarted);
+
 	if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().SetTimer(
@@ -394,23 +889,43 @@ void AHMVRGameMode::InitializeGameLift()
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: GameLift SDK reference acquired, session: %s"), *CurrentSessionId);
 }
 
+void AHMVRGameMode::HandleGameLiftSessionStarted(const FString& GameSessionId)
+{
+	CurrentSessionId = GameSessionId;
+	SessionStartTime = FDateTime::UtcNow();
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Session ID: %s"), *CurrentSessionId);
+}
+
 void AHMVRGameMode::ReportServerHealth()
 {
-	// Report server health to GameLift (Requirement 2.4)
-	int32 PlayerCount = GetCurrentPlayerCount();
-	
-	if (bGameLiftInitialized && bGameLiftProcessReady)
+	// Periodic capacity record (Requirement 2.4). GameLift polls OnHealthCheck itself; overload
+	// is shed through admission and the player session creation policy, not reported as a fault.
+	ApplyCapacity();
+	Capacity.LogStatus();
+}
+
+void AHMVRGameMode::ApplyCapacity()
+{
+	// Stop GameLift placing players we would turn away at PreLogin (DENY_ALL). Overload stays out
+	// of the health check: a failed check makes GameLift terminate the process and its players.
+	const int32 Reserved = AdmissionController ? AdmissionController->GetReservedCount() : 0;
+	const bool bAccept = !Capacity.IsOverloaded() && GetCurrentPlayerCount() + Reserved < GetAdmissionLimit();
+	if (bAccept == bAcceptingPlayerSessions || !bGameLiftInitialized || !GameLiftBackend)
+	{
+		return;
+	}
+
+	FString Error;
+	if (GameLiftBackend->UpdatePlayerSessionCreationPolicy(bAccept, Error))
 	{
-		// In production, call GameLift SDK health reporting
-		// This is automatically handled by the OnHealthCheck callback
-		UE_LOG(LogTemp, Verbose, TEXT("HMVRGameMode: GameLift health check - Players: %d/%d"), 
-			PlayerCount, MaxPlayers);
+		bAcceptingPlayerSessions = bAccept;
+		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: %s new player sessions (%d/%d players, limit %d, %s)"),
+			bAccept ? TEXT("Accepting") : TEXT("Denying"), GetCurrentPlayerCount(), MaxPlayers,
+			GetAdmissionLimit(), Capacity.IsOverloaded() ? TEXT("overloaded") : TEXT("within budget"));
 	}
 	else
 	{
-		// Development mode health logging
-		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Health Report - Players: %d/%d, Session: %s"), 
-			PlayerCount, MaxPlayers, *CurrentSessionId);
+		UE_LOG(LogTemp, Verbose, TEXT("HMVRGameMode: UpdatePlayerSessionCreationPolicy failed: %s"), *Error);
 	}
 }
 
@@ -423,12 +938,6 @@ bool AHMVRGameMode::ValidatePlayerSession(const FString& PlayerSessionId, FStrin
 		return false;
 	}
 
-	if (!bGameLiftInitialized || !bGameLiftProcessReady)
-	{
-		OutErrorMessage = TEXT("GameLift not initialized");
-		return false;
-	}
-
 	// In production, validate with GameLift SDK
 	// auto DescribeOutcome = Aws::GameLift::Server::DescribePlayerSessions(
 	//     Aws::GameLift::Server::Model::DescribePlayerSessionsRequest()
@@ -459,77 +968,104 @@ bool AHMVRGameMode::ValidatePlayerSession(const FString& PlayerSessionId, FStrin
 	return true;
 }
 
-void AHMVRGameMode::AcceptPlayerSession(const FString& PlayerSessionId)
+bool AHMVRGameMode::AcceptPlayerSession(const FString& PlayerSessionId, FString& OutErrorMessage)
 {
-	if (!bGameLiftInitialized || !bGameLiftProcessReady || !GameLiftSdkModule)
+	if (!bGameLiftInitialized || !bGameLiftProcessReady || !GameLiftBackend)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Cannot accept player session - GameLift not initialized"));
-		return;
+		OutErrorMessage = TEXT("GameLift not initialized");
+		return false;
 	}
 
-	auto AcceptOutcome = GameLiftSdkModule->AcceptPlayerSession(PlayerSessionId);
-	if (!AcceptOutcome.IsSuccess())
+	if (!GameLiftBackend->AcceptPlayerSession(PlayerSessionId, OutErrorMessage))
 	{
-		UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: AcceptPlayerSession failed: %s"),
-			*AcceptOutcome.GetError().m_errorMessage);
-		return;
+		UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: AcceptPlayerSession failed: %s"), *OutErrorMessage);
+		OutErrorMessage = FString::Printf(TEXT("GameLift validation failed: %s"), *OutErrorMessage);
+		return false;
 	}
 
-	PlayerSessionMap.Add(PlayerSessionId, FGuid::NewGuid().ToString());
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Accepted player session: %s"), *PlayerSessionId);
+	return true;
+}
+
+bool AHMVRGameMode::IsJoinInProgress(const FHMVRAdmission& Admission) const
+{
+	// Logged in (controller and PlayerState exist) but PostLogin has not registered them yet
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		const AHMVRPlayerState* PS = PC ? PC->GetPlayerState<AHMVRPlayerState>() : nullptr;
+		if (PS && !Admission.PlayerId.IsEmpty() && PS->CognitoPlayerId == Admission.PlayerId
+			&& !Players.FindByController(PC).IsSet())
+		{
+			return true;
+		}
+	}
+
+	// Connected from the admitted address and still loading the map: no controller yet
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if (NetDriver && !Admission.Address.IsEmpty())
+	{
+		for (const UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			if (Connection && !Connection->PlayerController && Connection->GetConnectionState() != USOCK_Closed
+				&& Connection->LowLevelGetRemoteAddress() == Admission.Address)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
 }
 
 void AHMVRGameMode::RemovePlayerSession(const FString& PlayerSessionId)
 {
-	if (PlayerSessionId.IsEmpty() || !bGameLiftInitialized || !bGameLiftProcessReady || !GameLiftSdkModule)
+	if (PlayerSessionId.IsEmpty() || !bGameLiftInitialized || !bGameLiftProcessReady || !GameLiftBackend)
 	{
 		return;
 	}
 
-	auto RemoveOutcome = GameLiftSdkModule->RemovePlayerSession(PlayerSessionId);
-	if (!RemoveOutcome.IsSuccess())
+	FString Error;
+	if (!GameLiftBackend->RemovePlayerSession(PlayerSessionId, Error))
 	{
-		UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: RemovePlayerSession failed: %s"),
-			*RemoveOutcome.GetError().m_errorMessage);
+		UE_LOG(LogTemp, Error, TEXT("HMVRGameMode: RemovePlayerSession failed: %s"), *Error);
 	}
 
-	PlayerSessionMap.Remove(PlayerSessionId);
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Removed player session: %s"), *PlayerSessionId);
 }
-#endif // WITH_GAMELIFT (else stub implementations above)
 
 
-void AHMVRGameMode::OnPlayerJoined(APlayerController* NewPlayer)
+void AHMVRGameMode::OnPlayerJoined(FHMVRPlayerHandle Player)
 {
-	if (!NewPlayer || !SessionManager)
+	const FHMVRPlayerRecord* Record = Players.Get(Player);
+	if (!Record || !SessionManager)
 	{
 		return;
 	}
+	GetWorldTimerManager().ClearTimer(EmptySessionTimerHandle);
 
-	// Read PlayerId set in Login() from the JWT sub claim
-	FString PlayerId;
-	if (const AHMVRPlayerState* PS = NewPlayer->GetPlayerState<AHMVRPlayerState>())
+	// The reward inventory is normally prefetched at admission; load it now for joins that skipped it
+	if (RewardSystem && !RewardSystem->IsInventoryRequested(Record->CognitoId))
 	{
-		PlayerId = PS->CognitoPlayerId;
+		RewardSystem->PrefetchPlayerRewards(Record->CognitoId);
 	}
-	if (PlayerId.IsEmpty())
+	else if (RewardSystem && !RewardSystem->IsInventoryLoaded(Record->CognitoId))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: OnPlayerJoined — PlayerId not on PlayerState, using fallback GUID"));
-		PlayerId = FGuid::NewGuid().ToString();
+		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Reward inventory of player %s still loading at PostLogin"), *Record->CognitoId);
 	}
 
 	// Create player session (state: CREATED)
-	FPlayerSession PlayerSession = SessionManager->CreateSession(PlayerId, CurrentSessionId);
+	FPlayerSession PlayerSession = SessionManager->CreateSession(Record->CognitoId, CurrentSessionId);
 
 	// Track player session
-	PlayerToSessionMap.Add(PlayerId, PlayerSession.SessionId);
+	Players.SetSessionId(Player, PlayerSession.SessionId);
 
 	// Start session (transition CREATED → ACTIVE)
 	SessionManager->StartSession(PlayerSession.SessionId);
 
 	// Log player join event
 	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Player joined - Session: %s, PlayerSession: %s"), 
-		*CurrentSessionId, *PlayerSession.SessionId);
+		*CurrentSessionId, *PlayerSession.SessionId.ToString());
 
 	// Track join event
 	TMap<FString, FString> EventData;
@@ -538,33 +1074,16 @@ void AHMVRGameMode::OnPlayerJoined(APlayerController* NewPlayer)
 	SessionManager->TrackEvent(PlayerSession.SessionId, TEXT("player_join"), EventData);
 }
 
-void AHMVRGameMode::OnPlayerLeft(AController* ExitingPlayer)
+void AHMVRGameMode::OnPlayerLeft(const FHMVRPlayerRecord& Player)
 {
-	if (!ExitingPlayer || !SessionManager || !SessionAPIClient)
-	{
-		return;
-	}
-
-	// Read PlayerId from the PlayerState (set during Login from JWT sub claim)
-	FString PlayerId;
-	if (const APlayerController* PC = Cast<APlayerController>(ExitingPlayer))
-	{
-		if (const AHMVRPlayerState* PS = PC->GetPlayerState<AHMVRPlayerState>())
-		{
-			PlayerId = PS->CognitoPlayerId;
-		}
-	}
-	if (PlayerId.IsEmpty())
+	if (!SessionManager || !SessionAPIClient)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: OnPlayerLeft — PlayerId not on PlayerState, cannot persist session"));
 		return;
 	}
 
-	FString* SessionIdPtr = PlayerToSessionMap.Find(PlayerId);
-	
-	if (SessionIdPtr)
+	if (!Player.SessionId.IsEmpty())
 	{
-		FString SessionId = *SessionIdPtr;
+		const FHMVRId SessionId = Player.SessionId;
 
 		// Track leave event
 		TMap<FString, FString> EventData;
@@ -578,41 +1097,210 @@ void AHMVRGameMode::OnPlayerLeft(AController* ExitingPlayer)
 		// Generate session summary (Requirement 5.2)
 		FPlayerSessionSummary Summary = SessionManager->GenerateSessionSummary(SessionId);
 
-		// Send summary to Session API (stub - actual API in Task 15.4)
-		if (SessionAPIClient->SendSessionSummary(Summary))
+		// Discard gameplay state (keep only rewards)
+		SessionManager->DiscardSessionState(SessionId);
+
+		// Send summary to Session API
+		SendSessionSummary(Summary);
+
+		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Player left - Session ended: %s, Rewards: %d"), 
+			*SessionId.ToString(), Summary.Rewards.Num());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Player left but no session found"));
+	}
+
+	// When the last player leaves, by default the world is reset in place while the GameLift
+	// session stays active, so players placed into it within hmvr.GameLift.EmptySessionSeconds
+	// skip process launch and map load. Then, or at once with hmvr.GameLift.RecycleSessions 0,
+	// the process ends and the fleet replaces it (ProcessReady is once per process).
+	if (GetCurrentPlayerCount() == 0 && bGameLiftInitialized && GameLiftBackend && !bRecyclePending)
+	{
+		SessionEndTime = FPlatformTime::Seconds();
+		if (CVarRecycleSessions.GetValueOnGameThread() != 0)
 		{
-			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Session summary sent to API for session %s"), *SessionId);
+			// Not from inside Logout — the exiting controller is still being torn down
+			bRecyclePending = true;
+			GetWorldTimerManager().SetTimerForNextTick(this, &AHMVRGameMode::RecycleSession);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Failed to send session summary to API"));
+			UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Last player left — calling ProcessEnding"));
+			FString Error;
+			GameLiftBackend->ProcessEnding(Error);
+			FPlatformMisc::RequestExit(false);
 		}
+	}
+}
 
-		// Discard gameplay state (keep only rewards)
-		SessionManager->DiscardSessionState(SessionId);
+bool AHMVRGameMode::SendSessionSummary(const FPlayerSessionSummary& Summary)
+{
+	// The ended session is evicted once the summary is acknowledged, otherwise it expires after
+	// hmvr.Session.EndedRetentionSeconds. The player's reward inventory goes with it unless they
+	// have rejoined since, so neither memory nor the snapshot keeps every past player.
+	const FHMVRId SessionId = Summary.SessionId;
+	const FString PlayerId = Summary.PlayerId;
+	TWeakObjectPtr<AHMVRGameMode> WeakThis(this);
+	const bool bSent = SessionAPIClient->SendSessionSummary(Summary, [WeakThis, SessionId, PlayerId](bool bAcknowledged)
+	{
+		AHMVRGameMode* This = WeakThis.Get();
+		if (!bAcknowledged || !This)
+		{
+			return;
+		}
+		if (This->SessionManager)
+		{
+			This->SessionManager->AcknowledgeSummary(SessionId);
+		}
+		if (This->RewardSystem && !PlayerId.IsEmpty() && !This->Players.FindByCognitoId(PlayerId).IsSet())
+		{
+			This->RewardSystem->EvictPlayerRewards(PlayerId);
+		}
+	});
+	if (bSent)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Session summary sent to API for session %s"), *SessionId.ToString());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Failed to send session summary to API"));
+	}
+	return bSent;
+}
 
-		// Remove from tracking
-		PlayerToSessionMap.Remove(PlayerId);
+void AHMVRGameMode::RestoreRecoveredSessions(const FHMVRSessionSnapshot::FRecovered& Recovered)
+{
+	if (!SessionManager || !RewardSystem || !SessionAPIClient)
+	{
+		return;
+	}
 
-		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Player left - Session ended: %s, Rewards: %d"), 
-			*SessionId, Summary.Rewards.Num());
+	const double StartTime = FPlatformTime::Seconds();
+	for (const TPair<FString, TArray<FString>>& Player : Recovered.PlayerRewards)
+	{
+		RewardSystem->RestorePlayerRewards(Player.Key, Player.Value);
 	}
-	else
+
+	// Every recovered session lost its player with the crash; end it and send its summary again
+	int32 Restored = 0;
+	int32 Sent = 0;
+	for (const FPlayerSession& Session : Recovered.Sessions)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Player left but no session found"));
+		if (SessionManager->RestoreSession(Session))
+		{
+			++Restored;
+			Sent += SendSessionSummary(SessionManager->GenerateSessionSummary(Session.SessionId)) ? 1 : 0;
+		}
 	}
 
-#if WITH_GAMELIFT
-	// When the last player leaves, signal ProcessEnding so GameLift reclaims this
-	// server process and FlexMatch can place the next session. The process then
-	// exits and GameLift spins up a fresh one (SDK 4.x has no TerminateGameSession).
-	if (GetCurrentPlayerCount() == 0 && bGameLiftInitialized && GameLiftSdkModule)
+	const FHMVRSessionSnapshot::FStats& SnapshotStats = SessionSnapshot->GetStats();
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRGameMode: Recovered snapshot %llu written %s — %d sessions restored (%d summaries sent), rewards for %d players; read %.2f ms, restore %.2f ms"),
+		Recovered.Sequence, *Recovered.WrittenAt.ToIso8601(), Restored, Sent, Recovered.PlayerRewards.Num(),
+		SnapshotStats.RecoverMs, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void AHMVRGameMode::RecycleSession()
+{
+	if (!bRecyclePending)
 	{
-		UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Last player left — calling ProcessEnding"));
-		GameLiftSdkModule->ProcessEnding();
-		FPlatformMisc::RequestExit(false);
+		// Console: the session ends now
+		SessionEndTime = FPlatformTime::Seconds();
 	}
-#endif
+	bRecyclePending = false;
+	if (AdmissionController && AdmissionController->GetReservedCount() > 0 && GetCurrentPlayerCount() == 0)
+	{
+		// A join is still being admitted into this session; look again once it lands or lapses
+		bRecyclePending = true;
+		FTimerHandle RetryHandle;
+		GetWorldTimerManager().SetTimer(RetryHandle, this, &AHMVRGameMode::RecycleSession, 1.f, false);
+		return;
+	}
+	if (GetCurrentPlayerCount() > 0 || !bGameLiftInitialized || !GameLiftBackend)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: Not recycling — %d players connected, GameLift %s"),
+			GetCurrentPlayerCount(), GameLiftBackend ? TEXT("ready") : TEXT("not initialized"));
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Session empty — resetting the world in place, keeping the game session open"));
+
+	// Send what the players who left still have buffered
+	if (EventStream)
+	{
+		EventStream->FlushSync();
+	}
+	if (RewardLedger)
+	{
+		RewardLedger->Flush();
+	}
+	const double ResetStart = FPlatformTime::Seconds();
+
+	// Player and session state. Logout has already closed each player's session; anything still
+	// registered is a player who never logged out and is dropped unsent.
+	const int32 StalePlayerSessions = Players.Num();
+	Players.ForEach([this](FHMVRPlayerHandle, const FHMVRPlayerRecord& Stale)
+	{
+		if (SessionManager && !Stale.SessionId.IsEmpty())
+		{
+			SessionManager->EndSession(Stale.SessionId);
+			SessionManager->DiscardSessionState(Stale.SessionId);
+		}
+	});
+	Players.Reset();
+	if (RewardSystem)
+	{
+		RewardSystem->EvictAllPlayerRewards();
+	}
+
+	// World state. Pooled wave actors do not outlive the session; the authored ones are reset.
+	UHMVRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UHMVRActorPoolSubsystem>();
+	const int32 PooledReleased = Pool ? Pool->ReleaseAll() : 0;
+	int32 ResetCount = 0;
+	RegisteredInteractables.RemoveAll([](const TWeakObjectPtr<UHMVRInteractableComponent>& Ptr) { return !Ptr.IsValid(); });
+	for (const TWeakObjectPtr<UHMVRInteractableComponent>& Interactable : RegisteredInteractables)
+	{
+		if (Pool && Pool->IsParked(Interactable->GetOwner()))
+		{
+			continue;
+		}
+		Interactable->ResetForNewSession();
+		++ResetCount;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Reset %d interactables (%d pooled actors parked) and %d stale player sessions in %.1f ms"),
+		ResetCount, PooledReleased, StalePlayerSessions, (FPlatformTime::Seconds() - ResetStart) * 1000.0);
+
+	// Open to new player sessions again; end the process if nobody is placed here in time
+	ApplyCapacity();
+	GetWorldTimerManager().SetTimer(EmptySessionTimerHandle, this, &AHMVRGameMode::EndEmptySession,
+		FMath::Max(1.f, CVarEmptySessionSeconds.GetValueOnGameThread()), false);
+}
+
+void AHMVRGameMode::EndEmptySession()
+{
+	if (GetCurrentPlayerCount() > 0 || (AdmissionController && AdmissionController->GetReservedCount() > 0))
+	{
+		return; // someone joined; OnPlayerJoined clears the timer, a pending join lands or lapses
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameMode: Game session empty for %.0f s — calling ProcessEnding"),
+		FPlatformTime::Seconds() - SessionEndTime);
+	if (EventStream)
+	{
+		EventStream->FlushSync();
+	}
+	if (RewardLedger)
+	{
+		RewardLedger->Flush();
+	}
+	FString Error;
+	if (GameLiftBackend && !GameLiftBackend->ProcessEnding(Error))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: ProcessEnding failed: %s"), *Error);
+	}
+	FPlatformMisc::RequestExit(false);
 }
 
 void AHMVRGameMode::GrantRewardToPlayer(APlayerController* Player, const FString& RewardId)
@@ -622,14 +1310,14 @@ void AHMVRGameMode::GrantRewardToPlayer(APlayerController* Player, const FString
 		return;
 	}
 
-	FString PlayerId;
-	if (const AHMVRPlayerState* PS = Player->GetPlayerState<AHMVRPlayerState>())
-		PlayerId = PS->CognitoPlayerId;
-	if (PlayerId.IsEmpty())
+	const FHMVRPlayerRecord* Record = Players.Get(Players.FindByController(Player));
+	if (!Record || Record->CognitoId.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: GrantRewardToPlayer — no PlayerId on PlayerState, aborting"));
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameMode: GrantRewardToPlayer — player is not registered, aborting"));
 		return;
 	}
+	const FString PlayerId = Record->CognitoId;
+	const FHMVRId SessionId = Record->SessionId;
 
 	// Grant reward with validation (Requirement 5.3, 15.2, 15.3)
 	FRewardGrantResult Result = RewardSystem->GrantReward(PlayerId, RewardId);
@@ -640,16 +1328,15 @@ void AHMVRGameMode::GrantRewardToPlayer(APlayerController* Player, const FString
 			*RewardId, *PlayerId);
 
 		// Add reward to player session
-		FString* SessionIdPtr = PlayerToSessionMap.Find(PlayerId);
-		if (SessionIdPtr)
+		if (!SessionId.IsEmpty())
 		{
-			SessionManager->AddReward(*SessionIdPtr, RewardId);
+			SessionManager->AddReward(SessionId, RewardId);
 
 			// Track reward grant event
 			TMap<FString, FString> EventData;
 			EventData.Add(TEXT("reward_id"), RewardId);
 			EventData.Add(TEXT("action"), TEXT("reward_granted"));
-			SessionManager->TrackEvent(*SessionIdPtr, TEXT("reward_grant"), EventData);
+			SessionManager->TrackEvent(SessionId, TEXT("reward_grant"), EventData);
 		}
 	}
 	else
@@ -10,9 +10,16 @@
 #include "SessionAPIClient.h"
 #include "HMVRPlayerState.h"
 #include "HMVRInteractableComponent.h"
+#include "HMVRScenePlanLoader.h"
+#include "HMVRAdmissionController.h"
+#include "HMVRPlayerRegistry.h"
+#include "HMVRCapacityController.h"
+#include "HMVREventStream.h"
+#include "HMVRSessionSnapshot.h"
+#include "HMVRRewardLedger.h"
 #include "HMVRGameMode.generated.h"
 
-class FGameLiftServerSDKModule; // incomplete type; only used as pointer — no header needed
+class IHMVRGameLiftBackend;
 
 /**
  * Server-authoritative Game Mode for VR Multiplayer
@@ -28,7 +35,8 @@ public:
 
 	// GameMode overrides
 	virtual void BeginPlay() override;
-	virtual void PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PreLoginAsync(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, const FOnPreLoginCompleteDelegate& OnComplete) override;
 	virtual APlayerController* Login(UPlayer* NewPlayer, ENetRole InRemoteRole, const FString& Portal, const FString& Options, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage) override;
 	virtual void Logout(AController* Exiting) override;
 	virtual void PostLogin(APlayerController* NewPlayer) override;
@@ -45,24 +53,62 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Server")
 	int32 GetCurrentPlayerCount() const;
 
-	// Check if server can accept more players
+	// Check if server can accept more players (connected + joins holding an admission reservation)
 	UFUNCTION(BlueprintCallable, Category = "Server")
 	bool CanAcceptNewPlayer() const;
 
+	// Players this shard admits right now: MaxPlayers scaled down by measured server load
+	UFUNCTION(BlueprintCallable, Category = "Server")
+	int32 GetAdmissionLimit() const;
+
+	const FHMVRCapacityController& GetCapacityController() const { return Capacity; }
+
+	// Interaction event streaming to the Session API; null until InitGame
+	const FHMVREventStream* GetEventStream() const { return EventStream.Get(); }
+
+	// Crash snapshot of sessions and rewards; null until InitGame or with hmvr.Snapshot.Enabled 0
+	const FHMVRSessionSnapshot* GetSessionSnapshot() const { return SessionSnapshot.Get(); }
+
+	// Durable reward grant upload; null until InitGame or if its log could not be opened
+	const FHMVRRewardLedger* GetRewardLedger() const { return RewardLedger.Get(); }
+
+	// Join admission (slot reservations, off-thread validation); null until InitGame
+	FHMVRAdmissionController* GetAdmissionController() const { return AdmissionController.Get(); }
+
+	// Track an interactable for the session; persistent ones load their saved state
+	void RegisterInteractable(UHMVRInteractableComponent* Interactable);
+
+	// Spawns the world from a ScenePlan (?ScenePlan=, -ScenePlan= or DefaultGame.ini)
+	UHMVRScenePlanLoader* GetScenePlanLoader() const { return ScenePlanLoader; }
+
+	// GameLift game session id, or a local one outside GameLift
+	const FString& GetCurrentSessionId() const { return CurrentSessionId; }
+
+	// Warm recycling inside the game session (hmvr.GameLift.RecycleSessions): drop player and
+	// session state and put every interactable back to its baseline while the GameLift session
+	// stays active. If nobody joins within hmvr.GameLift.EmptySessionSeconds the process ends
+	// (ProcessEnding, exit) and the fleet replaces it; the SDK allows one ProcessReady per process.
+	void RecycleSession();
+
 protected:
-	// JWT authentication (Requirement 3.1-3.4)
-	bool ValidateJWTToken(const FString& Token, FString& OutPlayerId, FString& OutErrorMessage);
+	// JWT authentication (Requirement 3.1-3.4). Thread-safe — runs in the admission worker.
+	static bool ValidateJWTToken(const FString& Token, FString& OutPlayerId, FString& OutErrorMessage);
 
-	// GameLift integration (server only; no-op implementations on client builds)
+	// GameLift integration (dedicated server; inert when the game instance has no GameLift backend)
 	void InitializeGameLift();
+	void HandleGameLiftSessionStarted(const FString& GameSessionId);
 	void ReportServerHealth();
-	bool ValidatePlayerSession(const FString& PlayerSessionId, FString& OutErrorMessage);
-	void AcceptPlayerSession(const FString& PlayerSessionId);
+	void ApplyCapacity(); // push health and the player session creation policy to GameLift
+	static bool ValidatePlayerSession(const FString& PlayerSessionId, FString& OutErrorMessage); // thread-safe
+	bool AcceptPlayerSession(const FString& PlayerSessionId, FString& OutErrorMessage);
 	void RemovePlayerSession(const FString& PlayerSessionId);
+	bool IsJoinInProgress(const FHMVRAdmission& Admission) const; // logged in or loading, not yet PostLogin
 
 	// Session management
-	void OnPlayerJoined(APlayerController* NewPlayer);
-	void OnPlayerLeft(AController* ExitingPlayer);
+	void OnPlayerJoined(FHMVRPlayerHandle Player);
+	void OnPlayerLeft(const FHMVRPlayerRecord& Player); // already removed from the registry
+	bool SendSessionSummary(const FPlayerSessionSummary& Summary); // evicts the session once acknowledged
+	void RestoreRecoveredSessions(const FHMVRSessionSnapshot::FRecovered& Recovered);
 
 	// Reward system
 	UFUNCTION(BlueprintCallable, Category = "Rewards")
@@ -81,12 +127,22 @@ protected:
 	USessionAPIClient* GetSessionAPIClient() const { return SessionAPIClient; }
 
 private:
-	// Track connected players
-	TArray<TWeakObjectPtr<APlayerController>> ConnectedPlayers;
+	// Connected players, indexed by controller, Cognito id, GameLift player session and session id
+	FHMVRPlayerRegistry Players;
 
-	// Interactable objects placed in the level — populated in BeginPlay
+	// Interactable objects placed in the level or spawned from the ScenePlan
 	TArray<TWeakObjectPtr<UHMVRInteractableComponent>> RegisteredInteractables;
 
+	// Rebuild the GM hook table once a ScenePlan has finished spawning
+	void OnScenePlanLoaded(bool bSuccess);
+
+	// Spawn the placeholder floor and vase used when no ScenePlan is loaded
+	void SpawnDefaultGeometry();
+
+	// ScenePlan loader
+	UPROPERTY()
+	UHMVRScenePlanLoader* ScenePlanLoader;
+
 	// Session manager
 	UPROPERTY()
 	USessionManager* SessionManager;
@@ -99,17 +155,32 @@ private:
 	UPROPERTY()
 	USessionAPIClient* SessionAPIClient;
 
-	// Player session tracking (PlayerId -> SessionId)
-	TMap<FString, FString> PlayerToSessionMap;
-
 	// GameLift SDK integration (server only; inert on client builds)
 	bool bGameLiftInitialized = false;
 	bool bGameLiftProcessReady = false;
 	FTimerHandle HealthReportTimerHandle;
-	FGameLiftServerSDKModule* GameLiftSdkModule = nullptr;
+	IHMVRGameLiftBackend* GameLiftBackend = nullptr; // owned by the game instance
+	FDelegateHandle GameLiftSessionStartedHandle;
+	double SessionEndTime = 0.0;
+	bool bRecyclePending = false;
+	FTimerHandle EmptySessionTimerHandle;
+	void EndEmptySession();
+
+	// Join admission
+	TSharedPtr<FHMVRAdmissionController> AdmissionController;
+
+	// Interaction events (SessionManager pushes, this owns)
+	TSharedPtr<FHMVREventStream> EventStream;
+
+	// Session and reward state on local disk, for recovery after a crash
+	TSharedPtr<FHMVRSessionSnapshot> SessionSnapshot;
+
+	// Reward grants on their way to the PlayerRewards table (RewardSystem appends, this owns)
+	TSharedPtr<FHMVRRewardLedger> RewardLedger;
 
-	// Track player sessions for GameLift
-	TMap<FString, FString> PlayerSessionMap; // PlayerSessionId -> PlayerId
+	// Load-derived admission limit and health
+	FHMVRCapacityController Capacity;
+	bool bAcceptingPlayerSessions = true; // last creation policy sent to GameLift
 
 	// Session tracking
 	FString CurrentSessionId;
@@ -0,0 +1,419 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRGameplayTimers.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "TimerManager.h"
+
+static TAutoConsoleVariable<float> CVarTimersPersistInterval(
+	TEXT("hmvr.Timers.PersistIntervalSeconds"),
+	1.f,
+	TEXT("How soon after a keyed gameplay timer is scheduled, cancelled or fired the pending set is rewritten to disk."));
+
+static TAutoConsoleVariable<int32> CVarTimersPersist(
+	TEXT("hmvr.Timers.Persist"),
+	1,
+	TEXT("Persist keyed gameplay timers next to the session snapshot and resume them after a crash (read at InitGame)."));
+
+static TAutoConsoleVariable<float> CVarTimersRestoreGrace(
+	TEXT("hmvr.Timers.RestoreGraceSeconds"),
+	120.f,
+	TEXT("Restored timers whose owner has not called ResumePersisted this long after the restore are dropped."));
+
+static FAutoConsoleCommandWithWorld CmdTimersStats(
+	TEXT("HMVR.Timers.Stats"),
+	TEXT("Log pending gameplay timers, fired and cancelled counts and the cost of the last advance."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UHMVRGameplayTimerSubsystem* Timers = World ? World->GetSubsystem<UHMVRGameplayTimerSubsystem>() : nullptr)
+		{
+			Timers->LogStats();
+		}
+	}));
+
+namespace
+{
+	constexpr uint32 PersistMagic = 0x4D54564D; // 'MVTM'
+	constexpr uint32 PersistVersion = 1;
+
+	struct FPersistHeader
+	{
+		uint32 Magic = PersistMagic;
+		uint32 Version = PersistVersion;
+		int64 WrittenAtTicks = 0;
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+	};
+}
+
+bool UHMVRGameplayTimerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHMVRGameplayTimerSubsystem::Deinitialize()
+{
+	Wheel.Reset();
+	Restored.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UHMVRGameplayTimerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHMVRGameplayTimerSubsystem, STATGROUP_Tickables);
+}
+
+bool UHMVRGameplayTimerSubsystem::IsPersistenceEnabled()
+{
+	return CVarTimersPersist.GetValueOnGameThread() != 0;
+}
+
+double UHMVRGameplayTimerSubsystem::Now() const
+{
+	return GetWorld()->GetTimeSeconds();
+}
+
+FHMVRGameplayTimerHandle UHMVRGameplayTimerSubsystem::Schedule(UObject* Target, FName Event, float DelaySeconds, const FString& PersistKey)
+{
+	FHMVRGameplayTimerHandle Handle;
+	if (!Target)
+	{
+		return Handle;
+	}
+
+	FTimer Timer;
+	Timer.Target = Target;
+	Timer.Event = Event;
+	Timer.PersistKey = PersistKey;
+	Handle.Value = Wheel.Schedule(Now(), FMath::Max(0.f, DelaySeconds), MoveTemp(Timer));
+	++Stats.Scheduled;
+	bPersistDirty |= !PersistKey.IsEmpty();
+	return Handle;
+}
+
+void UHMVRGameplayTimerSubsystem::Cancel(FHMVRGameplayTimerHandle& Handle)
+{
+	if (const FTimer* Timer = Wheel.Find(Handle.Value))
+	{
+		bPersistDirty |= !Timer->PersistKey.IsEmpty();
+		Wheel.Cancel(Handle.Value);
+		++Stats.Cancelled;
+	}
+	Handle.Invalidate();
+}
+
+bool UHMVRGameplayTimerSubsystem::IsPending(const FHMVRGameplayTimerHandle& Handle) const
+{
+	return Wheel.IsPending(Handle.Value);
+}
+
+void UHMVRGameplayTimerSubsystem::Tick(float DeltaTime)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	Wheel.Advance(Now(), [this](TArray<FTimer>& Batch)
+	{
+		Fire(Batch);
+	});
+	Stats.LastAdvanceMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	Stats.MaxAdvanceMs = FMath::Max(Stats.MaxAdvanceMs, Stats.LastAdvanceMs);
+	Stats.Pending = Wheel.Num();
+
+	if (Restored.Num() > 0 && Now() >= RestoreDeadline)
+	{
+		ExpireUnclaimedRestored();
+	}
+
+	if (bPersistDirty && !PersistPath.IsEmpty())
+	{
+		const double WallNow = FPlatformTime::Seconds();
+		if (NextPersistTime <= 0.0)
+		{
+			NextPersistTime = WallNow + FMath::Max(0.f, CVarTimersPersistInterval.GetValueOnGameThread());
+		}
+		else if (WallNow >= NextPersistTime && (!PendingWrite.IsValid() || PendingWrite.IsReady()))
+		{
+			WritePersisted();
+		}
+	}
+}
+
+void UHMVRGameplayTimerSubsystem::ExpireUnclaimedRestored()
+{
+	// The owner never began play (removed from the plan, renamed, or its level is gone); without
+	// this the timer would be written back on every persist forever
+	for (const FPersistedTimer& Timer : Restored)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGameplayTimers: Dropping restored %s %s - not resumed within %.0f s"),
+			*Timer.PersistKey, *Timer.Event.ToString(), CVarTimersRestoreGrace.GetValueOnGameThread());
+	}
+	Stats.RestoredExpired += Restored.Num();
+	Restored.Reset();
+	bPersistDirty = true;
+}
+
+void UHMVRGameplayTimerSubsystem::Fire(TArray<FTimer>& Batch)
+{
+	Stats.LargestBatch = FMath::Max(Stats.LargestBatch, Batch.Num());
+	for (FTimer& Timer : Batch)
+	{
+		bPersistDirty |= !Timer.PersistKey.IsEmpty();
+		IHMVRGameplayTimerTarget* Target = Cast<IHMVRGameplayTimerTarget>(Timer.Target.Get());
+		if (!Target)
+		{
+			++Stats.StaleTargets;
+			continue;
+		}
+		++Stats.Fired;
+		Target->OnGameplayTimer(Timer.Event);
+	}
+}
+
+FHMVRGameplayTimerHandle UHMVRGameplayTimerSubsystem::ResumePersisted(UObject* Target, FName Event, const FString& PersistKey)
+{
+	const int32 Index = PersistKey.IsEmpty() ? INDEX_NONE : Restored.IndexOfByPredicate([&](const FPersistedTimer& Timer)
+	{
+		return Timer.Event == Event && Timer.PersistKey == PersistKey;
+	});
+	if (Index == INDEX_NONE)
+	{
+		return FHMVRGameplayTimerHandle();
+	}
+
+	const double Remaining = Restored[Index].RemainingSeconds;
+	Restored.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	++Stats.Resumed;
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameplayTimers: Resuming %s %s with %.2f s left"), *PersistKey, *Event.ToString(), Remaining);
+	return Schedule(Target, Event, static_cast<float>(Remaining), PersistKey);
+}
+
+bool UHMVRGameplayTimerSubsystem::RestorePersisted(const FString& Path, FString& OutError)
+{
+	PersistPath = Path;
+	Restored.Reset();
+
+	if (!IFileManager::Get().FileExists(*Path))
+	{
+		return true; // first run on this slot
+	}
+
+	TArray<uint8> Bytes;
+	FPersistHeader Header;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path) || Bytes.Num() < static_cast<int32>(sizeof(FPersistHeader)))
+	{
+		OutError = FString::Printf(TEXT("Could not read %s"), *Path);
+		return false;
+	}
+	FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(FPersistHeader));
+	if (Header.Magic != PersistMagic || Header.Version != PersistVersion
+		|| Header.PayloadSize != static_cast<uint32>(Bytes.Num() - sizeof(FPersistHeader))
+		|| FCrc::MemCrc32(Bytes.GetData() + sizeof(FPersistHeader), Header.PayloadSize) != Header.PayloadCrc)
+	{
+		OutError = FString::Printf(TEXT("%s is torn or from another version"), *Path);
+		return false;
+	}
+
+	// The clock kept running while the server was down
+	const double DownSeconds = FMath::Max(0.0, (FDateTime::UtcNow() - FDateTime(Header.WrittenAtTicks)).GetTotalSeconds());
+
+	FMemoryReader Ar(Bytes);
+	Ar.Seek(sizeof(FPersistHeader));
+	int32 Num = 0;
+	Ar << Num;
+	for (int32 i = 0; i < Num && !Ar.IsError(); ++i)
+	{
+		FPersistedTimer& Timer = Restored.AddDefaulted_GetRef();
+		Ar << Timer.PersistKey << Timer.Event << Timer.RemainingSeconds;
+		Timer.RemainingSeconds = FMath::Max(0.0, Timer.RemainingSeconds - DownSeconds);
+	}
+	if (Ar.IsError())
+	{
+		Restored.Reset();
+		OutError = FString::Printf(TEXT("%s is malformed"), *Path);
+		return false;
+	}
+
+	Stats.Restored = Restored.Num();
+	RestoreDeadline = Now() + FMath::Max(0.f, CVarTimersRestoreGrace.GetValueOnGameThread());
+	UE_LOG(LogTemp, Log, TEXT("HMVRGameplayTimers: Restored %d pending timers from %s (server was down %.1f s)"),
+		Restored.Num(), *Path, DownSeconds);
+	return true;
+}
+
+void UHMVRGameplayTimerSubsystem::WritePersisted()
+{
+	bPersistDirty = false;
+	NextPersistTime = 0.0;
+
+	// Keyed timers still pending, plus restored ones whose owner has not come back yet
+	TArray<FPersistedTimer> Pending = Restored;
+	Wheel.ForEachPending(Now(), [&Pending](const FTimer& Timer, double RemainingSeconds)
+	{
+		if (!Timer.PersistKey.IsEmpty())
+		{
+			Pending.Add({ Timer.PersistKey, Timer.Event, RemainingSeconds });
+		}
+	});
+
+	TArray<uint8> Bytes;
+	Bytes.AddZeroed(sizeof(FPersistHeader));
+	FMemoryWriter Ar(Bytes);
+	Ar.Seek(sizeof(FPersistHeader));
+	int32 Num = Pending.Num();
+	Ar << Num;
+	for (FPersistedTimer& Timer : Pending)
+	{
+		Ar << Timer.PersistKey << Timer.Event << Timer.RemainingSeconds;
+	}
+
+	FPersistHeader Header;
+	Header.WrittenAtTicks = FDateTime::UtcNow().GetTicks();
+	Header.PayloadSize = static_cast<uint32>(Bytes.Num() - sizeof(FPersistHeader));
+	Header.PayloadCrc = FCrc::MemCrc32(Bytes.GetData() + sizeof(FPersistHeader), Header.PayloadSize);
+	FMemory::Memcpy(Bytes.GetData(), &Header, sizeof(FPersistHeader));
+	++Stats.PersistWrites;
+
+	// Side file then rename, so a crash mid-write leaves the previous set
+	PendingWrite = Async(EAsyncExecution::ThreadPool, [Path = PersistPath, Bytes = MoveTemp(Bytes)]()
+	{
+		const FString TempPath = Path + TEXT(".tmp");
+		if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, /*bReplace=*/true))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGameplayTimers: Could not write %s"), *Path);
+		}
+	});
+}
+
+void UHMVRGameplayTimerSubsystem::LogStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRGameplayTimers: %d pending (%d restored not yet resumed) | scheduled %lld, cancelled %lld, fired %lld, stale targets %lld, largest batch %d | resumed %d of %d restored (%d dropped unclaimed), %lld persist writes | advance %.3f ms last, %.3f ms max"),
+		Wheel.Num(), Restored.Num(), Stats.Scheduled, Stats.Cancelled, Stats.Fired, Stats.StaleTargets, Stats.LargestBatch,
+		Stats.Resumed, Stats.Restored, Stats.RestoredExpired, Stats.PersistWrites, Stats.LastAdvanceMs, Stats.MaxAdvanceMs);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	struct FTimersBench
+	{
+		THMVRHierarchicalTimingWheel<int32> Wheel;
+		FTimerManager TimerManager;
+		double SimTime = 0.0;
+		double EndTime = 0.0;
+		int32 WheelFired = 0;
+		int32 TimerManagerFired = 0;
+		int32 Frames = 0;
+		double WheelAdvanceMs = 0.0;
+		double WheelMaxFrameMs = 0.0;
+		double TimerManagerTickMs = 0.0;
+		double TimerManagerMaxFrameMs = 0.0;
+	};
+
+	bool bTimersBenchRunning = false;
+}
+
+// Both sides get the same delays (0.1–10 s), the same cancellations (every fourth) and the same
+// simulated 50 ms frames. FTimerManager only ticks once per engine frame, so the drain phase
+// steps both one simulated frame per real frame.
+static FAutoConsoleCommandWithWorldAndArgs CmdTimersBench(
+	TEXT("HMVR.Timers.Bench"),
+	TEXT("HMVR.Timers.Bench [Count=10000] — schedule, cancel and expiry cost of the gameplay timer wheel vs. FTimerManager."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (bTimersBenchRunning)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGameplayTimers: Bench already running"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		TSharedRef<FTimersBench> Bench = MakeShared<FTimersBench>();
+		FRandomStream Random(Count);
+		TArray<float> Delays;
+		Delays.SetNumUninitialized(Count);
+		for (float& Delay : Delays)
+		{
+			Delay = Random.FRandRange(0.1f, 10.f);
+		}
+
+		TArray<uint64> WheelHandles;
+		WheelHandles.Reserve(Count);
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			WheelHandles.Add(Bench->Wheel.Schedule(0.0, Delays[i], i));
+		}
+		const double WheelScheduleMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		TArray<FTimerHandle> TimerHandles;
+		TimerHandles.SetNum(Count);
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Bench->TimerManager.SetTimer(TimerHandles[i], FTimerDelegate::CreateLambda([Bench = &Bench.Get()]()
+			{
+				++Bench->TimerManagerFired;
+			}), Delays[i], false);
+		}
+		const double TimerManagerScheduleMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; i += 4)
+		{
+			Bench->Wheel.Cancel(WheelHandles[i]);
+		}
+		const double WheelCancelMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; i += 4)
+		{
+			Bench->TimerManager.ClearTimer(TimerHandles[i]);
+		}
+		const double TimerManagerCancelMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		UE_LOG(LogTemp, Log, TEXT("HMVRGameplayTimers: Bench %d timers — schedule: wheel %.3f ms, FTimerManager %.3f ms; cancel %d: wheel %.3f ms, FTimerManager %.3f ms; draining over ~10.5 s of simulated frames"),
+			Count, WheelScheduleMs, TimerManagerScheduleMs, (Count + 3) / 4, WheelCancelMs, TimerManagerCancelMs);
+
+		Bench->EndTime = 10.5;
+		bTimersBenchRunning = true;
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Bench, Count](float)
+		{
+			constexpr float FrameSeconds = 0.05f;
+			Bench->SimTime += FrameSeconds;
+			++Bench->Frames;
+
+			double StartTime = FPlatformTime::Seconds();
+			Bench->Wheel.Advance(Bench->SimTime, [&Bench](TArray<int32>& Batch)
+			{
+				Bench->WheelFired += Batch.Num();
+			});
+			double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			Bench->WheelAdvanceMs += FrameMs;
+			Bench->WheelMaxFrameMs = FMath::Max(Bench->WheelMaxFrameMs, FrameMs);
+
+			StartTime = FPlatformTime::Seconds();
+			Bench->TimerManager.Tick(FrameSeconds);
+			FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			Bench->TimerManagerTickMs += FrameMs;
+			Bench->TimerManagerMaxFrameMs = FMath::Max(Bench->TimerManagerMaxFrameMs, FrameMs);
+
+			if (Bench->SimTime < Bench->EndTime)
+			{
+				return true;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("HMVRGameplayTimers: Bench drain over %d frames — wheel fired %d in %.3f ms (%.4f ms max frame); FTimerManager fired %d in %.3f ms (%.4f ms max frame); %d expected"),
+				Bench->Frames, Bench->WheelFired, Bench->WheelAdvanceMs, Bench->WheelMaxFrameMs,
+				Bench->TimerManagerFired, Bench->TimerManagerTickMs, Bench->TimerManagerMaxFrameMs, Count - (Count + 3) / 4);
+			bTimersBenchRunning = false;
+			return false;
+		}));
+	}));
+#endif
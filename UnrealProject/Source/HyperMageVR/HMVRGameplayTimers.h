@@ -0,0 +1,140 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "HMVRTimingWheel.h"
+#include "HMVRGameplayTimers.generated.h"
+
+UINTERFACE(MinimalAPI)
+class UHMVRGameplayTimerTarget : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/** Receives the timers it scheduled on UHMVRGameplayTimerSubsystem. */
+class HYPERMAGEVR_API IHMVRGameplayTimerTarget
+{
+	GENERATED_BODY()
+
+public:
+	// Server: the timer scheduled with this Event is due. Handles for it are already stale.
+	virtual void OnGameplayTimer(FName Event) {}
+};
+
+/** A pending gameplay timer; zero is never a valid handle. */
+struct FHMVRGameplayTimerHandle
+{
+	uint64 Value = 0;
+
+	bool IsValid() const { return Value != 0; }
+	void Invalidate() { Value = 0; }
+};
+
+/**
+ * Server-side timers for gameplay-state transitions (machinery unlocks, environmental sequences,
+ * creature thinking), kept in one THMVRHierarchicalTimingWheel instead of an entry each in the
+ * world timer manager's heap. Schedule and Cancel are O(1); the wheel advances on world time
+ * once a frame and every timer due that frame is delivered as one batch.
+ *
+ * Timers scheduled with a PersistKey (an interactable's ObjectId) are also written, with their
+ * remaining time, to a CRC-checked file once hmvr.Timers.PersistIntervalSeconds after they
+ * change. A recovered server loads that file at startup (RestorePersisted) and hands each
+ * timer back when its owner calls ResumePersisted from BeginPlay, less the time the server was
+ * down — so an unlock or sequence in progress when the process died still completes. A restored
+ * timer nobody resumes within hmvr.Timers.RestoreGraceSeconds is dropped rather than carried
+ * into every later write. Persistence is switched by hmvr.Timers.Persist, independently of the
+ * session snapshot (the file lives in the snapshot directory either way).
+ *
+ * HMVR.Timers.Stats prints counters; HMVR.Timers.Bench compares the wheel with FTimerManager.
+ */
+UCLASS()
+class HYPERMAGEVR_API UHMVRGameplayTimerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Call Target->OnGameplayTimer(Event) DelaySeconds of world time from now. */
+	FHMVRGameplayTimerHandle Schedule(UObject* Target, FName Event, float DelaySeconds, const FString& PersistKey = FString());
+
+	/** Drop Handle if it is still pending, and invalidate it either way. */
+	void Cancel(FHMVRGameplayTimerHandle& Handle);
+
+	bool IsPending(const FHMVRGameplayTimerHandle& Handle) const;
+
+	/**
+	 * Reschedule for Target the persisted timer for (PersistKey, Event) that RestorePersisted
+	 * loaded, if there is one; invalid handle otherwise. Each restored timer resumes once.
+	 */
+	FHMVRGameplayTimerHandle ResumePersisted(UObject* Target, FName Event, const FString& PersistKey);
+
+	/**
+	 * Persist keyed timers to Path from now on, and load what a previous process left there for
+	 * ResumePersisted. False (with OutError) if the file exists but cannot be read; persisting
+	 * is on regardless.
+	 */
+	bool RestorePersisted(const FString& Path, FString& OutError);
+
+	/** hmvr.Timers.Persist */
+	static bool IsPersistenceEnabled();
+
+	struct FStats
+	{
+		int32 Pending = 0;
+		int64 Scheduled = 0;
+		int64 Cancelled = 0;
+		int64 Fired = 0;
+		int64 StaleTargets = 0;  // due, but the target was gone
+		int32 LargestBatch = 0;
+		int32 Restored = 0;      // loaded by RestorePersisted
+		int32 Resumed = 0;       // handed back by ResumePersisted
+		int32 RestoredExpired = 0; // restored, but not resumed within the grace period
+		int64 PersistWrites = 0;
+		double LastAdvanceMs = 0.0;
+		double MaxAdvanceMs = 0.0;
+	};
+	const FStats& GetStats() const { return Stats; }
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FTimer
+	{
+		TWeakObjectPtr<UObject> Target;
+		FName Event;
+		FString PersistKey;
+	};
+
+	struct FPersistedTimer
+	{
+		FString PersistKey;
+		FName Event;
+		double RemainingSeconds = 0.0;
+	};
+
+	double Now() const;
+	void Fire(TArray<FTimer>& Batch);
+	void WritePersisted();
+	void ExpireUnclaimedRestored();
+
+	THMVRHierarchicalTimingWheel<FTimer> Wheel;
+	TArray<FPersistedTimer> Restored;
+	double RestoreDeadline = 0.0; // world time after which unclaimed Restored entries are dropped
+	FString PersistPath;
+	TFuture<void> PendingWrite; // one write at a time; a later change waits for it
+	double NextPersistTime = 0.0;
+	bool bPersistDirty = false;
+	FStats Stats;
+};
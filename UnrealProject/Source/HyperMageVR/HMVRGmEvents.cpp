@@ -0,0 +1,725 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRGmEvents.h"
+#include "HMVRGameMode.h"
+#include "HMVRInteractable.h"
+#include "HMVRInteractableComponent.h"
+#include "HMVRScenePlan.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Hash/CityHash.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+static TAutoConsoleVariable<bool> CVarGmEnabled(
+	TEXT("hmvr.GM.Enabled"), true,
+	TEXT("Listen for GM control events on the server (read at world begin play)."));
+
+static TAutoConsoleVariable<int32> CVarGmPortOffset(
+	TEXT("hmvr.GM.PortOffset"), 1000,
+	TEXT("GM control events are received on UDP game port + this offset (0 = off). -GmEventPort=<port> overrides."));
+
+static TAutoConsoleVariable<FString> CVarGmBindAddress(
+	TEXT("hmvr.GM.BindAddress"), TEXT("127.0.0.1"),
+	TEXT("Address the GM event receiver binds to. Loopback only: events carry no signature yet, so the relay on the instance forwards from the LARP Integration API."));
+
+static TAutoConsoleVariable<int32> CVarGmQueueCapacity(
+	TEXT("hmvr.GM.QueueCapacity"), 256,
+	TEXT("GM events buffered between the receiver thread and the game thread (rounded up to a power of two)."));
+
+static int32 GActiveGmListenPort = 0;
+
+static FAutoConsoleCommandWithWorld CmdGmStats(
+	TEXT("HMVR.GM.Stats"),
+	TEXT("Log GM control event counters, hook table size and queue / end-to-end latency percentiles."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UHMVRGmEventSubsystem* GmEvents = World ? World->GetSubsystem<UHMVRGmEventSubsystem>() : nullptr)
+		{
+			GmEvents->LogStats();
+		}
+	}));
+
+// ── Receiver ─────────────────────────────────────────────────────────────────
+
+/**
+ * Owns the UDP socket and the thread reading it. Each datagram is one GMControlEvent; it is
+ * parsed here and pushed into the ring, so the game thread only pops ready events.
+ */
+class FHMVRGmEventReceiver : public FRunnable
+{
+public:
+	/** Bind Address:Port and start the thread. Null (with OutError) if the socket cannot be bound. */
+	static TSharedPtr<FHMVRGmEventReceiver> Create(const FString& Address, int32 Port,
+	                                               THMVRBoundedRing<FHMVRGmEvent>& Ring, FString& OutError)
+	{
+		ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (!Sockets)
+		{
+			OutError = TEXT("no socket subsystem");
+			return nullptr;
+		}
+
+		bool bIsValid = false;
+		TSharedRef<FInternetAddr> BindAddr = Sockets->CreateInternetAddr();
+		BindAddr->SetIp(*Address, bIsValid);
+		BindAddr->SetPort(Port);
+		if (!bIsValid)
+		{
+			OutError = FString::Printf(TEXT("invalid bind address '%s'"), *Address);
+			return nullptr;
+		}
+
+		FSocket* Socket = Sockets->CreateSocket(NAME_DGram, TEXT("HMVR GM events"), BindAddr->GetProtocolType());
+		if (!Socket)
+		{
+			OutError = TEXT("could not create a UDP socket");
+			return nullptr;
+		}
+
+		int32 ActualSize = 0;
+		Socket->SetReceiveBufferSize(256 * 1024, ActualSize);
+		if (!Socket->SetNonBlocking(true) || !Socket->Bind(*BindAddr))
+		{
+			OutError = FString::Printf(TEXT("could not bind %s (%s)"), *BindAddr->ToString(true),
+				Sockets->GetSocketError(Sockets->GetLastErrorCode()));
+			Sockets->DestroySocket(Socket);
+			return nullptr;
+		}
+
+		TSharedPtr<FHMVRGmEventReceiver> Receiver = MakeShareable(new FHMVRGmEventReceiver(Socket, Ring));
+		Receiver->Thread = FRunnableThread::Create(Receiver.Get(), TEXT("HMVRGmEventReceiver"), 128 * 1024, TPri_AboveNormal);
+		if (!Receiver->Thread)
+		{
+			OutError = TEXT("could not start the receiver thread");
+			return nullptr;
+		}
+		return Receiver;
+	}
+
+	virtual ~FHMVRGmEventReceiver() override
+	{
+		if (Thread)
+		{
+			Thread->Kill(/*bShouldWait=*/true);
+			delete Thread;
+		}
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	}
+
+	virtual uint32 Run() override
+	{
+		ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		TSharedRef<FInternetAddr> From = Sockets->CreateInternetAddr();
+		TArray<uint8> Buffer;
+		Buffer.SetNumUninitialized(MaxDatagramBytes);
+		double NextMalformedLog = 0.0;
+
+		while (!bStopping.load(std::memory_order_relaxed))
+		{
+			// Wakes for data or every 100 ms to check bStopping
+			if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+			{
+				continue;
+			}
+
+			int32 BytesRead = 0;
+			while (Socket->RecvFrom(Buffer.GetData(), Buffer.Num(), BytesRead, *From) && BytesRead > 0)
+			{
+				const double Now = FPlatformTime::Seconds();
+				Received.fetch_add(1, std::memory_order_relaxed);
+
+				FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), BytesRead);
+				FHMVRGmEvent Event;
+				FString Error;
+				if (!FHMVRGmEvent::Parse(FString(Conv.Length(), Conv.Get()), Event, Error))
+				{
+					// A flood of junk must not turn into a flood of log lines on this thread;
+					// HMVR.GM.Stats has the full count
+					const int64 Count = Malformed.fetch_add(1, std::memory_order_relaxed) + 1;
+					if (Now >= NextMalformedLog)
+					{
+						NextMalformedLog = Now + MalformedLogIntervalSeconds;
+						UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: dropped a datagram from %s: %s (%lld malformed so far; logged at most every %.0f s)"),
+							*From->ToString(true), *Error, Count, MalformedLogIntervalSeconds);
+					}
+					continue;
+				}
+
+				Event.ReceivedTime = Now;
+				if (!Ring.TryPush(MoveTemp(Event)))
+				{
+					DroppedFull.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping.store(true, std::memory_order_relaxed);
+	}
+
+	// Any thread
+	std::atomic<int64> Received { 0 };
+	std::atomic<int64> Malformed { 0 };
+	std::atomic<int64> DroppedFull { 0 };
+
+private:
+	FHMVRGmEventReceiver(FSocket* InSocket, THMVRBoundedRing<FHMVRGmEvent>& InRing)
+		: Socket(InSocket)
+		, Ring(InRing)
+	{
+	}
+
+	static constexpr int32 MaxDatagramBytes = 65507;
+	static constexpr double MalformedLogIntervalSeconds = 10.0;
+
+	FSocket* Socket = nullptr;
+	THMVRBoundedRing<FHMVRGmEvent>& Ring;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping { false };
+};
+
+// ── Event ────────────────────────────────────────────────────────────────────
+
+bool FHMVRGmEvent::Parse(const FString& Json, FHMVRGmEvent& OutEvent, FString& OutError)
+{
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		OutError = TEXT("not a JSON object");
+		return false;
+	}
+
+	const TPair<const TCHAR*, FString*> Required[] =
+	{
+		{ TEXT("event_id"), &OutEvent.EventId },
+		{ TEXT("session_id"), &OutEvent.SessionId },
+		{ TEXT("hook_id"), &OutEvent.HookId },
+		{ TEXT("fired_by"), &OutEvent.FiredBy },
+	};
+	for (const TPair<const TCHAR*, FString*>& Field : Required)
+	{
+		if (!Root->TryGetStringField(Field.Key, *Field.Value) || Field.Value->IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("missing '%s'"), Field.Key);
+			return false;
+		}
+	}
+
+	FString FiredAt;
+	if (!Root->TryGetStringField(TEXT("fired_at"), FiredAt) || !FDateTime::ParseIso8601(*FiredAt, OutEvent.FiredAt))
+	{
+		OutError = TEXT("missing or malformed 'fired_at' (ISO 8601 expected)");
+		return false;
+	}
+
+	Root->TryGetStringField(TEXT("source"), OutEvent.Source);
+	Root->TryGetStringField(TEXT("note"), OutEvent.Note);
+	const TSharedPtr<FJsonObject>* Parameters = nullptr;
+	if (Root->TryGetObjectField(TEXT("parameters"), Parameters))
+	{
+		OutEvent.Parameters = *Parameters;
+	}
+
+	OutEvent.HookHash = HashHookId(OutEvent.HookId);
+	return true;
+}
+
+uint64 FHMVRGmEvent::HashHookId(const FString& HookId)
+{
+	return CityHash64(reinterpret_cast<const char*>(*HookId), HookId.Len() * sizeof(TCHAR));
+}
+
+// ── Latency ──────────────────────────────────────────────────────────────────
+
+void UHMVRGmEventSubsystem::FLatency::Add(double Ms)
+{
+	static constexpr int32 Window = 512;
+	++Count;
+	TotalMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+	if (Recent.Num() < Window)
+	{
+		Recent.Add(static_cast<float>(Ms));
+	}
+	else
+	{
+		Recent[NextRecent] = static_cast<float>(Ms);
+		NextRecent = (NextRecent + 1) % Window;
+	}
+}
+
+double UHMVRGmEventSubsystem::FLatency::Percentile(double P) const
+{
+	if (Recent.IsEmpty())
+	{
+		return 0.0;
+	}
+	TArray<float> Sorted = Recent;
+	Sorted.Sort();
+	return Sorted[FMath::Clamp(FMath::FloorToInt32(P * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+}
+
+// ── Subsystem ────────────────────────────────────────────────────────────────
+
+namespace
+{
+	/**
+	 * Datagrams are trusted as they are, so only processes on this host may send them until
+	 * events are signed. Literal loopback addresses only; names are not resolved here.
+	 */
+	bool IsLoopbackAddress(const FString& Address)
+	{
+		return Address.StartsWith(TEXT("127.")) || Address == TEXT("::1") || Address == TEXT("[::1]");
+	}
+
+	/**
+	 * "kind: subject → argument" ("->" also accepted). The target is the subject's last word,
+	 * so "creature: sleeping_guard → alert" and "vfx: activate ice_wall" name sleeping_guard
+	 * and ice_wall. False if there is no subject.
+	 */
+	bool ParseEffect(const FString& Effect, FString& OutTarget, FString& OutArgument)
+	{
+		const int32 Colon = Effect.Find(TEXT(":"));
+		FString Subject = Colon == INDEX_NONE ? Effect : Effect.RightChop(Colon + 1);
+
+		OutArgument.Reset();
+		for (const TCHAR* Arrow : { TEXT("\u2192"), TEXT("->") })
+		{
+			const int32 At = Subject.Find(Arrow);
+			if (At != INDEX_NONE)
+			{
+				OutArgument = Subject.RightChop(At + FCString::Strlen(Arrow)).TrimStartAndEnd();
+				Subject.LeftInline(At);
+				break;
+			}
+		}
+
+		Subject.TrimStartAndEndInline();
+		int32 LastSpace = INDEX_NONE;
+		OutTarget = Subject.FindLastChar(TEXT(' '), LastSpace) ? Subject.RightChop(LastSpace + 1) : Subject;
+		return !OutTarget.IsEmpty();
+	}
+}
+
+bool UHMVRGmEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHMVRGmEventSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() != NM_Client && CVarGmEnabled.GetValueOnGameThread())
+	{
+		StartReceiver();
+	}
+}
+
+void UHMVRGmEventSubsystem::Deinitialize()
+{
+	StopReceiver();
+	Hooks.Reset();
+	HookByHash.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UHMVRGmEventSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHMVRGmEventSubsystem, STATGROUP_Tickables);
+}
+
+void UHMVRGmEventSubsystem::StartReceiver()
+{
+	int32 Port = 0;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("GmEventPort="), Port))
+	{
+		const int32 Offset = CVarGmPortOffset.GetValueOnGameThread();
+		Port = Offset > 0 ? GetWorld()->URL.Port + Offset : 0;
+	}
+	if (Port <= 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRGmEvents: receiver disabled (no port)"));
+		return;
+	}
+
+	const FString Address = CVarGmBindAddress.GetValueOnGameThread();
+	if (!IsLoopbackAddress(Address))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRGmEvents: refusing to bind %s - GM events are not authenticated, so the receiver only listens on loopback; forward through the relay on the instance"),
+			*Address);
+		return;
+	}
+
+	Ring = MakeUnique<THMVRBoundedRing<FHMVRGmEvent>>(static_cast<uint32>(FMath::Max(2, CVarGmQueueCapacity.GetValueOnGameThread())));
+
+	FString Error;
+	Receiver = FHMVRGmEventReceiver::Create(Address, Port, *Ring, Error);
+	if (!Receiver.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRGmEvents: %s - GM hooks cannot be fired live"), *Error);
+		Ring.Reset();
+		return;
+	}
+
+	ListenPort = Port;
+	GActiveGmListenPort = Port;
+	UE_LOG(LogTemp, Log, TEXT("HMVRGmEvents: receiving GM control events on udp://%s:%d (queue %u)"),
+		*Address, Port, Ring->GetCapacity());
+}
+
+void UHMVRGmEventSubsystem::StopReceiver()
+{
+	if (Receiver.IsValid())
+	{
+		// Joins the thread before the ring it pushes into goes away
+		Stats.Received += Receiver->Received.load();
+		Stats.Malformed += Receiver->Malformed.load();
+		Stats.DroppedFull += Receiver->DroppedFull.load();
+		Receiver.Reset();
+	}
+	Ring.Reset();
+
+	if (GActiveGmListenPort == ListenPort)
+	{
+		GActiveGmListenPort = 0;
+	}
+	ListenPort = 0;
+}
+
+int32 UHMVRGmEventSubsystem::GetActiveListenPort()
+{
+	return GActiveGmListenPort;
+}
+
+void UHMVRGmEventSubsystem::BuildHookTable(const FHMVRScenePlan& Plan,
+                                           TArrayView<const TWeakObjectPtr<UHMVRInteractableComponent>> Interactables)
+{
+	Hooks.Reset(Plan.GmHooks.Num());
+	HookByHash.Reset();
+	Stats.UnresolvedEffects = 0;
+
+	TMap<FString, UHMVRInteractableComponent*> ById;
+	ById.Reserve(Interactables.Num());
+	for (const TWeakObjectPtr<UHMVRInteractableComponent>& Ptr : Interactables)
+	{
+		UHMVRInteractableComponent* Interactable = Ptr.Get();
+		if (Interactable && !Interactable->ObjectId.IsEmpty())
+		{
+			ById.Add(Interactable->ObjectId, Interactable);
+		}
+	}
+
+	for (const FHMVRScenePlanHook& PlanHook : Plan.GmHooks)
+	{
+		if (PlanHook.Id.IsEmpty())
+		{
+			continue;
+		}
+
+		const int32 Index = Hooks.Num();
+		FHook& Hook = Hooks.AddDefaulted_GetRef();
+		Hook.Id = PlanHook.Id;
+		Hook.Name = PlanHook.Name;
+		Hook.HookName = FName(*PlanHook.Id);
+
+		for (const FString& Effect : PlanHook.Effects)
+		{
+			FString Target;
+			FString Argument;
+			UHMVRInteractableComponent** Found = ParseEffect(Effect, Target, Argument) ? ById.Find(Target) : nullptr;
+			if (Found)
+			{
+				Hook.Targets.Add({ *Found, MoveTemp(Argument) });
+			}
+			else
+			{
+				++Stats.UnresolvedEffects;
+			}
+		}
+
+		// Events may name a hook by id or by its GM-facing label, as the LARP Integration API does
+		for (const FString* Key : { &Hook.Id, &Hook.Name })
+		{
+			if (Key->IsEmpty())
+			{
+				continue;
+			}
+			const uint64 Hash = FHMVRGmEvent::HashHookId(*Key);
+			if (const int32* Existing = HookByHash.Find(Hash))
+			{
+				if (*Existing != Index)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: '%s' already names hook '%s', not '%s'"),
+						**Key, *Hooks[*Existing].Id, *Hook.Id);
+				}
+				continue;
+			}
+			HookByHash.Add(Hash, Index);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRGmEvents: %d hooks from ScenePlan '%s' (%d effects name no interactable)"),
+		Hooks.Num(), *Plan.Id, Stats.UnresolvedEffects);
+}
+
+void UHMVRGmEventSubsystem::Tick(float DeltaTime)
+{
+	ProcessEvents();
+}
+
+void UHMVRGmEventSubsystem::ProcessEvents()
+{
+	if (!Ring.IsValid())
+	{
+		return;
+	}
+
+	Stats.PeakQueue = FMath::Max(Stats.PeakQueue, Ring->ApproxNum());
+	FHMVRGmEvent Event;
+	while (Ring->TryPop(Event))
+	{
+		Fire(Event);
+	}
+}
+
+const UHMVRGmEventSubsystem::FHook* UHMVRGmEventSubsystem::FindHook(const FHMVRGmEvent& Event) const
+{
+	const int32* Index = HookByHash.Find(Event.HookHash);
+	if (!Index)
+	{
+		return nullptr;
+	}
+	const FHook& Hook = Hooks[*Index];
+	return (Hook.Id == Event.HookId || Hook.Name == Event.HookId) ? &Hook : nullptr;
+}
+
+void UHMVRGmEventSubsystem::RememberEvent(const FString& EventId)
+{
+	if (RecentEventOrder.Num() < RecentEventCapacity)
+	{
+		RecentEventOrder.Add(EventId);
+	}
+	else
+	{
+		RecentEventIds.Remove(RecentEventOrder[NextRecentEvent]);
+		RecentEventOrder[NextRecentEvent] = EventId;
+		NextRecentEvent = (NextRecentEvent + 1) % RecentEventCapacity;
+	}
+	RecentEventIds.Add(EventId);
+}
+
+void UHMVRGmEventSubsystem::Fire(const FHMVRGmEvent& Event)
+{
+	// No game mode means no session to check against; nothing may fire unchecked
+	const AHMVRGameMode* GameMode = GetWorld()->GetAuthGameMode<AHMVRGameMode>();
+	if (!GameMode || Event.SessionId != GameMode->GetCurrentSessionId())
+	{
+		++Stats.WrongSession;
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: event %s is for session %s, not %s - dropped"),
+			*Event.EventId, *Event.SessionId, GameMode ? *GameMode->GetCurrentSessionId() : TEXT("(no HMVR game mode)"));
+		return;
+	}
+
+	if (RecentEventIds.Contains(Event.EventId))
+	{
+		++Stats.Duplicate;
+		return;
+	}
+
+	// Not remembered until the hook resolves, so a retry after the hook table is built still fires
+	const FHook* Hook = FindHook(Event);
+	if (!Hook)
+	{
+		++Stats.UnknownHook;
+		UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: unknown hook '%s' (event %s from %s)"),
+			*Event.HookId, *Event.EventId, *Event.FiredBy);
+		return;
+	}
+	RememberEvent(Event.EventId);
+
+	int32 Applied = 0;
+	for (const FHook::FTarget& Target : Hook->Targets)
+	{
+		UHMVRInteractableComponent* Interactable = Target.Interactable.Get();
+		if (IHMVRInteractable* Owner = Interactable ? Cast<IHMVRInteractable>(Interactable->GetOwner()) : nullptr)
+		{
+			Owner->OnGmHook(Hook->HookName, Target.Argument);
+			++Applied;
+		}
+	}
+	OnHookFired.Broadcast(Hook->HookName, Event);
+
+	const double QueueMs = (FPlatformTime::Seconds() - Event.ReceivedTime) * 1000.0;
+	const double EndToEndMs = FMath::Max(0.0, (FDateTime::UtcNow() - Event.FiredAt).GetTotalMilliseconds());
+	++Stats.Fired;
+	Stats.TargetsApplied += Applied;
+	Stats.QueueLatency.Add(QueueMs);
+	Stats.EndToEndLatency.Add(EndToEndMs);
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRGmEvents: hook '%s' fired by %s (%d/%d targets) - queue %.2f ms, end-to-end %.0f ms%s%s"),
+		*Hook->Id, *Event.FiredBy, Applied, Hook->Targets.Num(), QueueMs, EndToEndMs,
+		Event.Note.IsEmpty() ? TEXT("") : TEXT(" - "), *Event.Note);
+}
+
+UHMVRGmEventSubsystem::FStats UHMVRGmEventSubsystem::GetStats() const
+{
+	FStats Out = Stats;
+	Out.Hooks = Hooks.Num();
+	if (Receiver.IsValid())
+	{
+		Out.Received += Receiver->Received.load(std::memory_order_relaxed);
+		Out.Malformed += Receiver->Malformed.load(std::memory_order_relaxed);
+		Out.DroppedFull += Receiver->DroppedFull.load(std::memory_order_relaxed);
+	}
+	return Out;
+}
+
+void UHMVRGmEventSubsystem::LogStats() const
+{
+	const FStats Current = GetStats();
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRGmEvents: port %d, %d hooks (%d unresolved effects) | %lld received, %lld fired, %lld targets | dropped %lld malformed, %lld queue full, %lld unknown hook, %lld other session, %lld duplicate | peak queue %d"),
+		ListenPort, Current.Hooks, Current.UnresolvedEffects, Current.Received, Current.Fired, Current.TargetsApplied,
+		Current.Malformed, Current.DroppedFull, Current.UnknownHook, Current.WrongSession, Current.Duplicate, Current.PeakQueue);
+
+	const FLatency& Queue = Current.QueueLatency;
+	const FLatency& EndToEnd = Current.EndToEndLatency;
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRGmEvents: queue latency p50 %.2f / p95 %.2f / max %.2f ms | end-to-end p50 %.0f / p95 %.0f / max %.0f ms | %lld events"),
+		Queue.Percentile(0.5), Queue.Percentile(0.95), Queue.MaxMs,
+		EndToEnd.Percentile(0.5), EndToEnd.Percentile(0.95), EndToEnd.MaxMs, Queue.Count);
+}
+
+bool UHMVRGmEventSubsystem::SendLocal(const FString& Json, int32 Port, FString& OutError)
+{
+	ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!Sockets || Port <= 0)
+	{
+		OutError = TEXT("no GM event receiver is listening");
+		return false;
+	}
+
+	FSocket* Socket = Sockets->CreateSocket(NAME_DGram, TEXT("HMVR GM event sender"), FNetworkProtocolTypes::IPv4);
+	if (!Socket)
+	{
+		OutError = TEXT("could not create a UDP socket");
+		return false;
+	}
+
+	TSharedRef<FInternetAddr> To = Sockets->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+	To->SetLoopbackAddress();
+	To->SetPort(Port);
+
+	FTCHARToUTF8 Utf8(*Json);
+	int32 BytesSent = 0;
+	const bool bSent = Socket->SendTo(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), BytesSent, *To)
+		&& BytesSent == Utf8.Length();
+	if (!bSent)
+	{
+		OutError = FString::Printf(TEXT("send to port %d failed"), Port);
+	}
+	Sockets->DestroySocket(Socket);
+	return bSent;
+}
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	FString MakeConsoleEvent(UWorld* World, const FString& HookId, const FString& FiredBy, const FString& Note)
+	{
+		const AHMVRGameMode* GameMode = World->GetAuthGameMode<AHMVRGameMode>();
+		const FString Session = GameMode ? GameMode->GetCurrentSessionId() : FString();
+		return FString::Printf(
+			TEXT("{\"event_id\":\"%s\",\"session_id\":\"%s\",\"hook_id\":\"%s\",\"fired_by\":\"%s\",\"fired_at\":\"%s\",\"source\":\"gm_panel\",\"note\":\"%s\"}"),
+			*FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower), *Session.ReplaceCharWithEscapedChar(),
+			*HookId.ReplaceCharWithEscapedChar(), *FiredBy.ReplaceCharWithEscapedChar(),
+			*FDateTime::UtcNow().ToIso8601(), *Note.ReplaceCharWithEscapedChar());
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdGmFire(
+	TEXT("HMVR.GM.Fire"),
+	TEXT("HMVR.GM.Fire <HookId> [FiredBy=gm:console] — send a GM control event for the current session through the receiver socket."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const UHMVRGmEventSubsystem* GmEvents = World ? World->GetSubsystem<UHMVRGmEventSubsystem>() : nullptr;
+		if (Args.Num() < 1 || !GmEvents || GmEvents->GetListenPort() == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: usage HMVR.GM.Fire <HookId> [FiredBy], on a server with the receiver listening"));
+			return;
+		}
+
+		FString Error;
+		const FString FiredBy = Args.Num() > 1 ? Args[1] : FString(TEXT("gm:console"));
+		if (!UHMVRGmEventSubsystem::SendLocal(MakeConsoleEvent(World, Args[0], FiredBy, TEXT("HMVR.GM.Fire")), GmEvents->GetListenPort(), Error))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: Fire failed: %s"), *Error);
+		}
+	}));
+
+// Count events for one hook sent back to back; the result is logged once they have all been
+// fired or dropped, or after 5 s. Fires the hook for real, so pick a harmless one.
+static FAutoConsoleCommandWithWorldAndArgs CmdGmBench(
+	TEXT("HMVR.GM.Bench"),
+	TEXT("HMVR.GM.Bench <HookId> [Count=200] — fire a hook Count times through the socket and log queue / end-to-end latency."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UHMVRGmEventSubsystem* GmEvents = World ? World->GetSubsystem<UHMVRGmEventSubsystem>() : nullptr;
+		if (Args.Num() < 1 || !GmEvents || GmEvents->GetListenPort() == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRGmEvents: usage HMVR.GM.Bench <HookId> [Count], on a server with the receiver listening"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 200;
+		const UHMVRGmEventSubsystem::FStats Before = GmEvents->GetStats();
+		const double StartTime = FPlatformTime::Seconds();
+		int32 Sent = 0;
+		FString Error;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (UHMVRGmEventSubsystem::SendLocal(MakeConsoleEvent(World, Args[0], TEXT("gm:bench"), FString()), GmEvents->GetListenPort(), Error))
+			{
+				++Sent;
+			}
+		}
+		const double SendMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		const auto Settled = [Before, Sent](const UHMVRGmEventSubsystem::FStats& Now)
+		{
+			const int64 Done = (Now.Fired - Before.Fired) + (Now.UnknownHook - Before.UnknownHook) + (Now.WrongSession - Before.WrongSession)
+				+ (Now.Malformed - Before.Malformed) + (Now.DroppedFull - Before.DroppedFull);
+			return Done >= Sent;
+		};
+
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(GmEvents,
+			[GmEvents, Before, Sent, Count, StartTime, SendMs, Settled](float) -> bool
+			{
+				const UHMVRGmEventSubsystem::FStats Now = GmEvents->GetStats();
+				const double Elapsed = FPlatformTime::Seconds() - StartTime;
+				if (!Settled(Now) && Elapsed < 5.0)
+				{
+					return true;
+				}
+				UE_LOG(LogTemp, Log,
+					TEXT("HMVRGmEvents: Bench %d/%d sent in %.1f ms, %lld fired, %lld dropped on a full queue, settled after %.1f ms"),
+					Sent, Count, SendMs, Now.Fired - Before.Fired, Now.DroppedFull - Before.DroppedFull, Elapsed * 1000.0);
+				GmEvents->LogStats();
+				return false;
+			}));
+	}));
+#endif
@@ -0,0 +1,171 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HMVRBoundedRing.h"
+#include "HMVRGmEvents.generated.h"
+
+class FJsonObject;
+class FHMVRGmEventReceiver;
+class UHMVRInteractableComponent;
+struct FHMVRScenePlan;
+
+/**
+ * One GM control event (Specs/schemas/GMControlEvent.schema.json), as received.
+ * Parsed on the receiver thread; everything past ReceivedTime is filled in there too.
+ */
+struct HYPERMAGEVR_API FHMVRGmEvent
+{
+	FString EventId;
+	FString SessionId;
+	FString HookId;
+	FString FiredBy;
+	FString Source;
+	FString Note;
+	FDateTime FiredAt;
+	TSharedPtr<FJsonObject> Parameters;
+
+	/** HashHookId(HookId), so the game thread looks the hook up without hashing. */
+	uint64 HookHash = 0;
+
+	/** FPlatformTime::Seconds() when the datagram was read. */
+	double ReceivedTime = 0.0;
+
+	/** Parse and validate one event. False (with OutError) if a required field is missing or malformed. */
+	static bool Parse(const FString& Json, FHMVRGmEvent& OutEvent, FString& OutError);
+
+	static uint64 HashHookId(const FString& HookId);
+};
+
+/** Server — a GM hook fired; Event carries who fired it, the note and any parameters. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGmHookFired, FName /*HookId*/, const FHMVRGmEvent& /*Event*/);
+
+/**
+ * Live GM control events on the dedicated server.
+ *
+ * The LARP Integration API (POST /gm/event) or a relay on the fleet instance forwards each
+ * GMControlEvent as one UDP datagram of JSON to this process, on hmvr.GM.BindAddress at the
+ * game port + hmvr.GM.PortOffset (-GmEventPort=<port> overrides). Datagrams are not signed, so
+ * the receiver refuses to start on anything but a loopback address. A receiver thread reads and
+ * parses datagrams and pushes them into a lock-free ring (hmvr.GM.QueueCapacity); the game
+ * thread drains the ring every tick, so a hook lands at most one frame after it arrives and
+ * the game thread never waits on the socket. A full ring drops new events and counts them.
+ *
+ * Hooks resolve through a table built from the ScenePlan's gm_hooks once the plan has spawned:
+ * hook id and name hash to an entry holding the interactables its effects name
+ * ("state: cell_door → open" targets cell_door). Firing a hook calls each target owner's
+ * IHMVRInteractable::OnGmHook with the text after the arrow, then broadcasts OnHookFired.
+ * Events whose session_id is not the game mode's current session (all of them when there is
+ * no HMVR game mode), repeats of a recently fired event_id and unknown hooks are counted and
+ * dropped. An event_id is remembered only once its hook resolved.
+ *
+ * Per event, the queue latency (datagram read → hook applied) and the end-to-end latency
+ * (fired_at → applied, wall clock, so subject to clock skew between hosts) are recorded;
+ * HMVR.GM.Stats prints counters and percentiles. HMVR.GM.Fire and HMVR.GM.Bench send events
+ * over the same socket, and the local API stub forwards POST /gm/event to it (development builds).
+ */
+UCLASS()
+class HYPERMAGEVR_API UHMVRGmEventSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Replace the hook table with Plan's gm_hooks, resolving effect targets among Interactables by ObjectId. */
+	void BuildHookTable(const FHMVRScenePlan& Plan, TArrayView<const TWeakObjectPtr<UHMVRInteractableComponent>> Interactables);
+
+	/** Drain the receive queue and fire every hook in it. Called from Tick. */
+	void ProcessEvents();
+
+	/** Port the receiver is bound to, 0 if not listening. */
+	int32 GetListenPort() const { return ListenPort; }
+
+	/** Send one event's JSON as a datagram to a receiver on this host. For tools and the local stub. */
+	static bool SendLocal(const FString& Json, int32 Port, FString& OutError);
+
+	/** Receiver port of the running game world's subsystem, 0 if none is listening. */
+	static int32 GetActiveListenPort();
+
+	FOnGmHookFired OnHookFired;
+
+	/** Latency samples in milliseconds: totals plus a window of the most recent for percentiles. */
+	struct FLatency
+	{
+		int64 Count = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+		TArray<float> Recent;
+		int32 NextRecent = 0;
+
+		void Add(double Ms);
+		double Percentile(double P) const;
+	};
+
+	struct FStats
+	{
+		int64 Received = 0;       // datagrams read
+		int64 Malformed = 0;      // failed GMControlEvent validation
+		int64 DroppedFull = 0;    // ring full
+		int64 Fired = 0;
+		int64 UnknownHook = 0;
+		int64 WrongSession = 0;
+		int64 Duplicate = 0;
+		int64 TargetsApplied = 0;
+		int32 Hooks = 0;
+		int32 UnresolvedEffects = 0;  // effects naming no known interactable at build time
+		int32 PeakQueue = 0;
+		FLatency QueueLatency;
+		FLatency EndToEndLatency;
+	};
+	FStats GetStats() const;
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FHook
+	{
+		FString Id;
+		FString Name;
+		FName HookName;
+		struct FTarget
+		{
+			TWeakObjectPtr<UHMVRInteractableComponent> Interactable;
+			FString Argument;
+		};
+		TArray<FTarget> Targets;
+	};
+
+	void StartReceiver();
+	void StopReceiver();
+	void Fire(const FHMVRGmEvent& Event);
+	const FHook* FindHook(const FHMVRGmEvent& Event) const;
+	void RememberEvent(const FString& EventId);
+
+	static constexpr int32 RecentEventCapacity = 1024;
+
+	TArray<FHook> Hooks;
+	TMap<uint64, int32> HookByHash;   // hash of id and of name → Hooks index
+
+	// Created with the receiver, which pushes into it; the game thread is the only consumer
+	TUniquePtr<THMVRBoundedRing<FHMVRGmEvent>> Ring;
+	TSharedPtr<FHMVRGmEventReceiver> Receiver;
+	int32 ListenPort = 0;
+
+	// Recently fired event_ids, oldest overwritten first
+	TSet<FString> RecentEventIds;
+	TArray<FString> RecentEventOrder;
+	int32 NextRecentEvent = 0;
+
+	FStats Stats;
+};
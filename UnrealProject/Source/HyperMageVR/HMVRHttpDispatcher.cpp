@@ -0,0 +1,453 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRHttpDispatcher.h"
+#include "HMVRLocalApiStub.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarHttpMaxInFlight(
+	TEXT("hmvr.Http.MaxInFlight"), 8,
+	TEXT("Outbound HTTP: maximum concurrent requests across all hosts (Critical requests are exempt)."));
+
+static TAutoConsoleVariable<int32> CVarHttpMaxPerHost(
+	TEXT("hmvr.Http.MaxPerHost"), 4,
+	TEXT("Outbound HTTP: maximum concurrent requests to a single host."));
+
+static TAutoConsoleVariable<int32> CVarHttpMaxQueuedTelemetry(
+	TEXT("hmvr.Http.MaxQueuedTelemetry"), 256,
+	TEXT("Outbound HTTP: queued Telemetry requests above this count drop the oldest."));
+
+static FAutoConsoleCommand CmdHttpStats(
+	TEXT("HMVR.Http.Stats"),
+	TEXT("Print outbound HTTP dispatcher queue depth, in-flight, wait-time, retry and breaker metrics."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHMVRHttpDispatcher::Get().DumpStats(); }));
+
+static FAutoConsoleCommand CmdHttpResetStats(
+	TEXT("HMVR.Http.ResetStats"),
+	TEXT("Reset outbound HTTP dispatcher counters."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHMVRHttpDispatcher::Get().ResetStats(); }));
+
+#if WITH_HMVR_API_STUB
+// HMVR.Http.Burst [Count] — end-of-session shaped burst against the local stub:
+// Count telemetry events, Count/2 world-state writes over 8 objects (exercises coalescing)
+// and Count/8 summaries. Prints dispatcher stats once every request has completed.
+static FAutoConsoleCommand CmdHttpBurst(
+	TEXT("HMVR.Http.Burst"),
+	TEXT("HMVR.Http.Burst [Count] — fire a synthetic request burst at the local API stub."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (!FHMVRLocalApiStub::Get().IsRunning())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HttpDispatcher: HMVR.Http.Burst needs -LocalApiStub"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 64;
+		const FString BaseUrl = FString::Printf(TEXT("http://127.0.0.1:%d"), FHMVRLocalApiStub::Get().GetPort());
+		TSharedRef<int32> Outstanding = MakeShared<int32>(0);
+
+		auto Fire = [&BaseUrl, Outstanding](const TCHAR* Path, const FString& Body,
+		                                    EHMVRHttpPriority Priority, const FString& Key)
+		{
+			FHttpRequestRef Req = FHttpModule::Get().CreateRequest();
+			Req->SetURL(BaseUrl + Path);
+			Req->SetVerb(TEXT("POST"));
+			Req->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+			Req->SetContentAsString(Body);
+			++(*Outstanding);
+			Req->OnProcessRequestComplete().BindLambda([Outstanding](FHttpRequestPtr, FHttpResponsePtr, bool)
+			{
+				if (--(*Outstanding) == 0)
+				{
+					FHMVRHttpDispatcher::Get().DumpStats();
+				}
+			});
+			FHMVRHttpDispatcher::Get().Submit(Req, Priority, Key);
+		};
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Fire(TEXT("/interaction-events"),
+				FString::Printf(TEXT("{\"eventId\":\"burst-%d\",\"eventType\":\"burst\"}"), i),
+				EHMVRHttpPriority::Telemetry, FString());
+		}
+		for (int32 i = 0; i < Count / 2; ++i)
+		{
+			const FString ObjectId = FString::Printf(TEXT("burst-object-%d"), i % 8);
+			Fire(TEXT("/world-state"),
+				FString::Printf(TEXT("{\"object_id\":\"%s\",\"state\":\"Active\"}"), *ObjectId),
+				EHMVRHttpPriority::WorldState, TEXT("world-state:") + ObjectId);
+		}
+		for (int32 i = 0; i < FMath::Max(1, Count / 8); ++i)
+		{
+			Fire(TEXT("/session-summary"),
+				FString::Printf(TEXT("{\"playerId\":\"burst-%d\",\"sessionId\":\"burst\",\"rewards\":[]}"), i),
+				EHMVRHttpPriority::Summary, FString());
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("HttpDispatcher: burst of %d requests submitted (%d queued, %d in flight)"),
+			*Outstanding, FHMVRHttpDispatcher::Get().GetTotalQueueDepth(), FHMVRHttpDispatcher::Get().GetNumInFlight());
+	}));
+#endif // WITH_HMVR_API_STUB
+
+namespace
+{
+	const TCHAR* PriorityName(EHMVRHttpPriority Priority)
+	{
+		switch (Priority)
+		{
+		case EHMVRHttpPriority::Critical:   return TEXT("Critical");
+		case EHMVRHttpPriority::Summary:    return TEXT("Summary");
+		case EHMVRHttpPriority::WorldState: return TEXT("WorldState");
+		case EHMVRHttpPriority::Telemetry:  return TEXT("Telemetry");
+		default:                            return TEXT("?");
+		}
+	}
+}
+
+FHMVRHttpDispatcher& FHMVRHttpDispatcher::Get()
+{
+	static FHMVRHttpDispatcher Instance;
+	return Instance;
+}
+
+void FHMVRHttpDispatcher::Submit(const FHttpRequestRef& Request, EHMVRHttpPriority Priority, const FString& CoalesceKey,
+                                 FHMVRRetryPolicy RetryPolicy)
+{
+	check(IsInGameThread());
+
+	FPendingRequest Pending;
+	Pending.Id = NextId++;
+	Pending.Request = Request;
+	Pending.Priority = Priority;
+	Pending.Host = FGenericPlatformHttp::GetUrlDomain(Request->GetURL());
+	Pending.CoalesceKey = CoalesceKey;
+	Pending.RetryPolicy = MoveTemp(RetryPolicy);
+	Pending.Completions.Add(Request->OnProcessRequestComplete());
+	Request->OnProcessRequestComplete().Unbind();
+
+	++Stats.Submitted;
+	RetryScheduler.NoteFirstAttempt(Pending.Host);
+
+	Enqueue(MoveTemp(Pending), /*bIsNewest=*/true);
+}
+
+void FHMVRHttpDispatcher::Enqueue(FPendingRequest&& Pending, bool bIsNewest)
+{
+	Pending.EnqueueTime = FPlatformTime::Seconds();
+
+	if (!Pending.CoalesceKey.IsEmpty() && TryCoalesce(Pending, bIsNewest))
+	{
+		++Stats.Coalesced;
+		Pump();
+		return;
+	}
+
+	const int32 P = static_cast<int32>(Pending.Priority);
+	Queues[P].Add(MoveTemp(Pending));
+	Stats.PeakQueued[P] = FMath::Max(Stats.PeakQueued[P], Queues[P].Num());
+
+	EnforceTelemetryLimit();
+	Pump();
+}
+
+bool FHMVRHttpDispatcher::TryCoalesce(FPendingRequest& Incoming, bool bIsNewest)
+{
+	for (int32 P = 0; P < static_cast<int32>(EHMVRHttpPriority::Count); ++P)
+	{
+		TArray<FPendingRequest>& Queue = Queues[P];
+		const int32 Index = Queue.IndexOfByPredicate([&Incoming](const FPendingRequest& Queued)
+		{
+			return Queued.CoalesceKey == Incoming.CoalesceKey;
+		});
+		if (Index == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Newest payload wins; keep the queued entry's place in line and every waiting caller.
+		// A retry coming back off the wheel is older than anything queued under its key.
+		FPendingRequest& Queued = Queue[Index];
+		if (bIsNewest)
+		{
+			Queued.Request = Incoming.Request;
+			Queued.Host = Incoming.Host;
+			Queued.RetryPolicy = Incoming.RetryPolicy;
+			Queued.Attempt = Incoming.Attempt;
+		}
+		Queued.Completions.Append(Incoming.Completions);
+
+		if (Incoming.Priority < Queued.Priority)
+		{
+			FPendingRequest Promoted = MoveTemp(Queued);
+			Queue.RemoveAt(Index);
+			Promoted.Priority = Incoming.Priority;
+			Queues[static_cast<int32>(Incoming.Priority)].Add(MoveTemp(Promoted));
+		}
+		return true;
+	}
+	return false;
+}
+
+void FHMVRHttpDispatcher::EnforceTelemetryLimit()
+{
+	TArray<FPendingRequest>& Queue = Queues[static_cast<int32>(EHMVRHttpPriority::Telemetry)];
+	const int32 Limit = FMath::Max(1, CVarHttpMaxQueuedTelemetry.GetValueOnGameThread());
+	TArray<FPendingRequest> Dropped;
+	while (Queue.Num() > Limit)
+	{
+		Dropped.Add(MoveTemp(Queue[0]));
+		Queue.RemoveAt(0);
+	}
+
+	// Completions fire like a short-circuit (no response), so a caller holding a slot for the
+	// request (e.g. FHMVREventStream) counts it failed and frees it instead of waiting out a
+	// timeout. Telemetry callers do not resubmit. Run after the queue is settled: a completion
+	// may Submit().
+	for (FPendingRequest& Oldest : Dropped)
+	{
+		++Stats.Dropped;
+		UE_LOG(LogTemp, Verbose, TEXT("HttpDispatcher: telemetry queue full — dropped %s"), *Oldest.Request->GetURL());
+		for (const FHttpRequestCompleteDelegate& Completion : Oldest.Completions)
+		{
+			Completion.ExecuteIfBound(Oldest.Request, nullptr, false);
+		}
+	}
+}
+
+void FHMVRHttpDispatcher::Pump()
+{
+	const int32 MaxInFlight = FMath::Max(1, CVarHttpMaxInFlight.GetValueOnGameThread());
+	const int32 MaxPerHost = FMath::Max(1, CVarHttpMaxPerHost.GetValueOnGameThread());
+
+	// Short-circuited requests may complete synchronously, and completions may Submit();
+	// finish walking the queues before running any of them.
+	TArray<FPendingRequest> Rejected;
+	bool bGlobalCapReached = false;
+
+	for (int32 P = 0; P < static_cast<int32>(EHMVRHttpPriority::Count) && !bGlobalCapReached; ++P)
+	{
+		const bool bBypassGlobalCap = (P == static_cast<int32>(EHMVRHttpPriority::Critical));
+		TArray<FPendingRequest>& Queue = Queues[P];
+
+		for (int32 i = 0; i < Queue.Num();)
+		{
+			if (!bBypassGlobalCap && InFlight.Num() >= MaxInFlight)
+			{
+				bGlobalCapReached = true; // lower priorities can't go either
+				break;
+			}
+			if (InFlightByHost.FindRef(Queue[i].Host) >= MaxPerHost)
+			{
+				++i; // host saturated — a later entry for another host may still go
+				continue;
+			}
+
+			const FHMVRRetryScheduler::EAdmission Admission = RetryScheduler.Admit(Queue[i].Host);
+			if (Admission == FHMVRRetryScheduler::EAdmission::Wait)
+			{
+				++i; // half-open probe in flight for this host
+				continue;
+			}
+
+			FPendingRequest Pending = MoveTemp(Queue[i]);
+			Queue.RemoveAt(i);
+			if (Admission == FHMVRRetryScheduler::EAdmission::ShortCircuit)
+			{
+				Rejected.Add(MoveTemp(Pending));
+			}
+			else
+			{
+				Dispatch(MoveTemp(Pending));
+			}
+		}
+	}
+
+	for (FPendingRequest& Pending : Rejected)
+	{
+		ShortCircuit(MoveTemp(Pending));
+	}
+}
+
+void FHMVRHttpDispatcher::ShortCircuit(FPendingRequest&& Pending)
+{
+	RetryScheduler.NoteShortCircuit();
+
+	if (Pending.Attempt < Pending.RetryPolicy.MaxRetries)
+	{
+		// Park until the breaker half-opens, spread over one extra cooldown so parked
+		// requests don't all arrive together behind the probe
+		const double Remaining = RetryScheduler.GetOpenSecondsRemaining(Pending.Host);
+		++Pending.Attempt;
+		RetryScheduler.ScheduleAfter(Remaining + FMath::FRandRange(0.0, Remaining),
+			[this, Parked = MoveTemp(Pending)]() mutable
+			{
+				Requeue(MoveTemp(Parked), /*bWasSent=*/false);
+			});
+		return;
+	}
+
+	++Stats.Failed;
+	UE_LOG(LogTemp, Warning, TEXT("HttpDispatcher: %s %s short-circuited — breaker open for %s"),
+		*Pending.Request->GetVerb(), *Pending.Request->GetURL(), *Pending.Host);
+	for (const FHttpRequestCompleteDelegate& Completion : Pending.Completions)
+	{
+		Completion.ExecuteIfBound(Pending.Request, nullptr, false);
+	}
+}
+
+void FHMVRHttpDispatcher::Requeue(FPendingRequest&& Pending, bool bWasSent)
+{
+	if (bWasSent)
+	{
+		// A processed IHttpRequest can't be sent again; copy it onto a fresh one
+		FHttpRequestRef Copy = FHttpModule::Get().CreateRequest();
+		Copy->SetURL(Pending.Request->GetURL());
+		Copy->SetVerb(Pending.Request->GetVerb());
+		for (const FString& Header : Pending.Request->GetAllHeaders())
+		{
+			FString Name, Value;
+			if (Header.Split(TEXT(": "), &Name, &Value))
+			{
+				Copy->SetHeader(Name, Value);
+			}
+		}
+		Copy->SetContent(TArray<uint8>(Pending.Request->GetContent()));
+		if (Pending.RetryPolicy.PrepareRetry)
+		{
+			Pending.RetryPolicy.PrepareRetry(Copy);
+		}
+		Pending.Request = Copy;
+	}
+
+	Enqueue(MoveTemp(Pending), /*bIsNewest=*/false);
+}
+
+void FHMVRHttpDispatcher::Dispatch(FPendingRequest&& Pending)
+{
+	const double Wait = FPlatformTime::Seconds() - Pending.EnqueueTime;
+	Stats.TotalQueueWaitSeconds += Wait;
+	Stats.MaxQueueWaitSeconds = FMath::Max(Stats.MaxQueueWaitSeconds, Wait);
+	++Stats.Dispatched;
+
+	++InFlightByHost.FindOrAdd(Pending.Host);
+
+	FHttpRequestPtr Request = Pending.Request;
+	const uint64 Id = Pending.Id;
+	Request->OnProcessRequestComplete().BindRaw(this, &FHMVRHttpDispatcher::OnRequestComplete, Id);
+	InFlight.Add(Id, MoveTemp(Pending));
+	Stats.PeakInFlight = FMath::Max(Stats.PeakInFlight, InFlight.Num());
+
+	Request->ProcessRequest();
+}
+
+void FHMVRHttpDispatcher::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response,
+                                            bool bConnectedSuccessfully, uint64 Id)
+{
+	FPendingRequest Finished;
+	if (!InFlight.RemoveAndCopyValue(Id, Finished))
+	{
+		return; // dispatcher was shut down while this was in flight
+	}
+
+	if (int32* HostCount = InFlightByHost.Find(Finished.Host))
+	{
+		if (--(*HostCount) <= 0)
+		{
+			InFlightByHost.Remove(Finished.Host);
+		}
+	}
+
+	const int32 Code = Response.IsValid() ? Response->GetResponseCode() : 0;
+	const bool bTransientFailure = FHMVRRetryScheduler::IsTransientFailure(bConnectedSuccessfully && Response.IsValid(), Code);
+	RetryScheduler.RecordResult(Finished.Host, bTransientFailure);
+
+	if (bTransientFailure && Finished.Attempt < Finished.RetryPolicy.MaxRetries)
+	{
+		FPendingRequest Retry = Finished;
+		++Retry.Attempt;
+		const bool bScheduled = RetryScheduler.ScheduleRetry(Finished.Host, Finished.Attempt,
+			[this, Retry = MoveTemp(Retry)]() mutable
+			{
+				Requeue(MoveTemp(Retry), /*bWasSent=*/true);
+			});
+
+		if (bScheduled)
+		{
+			UE_LOG(LogTemp, Log, TEXT("HttpDispatcher: %s %s failed (%d) — retry %d/%d scheduled"),
+				*Request->GetVerb(), *Request->GetURL(), Code, Finished.Attempt + 1, Finished.RetryPolicy.MaxRetries);
+			Pump();
+			return;
+		}
+	}
+
+	if (bTransientFailure)
+	{
+		++Stats.Failed;
+	}
+	else if (!EHttpResponseCodes::IsOk(Code))
+	{
+		// 4xx and other non-2xx answers are final: not retried and no breaker strike, but a failure
+		++Stats.Failed;
+		++Stats.Rejected;
+		UE_LOG(LogTemp, Warning, TEXT("HttpDispatcher: %s %s rejected (%d) — not retried"),
+			*Request->GetVerb(), *Request->GetURL(), Code);
+	}
+	else
+	{
+		++Stats.Succeeded;
+	}
+
+	for (const FHttpRequestCompleteDelegate& Completion : Finished.Completions)
+	{
+		Completion.ExecuteIfBound(Request, Response, bConnectedSuccessfully);
+	}
+
+	Pump();
+}
+
+void FHMVRHttpDispatcher::Shutdown()
+{
+	for (TArray<FPendingRequest>& Queue : Queues)
+	{
+		Queue.Empty();
+	}
+	InFlight.Empty();
+	InFlightByHost.Empty();
+	RetryScheduler.Reset();
+}
+
+int32 FHMVRHttpDispatcher::GetTotalQueueDepth() const
+{
+	int32 Total = 0;
+	for (const TArray<FPendingRequest>& Queue : Queues)
+	{
+		Total += Queue.Num();
+	}
+	return Total;
+}
+
+void FHMVRHttpDispatcher::DumpStats() const
+{
+	const double AvgWaitMs = Stats.Dispatched > 0 ? 1000.0 * Stats.TotalQueueWaitSeconds / Stats.Dispatched : 0.0;
+
+	UE_LOG(LogTemp, Log,
+		TEXT("HttpDispatcher: %lld submitted, %lld dispatched, %lld ok, %lld failed (%lld rejected), %lld coalesced, %lld dropped"),
+		Stats.Submitted, Stats.Dispatched, Stats.Succeeded, Stats.Failed, Stats.Rejected, Stats.Coalesced, Stats.Dropped);
+	UE_LOG(LogTemp, Log, TEXT("HttpDispatcher: in flight %d (peak %d), queue wait avg %.1f ms / max %.1f ms"),
+		InFlight.Num(), Stats.PeakInFlight, AvgWaitMs, 1000.0 * Stats.MaxQueueWaitSeconds);
+
+	for (int32 P = 0; P < static_cast<int32>(EHMVRHttpPriority::Count); ++P)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HttpDispatcher:   %-10s queued %d (peak %d)"),
+			PriorityName(static_cast<EHMVRHttpPriority>(P)), Queues[P].Num(), Stats.PeakQueued[P]);
+	}
+	for (const TPair<FString, int32>& Pair : InFlightByHost)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HttpDispatcher:   host %s in flight %d"), *Pair.Key, Pair.Value);
+	}
+
+	RetryScheduler.DumpStats();
+}
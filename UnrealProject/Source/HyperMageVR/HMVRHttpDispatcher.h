@@ -0,0 +1,124 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HMVRRetryScheduler.h"
+
+/** Dispatch order for queued outbound requests (lower value dispatches first). */
+enum class EHMVRHttpPriority : uint8
+{
+	Critical,    // login, token refresh, matchmaking — player is waiting on it
+	Summary,     // end-of-session summaries (rewards)
+	WorldState,  // interactable persistence
+	Telemetry,   // interaction events; first to be dropped under back-pressure
+	Count
+};
+
+/** Opt-in retry behaviour for a submitted request. */
+struct FHMVRRetryPolicy
+{
+	/** Retries after the first attempt on network error, 429 or 5xx (0 = never retry). */
+	int32 MaxRetries = 0;
+
+	/** Applied to each retry's fresh copy of the request before it is queued (e.g. SigV4 re-signing). */
+	TFunction<void(const FHttpRequestRef&)> PrepareRetry;
+};
+
+/**
+ * Single choke point for all outbound HTTP traffic (Session API, world-state API, Cognito).
+ *
+ * Callers build and bind a request exactly as before, then hand it to Submit() instead of
+ * calling ProcessRequest(). The dispatcher:
+ *   - caps in-flight requests globally (hmvr.Http.MaxInFlight) and per host (hmvr.Http.MaxPerHost),
+ *     so a burst at session end reuses a few kept-alive connections instead of opening one TLS
+ *     handshake per request ([HTTP.Curl] in DefaultEngine.ini sizes libcurl's connection cache)
+ *   - dispatches queued requests in EHMVRHttpPriority order; Critical ignores the global cap
+ *   - coalesces queued requests that share a CoalesceKey: the newest request replaces the queued
+ *     one and every caller's completion delegate fires with its response
+ *   - drops the oldest Telemetry request once that queue exceeds hmvr.Http.MaxQueuedTelemetry
+ *     (its completion fires with a null response, as for a short-circuit)
+ *   - retries transient failures per FHMVRRetryPolicy and short-circuits endpoints whose
+ *     breaker is open (see FHMVRRetryScheduler); completions fire once, with the final outcome
+ *
+ * Game thread only. Queue depth and wait-time metrics are printed by HMVR.Http.Stats;
+ * HMVR.Http.Burst fires a synthetic burst at the local API stub (development builds).
+ */
+class HYPERMAGEVR_API FHMVRHttpDispatcher
+{
+public:
+	struct FStats
+	{
+		int64 Submitted = 0;
+		int64 Dispatched = 0;
+		int64 Succeeded = 0;
+		int64 Failed = 0;         // final outcome was network error, 429, 5xx, short-circuit or Rejected
+		int64 Rejected = 0;       // final non-transient, non-2xx answer (4xx); not retried
+		int64 Coalesced = 0;
+		int64 Dropped = 0;
+		int32 PeakInFlight = 0;
+		int32 PeakQueued[static_cast<int32>(EHMVRHttpPriority::Count)] = {};
+		double TotalQueueWaitSeconds = 0.0;
+		double MaxQueueWaitSeconds = 0.0;
+	};
+
+	static FHMVRHttpDispatcher& Get();
+
+	/**
+	 * Queue a fully prepared request. The request's OnProcessRequestComplete delegate is taken
+	 * over by the dispatcher and invoked when the request completes, after any retries. A request
+	 * short-circuited by an open breaker, or dropped from the Telemetry queue, completes with a
+	 * null response; any other completion carries the final response, whose code the caller checks.
+	 *
+	 * @param CoalesceKey  Requests with the same non-empty key that are still queued collapse
+	 *                     into the newest one, e.g. "world-state:<ObjectId>".
+	 */
+	void Submit(const FHttpRequestRef& Request, EHMVRHttpPriority Priority, const FString& CoalesceKey = FString(),
+	            FHMVRRetryPolicy RetryPolicy = FHMVRRetryPolicy());
+
+	/** Discard everything queued or awaiting retry without invoking completions (module shutdown). */
+	void Shutdown();
+
+	int32 GetNumInFlight() const { return InFlight.Num(); }
+	int32 GetQueueDepth(EHMVRHttpPriority Priority) const { return Queues[static_cast<int32>(Priority)].Num(); }
+	int32 GetTotalQueueDepth() const;
+
+	const FStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FStats(); RetryScheduler.ResetStats(); }
+
+	const FHMVRRetryScheduler& GetRetryScheduler() const { return RetryScheduler; }
+	void DumpStats() const;
+
+private:
+	struct FPendingRequest
+	{
+		uint64 Id = 0;
+		FHttpRequestPtr Request;
+		EHMVRHttpPriority Priority = EHMVRHttpPriority::Telemetry;
+		FString Host;
+		FString CoalesceKey;
+		double EnqueueTime = 0.0;
+		int32 Attempt = 0;
+		FHMVRRetryPolicy RetryPolicy;
+		TArray<FHttpRequestCompleteDelegate, TInlineAllocator<1>> Completions;
+	};
+
+	void Pump();
+	void Dispatch(FPendingRequest&& Pending);
+	void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, uint64 Id);
+	void Enqueue(FPendingRequest&& Pending, bool bIsNewest);
+	void Requeue(FPendingRequest&& Pending, bool bWasSent);
+	void ShortCircuit(FPendingRequest&& Pending);
+	bool TryCoalesce(FPendingRequest& Incoming, bool bIsNewest);
+	void EnforceTelemetryLimit();
+
+	TArray<FPendingRequest> Queues[static_cast<int32>(EHMVRHttpPriority::Count)];
+	TMap<uint64, FPendingRequest> InFlight;
+	TMap<FString, int32> InFlightByHost;
+
+	FHMVRRetryScheduler RetryScheduler;
+
+	uint64 NextId = 1;
+	FStats Stats;
+};
@@ -0,0 +1,162 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRId.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Parse.h"
+#include <atomic>
+
+namespace
+{
+	// Wall clock anchored once, advanced by the cycle counter
+	struct FIdClock
+	{
+		uint64 BaseUnixMs = 0;
+		uint64 BaseCycles = 0;
+		double MsPerCycle = 0.0;
+
+		FIdClock()
+		{
+			BaseUnixMs = static_cast<uint64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+			BaseCycles = FPlatformTime::Cycles64();
+			MsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+		}
+
+		uint64 NowMs() const
+		{
+			return BaseUnixMs + static_cast<uint64>((FPlatformTime::Cycles64() - BaseCycles) * MsPerCycle);
+		}
+	};
+
+	const FIdClock& GetIdClock()
+	{
+		static const FIdClock Clock;
+		return Clock;
+	}
+
+	uint16 DefaultShard()
+	{
+		const uint32 Hash = HashCombineFast(GetTypeHash(FString(FPlatformProcess::ComputerName())),
+			GetTypeHash(FPlatformProcess::GetCurrentProcessId()));
+		return static_cast<uint16>(Hash ^ (Hash >> 16));
+	}
+
+	std::atomic<uint64>& GetSequence()
+	{
+		// Random start (below 2^62 so it never wraps) keeps a restarted process on the same shard
+		// from reissuing ids inside the same millisecond
+		static std::atomic<uint64> Sequence { [] {
+			const FGuid Seed = FGuid::NewGuid();
+			return ((static_cast<uint64>(Seed.A) << 32) | Seed.B) & ((uint64(1) << 62) - 1);
+		}() };
+		return Sequence;
+	}
+
+	std::atomic<uint16>& GetShardBits()
+	{
+		static std::atomic<uint16> Shard { DefaultShard() };
+		return Shard;
+	}
+}
+
+FHMVRId FHMVRId::Generate()
+{
+	FHMVRId Id;
+	Id.Hi = (GetIdClock().NowMs() << 16) | GetShardBits().load(std::memory_order_relaxed);
+	Id.Lo = GetSequence().fetch_add(1, std::memory_order_relaxed);
+	return Id;
+}
+
+void FHMVRId::SetShard(uint16 Shard)
+{
+	GetShardBits().store(Shard, std::memory_order_relaxed);
+}
+
+FString FHMVRId::ToString() const
+{
+	if (IsEmpty())
+	{
+		return FString();
+	}
+
+	static const TCHAR Digits[] = TEXT("0123456789abcdef");
+	TCHAR Buffer[33];
+	for (int32 i = 0; i < 16; ++i)
+	{
+		Buffer[i] = Digits[(Hi >> (60 - i * 4)) & 0xF];
+		Buffer[16 + i] = Digits[(Lo >> (60 - i * 4)) & 0xF];
+	}
+	Buffer[32] = 0;
+	return FString::ConstructFromPtrSize(Buffer, 32);
+}
+
+bool FHMVRId::Parse(const FString& Hex, FHMVRId& OutId)
+{
+	if (Hex.Len() != 32)
+	{
+		return false;
+	}
+
+	uint64 Words[2] = { 0, 0 };
+	for (int32 i = 0; i < 32; ++i)
+	{
+		const TCHAR C = Hex[i];
+		if (!FChar::IsHexDigit(C))
+		{
+			return false;
+		}
+		Words[i / 16] = (Words[i / 16] << 4) | static_cast<uint64>(FParse::HexDigit(C));
+	}
+	OutId.Hi = Words[0];
+	OutId.Lo = Words[1];
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+// Generation throughput against what the session and event constructors used to pay
+static FAutoConsoleCommandWithArgs CmdIdBench(
+	TEXT("HMVR.Id.Bench"),
+	TEXT("HMVR.Id.Bench [Count=1000000] — time FHMVRId::Generate (binary and hex) against FGuid::NewGuid().ToString()."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+		// Binary, checking order as we go
+		int32 OutOfOrder = 0;
+		FHMVRId Previous;
+		double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FHMVRId Id = FHMVRId::Generate();
+			OutOfOrder += Id < Previous ? 1 : 0;
+			Previous = Id;
+		}
+		const double BinarySeconds = FPlatformTime::Seconds() - Start;
+
+		// Binary + hex, i.e. an id that gets serialised
+		int64 Chars = 0;
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Chars += FHMVRId::Generate().ToString().Len();
+		}
+		const double HexSeconds = FPlatformTime::Seconds() - Start;
+
+		// The old path: one NewGuid + ToString per object
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Chars += FGuid::NewGuid().ToString().Len();
+		}
+		const double GuidSeconds = FPlatformTime::Seconds() - Start;
+
+		FHMVRId RoundTrip;
+		const bool bRoundTrips = FHMVRId::Parse(Previous.ToString(), RoundTrip) && RoundTrip == Previous;
+
+		UE_LOG(LogTemp, Log,
+			TEXT("HMVRId: %d ids — Generate %.1f ns/id, Generate+ToString %.1f ns/id, NewGuid+ToString %.1f ns/id (%.1fx); %d out of order, hex round trip %s, shard %04x (%lld chars)"),
+			Count, BinarySeconds * 1e9 / Count, HexSeconds * 1e9 / Count, GuidSeconds * 1e9 / Count,
+			GuidSeconds / FMath::Max(BinarySeconds, 1e-9), OutOfOrder, bRoundTrips ? TEXT("ok") : TEXT("FAILED"),
+			Previous.GetShard(), Chars);
+	}));
+#endif
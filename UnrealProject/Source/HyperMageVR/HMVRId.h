@@ -0,0 +1,54 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HMVRId.generated.h"
+
+/**
+ * 128-bit time-ordered id for sessions and interaction events.
+ *
+ *   Hi  [63..16] Unix time in milliseconds   [15..0] shard
+ *   Lo  per-process sequence (random start)
+ *
+ * Generate() is one relaxed atomic increment plus a cycle-counter read — no GUID, no clock
+ * syscall, no allocation. Ids compare (operator<) and format (ToString: 32 hex digits, Hi first)
+ * in creation-time order, so the hex form works as a DynamoDB range key. Keep ids binary in
+ * memory and call ToString only where they leave the process (JSON, logs).
+ */
+USTRUCT(BlueprintType)
+struct HYPERMAGEVR_API FHMVRId
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint64 Hi = 0;
+
+	UPROPERTY()
+	uint64 Lo = 0;
+
+	/** Thread-safe. */
+	static FHMVRId Generate();
+
+	/** Low 16 bits of Hi for ids generated from now on (defaults to a hash of host name and process id). */
+	static void SetShard(uint16 Shard);
+
+	bool IsEmpty() const { return Hi == 0 && Lo == 0; }
+	void Reset() { Hi = Lo = 0; }
+
+	int64 GetUnixMilliseconds() const { return static_cast<int64>(Hi >> 16); }
+	uint16 GetShard() const { return static_cast<uint16>(Hi & 0xFFFF); }
+
+	/** 32 lowercase hex digits; empty string for an empty id. */
+	FString ToString() const;
+	static bool Parse(const FString& Hex, FHMVRId& OutId);
+
+	bool operator==(const FHMVRId& Other) const { return Hi == Other.Hi && Lo == Other.Lo; }
+	bool operator!=(const FHMVRId& Other) const { return !(*this == Other); }
+	bool operator<(const FHMVRId& Other) const { return Hi != Other.Hi ? Hi < Other.Hi : Lo < Other.Lo; }
+
+	friend uint32 GetTypeHash(const FHMVRId& Id)
+	{
+		return HashCombineFast(GetTypeHash(Id.Hi), GetTypeHash(Id.Lo));
+	}
+};
@@ -17,12 +17,37 @@ enum class EInteractableState : uint8
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractableStateChanged, EInteractableState, NewState);
 
+/** What happened to an interactable; the owner's state machine decides what, if anything, it changes. */
+UENUM(BlueprintType)
+enum class EHMVRInteractableEvent : uint8
+{
+	Approach         UMETA(DisplayName = "Approach"),
+	ApproachInRange  UMETA(DisplayName = "Approach In Range"),   // close enough to act on straight away
+	Leave            UMETA(DisplayName = "Leave"),
+	Interact         UMETA(DisplayName = "Interact"),
+	Damage           UMETA(DisplayName = "Damage"),
+	Killed           UMETA(DisplayName = "Killed"),
+	TimerDone        UMETA(DisplayName = "Timer Done"),
+	Num              UMETA(Hidden)
+};
+
 UINTERFACE(MinimalAPI, Blueprintable)
 class UHMVRInteractable : public UInterface
 {
 	GENERATED_BODY()
 };
 
+/**
+ * Implemented by actors that own a UHMVRInteractableComponent.
+ *
+ * State changes are deferred: the component's RaiseEvent only queues the event, and the
+ * interactable state machine applies it in its next pass, at the end of the frame at the
+ * earliest and in the following frame when raised after that pass has run (from a dispatch,
+ * or a tickable that ticks later). Until then GetState() and GetSubState() still return the
+ * old values, so code that raises an event and then checks the state sees the state before
+ * it — guard on the owner's own data instead (the creature checks Health <= 0 for a killing
+ * blow still in the queue) and put the reaction in OnStateMachineTransition.
+ */
 class HYPERMAGEVR_API IHMVRInteractable
 {
 	GENERATED_BODY()
@@ -32,4 +57,18 @@ public:
 	virtual void OnPlayerInteract(APlayerController* Player) {}
 	virtual void OnDamageReceived(float Amount, AActor* Source) {}
 	virtual void OnCollected(APlayerController* Player) {}
+
+	// Server: the game session ended and the process is being recycled — restore the
+	// owner's authored values (health, sub-state, visibility, timers) before the next one.
+	virtual void OnSessionReset() {}
+
+	// Server: the interactable state machine moved the owner's component from FromState /
+	// FromSubState to its current state and sub-state. Runs in the pass after the events were
+	// raised, not inside RaiseEvent; several events in one pass arrive as one call, and nothing
+	// is called when they cancel out.
+	virtual void OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState) {}
+
+	// Server: a GM fired HookId, one of whose ScenePlan effects names this object. Argument is
+	// the effect's text after the arrow ("state: cell_door → open" gives "open"), may be empty.
+	virtual void OnGmHook(FName HookId, const FString& Argument) {}
 };
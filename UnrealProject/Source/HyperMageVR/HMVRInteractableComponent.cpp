@@ -1,8 +1,11 @@
 // Copyright 2026 HyperMage. All Rights Reserved.
 
 #include "HMVRInteractableComponent.h"
-#include "Net/UnrealNetwork.h"
+#include "HMVRInteractableStateRegistry.h"
+#include "HMVRInteractableStateMachine.h"
+#include "HMVRServerPolicy.h"
 #include "Kismet/GameplayStatics.h"
+#include "HMVRHttpDispatcher.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -10,14 +13,96 @@ FString UHMVRInteractableComponent::WorldStateApiUrl = TEXT("");
 
 UHMVRInteractableComponent::UHMVRInteractableComponent()
 {
-	SetIsReplicatedByDefault(true);
+	// State travels in the shared registry table, so the component itself is not replicated
+	SetIsReplicatedByDefault(false);
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
-void UHMVRInteractableComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void UHMVRInteractableComponent::BeginPlay()
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(UHMVRInteractableComponent, State);
+	Super::BeginPlay();
+
+	AActor* Owner = GetOwner();
+	BaselineState = State;
+	if (Owner && Owner->HasAuthority() && Owner->GetIsReplicated())
+	{
+		if (AHMVRInteractableStateRegistry* Found = AHMVRInteractableStateRegistry::Get(GetWorld()))
+		{
+			Registry = Found;
+			RegistryIndex = Found->Register(this);
+		}
+	}
+	if (Owner && Owner->HasAuthority() && !StateMachine.IsNone())
+	{
+		if (UHMVRInteractableStateMachineSubsystem* Found = GetWorld()->GetSubsystem<UHMVRInteractableStateMachineSubsystem>())
+		{
+			StateMachineSlot = Found->Register(this, StateMachine, State, SubState);
+			if (StateMachineSlot != INDEX_NONE)
+			{
+				StateMachines = Found;
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("HMVRInteractableComponent: %s has no state machine '%s' loaded"), *GetNameSafe(Owner), *StateMachine.ToString());
+			}
+		}
+	}
+}
+
+void UHMVRInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (AHMVRInteractableStateRegistry* Found = Registry.Get())
+	{
+		Found->Unregister(RegistryIndex);
+	}
+	Registry.Reset();
+	RegistryIndex = INDEX_NONE;
+
+	if (UHMVRInteractableStateMachineSubsystem* Found = StateMachines.Get())
+	{
+		Found->Unregister(StateMachineSlot);
+	}
+	StateMachines.Reset();
+	StateMachineSlot = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UHMVRInteractableComponent::MarkRegistryDirty()
+{
+	if (AHMVRInteractableStateRegistry* Found = Registry.Get())
+	{
+		Found->MarkChanged(RegistryIndex);
+	}
+}
+
+void UHMVRInteractableComponent::SyncStateMachine()
+{
+	if (UHMVRInteractableStateMachineSubsystem* Found = StateMachines.Get())
+	{
+		Found->SyncState(StateMachineSlot, State, SubState);
+	}
+}
+
+bool UHMVRInteractableComponent::RaiseEvent(EHMVRInteractableEvent Event)
+{
+	UHMVRInteractableStateMachineSubsystem* Found = StateMachines.Get();
+	if (!Found) return false;
+	Found->RaiseEvent(StateMachineSlot, Event);
+	return true;
+}
+
+void UHMVRInteractableComponent::ApplyMachineTransition(EInteractableState FromState, uint8 FromSubState,
+                                                        EInteractableState ToState, uint8 ToSubState)
+{
+	// Sub-state first, so OnStateChanged listeners read the new one
+	SetSubState(ToSubState);
+	TransitionTo(ToState);
+
+	if (IHMVRInteractable* Interactable = Cast<IHMVRInteractable>(GetOwner()))
+	{
+		Interactable->OnStateMachineTransition(FromState, FromSubState);
+	}
 }
 
 void UHMVRInteractableComponent::TransitionTo(EInteractableState NewState)
@@ -27,20 +112,97 @@ void UHMVRInteractableComponent::TransitionTo(EInteractableState NewState)
 	if (NewState == State) return;
 
 	State = NewState;
+	MarkRegistryDirty();
+	SyncStateMachine();
 	TriggerAudio(NewState);
 	OnStateChanged.Broadcast(NewState);
 
 	if (bPersistent) PersistState();
 }
 
-void UHMVRInteractableComponent::OnRep_State()
+void UHMVRInteractableComponent::ResetForNewSession()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority()) return;
+
+	if (IHMVRInteractable* Interactable = Cast<IHMVRInteractable>(Owner))
+	{
+		Interactable->OnSessionReset();
+	}
+
+	// Persistent objects carry their world-state row across sessions; the rest start over
+	if (bPersistent)
+	{
+		LoadState();
+	}
+	else
+	{
+		TransitionTo(BaselineState);
+	}
+}
+
+void UHMVRInteractableComponent::ResetForReuse()
 {
-	TriggerAudio(State);
-	OnStateChanged.Broadcast(State);
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority()) return;
+
+	const bool bChanged = State != BaselineState;
+	State = BaselineState;
+	SubState = 0;
+	MarkRegistryDirty();
+	SyncStateMachine();
+	if (bChanged)
+	{
+		OnStateChanged.Broadcast(State);
+	}
+}
+
+void UHMVRInteractableComponent::SetSubState(uint8 NewSubState)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority()) return;
+	if (NewSubState == SubState) return;
+
+	SubState = NewSubState;
+	MarkRegistryDirty();
+	SyncStateMachine();
+}
+
+void UHMVRInteractableComponent::SetHealth(float NewHealth)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority()) return;
+	if (NewHealth == Health) return;
+
+	Health = NewHealth;
+	MarkRegistryDirty();
+}
+
+void UHMVRInteractableComponent::ApplyReplicatedState(EInteractableState NewState, uint8 NewSubState, float NewHealth)
+{
+	const bool bFirst = !bHasReplicatedState;
+	bHasReplicatedState = true;
+
+	if (bFirst || NewSubState != SubState || NewHealth != Health)
+	{
+		SubState = NewSubState;
+		Health = NewHealth;
+		OnDetailChanged.Broadcast(SubState, Health);
+	}
+
+	if (NewState != State)
+	{
+		State = NewState;
+		TriggerAudio(State);
+		OnStateChanged.Broadcast(State);
+	}
 }
 
 void UHMVRInteractableComponent::TriggerAudio(EInteractableState ForState)
 {
+	// Nobody listens on the dedicated server; clients play it when the state replicates
+	if (!HMVRServerPolicy::WantsCosmetics()) return;
+
 	if (USoundBase** Sound = SoundsByState.Find(ForState))
 	{
 		AActor* Owner = GetOwner();
@@ -64,7 +226,10 @@ void UHMVRInteractableComponent::PersistState()
 	Req->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	Req->SetContentAsString(Body);
 	Req->OnProcessRequestComplete().BindUObject(this, &UHMVRInteractableComponent::OnPersistResponse);
-	Req->ProcessRequest();
+	// Rapid transitions collapse into one write of the latest state
+	FHMVRRetryPolicy RetryPolicy;
+	RetryPolicy.MaxRetries = MaxPersistRetries;
+	FHMVRHttpDispatcher::Get().Submit(Req, EHMVRHttpPriority::WorldState, TEXT("world-state:") + ObjectId, MoveTemp(RetryPolicy));
 }
 
 void UHMVRInteractableComponent::LoadState()
@@ -75,14 +240,16 @@ void UHMVRInteractableComponent::LoadState()
 	Req->SetURL(FString::Printf(TEXT("%s/world-state/%s"), *WorldStateApiUrl, *ObjectId));
 	Req->SetVerb(TEXT("GET"));
 	Req->OnProcessRequestComplete().BindUObject(this, &UHMVRInteractableComponent::OnLoadResponse);
-	Req->ProcessRequest();
+	FHMVRRetryPolicy RetryPolicy;
+	RetryPolicy.MaxRetries = MaxPersistRetries;
+	FHMVRHttpDispatcher::Get().Submit(Req, EHMVRHttpPriority::WorldState, TEXT("world-state-load:") + ObjectId, MoveTemp(RetryPolicy));
 }
 
 void UHMVRInteractableComponent::OnPersistResponse(FHttpRequestPtr, FHttpResponsePtr Response, bool bConnected)
 {
 	if (!bConnected || !Response || Response->GetResponseCode() >= 500)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HMVRInteractable: failed to persist state for %s"), *ObjectId);
+		UE_LOG(LogTemp, Warning, TEXT("HMVRInteractable: failed to persist state for %s after retries"), *ObjectId);
 	}
 }
 
@@ -9,6 +9,12 @@
 #include "Http.h"
 #include "HMVRInteractableComponent.generated.h"
 
+class AHMVRInteractableStateRegistry;
+class UHMVRInteractableStateMachineSubsystem;
+
+// Client: a replicated row brought a new sub-state or health value
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInteractableDetailChanged, uint8 /*SubState*/, float /*Health*/);
+
 UCLASS(ClassGroup=(HyperMage), meta=(BlueprintSpawnableComponent))
 class HYPERMAGEVR_API UHMVRInteractableComponent : public UActorComponent
 {
@@ -25,6 +31,11 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interactable")
 	bool bPersistent = false;
 
+	// Machine in InteractableStateMachines.json that turns RaiseEvent into state changes.
+	// None = the owner only sets state directly.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interactable")
+	FName StateMachine;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Interactable")
 	float AlertRadius = 500.f;
 
@@ -38,34 +49,83 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Interactable")
 	FOnInteractableStateChanged OnStateChanged;
 
-	// Server only — call this to drive the state machine.
-	// No-op on clients; the replicated State property handles visual sync.
+	// Fired on clients when the owner's sub-state or health changes (see SetSubState/SetHealth).
+	FOnInteractableDetailChanged OnDetailChanged;
+
+	// Server only — set the state directly (resets, loads, reuse); gameplay goes through RaiseEvent.
+	// No-op on clients; the state registry row handles visual sync.
 	void TransitionTo(EInteractableState NewState);
 
+	// Server only — queue Event for the next state machine pass; GetState() is unchanged until
+	// that pass runs (see IHMVRInteractable). False if the component has no machine
+	// (StateMachine unset or not loaded), in which case nothing will happen.
+	bool RaiseEvent(EHMVRInteractableEvent Event);
+
+	// Server — called by the state machine pass: set sub-state and state, then tell the owner.
+	void ApplyMachineTransition(EInteractableState FromState, uint8 FromSubState, EInteractableState ToState, uint8 ToSubState);
+
+	// Server only — owner-specific sub-state and health, replicated in the same registry row.
+	void SetSubState(uint8 NewSubState);
+	void SetHealth(float NewHealth);
+
+	uint8 GetSubState() const { return SubState; }
+	float GetHealth() const { return Health; }
+
+	// Client — true once a registry row has been applied.
+	bool HasReplicatedState() const { return bHasReplicatedState; }
+
+	// Client — called by AHMVRInteractableStateRegistry when this component's row arrives or changes.
+	void ApplyReplicatedState(EInteractableState NewState, uint8 NewSubState, float NewHealth);
+
 	// Async: POST current state to world-state API. No-op if !bPersistent.
 	void PersistState();
 
 	// Async: GET state from world-state API and apply it. No-op if !bPersistent.
 	void LoadState();
 
+	// Server — between sessions of a recycled process: reset the owner (OnSessionReset), then
+	// reload persistent state from the world-state API or return to the state held at BeginPlay.
+	void ResetForNewSession();
+
+	// Server — the owner is being handed out again by the actor pool: back to the state held at
+	// BeginPlay with sub-state 0, without persisting or playing transition audio.
+	void ResetForReuse();
+
 	UFUNCTION(BlueprintCallable, Category="Interactable")
 	EInteractableState GetState() const { return State; }
 
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	UPROPERTY(ReplicatedUsing=OnRep_State)
+	// Replicated through AHMVRInteractableStateRegistry, not by this component
 	EInteractableState State = EInteractableState::Idle;
+	uint8 SubState = 0;
+	float Health = 0.f;
+	bool bHasReplicatedState = false;
 
-	UFUNCTION()
-	void OnRep_State();
+	// Server — state at BeginPlay, restored by ResetForNewSession for non-persistent objects
+	EInteractableState BaselineState = EInteractableState::Idle;
+
+	void MarkRegistryDirty();
+	void SyncStateMachine();
+
+	TWeakObjectPtr<AHMVRInteractableStateRegistry> Registry;
+	int32 RegistryIndex = INDEX_NONE;
+
+	TWeakObjectPtr<UHMVRInteractableStateMachineSubsystem> StateMachines;
+	int32 StateMachineSlot = INDEX_NONE;
 
 	void TriggerAudio(EInteractableState ForState);
 
 	void OnPersistResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnected);
 	void OnLoadResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnected);
 
+	// Retries on network error / 429 / 5xx, via the shared retry scheduler
+	static constexpr int32 MaxPersistRetries = 3;
+
 public:
-	// Set from HMVRGameMode::InitGame() once world-state Lambda is deployed.
+	// Set from HMVRGameMode::InitGame() via FHMVRApiEndpoints.
 	static FString WorldStateApiUrl;
 };
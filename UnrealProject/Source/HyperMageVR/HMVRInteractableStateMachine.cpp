@@ -0,0 +1,448 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRInteractableStateMachine.h"
+#include "HMVRInteractableComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static TAutoConsoleVariable<FString> CVarStateMachineFile(
+	TEXT("hmvr.StateMachine.File"),
+	TEXT(""),
+	TEXT("Interactable state machine definitions (JSON). Empty = Content/Data/InteractableStateMachines.json."));
+
+static FAutoConsoleCommandWithWorld CmdStateMachineStats(
+	TEXT("HMVR.StateMachine.Stats"),
+	TEXT("Log loaded machines, registered interactables, events, transitions dispatched and the cost of the last pass."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const UHMVRInteractableStateMachineSubsystem* StateMachines = World ? World->GetSubsystem<UHMVRInteractableStateMachineSubsystem>() : nullptr)
+		{
+			StateMachines->LogStats();
+		}
+	}));
+
+namespace
+{
+	/** "*" → every index; otherwise each listed name through Lookup. False on an unknown name. */
+	bool ParseSet(const TSharedPtr<FJsonObject>& Rule, const TCHAR* Field, int32 Count,
+	              TFunctionRef<int32(const FString&)> Lookup, TArray<int32>& OutIndices, FString& OutError)
+	{
+		OutIndices.Reset();
+		FString Wildcard;
+		const TArray<TSharedPtr<FJsonValue>>* Names = nullptr;
+		if (!Rule->HasField(Field) || (Rule->TryGetStringField(Field, Wildcard) && Wildcard == TEXT("*")))
+		{
+			for (int32 i = 0; i < Count; ++i)
+			{
+				OutIndices.Add(i);
+			}
+			return true;
+		}
+		if (!Rule->TryGetArrayField(Field, Names))
+		{
+			OutError = FString::Printf(TEXT("'%s' must be \"*\" or an array of names"), Field);
+			return false;
+		}
+		for (const TSharedPtr<FJsonValue>& Name : *Names)
+		{
+			const int32 Index = Lookup(Name->AsString());
+			if (Index == INDEX_NONE)
+			{
+				OutError = FString::Printf(TEXT("unknown '%s' entry '%s'"), Field, *Name->AsString());
+				return false;
+			}
+			OutIndices.Add(Index);
+		}
+		return true;
+	}
+
+	int32 StateIndex(const FString& Name)
+	{
+		return StaticEnum<EInteractableState>()->GetValueByNameString(Name);
+	}
+
+	int32 EventIndex(const FString& Name)
+	{
+		const int64 Value = StaticEnum<EHMVRInteractableEvent>()->GetValueByNameString(Name);
+		return Value >= 0 && Value < static_cast<int64>(EHMVRInteractableEvent::Num) ? static_cast<int32>(Value) : INDEX_NONE;
+	}
+}
+
+bool UHMVRInteractableStateMachineSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHMVRInteractableStateMachineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FString Path = CVarStateMachineFile.GetValueOnGameThread();
+	if (Path.IsEmpty())
+	{
+		Path = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("Data"), TEXT("InteractableStateMachines.json"));
+	}
+
+	FString Json;
+	FString Error;
+	if (!FFileHelper::LoadFileToString(Json, *Path))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRInteractableStateMachine: Could not read %s - interactables will not change state"), *Path);
+	}
+	else if (!LoadDefinitions(Json, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRInteractableStateMachine: %s: %s - interactables will not change state"), *Path, *Error);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRInteractableStateMachine: Loaded %d machines from %s"), Machines.Num(), *Path);
+	}
+}
+
+void UHMVRInteractableStateMachineSubsystem::Deinitialize()
+{
+	Queue.Reset();
+	Components.Reset();
+	MachineOf.Reset();
+	Current.Reset();
+	PassFrom.Reset();
+	FreeSlots.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UHMVRInteractableStateMachineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHMVRInteractableStateMachineSubsystem, STATGROUP_Tickables);
+}
+
+bool UHMVRInteractableStateMachineSubsystem::LoadDefinitions(const FString& Json, FString& OutError)
+{
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	const TArray<TSharedPtr<FJsonValue>>* MachineValues = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("machines"), MachineValues))
+	{
+		OutError = TEXT("not a JSON object with a 'machines' array");
+		return false;
+	}
+
+	TArray<FMachine> Compiled;
+	TMap<FName, int32> ByName;
+	for (const TSharedPtr<FJsonValue>& MachineValue : *MachineValues)
+	{
+		const TSharedPtr<FJsonObject> Definition = MachineValue->AsObject();
+		FMachine Machine;
+		FString MachineName;
+		if (!Definition.IsValid() || !Definition->TryGetStringField(TEXT("name"), MachineName) || MachineName.IsEmpty())
+		{
+			OutError = TEXT("machine without a name");
+			return false;
+		}
+		Machine.Name = FName(*MachineName);
+		if (ByName.Contains(Machine.Name))
+		{
+			OutError = FString::Printf(TEXT("machine '%s' defined twice"), *Machine.Name.ToString());
+			return false;
+		}
+
+		// Owners without sub-states still have the one, sub-state 0
+		Definition->TryGetStringArrayField(TEXT("sub_states"), Machine.SubStates);
+		Machine.NumSubStates = FMath::Max(1, Machine.SubStates.Num());
+		if (NumStates * Machine.NumSubStates >= NoTransition)
+		{
+			OutError = FString::Printf(TEXT("machine '%s' has too many sub-states"), *Machine.Name.ToString());
+			return false;
+		}
+		Machine.Next.Init(NoTransition, NumStates * Machine.NumSubStates * NumEvents);
+
+		auto SubStateIndex = [&Machine](const FString& Name) { return Machine.SubStates.IndexOfByKey(Name); };
+
+		const TArray<TSharedPtr<FJsonValue>>* Rules = nullptr;
+		if (!Definition->TryGetArrayField(TEXT("transitions"), Rules))
+		{
+			OutError = FString::Printf(TEXT("machine '%s' has no 'transitions'"), *Machine.Name.ToString());
+			return false;
+		}
+		for (int32 RuleIndex = 0; RuleIndex < Rules->Num(); ++RuleIndex)
+		{
+			const TSharedPtr<FJsonObject> Rule = (*Rules)[RuleIndex]->AsObject();
+			FString EventName, ToName, ToSubName;
+			TArray<int32> FromStates, FromSubStates;
+			FString RuleError;
+			const int32 Event = Rule.IsValid() && Rule->TryGetStringField(TEXT("event"), EventName) ? EventIndex(EventName) : INDEX_NONE;
+			const int32 To = Rule.IsValid() && Rule->TryGetStringField(TEXT("to"), ToName) ? StateIndex(ToName) : INDEX_NONE;
+			const bool bKeepSub = !Rule.IsValid() || !Rule->TryGetStringField(TEXT("to_sub"), ToSubName);
+			const int32 ToSub = bKeepSub ? INDEX_NONE : SubStateIndex(ToSubName);
+			if (Event == INDEX_NONE || To == INDEX_NONE || (!bKeepSub && ToSub == INDEX_NONE))
+			{
+				RuleError = TEXT("needs a known 'event' and 'to' (and 'to_sub', if given)");
+			}
+			else if (ParseSet(Rule, TEXT("from"), NumStates, [](const FString& Name) { return StateIndex(Name); }, FromStates, RuleError)
+				&& ParseSet(Rule, TEXT("from_sub"), Machine.NumSubStates, SubStateIndex, FromSubStates, RuleError))
+			{
+				// First matching rule wins: fill only cells no earlier rule claimed
+				for (const int32 From : FromStates)
+				{
+					for (const int32 FromSub : FromSubStates)
+					{
+						uint8& Cell = Machine.Next[((From * Machine.NumSubStates) + FromSub) * NumEvents + Event];
+						if (Cell == NoTransition)
+						{
+							Cell = static_cast<uint8>(To * Machine.NumSubStates + (bKeepSub ? FromSub : ToSub));
+						}
+					}
+				}
+			}
+			if (!RuleError.IsEmpty())
+			{
+				OutError = FString::Printf(TEXT("machine '%s' transition %d: %s"), *Machine.Name.ToString(), RuleIndex, *RuleError);
+				return false;
+			}
+		}
+
+		ByName.Add(Machine.Name, Compiled.Num());
+		Compiled.Add(MoveTemp(Machine));
+	}
+
+	// Slots hold machine indices; keep them valid by name
+	for (int32 Slot = 0; Slot < MachineOf.Num(); ++Slot)
+	{
+		if (MachineOf[Slot] != INDEX_NONE)
+		{
+			const int32* NewIndex = ByName.Find(Machines[MachineOf[Slot]].Name);
+			if (!NewIndex)
+			{
+				OutError = FString::Printf(TEXT("machine '%s' is in use and missing from the new definitions"), *Machines[MachineOf[Slot]].Name.ToString());
+				return false;
+			}
+		}
+	}
+	for (int32 Slot = 0; Slot < MachineOf.Num(); ++Slot)
+	{
+		if (MachineOf[Slot] != INDEX_NONE)
+		{
+			MachineOf[Slot] = ByName.FindChecked(Machines[MachineOf[Slot]].Name);
+		}
+	}
+
+	Machines = MoveTemp(Compiled);
+	MachineByName = MoveTemp(ByName);
+	Stats.Machines = Machines.Num();
+	return true;
+}
+
+uint8 UHMVRInteractableStateMachineSubsystem::Pack(int32 Machine, EInteractableState State, uint8 SubState) const
+{
+	const int32 NumSubStates = Machines[Machine].NumSubStates;
+	return static_cast<uint8>(static_cast<int32>(State) * NumSubStates + FMath::Min<int32>(SubState, NumSubStates - 1));
+}
+
+int32 UHMVRInteractableStateMachineSubsystem::Register(UHMVRInteractableComponent* Component, FName Machine, EInteractableState State, uint8 SubState)
+{
+	const int32* MachineIndex = MachineByName.Find(Machine);
+	if (!MachineIndex)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Components.AddDefaulted();
+		MachineOf.Add(INDEX_NONE);
+		Current.Add(0);
+		PassFrom.Add(NoTransition);
+	}
+	Components[Slot] = Component;
+	MachineOf[Slot] = *MachineIndex;
+	Current[Slot] = Pack(*MachineIndex, State, SubState);
+	PassFrom[Slot] = NoTransition;
+	++Stats.Registered;
+	return Slot;
+}
+
+void UHMVRInteractableStateMachineSubsystem::Unregister(int32 Slot)
+{
+	if (!MachineOf.IsValidIndex(Slot) || MachineOf[Slot] == INDEX_NONE)
+	{
+		return;
+	}
+	// Queued events for the slot are skipped by the pass; the slot is reused after it
+	Components[Slot].Reset();
+	MachineOf[Slot] = INDEX_NONE;
+	FreeSlots.Add(Slot);
+	--Stats.Registered;
+}
+
+void UHMVRInteractableStateMachineSubsystem::SyncState(int32 Slot, EInteractableState State, uint8 SubState)
+{
+	if (MachineOf.IsValidIndex(Slot) && MachineOf[Slot] != INDEX_NONE)
+	{
+		Current[Slot] = Pack(MachineOf[Slot], State, SubState);
+	}
+}
+
+void UHMVRInteractableStateMachineSubsystem::RaiseEvent(int32 Slot, EHMVRInteractableEvent Event)
+{
+	if (MachineOf.IsValidIndex(Slot) && MachineOf[Slot] != INDEX_NONE && Event < EHMVRInteractableEvent::Num)
+	{
+		Queue.Add({ Slot, Event });
+	}
+}
+
+bool UHMVRInteractableStateMachineSubsystem::GetState(int32 Slot, EInteractableState& OutState, uint8& OutSubState) const
+{
+	if (!MachineOf.IsValidIndex(Slot) || MachineOf[Slot] == INDEX_NONE)
+	{
+		return false;
+	}
+	const int32 NumSubStates = Machines[MachineOf[Slot]].NumSubStates;
+	OutState = static_cast<EInteractableState>(Current[Slot] / NumSubStates);
+	OutSubState = static_cast<uint8>(Current[Slot] % NumSubStates);
+	return true;
+}
+
+void UHMVRInteractableStateMachineSubsystem::Tick(float DeltaTime)
+{
+	if (Queue.Num() > 0)
+	{
+		ProcessEvents();
+	}
+}
+
+void UHMVRInteractableStateMachineSubsystem::ProcessEvents()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Events raised while dispatching wait for the next pass
+	Swap(Queue, Processing);
+	Queue.Reset();
+	Touched.Reset();
+	Stats.Events += Processing.Num();
+	Stats.LargestQueue = FMath::Max(Stats.LargestQueue, Processing.Num());
+
+	for (const FQueuedEvent& Queued : Processing)
+	{
+		const int32 Machine = MachineOf[Queued.Slot];
+		if (Machine == INDEX_NONE)
+		{
+			continue; // unregistered since it was raised
+		}
+		const uint8 From = Current[Queued.Slot];
+		const uint8 To = Machines[Machine].Next[From * NumEvents + static_cast<int32>(Queued.Event)];
+		if (To == NoTransition || To == From)
+		{
+			continue;
+		}
+		++Stats.Transitions;
+		if (PassFrom[Queued.Slot] == NoTransition)
+		{
+			PassFrom[Queued.Slot] = From;
+			Touched.Add(Queued.Slot);
+		}
+		Current[Queued.Slot] = To;
+	}
+	Processing.Reset();
+
+	for (const int32 Slot : Touched)
+	{
+		const uint8 From = PassFrom[Slot];
+		PassFrom[Slot] = NoTransition;
+		const int32 Machine = MachineOf[Slot];
+		if (Machine == INDEX_NONE || Current[Slot] == From)
+		{
+			continue; // round trip within the pass
+		}
+		++Stats.Dispatched;
+		if (UHMVRInteractableComponent* Component = Components[Slot].Get())
+		{
+			const int32 NumSubStates = Machines[Machine].NumSubStates;
+			const uint8 To = Current[Slot];
+			Component->ApplyMachineTransition(
+				static_cast<EInteractableState>(From / NumSubStates), static_cast<uint8>(From % NumSubStates),
+				static_cast<EInteractableState>(To / NumSubStates), static_cast<uint8>(To % NumSubStates));
+		}
+	}
+
+	Stats.LastPassMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	Stats.MaxPassMs = FMath::Max(Stats.MaxPassMs, Stats.LastPassMs);
+}
+
+void UHMVRInteractableStateMachineSubsystem::LogStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRInteractableStateMachine: %d machines, %d interactables | %lld events, %lld transitions, %lld dispatched, largest queue %d | pass %.3f ms last, %.3f ms max"),
+		Stats.Machines, Stats.Registered, Stats.Events, Stats.Transitions, Stats.Dispatched, Stats.LargestQueue,
+		Stats.LastPassMs, Stats.MaxPassMs);
+}
+
+#if !UE_BUILD_SHIPPING
+// Pure runtime cost: Count objects under one machine (no actors, so no dispatch work beyond the
+// bookkeeping), EventsPerFrame random events a frame for Frames frames, every pass timed.
+static FAutoConsoleCommandWithWorldAndArgs CmdStateMachineBench(
+	TEXT("HMVR.StateMachine.Bench"),
+	TEXT("HMVR.StateMachine.Bench [Count=10000] [EventsPerFrame=5000] [Frames=300] [Machine=Creature] — event pass cost over Count objects."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UHMVRInteractableStateMachineSubsystem* StateMachines = World ? World->GetSubsystem<UHMVRInteractableStateMachineSubsystem>() : nullptr;
+		const FName Machine = Args.Num() > 3 ? FName(*Args[3]) : FName(TEXT("Creature"));
+		if (!StateMachines || !StateMachines->HasMachine(Machine))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRInteractableStateMachine: Bench needs a game world with machine '%s' loaded"), *Machine.ToString());
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+		const int32 EventsPerFrame = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 5000;
+		const int32 Frames = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 300;
+
+		// Drain anything real first so it is not counted
+		StateMachines->ProcessEvents();
+		const UHMVRInteractableStateMachineSubsystem::FStats Before = StateMachines->GetStats();
+
+		TArray<int32> Slots;
+		Slots.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Slots.Add(StateMachines->Register(nullptr, Machine, EInteractableState::Idle, 0));
+		}
+
+		FRandomStream Random(Count);
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			for (int32 i = 0; i < EventsPerFrame; ++i)
+			{
+				StateMachines->RaiseEvent(Slots[Random.RandHelper(Count)],
+					static_cast<EHMVRInteractableEvent>(Random.RandHelper(static_cast<int32>(EHMVRInteractableEvent::Num))));
+			}
+			const double StartTime = FPlatformTime::Seconds();
+			StateMachines->ProcessEvents();
+			const double Ms = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			TotalMs += Ms;
+			MaxMs = FMath::Max(MaxMs, Ms);
+		}
+
+		const UHMVRInteractableStateMachineSubsystem::FStats& After = StateMachines->GetStats();
+		UE_LOG(LogTemp, Log,
+			TEXT("HMVRInteractableStateMachine: Bench %d '%s' objects, %d events/frame over %d frames — pass %.4f ms avg, %.4f ms max (%.1f ns/event); %lld transitions, %lld dispatched"),
+			Count, *Machine.ToString(), EventsPerFrame, Frames, TotalMs / Frames, MaxMs,
+			TotalMs * 1.0e6 / (static_cast<double>(EventsPerFrame) * Frames),
+			After.Transitions - Before.Transitions, After.Dispatched - Before.Dispatched);
+
+		for (const int32 Slot : Slots)
+		{
+			StateMachines->Unregister(Slot);
+		}
+	}));
+#endif
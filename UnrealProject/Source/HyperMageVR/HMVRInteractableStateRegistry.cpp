@@ -0,0 +1,279 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRInteractableStateRegistry.h"
+#include "HMVRInteractableComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld CmdInteractablesStats(
+	TEXT("HMVR.Interactables.Stats"),
+	TEXT("Print interactable state registry rows, dirty rate and server serialization cost."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (AHMVRInteractableStateRegistry* Registry = AHMVRInteractableStateRegistry::Get(World))
+		{
+			Registry->DumpStats();
+		}
+	}));
+
+#if !UE_BUILD_SHIPPING
+// HMVR.Interactables.Stress [Count] [ChangesPerSecond] — run on the server with clients
+// connected, then compare `stat net` / HMVR.Interactables.Stats. Count 0 removes them.
+static FAutoConsoleCommandWithWorldAndArgs CmdInteractablesStress(
+	TEXT("HMVR.Interactables.Stress"),
+	TEXT("HMVR.Interactables.Stress [Count=1000] [ChangesPerSecond=50] — spawn stand-in interactables and churn their state."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("InteractableStateRegistry: HMVR.Interactables.Stress must run on the server"));
+			return;
+		}
+		const int32 Count = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : 1000;
+		const float ChangesPerSecond = Args.Num() > 1 ? FMath::Max(0.f, FCString::Atof(*Args[1])) : 50.f;
+		if (AHMVRInteractableStateRegistry* Registry = AHMVRInteractableStateRegistry::Get(World))
+		{
+			Registry->RunStress(Count, ChangesPerSecond);
+		}
+	}));
+#endif
+
+// ── Fast array ───────────────────────────────────────────────────────────────
+
+void FHMVRInteractableStateItem::PostReplicatedAdd(const FHMVRInteractableStateArray& InArraySerializer)
+{
+	PostReplicatedChange(InArraySerializer);
+}
+
+void FHMVRInteractableStateItem::PostReplicatedChange(const FHMVRInteractableStateArray& /*InArraySerializer*/)
+{
+	// Null until the owning actor has replicated; the array calls back again once it maps
+	if (Component)
+	{
+		Component->ApplyReplicatedState(State, SubState, Health);
+	}
+}
+
+bool FHMVRInteractableStateArray::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	if (!DeltaParms.Writer)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FHMVRInteractableStateItem, FHMVRInteractableStateArray>(Items, DeltaParms, *this);
+	}
+
+	const int64 BitsBefore = DeltaParms.Writer->GetNumBits();
+	const double Start = FPlatformTime::Seconds();
+	const bool bWrote = FFastArraySerializer::FastArrayDeltaSerialize<FHMVRInteractableStateItem, FHMVRInteractableStateArray>(Items, DeltaParms, *this);
+
+	++SerializeCalls;
+	SerializeSeconds += FPlatformTime::Seconds() - Start;
+	BitsWritten += DeltaParms.Writer->GetNumBits() - BitsBefore;
+	return bWrote;
+}
+
+// ── Registry ─────────────────────────────────────────────────────────────────
+
+AHMVRInteractableStateRegistry::AHMVRInteractableStateRegistry()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetNetUpdateFrequency(20.f);
+	SetMinNetUpdateFrequency(2.f);
+}
+
+AHMVRInteractableStateRegistry* AHMVRInteractableStateRegistry::Get(UWorld* World)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	for (TActorIterator<AHMVRInteractableStateRegistry> It(World); It; ++It)
+	{
+		return *It;
+	}
+
+	if (World->GetNetMode() == NM_Client || World->bIsTearingDown)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AHMVRInteractableStateRegistry* Registry = World->SpawnActor<AHMVRInteractableStateRegistry>(Params);
+	if (Registry)
+	{
+		Registry->StatsStartTime = FPlatformTime::Seconds();
+	}
+	return Registry;
+}
+
+void AHMVRInteractableStateRegistry::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AHMVRInteractableStateRegistry, StateArray);
+}
+
+int32 AHMVRInteractableStateRegistry::Register(UHMVRInteractableComponent* Component)
+{
+	if (!Component)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 ObjectIndex;
+	if (FreeIndices.Num() > 0)
+	{
+		ObjectIndex = FreeIndices.Pop(EAllowShrinking::No);
+	}
+	else if (ItemByIndex.Num() <= MAX_uint16)
+	{
+		ObjectIndex = ItemByIndex.Add(INDEX_NONE);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("InteractableStateRegistry: full, %s will not replicate state"), *Component->ObjectId);
+		return INDEX_NONE;
+	}
+
+	FHMVRInteractableStateItem& Item = StateArray.Items.AddDefaulted_GetRef();
+	Item.ObjectIndex = static_cast<uint16>(ObjectIndex);
+	Item.Component = Component;
+	Item.State = Component->GetState();
+	Item.SubState = Component->GetSubState();
+	Item.Health = Component->GetHealth();
+	StateArray.MarkItemDirty(Item);
+	ItemByIndex[ObjectIndex] = StateArray.Items.Num() - 1;
+	++RowsDirtied;
+	return ObjectIndex;
+}
+
+void AHMVRInteractableStateRegistry::Unregister(int32 ObjectIndex)
+{
+	if (!ItemByIndex.IsValidIndex(ObjectIndex) || ItemByIndex[ObjectIndex] == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 ItemPos = ItemByIndex[ObjectIndex];
+	StateArray.Items.RemoveAtSwap(ItemPos, 1, EAllowShrinking::No);
+	if (StateArray.Items.IsValidIndex(ItemPos))
+	{
+		ItemByIndex[StateArray.Items[ItemPos].ObjectIndex] = ItemPos;
+	}
+	StateArray.MarkArrayDirty();
+
+	ItemByIndex[ObjectIndex] = INDEX_NONE;
+	FreeIndices.Add(static_cast<uint16>(ObjectIndex));
+}
+
+void AHMVRInteractableStateRegistry::MarkChanged(int32 ObjectIndex)
+{
+	if (!ItemByIndex.IsValidIndex(ObjectIndex) || ItemByIndex[ObjectIndex] == INDEX_NONE)
+	{
+		return;
+	}
+
+	FHMVRInteractableStateItem& Item = StateArray.Items[ItemByIndex[ObjectIndex]];
+	const UHMVRInteractableComponent* Component = Item.Component;
+	if (!Component)
+	{
+		return;
+	}
+
+	if (Item.State == Component->GetState() && Item.SubState == Component->GetSubState() && Item.Health == Component->GetHealth())
+	{
+		return;
+	}
+
+	Item.State = Component->GetState();
+	Item.SubState = Component->GetSubState();
+	Item.Health = Component->GetHealth();
+	StateArray.MarkItemDirty(Item);
+	++RowsDirtied;
+}
+
+void AHMVRInteractableStateRegistry::DumpStats() const
+{
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StatsStartTime, 1e-3);
+	const int64 Calls = FMath::Max<int64>(StateArray.SerializeCalls, 1);
+	UE_LOG(LogTemp, Log,
+		TEXT("InteractableStateRegistry: %d rows, %.1f rows dirtied/s, %lld serializes (%.2f us, %.1f bits avg), %.1f kbit/s written"),
+		StateArray.Items.Num(), RowsDirtied / Elapsed, StateArray.SerializeCalls,
+		StateArray.SerializeSeconds * 1e6 / Calls, static_cast<double>(StateArray.BitsWritten) / Calls,
+		StateArray.BitsWritten / Elapsed / 1000.0);
+}
+
+// ── Stress ───────────────────────────────────────────────────────────────────
+
+#if !UE_BUILD_SHIPPING
+void AHMVRInteractableStateRegistry::RunStress(int32 Count, float ChangesPerSecond)
+{
+	for (const TWeakObjectPtr<AActor>& Actor : StressActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+	StressActors.Reset();
+	GetWorldTimerManager().ClearTimer(StressTimerHandle);
+
+	if (Count <= 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("InteractableStateRegistry: stress stopped"));
+		return;
+	}
+
+	// Out of everyone's way, on a grid so nothing overlaps
+	const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector Location(100000.f + (i % Side) * 200.f, 100000.f + (i / Side) * 200.f, -10000.f);
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		StressActors.Add(GetWorld()->SpawnActor<AHMVRStressInteractable>(Location, FRotator::ZeroRotator, Params));
+	}
+
+	StressChangesPerSecond = ChangesPerSecond;
+	RowsDirtied = 0;
+	StateArray.SerializeCalls = 0;
+	StateArray.BitsWritten = 0;
+	StateArray.SerializeSeconds = 0.0;
+	StatsStartTime = FPlatformTime::Seconds();
+
+	GetWorldTimerManager().SetTimer(StressTimerHandle, this, &AHMVRInteractableStateRegistry::StressTick, 0.1f, true);
+	UE_LOG(LogTemp, Log, TEXT("InteractableStateRegistry: stress %d interactables, %.0f changes/s (%d rows)"),
+		Count, ChangesPerSecond, StateArray.Items.Num());
+}
+
+void AHMVRInteractableStateRegistry::StressTick()
+{
+	if (StressActors.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 Changes = FMath::RoundToInt(StressChangesPerSecond * 0.1f);
+	for (int32 i = 0; i < Changes; ++i)
+	{
+		AHMVRStressInteractable* Actor = Cast<AHMVRStressInteractable>(StressActors[FMath::RandRange(0, StressActors.Num() - 1)].Get());
+		if (Actor && Actor->Interactable)
+		{
+			Actor->Interactable->TransitionTo(static_cast<EInteractableState>(FMath::RandRange(0, 3)));
+		}
+	}
+}
+#endif
+
+AHMVRStressInteractable::AHMVRStressInteractable()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	SetNetUpdateFrequency(1.f);
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	Interactable = CreateDefaultSubobject<UHMVRInteractableComponent>(TEXT("Interactable"));
+}
@@ -0,0 +1,136 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "HMVRInteractable.h"
+#include "HMVRInteractableStateRegistry.generated.h"
+
+class UHMVRInteractableComponent;
+struct FHMVRInteractableStateArray;
+
+/** One interactable's replicated row. ObjectIndex is the registry slot the component holds. */
+USTRUCT()
+struct FHMVRInteractableStateItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint16 ObjectIndex = 0;
+
+	UPROPERTY()
+	TObjectPtr<UHMVRInteractableComponent> Component;
+
+	UPROPERTY()
+	EInteractableState State = EInteractableState::Idle;
+
+	/** Owner-specific sub-state (ECreatureSubState, EMachinerySubState, ...). */
+	UPROPERTY()
+	uint8 SubState = 0;
+
+	UPROPERTY()
+	float Health = 0.f;
+
+	void PostReplicatedAdd(const FHMVRInteractableStateArray& InArraySerializer);
+	void PostReplicatedChange(const FHMVRInteractableStateArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FHMVRInteractableStateArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FHMVRInteractableStateItem> Items;
+
+	// Server-side serialization cost, for HMVR.Interactables.Stats
+	int64 SerializeCalls = 0;
+	int64 BitsWritten = 0;
+	double SerializeSeconds = 0.0;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+};
+
+template<>
+struct TStructOpsTypeTraits<FHMVRInteractableStateArray> : public TStructOpsTypeTraitsBase2<FHMVRInteractableStateArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+/**
+ * Single replicated table of interactable state.
+ *
+ * Interactable components no longer replicate themselves: on the server each one registers
+ * here, gets a compact ObjectIndex and writes State, sub-state and health into its row. The
+ * rows live in one fast array, so a net update compares one replication key when nothing
+ * changed and serializes only the rows marked dirty since the connection's last ack. On
+ * clients the row callbacks hand the values back to the component, which fires
+ * OnStateChanged (and through it the owners' BP_OnStateChanged) as OnRep_State used to.
+ *
+ * Spawned on demand by the first registering component; always relevant.
+ */
+UCLASS(NotPlaceable, Transient)
+class HYPERMAGEVR_API AHMVRInteractableStateRegistry : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AHMVRInteractableStateRegistry();
+
+	/** Registry for World. Spawns one on the server if none exists; null on clients until replicated. */
+	static AHMVRInteractableStateRegistry* Get(UWorld* World);
+
+	/** Server: add a row for Component. Returns its ObjectIndex, or INDEX_NONE when full. */
+	int32 Register(UHMVRInteractableComponent* Component);
+
+	/** Server: drop the row. */
+	void Unregister(int32 ObjectIndex);
+
+	/** Server: copy the component's current values into its row and mark it dirty. */
+	void MarkChanged(int32 ObjectIndex);
+
+	int32 Num() const { return StateArray.Items.Num(); }
+
+	void DumpStats() const;
+
+#if !UE_BUILD_SHIPPING
+	/** Spawn Count stand-in interactables and drive ChangesPerSecond random transitions. Count 0 stops. */
+	void RunStress(int32 Count, float ChangesPerSecond);
+#endif
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	UPROPERTY(Replicated)
+	FHMVRInteractableStateArray StateArray;
+
+	/** ObjectIndex → position in StateArray.Items (INDEX_NONE when free). */
+	TArray<int32> ItemByIndex;
+	TArray<uint16> FreeIndices;
+
+	int64 RowsDirtied = 0;
+	double StatsStartTime = 0.0;
+
+#if !UE_BUILD_SHIPPING
+	void StressTick();
+
+	TArray<TWeakObjectPtr<AActor>> StressActors;
+	FTimerHandle StressTimerHandle;
+	float StressChangesPerSecond = 0.f;
+#endif
+};
+
+/** Minimal replicated actor carrying one interactable, for HMVR.Interactables.Stress. */
+UCLASS(NotPlaceable, Transient)
+class HYPERMAGEVR_API AHMVRStressInteractable : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AHMVRStressInteractable();
+
+	UPROPERTY()
+	TObjectPtr<UHMVRInteractableComponent> Interactable;
+};
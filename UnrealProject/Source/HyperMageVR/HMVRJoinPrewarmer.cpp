@@ -0,0 +1,278 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRJoinPrewarmer.h"
+#include "HMVRScenePlan.h"
+#include "HMVRScenePlanLoader.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/Async.h"
+#include "Misc/CoreDelegates.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+void UHMVRJoinPrewarmer::BeginDestroy()
+{
+	UnbindMapDelegates();
+	PrewarmHandle.Reset();
+	Super::BeginDestroy();
+}
+
+// ── Asset prewarm ────────────────────────────────────────────────────────────
+
+TArray<FSoftObjectPath> UHMVRJoinPrewarmer::CollectPrewarmPaths() const
+{
+	TArray<FSoftObjectPath> Paths = PrewarmAssets;
+
+	IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	for (const FSoftObjectPath& Map : PrewarmMaps)
+	{
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(Map.GetLongPackageFName(), Dependencies,
+			UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+		for (const FName& PackageName : Dependencies)
+		{
+			if (PackageName.ToString().StartsWith(TEXT("/Script/")))
+			{
+				continue; // native classes are already resident
+			}
+
+			TArray<FAssetData> Assets;
+			AssetRegistry.GetAssetsByPackageName(PackageName, Assets);
+			for (const FAssetData& Asset : Assets)
+			{
+				Paths.AddUnique(Asset.GetSoftObjectPath());
+			}
+		}
+	}
+
+	return Paths;
+}
+
+FString UHMVRJoinPrewarmer::GetPrewarmScenePlanPath() const
+{
+	FString Path = PrewarmScenePlan;
+	if (Path.IsEmpty() && !FParse::Value(FCommandLine::Get(), TEXT("ScenePlan="), Path))
+	{
+		Path = GetDefault<UHMVRScenePlanLoader>()->ScenePlanPath;
+	}
+	if (!Path.IsEmpty() && FPaths::IsRelative(Path))
+	{
+		Path = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Path);
+	}
+	return Path;
+}
+
+void UHMVRJoinPrewarmer::BeginPrewarm()
+{
+	if (PrewarmHandle.IsValid() || bParsingScenePlan)
+	{
+		return;
+	}
+
+	bPrewarmComplete = false;
+	PrewarmStartTime = FPlatformTime::Seconds();
+	PrewarmDoneTime = 0.0;
+
+	const FString PlanPath = GetPrewarmScenePlanPath();
+	if (PlanPath.IsEmpty())
+	{
+		StartPrewarmLoad(CollectPrewarmPaths());
+		return;
+	}
+
+	// The plan is the bulk of what the server spawns; read it off the game thread, then load
+	// its assets together with the configured lists
+	bParsingScenePlan = true;
+	TWeakObjectPtr<UHMVRJoinPrewarmer> WeakThis(this);
+	const uint32 Generation = PrewarmGeneration;
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Generation, PlanPath]()
+	{
+		TSharedPtr<FHMVRScenePlan> Plan = MakeShared<FHMVRScenePlan>();
+		FString Json;
+		FString Error;
+		if (!FFileHelper::LoadFileToString(Json, *PlanPath))
+		{
+			Error = TEXT("could not read file");
+		}
+		else if (!FHMVRScenePlan::Parse(Json, *Plan, Error))
+		{
+			Plan.Reset();
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, PlanPath, Plan, Error]()
+		{
+			UHMVRJoinPrewarmer* This = WeakThis.Get();
+			if (!This || This->PrewarmGeneration != Generation)
+			{
+				return;
+			}
+			This->bParsingScenePlan = false;
+
+			TArray<FSoftObjectPath> Paths = This->CollectPrewarmPaths();
+			if (Plan.IsValid() && Error.IsEmpty())
+			{
+				GetDefault<UHMVRScenePlanLoader>()->CollectAssetPaths(*Plan, Paths);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("HMVRJoinPrewarmer: ScenePlan %s not prewarmed: %s"), *PlanPath, *Error);
+			}
+			This->StartPrewarmLoad(MoveTemp(Paths));
+		});
+	});
+}
+
+void UHMVRJoinPrewarmer::StartPrewarmLoad(TArray<FSoftObjectPath>&& Paths)
+{
+	PrewarmAssetCount = Paths.Num();
+	if (Paths.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRJoinPrewarmer: nothing to prewarm"));
+		bPrewarmComplete = true;
+		PrewarmDoneTime = FPlatformTime::Seconds();
+		return;
+	}
+
+	// Default priority: this runs while the player watches the matchmaking UI, and must not
+	// compete with anything that affects frame time on Quest.
+	PrewarmHandle = StreamableManager.RequestAsyncLoad(Paths,
+		FStreamableDelegate::CreateUObject(this, &UHMVRJoinPrewarmer::OnPrewarmLoaded),
+		FStreamableManager::DefaultAsyncLoadPriority, /*bManageActiveHandle=*/false, /*bStartStalled=*/false,
+		TEXT("HMVRJoinPrewarm"));
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRJoinPrewarmer: streaming %d assets for %d map(s)"), Paths.Num(), PrewarmMaps.Num());
+}
+
+void UHMVRJoinPrewarmer::OnPrewarmLoaded()
+{
+	bPrewarmComplete = true;
+	PrewarmDoneTime = FPlatformTime::Seconds();
+	UE_LOG(LogTemp, Log, TEXT("HMVRJoinPrewarmer: %d assets resident after %.0f ms"),
+		PrewarmAssetCount, (PrewarmDoneTime - PrewarmStartTime) * 1000.0);
+}
+
+void UHMVRJoinPrewarmer::Release()
+{
+	++PrewarmGeneration;
+	bParsingScenePlan = false;
+	if (PrewarmHandle.IsValid())
+	{
+		PrewarmHandle->CancelHandle();
+		PrewarmHandle.Reset();
+	}
+	bPrewarmComplete = false;
+	UnbindMapDelegates();
+	MatchCompletedTime = TravelStartTime = MapLoadStartTime = MapLoadedTime = DnsResolvedTime = 0.0;
+}
+
+// ── Join milestones ──────────────────────────────────────────────────────────
+
+void UHMVRJoinPrewarmer::OnMatchCompleted(const FString& ServerAddress)
+{
+	MatchCompletedTime = FPlatformTime::Seconds();
+	TravelStartTime = MapLoadStartTime = MapLoadedTime = DnsResolvedTime = 0.0;
+
+	UnbindMapDelegates();
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UHMVRJoinPrewarmer::HandlePreLoadMap);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UHMVRJoinPrewarmer::HandlePostLoadMap);
+
+	// GameLift normally hands out an IP literal; only a host name needs resolving
+	ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!Sockets || ServerAddress.IsEmpty())
+	{
+		return;
+	}
+
+	bool bIsIpLiteral = false;
+	Sockets->CreateInternetAddr()->SetIp(*ServerAddress, bIsIpLiteral);
+	if (bIsIpLiteral)
+	{
+		return;
+	}
+
+	// Warms the OS resolver cache the net driver's lookup will hit moments later
+	TWeakObjectPtr<UHMVRJoinPrewarmer> WeakThis(this);
+	Sockets->GetAddressInfoAsync([WeakThis, ServerAddress](FAddressInfoResult Result)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, ServerAddress, Code = Result.ReturnCode]()
+		{
+			if (UHMVRJoinPrewarmer* This = WeakThis.Get())
+			{
+				This->DnsResolvedTime = FPlatformTime::Seconds();
+				UE_LOG(LogTemp, Log, TEXT("HMVRJoinPrewarmer: resolved %s in %.0f ms (%s)"),
+					*ServerAddress, (This->DnsResolvedTime - This->MatchCompletedTime) * 1000.0,
+					Code == SE_NO_ERROR ? TEXT("ok") : TEXT("failed"));
+			}
+		});
+	}, *ServerAddress);
+}
+
+void UHMVRJoinPrewarmer::OnTravelStarted()
+{
+	TravelStartTime = FPlatformTime::Seconds();
+}
+
+void UHMVRJoinPrewarmer::HandlePreLoadMap(const FString& /*MapName*/)
+{
+	if (MapLoadStartTime == 0.0)
+	{
+		MapLoadStartTime = FPlatformTime::Seconds();
+	}
+}
+
+void UHMVRJoinPrewarmer::HandlePostLoadMap(UWorld* /*LoadedWorld*/)
+{
+	MapLoadedTime = FPlatformTime::Seconds();
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UHMVRJoinPrewarmer::HandleEndFrame);
+}
+
+void UHMVRJoinPrewarmer::HandleEndFrame()
+{
+	LogJoinTiming();
+	UnbindMapDelegates();
+
+	// The loaded map now references what it uses; let the rest go
+	PrewarmHandle.Reset();
+}
+
+void UHMVRJoinPrewarmer::UnbindMapDelegates()
+{
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	PreLoadMapHandle.Reset();
+	PostLoadMapHandle.Reset();
+	EndFrameHandle.Reset();
+}
+
+void UHMVRJoinPrewarmer::LogJoinTiming()
+{
+	const double FirstFrameTime = FPlatformTime::Seconds();
+	auto Ms = [](double From, double To) { return (From > 0.0 && To > 0.0) ? (To - From) * 1000.0 : -1.0; };
+
+	UE_LOG(LogTemp, Log, TEXT("JoinTiming: COMPLETED -> travel      %8.1f ms"), Ms(MatchCompletedTime, TravelStartTime));
+	UE_LOG(LogTemp, Log, TEXT("JoinTiming: travel -> map load start %8.1f ms  (connect + handshake)"), Ms(TravelStartTime, MapLoadStartTime));
+	UE_LOG(LogTemp, Log, TEXT("JoinTiming: map load                 %8.1f ms"), Ms(MapLoadStartTime, MapLoadedTime));
+	UE_LOG(LogTemp, Log, TEXT("JoinTiming: map loaded -> 1st frame  %8.1f ms"), Ms(MapLoadedTime, FirstFrameTime));
+	UE_LOG(LogTemp, Log, TEXT("JoinTiming: total                    %8.1f ms"), Ms(MatchCompletedTime, FirstFrameTime));
+
+	if (PrewarmStartTime > 0.0)
+	{
+		FString PrewarmResult = TEXT("still streaming at first frame");
+		if (bPrewarmComplete && PrewarmDoneTime <= MatchCompletedTime)
+		{
+			PrewarmResult = FString::Printf(TEXT("resident %.1f ms before COMPLETED"), Ms(PrewarmDoneTime, MatchCompletedTime));
+		}
+		else if (bPrewarmComplete)
+		{
+			PrewarmResult = FString::Printf(TEXT("resident %.1f ms after COMPLETED"), Ms(MatchCompletedTime, PrewarmDoneTime));
+		}
+		UE_LOG(LogTemp, Log, TEXT("JoinTiming: prewarm %d assets, %s"), PrewarmAssetCount, *PrewarmResult);
+	}
+}
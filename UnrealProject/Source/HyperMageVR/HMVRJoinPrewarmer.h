@@ -0,0 +1,98 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "UObject/SoftObjectPath.h"
+#include "Engine/StreamableManager.h"
+#include "HMVRJoinPrewarmer.generated.h"
+
+/**
+ * Overlaps join work with the matchmaking wait and measures what is left.
+ *
+ * BeginPrewarm() (matchmaking started) streams the hard dependencies of PrewarmMaps, the
+ * classes, meshes and materials of the ScenePlan the server builds its world from, and
+ * PrewarmAssets in the background and holds them until the gameplay map has loaded, so
+ * LoadMap and the first replicated actors resolve them from memory instead of disk. The plan
+ * is read and parsed on a worker thread before the load starts.
+ *
+ * OnMatchCompleted() (server address known) starts an async DNS lookup when the address is
+ * a host name. The UE connection handshake itself belongs to the pending net game created by
+ * travel, so travel should be issued in the same frame; there is nothing to pre-handshake.
+ *
+ * Join timing (matchmaking COMPLETED → travel → map load start → map loaded → first frame in
+ * world) is logged with a "JoinTiming:" prefix once the first frame in the new world ends.
+ * Works with -nullrhi for headless measurement.
+ *
+ * Lists are read from [/Script/HyperMageVR.HMVRJoinPrewarmer] in DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class HYPERMAGEVR_API UHMVRJoinPrewarmer : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	/** Start streaming map dependencies and assets. Idempotent while a prewarm is held. */
+	void BeginPrewarm();
+
+	/** Matchmaking finished — start the join clock and pre-resolve ServerAddress. */
+	void OnMatchCompleted(const FString& ServerAddress);
+
+	/** Travel to the game server was issued. */
+	void OnTravelStarted();
+
+	/** Drop everything held (matchmaking cancelled or failed). */
+	void Release();
+
+	bool IsPrewarmComplete() const { return bPrewarmComplete; }
+
+	/** Maps whose hard package dependencies are streamed during matchmaking. */
+	UPROPERTY(Config)
+	TArray<FSoftObjectPath> PrewarmMaps;
+
+	/** Additional assets streamed during matchmaking (e.g. BasicShapes spawned by HMVRGameMode). */
+	UPROPERTY(Config)
+	TArray<FSoftObjectPath> PrewarmAssets;
+
+	/**
+	 * ScenePlan whose assets are streamed during matchmaking (relative to the project dir).
+	 * Empty = -ScenePlan= or the HMVRScenePlanLoader's ScenePlanPath, as the server resolves it.
+	 */
+	UPROPERTY(Config)
+	FString PrewarmScenePlan;
+
+private:
+	TArray<FSoftObjectPath> CollectPrewarmPaths() const;
+	FString GetPrewarmScenePlanPath() const;
+	void StartPrewarmLoad(TArray<FSoftObjectPath>&& Paths);
+	void OnPrewarmLoaded();
+
+	void HandlePreLoadMap(const FString& MapName);
+	void HandlePostLoadMap(UWorld* LoadedWorld);
+	void HandleEndFrame();
+	void LogJoinTiming();
+	void UnbindMapDelegates();
+
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> PrewarmHandle;
+	int32 PrewarmAssetCount = 0;
+	bool bPrewarmComplete = false;
+	bool bParsingScenePlan = false;
+	uint32 PrewarmGeneration = 0; // bumped by Release so a plan parse finishing late is ignored
+
+	// Timestamps (FPlatformTime::Seconds, 0 = not reached)
+	double PrewarmStartTime = 0.0;
+	double PrewarmDoneTime = 0.0;
+	double MatchCompletedTime = 0.0;
+	double DnsResolvedTime = 0.0;
+	double TravelStartTime = 0.0;
+	double MapLoadStartTime = 0.0;
+	double MapLoadedTime = 0.0;
+
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle PostLoadMapHandle;
+	FDelegateHandle EndFrameHandle;
+};
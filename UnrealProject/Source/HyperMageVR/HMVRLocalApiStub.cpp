@@ -0,0 +1,691 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRLocalApiStub.h"
+
+#if WITH_HMVR_API_STUB
+
+#include "AwsSigV4.h"
+#include "HMVRGmEvents.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "HAL/IConsoleManager.h"
+#include "Containers/Ticker.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+// ── Fault injection ──────────────────────────────────────────────────────────
+
+static TAutoConsoleVariable<float> CVarStubLatencyMs(
+	TEXT("hmvr.Stub.LatencyMs"), 0.f,
+	TEXT("Local API stub: base response latency in milliseconds."));
+
+static TAutoConsoleVariable<float> CVarStubLatencyJitterMs(
+	TEXT("hmvr.Stub.LatencyJitterMs"), 0.f,
+	TEXT("Local API stub: uniform random latency added on top of hmvr.Stub.LatencyMs."));
+
+static TAutoConsoleVariable<float> CVarStubErrorRate(
+	TEXT("hmvr.Stub.ErrorRate"), 0.f,
+	TEXT("Local API stub: fraction of requests (0-1) answered with HTTP 503."));
+
+static TAutoConsoleVariable<int32> CVarStubMaxRequestsPerSecond(
+	TEXT("hmvr.Stub.MaxRequestsPerSecond"), 0,
+	TEXT("Local API stub: requests above this rate are answered with HTTP 429 (0 = unlimited)."));
+
+static TAutoConsoleVariable<int32> CVarStubSeed(
+	TEXT("hmvr.Stub.Seed"), 1,
+	TEXT("Local API stub: random seed for latency jitter and error injection, applied on start."));
+
+static TAutoConsoleVariable<float> CVarStubMatchSearchSeconds(
+	TEXT("hmvr.Stub.MatchmakingSearchSeconds"), 4.f,
+	TEXT("Local API stub: seconds a ticket stays SEARCHING before PLACING."));
+
+static TAutoConsoleVariable<float> CVarStubMatchPlacingSeconds(
+	TEXT("hmvr.Stub.MatchmakingPlacingSeconds"), 1.f,
+	TEXT("Local API stub: seconds a ticket stays PLACING before COMPLETED."));
+
+static TAutoConsoleVariable<FString> CVarStubGameServerAddress(
+	TEXT("hmvr.Stub.GameServerAddress"), TEXT("127.0.0.1"),
+	TEXT("Local API stub: ipAddress returned for completed matchmaking tickets."));
+
+static TAutoConsoleVariable<int32> CVarStubGameServerPort(
+	TEXT("hmvr.Stub.GameServerPort"), 7777,
+	TEXT("Local API stub: port returned for completed matchmaking tickets."));
+
+static TAutoConsoleVariable<bool> CVarStubLongPoll(
+	TEXT("hmvr.Stub.LongPoll"), true,
+	TEXT("Local API stub: honour ?wait on matchmaking status (false = answer immediately, like a plain poll endpoint)."));
+
+static TAutoConsoleVariable<float> CVarStubMaxLongPollSeconds(
+	TEXT("hmvr.Stub.MaxLongPollSeconds"), 20.f,
+	TEXT("Local API stub: longest a matchmaking status request is held."));
+
+static FAutoConsoleCommand CmdStubStats(
+	TEXT("HMVR.Stub.Stats"),
+	TEXT("Print local API stub request counters."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHMVRLocalApiStub::Get().DumpStats(); }));
+
+static FAutoConsoleCommand CmdStubResetStats(
+	TEXT("HMVR.Stub.ResetStats"),
+	TEXT("Reset local API stub request counters."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHMVRLocalApiStub::Get().ResetStats(); }));
+
+// ── Helpers ──────────────────────────────────────────────────────────────────
+
+namespace
+{
+	FString BodyToString(const FHttpServerRequest& Request)
+	{
+		FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+		return FString(Conv.Length(), Conv.Get());
+	}
+
+	TSharedPtr<FJsonObject> ParseBody(const FHttpServerRequest& Request)
+	{
+		TSharedPtr<FJsonObject> Json;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyToString(Request));
+		FJsonSerializer::Deserialize(Reader, Json);
+		return Json;
+	}
+
+	FString ToJson(const TSharedRef<FJsonObject>& Object)
+	{
+		FString Out;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+		FJsonSerializer::Serialize(Object, Writer);
+		return Out;
+	}
+
+	TPair<int32, FString> Error(int32 Code, const TCHAR* ErrorCode, const FString& Message)
+	{
+		return { Code, FString::Printf(TEXT("{\"error\":\"%s\",\"message\":\"%s\"}"), ErrorCode, *Message) };
+	}
+}
+
+// ── Lifecycle ────────────────────────────────────────────────────────────────
+
+FHMVRLocalApiStub& FHMVRLocalApiStub::Get()
+{
+	static FHMVRLocalApiStub Instance;
+	return Instance;
+}
+
+bool FHMVRLocalApiStub::IsPortTaken(int32 Port)
+{
+	ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!Sockets)
+	{
+		return false;
+	}
+
+	// Same wildcard address the HTTP listener binds; no SO_REUSEADDR, so a live listener refuses it
+	TSharedRef<FInternetAddr> Addr = Sockets->CreateInternetAddr();
+	Addr->SetAnyAddress();
+	Addr->SetPort(Port);
+	FSocket* Probe = Sockets->CreateSocket(NAME_Stream, TEXT("HMVRLocalApiStubProbe"), Addr->GetProtocolType());
+	if (!Probe)
+	{
+		return false;
+	}
+	const bool bTaken = !Probe->Bind(*Addr);
+	Probe->Close();
+	Sockets->DestroySocket(Probe);
+	return bTaken;
+}
+
+bool FHMVRLocalApiStub::Start(int32 Port)
+{
+	if (IsRunning())
+	{
+		return true;
+	}
+
+	Router = FHttpServerModule::Get().GetHttpRouter(Port, /*bFailOnBindFailure=*/true);
+	if (!Router.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("LocalApiStub: could not bind port %d"), Port);
+		return false;
+	}
+
+	ListenPort = Port;
+	Random.Initialize(CVarStubSeed.GetValueOnGameThread());
+
+	BindStubRoute(TEXT("/session-summary"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandleSessionSummary(R); });
+	BindStubRoute(TEXT("/interaction-events"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandleInteractionEvents(R); });
+	BindStubRoute(TEXT("/player-rewards"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandlePutPlayerReward(R); });
+	BindStubRoute(TEXT("/player-rewards/batch"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandlePutPlayerRewardBatch(R); });
+	BindStubRoute(TEXT("/player-rewards/:playerId"), EHttpServerRequestVerbs::VERB_GET,
+		[this](const FHttpServerRequest& R) { return HandleGetPlayerRewards(R); });
+	BindStubRoute(TEXT("/world-state"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandlePutWorldState(R); });
+	BindStubRoute(TEXT("/world-state/:objectId"), EHttpServerRequestVerbs::VERB_GET,
+		[this](const FHttpServerRequest& R) { return HandleGetWorldState(R); });
+	BindStubRoute(TEXT("/matchmaking/start"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandleStartMatchmaking(R); });
+	BindStubAsyncRoute(TEXT("/matchmaking/status/:ticketId"), EHttpServerRequestVerbs::VERB_GET,
+		[this](const FHttpServerRequest& R, const FStubReply& Reply) { HandleMatchmakingStatus(R, Reply); });
+	BindStubRoute(TEXT("/matchmaking/cancel/:ticketId"), EHttpServerRequestVerbs::VERB_DELETE,
+		[this](const FHttpServerRequest& R) { return HandleCancelMatchmaking(R); });
+	BindStubRoute(TEXT("/gm/event"), EHttpServerRequestVerbs::VERB_POST,
+		[this](const FHttpServerRequest& R) { return HandleGmEvent(R); });
+
+	FHttpServerModule::Get().StartAllListeners();
+
+	UE_LOG(LogTemp, Log, TEXT("LocalApiStub: listening on http://127.0.0.1:%d (%d routes)"),
+		Port, RouteHandles.Num());
+	return true;
+}
+
+void FHMVRLocalApiStub::Stop()
+{
+	if (!Router.IsValid())
+	{
+		return;
+	}
+
+	for (const FHttpRouteHandle& Handle : RouteHandles)
+	{
+		Router->UnbindRoute(Handle);
+	}
+	RouteHandles.Empty();
+	Router.Reset();
+
+	StatusWaiters.Empty();
+	if (StatusWaiterTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(StatusWaiterTicker);
+		StatusWaiterTicker.Reset();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LocalApiStub: stopped (port %d)"), ListenPort);
+	ListenPort = 0;
+}
+
+void FHMVRLocalApiStub::DumpStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("LocalApiStub: %lld requests, %lld bytes in, %lld injected 503, %lld throttled 429, %lld long-polls held, %lld duplicate grants dropped, %lld bad signatures 403"),
+		Stats.Requests, Stats.BytesReceived, Stats.InjectedErrors, Stats.Throttled, Stats.LongPollsHeld, Stats.DuplicateGrants, Stats.SignatureRejected);
+	for (const TPair<FString, int64>& Pair : Stats.RequestsByRoute)
+	{
+		UE_LOG(LogTemp, Log, TEXT("LocalApiStub:   %-32s %lld"), *Pair.Key, Pair.Value);
+	}
+}
+
+// ── Request pipeline ─────────────────────────────────────────────────────────
+
+void FHMVRLocalApiStub::BindStubRoute(const TCHAR* Path, EHttpServerRequestVerbs Verb, FStubHandler Handler)
+{
+	BindStubAsyncRoute(Path, Verb, [Handler = MoveTemp(Handler)](const FHttpServerRequest& Request, const FStubReply& Reply)
+	{
+		TPair<int32, FString> Result = Handler(Request);
+		Reply(Result.Key, Result.Value);
+	});
+}
+
+void FHMVRLocalApiStub::BindStubAsyncRoute(const TCHAR* Path, EHttpServerRequestVerbs Verb, FStubAsyncHandler Handler)
+{
+	const FString Route = Path;
+	FHttpRouteHandle Handle = Router->BindRoute(FHttpPath(Path), Verb, FHttpRequestHandler::CreateLambda(
+		[this, Route, Handler = MoveTemp(Handler)](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+		{
+			HandleRequest(Route, Request, OnComplete, Handler);
+			return true;
+		}));
+
+	if (Handle.IsValid())
+	{
+		RouteHandles.Add(Handle);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("LocalApiStub: failed to bind route %s"), Path);
+	}
+}
+
+void FHMVRLocalApiStub::HandleRequest(const FString& Route, const FHttpServerRequest& Request,
+                                      const FHttpResultCallback& OnComplete, const FStubAsyncHandler& Handler)
+{
+	++Stats.Requests;
+	++Stats.RequestsByRoute.FindOrAdd(Route);
+	Stats.BytesReceived += Request.Body.Num();
+
+	FString SignatureError;
+	if (!VerifySignature(Route, Request, SignatureError))
+	{
+		++Stats.SignatureRejected;
+		UE_LOG(LogTemp, Warning, TEXT("LocalApiStub: %s rejected: %s"), *Route, *SignatureError);
+		Respond(OnComplete, 403, Error(403, TEXT("SIGNATURE_DOES_NOT_MATCH"), SignatureError).Value);
+		return;
+	}
+
+	const int32 MaxRps = CVarStubMaxRequestsPerSecond.GetValueOnGameThread();
+	if (MaxRps > 0)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now - ThrottleWindowStart >= 1.0)
+		{
+			ThrottleWindowStart = Now;
+			ThrottleWindowCount = 0;
+		}
+		if (++ThrottleWindowCount > MaxRps)
+		{
+			++Stats.Throttled;
+			Respond(OnComplete, 429, TEXT("{\"error\":\"THROTTLED\"}"));
+			return;
+		}
+	}
+
+	if (Random.FRand() < CVarStubErrorRate.GetValueOnGameThread())
+	{
+		++Stats.InjectedErrors;
+		Respond(OnComplete, 503, TEXT("{\"error\":\"SERVICE_UNAVAILABLE\"}"));
+		return;
+	}
+
+	Handler(Request, [this, OnComplete](int32 Code, const FString& Body)
+	{
+		Respond(OnComplete, Code, Body);
+	});
+}
+
+void FHMVRLocalApiStub::Respond(const FHttpResultCallback& OnComplete, int32 Code, const FString& Body)
+{
+	auto Send = [OnComplete, Code, Body]()
+	{
+		TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body, TEXT("application/json"));
+		Response->Code = static_cast<EHttpServerResponseCodes>(Code);
+		OnComplete(MoveTemp(Response));
+	};
+
+	const float Delay = SampleLatencySeconds();
+	if (Delay <= 0.f)
+	{
+		Send();
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Send](float) -> bool
+	{
+		Send();
+		return false; // fire once then remove
+	}), Delay);
+}
+
+bool FHMVRLocalApiStub::VerifySignature(const FString& Route, const FHttpServerRequest& Request, FString& OutError) const
+{
+	TMap<FString, FString> Headers;
+	for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+	{
+		Headers.Add(Header.Key.ToLower(), FString::Join(Header.Value, TEXT(",")));
+	}
+
+	const bool bSessionApi = Route.StartsWith(TEXT("/session-summary"))
+		|| Route.StartsWith(TEXT("/interaction-events"))
+		|| Route.StartsWith(TEXT("/player-rewards"));
+	const FString* Authorization = Headers.Find(TEXT("authorization"));
+	if (!bSessionApi && !(Authorization && Authorization->StartsWith(TEXT("AWS4-HMAC-SHA256 "))))
+	{
+		return true;
+	}
+
+	// Rebuild the path the client signed: route params go back in URL-encoded, as the client sent them
+	FString Path;
+	TArray<FString> Segments;
+	Route.ParseIntoArray(Segments, TEXT("/"));
+	for (const FString& Segment : Segments)
+	{
+		const FString* Param = Segment.StartsWith(TEXT(":")) ? Request.PathParams.Find(Segment.Mid(1)) : nullptr;
+		Path += TEXT("/") + (Param ? FGenericPlatformHttp::UrlEncode(*Param) : Segment);
+	}
+
+	TArray<FString> Query;
+	for (const TPair<FString, FString>& Param : Request.QueryParams)
+	{
+		Query.Add(FGenericPlatformHttp::UrlEncode(Param.Key) + TEXT("=") + FGenericPlatformHttp::UrlEncode(Param.Value));
+	}
+	Query.Sort();
+
+	const TCHAR* Verb = TEXT("GET");
+	switch (Request.Verb)
+	{
+	case EHttpServerRequestVerbs::VERB_POST:   Verb = TEXT("POST");   break;
+	case EHttpServerRequestVerbs::VERB_PUT:    Verb = TEXT("PUT");    break;
+	case EHttpServerRequestVerbs::VERB_PATCH:  Verb = TEXT("PATCH");  break;
+	case EHttpServerRequestVerbs::VERB_DELETE: Verb = TEXT("DELETE"); break;
+	default: break;
+	}
+
+	return FAwsSigV4::VerifyRequest(Verb, Path, FString::Join(Query, TEXT("&")), Headers,
+		Request.Body, TEXT("execute-api"), OutError);
+}
+
+float FHMVRLocalApiStub::SampleLatencySeconds()
+{
+	const float BaseMs = CVarStubLatencyMs.GetValueOnGameThread();
+	const float JitterMs = CVarStubLatencyJitterMs.GetValueOnGameThread();
+	const float TotalMs = BaseMs + (JitterMs > 0.f ? Random.FRandRange(0.f, JitterMs) : 0.f);
+	return FMath::Max(0.f, TotalMs) / 1000.f;
+}
+
+// ── Session API ──────────────────────────────────────────────────────────────
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleSessionSummary(const FHttpServerRequest& Request)
+{
+	TSharedPtr<FJsonObject> Json = ParseBody(Request);
+	FString SessionId;
+	if (!Json.IsValid() || !Json->TryGetStringField(TEXT("sessionId"), SessionId))
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("sessionId is required"));
+	}
+
+	// The summary's rewards land in the player's inventory, as the Lambda writes them
+	FString PlayerId;
+	const TArray<TSharedPtr<FJsonValue>>* Rewards = nullptr;
+	if (Json->TryGetStringField(TEXT("playerId"), PlayerId) && Json->TryGetArrayField(TEXT("rewards"), Rewards))
+	{
+		TSet<FString>& Owned = PlayerRewards.FindOrAdd(PlayerId);
+		for (const TSharedPtr<FJsonValue>& Reward : *Rewards)
+		{
+			Owned.Add(Reward->AsString());
+		}
+	}
+	return { 200, FString::Printf(TEXT("{\"sessionId\":\"%s\"}"), *SessionId) };
+}
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleInteractionEvents(const FHttpServerRequest& Request)
+{
+	TSharedPtr<FJsonObject> Json = ParseBody(Request);
+	if (!Json.IsValid())
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("body must be a JSON object"));
+	}
+
+	// A batch from FHMVREventStream ({"events":[...]}) or a single event
+	const TArray<TSharedPtr<FJsonValue>>* Events = nullptr;
+	const int32 Accepted = Json->TryGetArrayField(TEXT("events"), Events) ? Events->Num() : 1;
+	return { 201, FString::Printf(TEXT("{\"accepted\":%d}"), Accepted) };
+}
+
+// ── Player rewards ──────────────────────────────────────────────────────────
+
+TPair<int32, FString> FHMVRLocalApiStub::HandlePutPlayerReward(const FHttpServerRequest& Request)
+{
+	TSharedPtr<FJsonObject> Json = ParseBody(Request);
+	FString PlayerId, RewardId;
+	if (!Json.IsValid() || !Json->TryGetStringField(TEXT("playerId"), PlayerId)
+		|| !Json->TryGetStringField(TEXT("rewardId"), RewardId))
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("playerId and rewardId are required"));
+	}
+
+	// Idempotent, like the conditional put behind it: a repeat grant succeeds and says so
+	bool bAlreadyGranted = false;
+	PlayerRewards.FindOrAdd(PlayerId).Add(RewardId, &bAlreadyGranted);
+	return { 200, FString::Printf(TEXT("{\"playerId\":\"%s\",\"rewardId\":\"%s\",\"alreadyGranted\":%s}"),
+		*PlayerId, *RewardId, bAlreadyGranted ? TEXT("true") : TEXT("false")) };
+}
+
+TPair<int32, FString> FHMVRLocalApiStub::HandlePutPlayerRewardBatch(const FHttpServerRequest& Request)
+{
+	TSharedPtr<FJsonObject> Json = ParseBody(Request);
+	const TArray<TSharedPtr<FJsonValue>>* Grants = nullptr;
+	if (!Json.IsValid() || !Json->TryGetArrayField(TEXT("grants"), Grants))
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("grants array is required"));
+	}
+
+	// A key already applied is acknowledged again but not re-applied (a re-sent batch after a lost ack or a restart)
+	int32 Accepted = 0;
+	int32 Duplicates = 0;
+	for (const TSharedPtr<FJsonValue>& Value : *Grants)
+	{
+		const TSharedPtr<FJsonObject>* Grant = nullptr;
+		FString Key, PlayerId, RewardId;
+		if (!Value->TryGetObject(Grant) || !(*Grant)->TryGetStringField(TEXT("idempotencyKey"), Key)
+			|| !(*Grant)->TryGetStringField(TEXT("playerId"), PlayerId) || !(*Grant)->TryGetStringField(TEXT("rewardId"), RewardId))
+		{
+			return Error(400, TEXT("INVALID_REQUEST"), TEXT("each grant needs idempotencyKey, playerId and rewardId"));
+		}
+
+		bool bSeen = false;
+		SeenGrantKeys.Add(Key, &bSeen);
+		if (bSeen)
+		{
+			++Duplicates;
+			continue;
+		}
+		PlayerRewards.FindOrAdd(PlayerId).Add(RewardId);
+		++Accepted;
+	}
+	Stats.DuplicateGrants += Duplicates;
+	return { 200, FString::Printf(TEXT("{\"accepted\":%d,\"duplicates\":%d}"), Accepted, Duplicates) };
+}
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleGetPlayerRewards(const FHttpServerRequest& Request)
+{
+	const FString* PlayerId = Request.PathParams.Find(TEXT("playerId"));
+	if (!PlayerId)
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("playerId is required"));
+	}
+
+	TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+	Body->SetStringField(TEXT("playerId"), *PlayerId);
+	TArray<TSharedPtr<FJsonValue>> Rewards;
+	if (const TSet<FString>* Owned = PlayerRewards.Find(*PlayerId))
+	{
+		for (const FString& RewardId : *Owned)
+		{
+			Rewards.Add(MakeShared<FJsonValueString>(RewardId));
+		}
+	}
+	Body->SetArrayField(TEXT("rewards"), Rewards);
+	return { 200, ToJson(Body) };
+}
+
+// ── World-state API ──────────────────────────────────────────────────────────
+
+TPair<int32, FString> FHMVRLocalApiStub::HandlePutWorldState(const FHttpServerRequest& Request)
+{
+	TSharedPtr<FJsonObject> Json = ParseBody(Request);
+	FString ObjectId, State;
+	if (!Json.IsValid() || !Json->TryGetStringField(TEXT("object_id"), ObjectId)
+		|| !Json->TryGetStringField(TEXT("state"), State))
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("object_id and state are required"));
+	}
+
+	WorldState.Add(ObjectId, State);
+	return { 200, FString::Printf(TEXT("{\"object_id\":\"%s\",\"state\":\"%s\"}"), *ObjectId, *State) };
+}
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleGetWorldState(const FHttpServerRequest& Request)
+{
+	const FString* ObjectId = Request.PathParams.Find(TEXT("objectId"));
+	const FString* State = ObjectId ? WorldState.Find(*ObjectId) : nullptr;
+	if (!State)
+	{
+		return Error(404, TEXT("NOT_FOUND"), TEXT("no state stored for object"));
+	}
+	return { 200, FString::Printf(TEXT("{\"object_id\":\"%s\",\"state\":\"%s\"}"), **ObjectId, **State) };
+}
+
+// ── Matchmaking ──────────────────────────────────────────────────────────────
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleStartMatchmaking(const FHttpServerRequest& Request)
+{
+	TSharedPtr<FJsonObject> Json = ParseBody(Request);
+	FString PlayerId;
+	if (!Json.IsValid() || !Json->TryGetStringField(TEXT("playerId"), PlayerId))
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), TEXT("playerId is required"));
+	}
+
+	const FString TicketId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+	FStubTicket& Ticket = Tickets.Add(TicketId);
+	Ticket.PlayerId = PlayerId;
+	Ticket.CreatedAt = FPlatformTime::Seconds();
+
+	return { 200, FString::Printf(TEXT("{\"ticketId\":\"%s\",\"status\":\"SEARCHING\"}"), *TicketId) };
+}
+
+FString FHMVRLocalApiStub::GetTicketStatus(const FStubTicket& Ticket) const
+{
+	const double Elapsed = FPlatformTime::Seconds() - Ticket.CreatedAt;
+	const float SearchSeconds = CVarStubMatchSearchSeconds.GetValueOnGameThread();
+	const float PlacingSeconds = CVarStubMatchPlacingSeconds.GetValueOnGameThread();
+
+	if (Ticket.bCancelled)
+	{
+		return TEXT("CANCELLED");
+	}
+	if (Elapsed < SearchSeconds)
+	{
+		return TEXT("SEARCHING");
+	}
+	if (Elapsed < SearchSeconds + PlacingSeconds)
+	{
+		return TEXT("PLACING");
+	}
+	return TEXT("COMPLETED");
+}
+
+FString FHMVRLocalApiStub::BuildTicketStatusJson(const FString& TicketId, const FStubTicket& Ticket) const
+{
+	const FString Status = GetTicketStatus(Ticket);
+
+	TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+	Body->SetStringField(TEXT("ticketId"), TicketId);
+	Body->SetStringField(TEXT("status"), Status);
+
+	if (Status == TEXT("COMPLETED"))
+	{
+		TSharedRef<FJsonObject> PlayerSession = MakeShared<FJsonObject>();
+		PlayerSession->SetStringField(TEXT("playerId"), Ticket.PlayerId);
+		PlayerSession->SetStringField(TEXT("playerSessionId"), TEXT("psess-") + TicketId);
+
+		TSharedRef<FJsonObject> ConnectionInfo = MakeShared<FJsonObject>();
+		ConnectionInfo->SetStringField(TEXT("ipAddress"), CVarStubGameServerAddress.GetValueOnGameThread());
+		ConnectionInfo->SetNumberField(TEXT("port"), CVarStubGameServerPort.GetValueOnGameThread());
+		TArray<TSharedPtr<FJsonValue>> MatchedSessions;
+		MatchedSessions.Add(MakeShared<FJsonValueObject>(PlayerSession));
+		ConnectionInfo->SetArrayField(TEXT("matchedPlayerSessions"), MatchedSessions);
+		Body->SetObjectField(TEXT("gameSessionConnectionInfo"), ConnectionInfo);
+	}
+
+	return ToJson(Body);
+}
+
+void FHMVRLocalApiStub::HandleMatchmakingStatus(const FHttpServerRequest& Request, const FStubReply& Reply)
+{
+	const FString* TicketId = Request.PathParams.Find(TEXT("ticketId"));
+	const FStubTicket* Ticket = TicketId ? Tickets.Find(*TicketId) : nullptr;
+	if (!Ticket)
+	{
+		const TPair<int32, FString> NotFound = Error(404, TEXT("TICKET_NOT_FOUND"), TEXT("unknown ticket"));
+		Reply(NotFound.Key, NotFound.Value);
+		return;
+	}
+
+	// Long-poll: hold while the status still equals ?since, up to ?wait seconds
+	const FString* WaitParam = Request.QueryParams.Find(TEXT("wait"));
+	const FString* SinceParam = Request.QueryParams.Find(TEXT("since"));
+	const float WaitSeconds = WaitParam
+		? FMath::Min(FCString::Atof(**WaitParam), CVarStubMaxLongPollSeconds.GetValueOnGameThread())
+		: 0.f;
+
+	if (!CVarStubLongPoll.GetValueOnGameThread() || WaitSeconds <= 0.f || !SinceParam
+		|| GetTicketStatus(*Ticket) != *SinceParam)
+	{
+		Reply(200, BuildTicketStatusJson(*TicketId, *Ticket));
+		return;
+	}
+
+	FStatusWaiter& Waiter = StatusWaiters.AddDefaulted_GetRef();
+	Waiter.TicketId = *TicketId;
+	Waiter.Since = *SinceParam;
+	Waiter.Deadline = FPlatformTime::Seconds() + WaitSeconds;
+	Waiter.Reply = Reply;
+	++Stats.LongPollsHeld;
+
+	if (!StatusWaiterTicker.IsValid())
+	{
+		StatusWaiterTicker = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FHMVRLocalApiStub::TickStatusWaiters), 0.05f);
+	}
+}
+
+bool FHMVRLocalApiStub::TickStatusWaiters(float /*DeltaTime*/)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (int32 i = StatusWaiters.Num() - 1; i >= 0; --i)
+	{
+		FStatusWaiter& Waiter = StatusWaiters[i];
+		const FStubTicket* Ticket = Tickets.Find(Waiter.TicketId);
+		if (!Ticket)
+		{
+			StatusWaiters.RemoveAtSwap(i);
+			continue;
+		}
+
+		// Release on a status change (including cancel) or when the hold expires
+		if (GetTicketStatus(*Ticket) != Waiter.Since || Now >= Waiter.Deadline)
+		{
+			Waiter.Reply(200, BuildTicketStatusJson(Waiter.TicketId, *Ticket));
+			StatusWaiters.RemoveAtSwap(i);
+		}
+	}
+
+	if (StatusWaiters.Num() == 0)
+	{
+		StatusWaiterTicker.Reset();
+		return false;
+	}
+	return true;
+}
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleCancelMatchmaking(const FHttpServerRequest& Request)
+{
+	const FString* TicketId = Request.PathParams.Find(TEXT("ticketId"));
+	FStubTicket* Ticket = TicketId ? Tickets.Find(*TicketId) : nullptr;
+	if (!Ticket)
+	{
+		return Error(404, TEXT("TICKET_NOT_FOUND"), TEXT("unknown ticket"));
+	}
+
+	Ticket->bCancelled = true;
+	return { 200, FString::Printf(TEXT("{\"ticketId\":\"%s\",\"status\":\"CANCELLED\"}"), **TicketId) };
+}
+
+// ── LARP Integration API ─────────────────────────────────────────────────────
+
+TPair<int32, FString> FHMVRLocalApiStub::HandleGmEvent(const FHttpServerRequest& Request)
+{
+	// Validated here so a bad body gets a 400 instead of vanishing at the receiver
+	const FString Body = BodyToString(Request);
+	FHMVRGmEvent Event;
+	FString ParseError;
+	if (!FHMVRGmEvent::Parse(Body, Event, ParseError))
+	{
+		return Error(400, TEXT("INVALID_REQUEST"), ParseError);
+	}
+
+	FString SendError;
+	if (!UHMVRGmEventSubsystem::SendLocal(Body, UHMVRGmEventSubsystem::GetActiveListenPort(), SendError))
+	{
+		return Error(503, TEXT("GM_CHANNEL_UNAVAILABLE"), SendError);
+	}
+	return { 202, FString::Printf(TEXT("{\"event_id\":\"%s\",\"delivered\":true}"), *Event.EventId) };
+}
+
+#endif // WITH_HMVR_API_STUB
@@ -0,0 +1,147 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_HMVR_API_STUB
+
+#include "IHttpRouter.h"
+#include "HttpResultCallback.h"
+#include "Math/RandomStream.h"
+#include "Containers/Ticker.h"
+
+struct FHttpServerRequest;
+
+/**
+ * Local stand-in for the Session API and world-state API (development builds only).
+ *
+ * Serves the same routes as the deployed Lambdas on http://127.0.0.1:<port>, so the
+ * client and dedicated server can run end-to-end without AWS:
+ *   POST   /session-summary
+ *   POST   /interaction-events
+ *   POST   /player-rewards             GET /player-rewards/:playerId
+ *   POST   /player-rewards/batch       (deduplicated on each grant's idempotencyKey)
+ *   POST   /world-state                GET /world-state/:objectId
+ *   POST   /matchmaking/start          GET /matchmaking/status/:ticketId[?wait=<s>&since=<status>]
+ *   DELETE /matchmaking/cancel/:ticketId
+ *   POST   /gm/event                   (LARP Integration API; forwarded to this process's GM event receiver)
+ *
+ * Start it with -LocalApiStub[=<port>]; FHMVRApiEndpoints then points every client at it.
+ * Only the hosting process listens (dedicated server, or the game mode of a standalone or
+ * listen-server game); clients given the same switch talk to the host's stub.
+ * Faults are injected through console variables so retry storms, batching and
+ * back-pressure can be reproduced deterministically:
+ *   hmvr.Stub.LatencyMs / hmvr.Stub.LatencyJitterMs   response delay
+ *   hmvr.Stub.ErrorRate                                fraction of requests answered 503
+ *   hmvr.Stub.MaxRequestsPerSecond                     requests over the cap get 429
+ *   hmvr.Stub.Seed                                     random seed applied on Start()
+ *   hmvr.Stub.LongPoll                                 0 = ignore ?wait (exercises client polling fallback)
+ * Session API routes (/session-summary, /interaction-events, /player-rewards*) require a SigV4
+ * signature and answer 403 when it does not verify, as API Gateway with IAM auth does; any other
+ * request that carries one is checked too (see FAwsSigV4::GetCredentials for the local credentials).
+ * Request counters are printed with the HMVR.Stub.Stats console command.
+ */
+class HYPERMAGEVR_API FHMVRLocalApiStub
+{
+public:
+	struct FStats
+	{
+		int64 Requests = 0;
+		int64 BytesReceived = 0;
+		int64 InjectedErrors = 0;
+		int64 Throttled = 0;
+		int64 LongPollsHeld = 0;
+		int64 DuplicateGrants = 0;
+		int64 SignatureRejected = 0;
+		TMap<FString, int64> RequestsByRoute;
+	};
+
+	static FHMVRLocalApiStub& Get();
+
+	/** Bind all routes and start listening. Idempotent. */
+	bool Start(int32 Port);
+
+	/** Unbind all routes. Listener shutdown is left to the HTTPServer module. */
+	void Stop();
+
+	bool IsRunning() const { return Router.IsValid(); }
+
+	/** True if another process already listens on Port (e.g. a local server started with the same switch). */
+	static bool IsPortTaken(int32 Port);
+	int32 GetPort() const { return ListenPort; }
+
+	const FStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FStats(); }
+	void DumpStats() const;
+
+private:
+	/** Synchronous route body: returns (HTTP status, JSON body). */
+	using FStubHandler = TFunction<TPair<int32, FString>(const FHttpServerRequest&)>;
+
+	/** Deferred route body: reads the request immediately, calls Reply(status, body) now or later. */
+	using FStubReply = TFunction<void(int32, const FString&)>;
+	using FStubAsyncHandler = TFunction<void(const FHttpServerRequest&, const FStubReply&)>;
+
+	void BindStubRoute(const TCHAR* Path, EHttpServerRequestVerbs Verb, FStubHandler Handler);
+	void BindStubAsyncRoute(const TCHAR* Path, EHttpServerRequestVerbs Verb, FStubAsyncHandler Handler);
+	void HandleRequest(const FString& Route, const FHttpServerRequest& Request,
+	                   const FHttpResultCallback& OnComplete, const FStubAsyncHandler& Handler);
+	void Respond(const FHttpResultCallback& OnComplete, int32 Code, const FString& Body);
+	float SampleLatencySeconds();
+	bool VerifySignature(const FString& Route, const FHttpServerRequest& Request, FString& OutError) const;
+
+	// Route bodies
+	TPair<int32, FString> HandleSessionSummary(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandleInteractionEvents(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandlePutPlayerReward(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandlePutPlayerRewardBatch(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandleGetPlayerRewards(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandlePutWorldState(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandleGetWorldState(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandleStartMatchmaking(const FHttpServerRequest& Request);
+	void HandleMatchmakingStatus(const FHttpServerRequest& Request, const FStubReply& Reply);
+	TPair<int32, FString> HandleCancelMatchmaking(const FHttpServerRequest& Request);
+	TPair<int32, FString> HandleGmEvent(const FHttpServerRequest& Request);
+
+	struct FStubTicket
+	{
+		FString PlayerId;
+		double CreatedAt = 0.0;
+		bool bCancelled = false;
+	};
+
+	/** A held long-poll status request. */
+	struct FStatusWaiter
+	{
+		FString TicketId;
+		FString Since;
+		double Deadline = 0.0;
+		FStubReply Reply;
+	};
+
+	FString GetTicketStatus(const FStubTicket& Ticket) const;
+	FString BuildTicketStatusJson(const FString& TicketId, const FStubTicket& Ticket) const;
+	bool TickStatusWaiters(float DeltaTime);
+
+	TSharedPtr<IHttpRouter> Router;
+	TArray<FHttpRouteHandle> RouteHandles;
+	int32 ListenPort = 0;
+
+	FStats Stats;
+	FRandomStream Random;
+
+	// Throughput cap — fixed one-second window
+	double ThrottleWindowStart = 0.0;
+	int32 ThrottleWindowCount = 0;
+
+	// Simulated backend state
+	TMap<FString, FString> WorldState;       // ObjectId -> state name
+	TMap<FString, TSet<FString>> PlayerRewards; // PlayerId -> granted reward ids (grants and summaries)
+	TSet<FString> SeenGrantKeys;             // idempotency keys applied by /player-rewards/batch
+	TMap<FString, FStubTicket> Tickets;      // TicketId -> ticket
+	TArray<FStatusWaiter> StatusWaiters;
+	FTSTicker::FDelegateHandle StatusWaiterTicker;
+};
+
+#endif // WITH_HMVR_API_STUB
@@ -3,7 +3,11 @@
 #include "HMVRMachinery.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
-#include "Net/UnrealNetwork.h"
+
+namespace
+{
+	const FName UnlockEvent(TEXT("Unlock"));
+}
 
 AHMVRMachinery::AHMVRMachinery()
 {
@@ -20,54 +24,108 @@ AHMVRMachinery::AHMVRMachinery()
 	InteractionSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 
 	Interactable = CreateDefaultSubobject<UHMVRInteractableComponent>(TEXT("Interactable"));
+	Interactable->StateMachine = TEXT("Machinery");
 }
 
 void AHMVRMachinery::BeginPlay()
 {
 	Super::BeginPlay();
 	Interactable->OnStateChanged.AddDynamic(this, &AHMVRMachinery::OnInteractableStateChanged);
+	Interactable->OnDetailChanged.AddUObject(this, &AHMVRMachinery::OnInteractableDetailChanged);
 
 	if (HasAuthority())
 	{
+		InitialSubState = MachinerySubState;
+		SetMachinerySubState(MachinerySubState); // the state machine reads the component's copy
 		Interactable->LoadState();
+
+		// A previous process died mid-unlock: finish it
+		if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+		{
+			UnlockTimerHandle = Timers->ResumePersisted(this, UnlockEvent, Interactable->ObjectId);
+			if (UnlockTimerHandle.IsValid())
+			{
+				SetMachinerySubState(EMachinerySubState::Unlocking);
+			}
+		}
 	}
+	else if (Interactable->HasReplicatedState())
+	{
+		// Row may have arrived before we bound
+		OnInteractableDetailChanged(Interactable->GetSubState(), Interactable->GetHealth());
+	}
+}
+
+void AHMVRMachinery::SetMachinerySubState(EMachinerySubState NewSubState)
+{
+	MachinerySubState = NewSubState;
+	Interactable->SetSubState(static_cast<uint8>(NewSubState));
 }
 
-void AHMVRMachinery::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void AHMVRMachinery::OnInteractableDetailChanged(uint8 SubState, float)
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AHMVRMachinery, MachinerySubState);
+	MachinerySubState = static_cast<EMachinerySubState>(SubState);
 }
 
 void AHMVRMachinery::OnPlayerApproach(APlayerController* Player, float Distance)
 {
 	if (!HasAuthority()) return;
-	if (MachinerySubState != EMachinerySubState::Locked) return;
-	Interactable->TransitionTo(EInteractableState::Alert);
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Approach);
 }
 
 void AHMVRMachinery::OnPlayerInteract(APlayerController* Player)
 {
 	if (!HasAuthority()) return;
-	if (MachinerySubState != EMachinerySubState::Locked) return;
 
 	// Key check: caller is responsible for passing interact only when key conditions are met.
 	// Inventory system will enforce bRequiresKey / RequiredKeyId before calling this.
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Interact);
+}
 
-	MachinerySubState = EMachinerySubState::Unlocking;
-	Interactable->TransitionTo(EInteractableState::Active);
-	BP_OnTriggered();
+void AHMVRMachinery::OnGmHook(FName HookId, const FString& Argument)
+{
+	// A GM unlock bypasses the key, as the inventory check sits in front of OnPlayerInteract
+	if (!HasAuthority()) return;
+	Interactable->RaiseEvent(EHMVRInteractableEvent::Interact);
+}
 
-	GetWorldTimerManager().SetTimer(UnlockTimerHandle, this,
-	                                &AHMVRMachinery::OnUnlockTimerComplete,
-	                                TriggerDelay, false);
+void AHMVRMachinery::OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState)
+{
+	const EMachinerySubState NewSubState = static_cast<EMachinerySubState>(Interactable->GetSubState());
+	MachinerySubState = NewSubState;
+	if (NewSubState == static_cast<EMachinerySubState>(FromSubState)) return;
+
+	if (NewSubState == EMachinerySubState::Unlocking)
+	{
+		BP_OnTriggered();
+		if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+		{
+			UnlockTimerHandle = Timers->Schedule(this, UnlockEvent, TriggerDelay, Interactable->ObjectId);
+		}
+	}
+	else if (NewSubState == EMachinerySubState::Open)
+	{
+		BP_OnOpened();
+	}
 }
 
-void AHMVRMachinery::OnUnlockTimerComplete()
+void AHMVRMachinery::OnSessionReset()
 {
-	MachinerySubState = EMachinerySubState::Open;
-	Interactable->TransitionTo(EInteractableState::Resolved);
-	BP_OnOpened();
+	if (!HasAuthority()) return;
+	if (UHMVRGameplayTimerSubsystem* Timers = GetWorld()->GetSubsystem<UHMVRGameplayTimerSubsystem>())
+	{
+		Timers->Cancel(UnlockTimerHandle);
+	}
+	SetMachinerySubState(InitialSubState);
+}
+
+void AHMVRMachinery::OnGameplayTimer(FName Event)
+{
+	if (Event == UnlockEvent)
+	{
+		UnlockTimerHandle.Invalidate();
+		Interactable->RaiseEvent(EHMVRInteractableEvent::TimerDone);
+	}
 }
 
 void AHMVRMachinery::OnInteractableStateChanged(EInteractableState NewState)
@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "HMVRInteractable.h"
 #include "HMVRInteractableComponent.h"
+#include "HMVRGameplayTimers.h"
 #include "HMVRMachinery.generated.h"
 
 class UStaticMeshComponent;
@@ -20,7 +21,7 @@ enum class EMachinerySubState : uint8
 };
 
 UCLASS()
-class HYPERMAGEVR_API AHMVRMachinery : public AActor, public IHMVRInteractable
+class HYPERMAGEVR_API AHMVRMachinery : public AActor, public IHMVRInteractable, public IHMVRGameplayTimerTarget
 {
 	GENERATED_BODY()
 
@@ -32,6 +33,12 @@ public:
 	virtual void OnPlayerInteract(APlayerController* Player) override;
 	virtual void OnDamageReceived(float Amount, AActor* Source) override {}
 	virtual void OnCollected(APlayerController* Player) override {}
+	virtual void OnSessionReset() override;
+	virtual void OnStateMachineTransition(EInteractableState FromState, uint8 FromSubState) override;
+	virtual void OnGmHook(FName HookId, const FString& Argument) override;
+
+	// IHMVRGameplayTimerTarget
+	virtual void OnGameplayTimer(FName Event) override;
 
 	// If true the player must carry an item whose ID matches RequiredKeyId.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Machinery")
@@ -45,7 +52,8 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Machinery")
 	float TriggerDelay = 2.f;
 
-	UPROPERTY(BlueprintReadOnly, Replicated, Category="Machinery")
+	// Replicated through the interactable state registry
+	UPROPERTY(BlueprintReadOnly, Category="Machinery")
 	EMachinerySubState MachinerySubState = EMachinerySubState::Locked;
 
 	UFUNCTION(BlueprintImplementableEvent, Category="Machinery")
@@ -66,16 +74,18 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Interaction")
 	USphereComponent* InteractionSphere;
 
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
-
 protected:
 	virtual void BeginPlay() override;
 
 private:
-	FTimerHandle UnlockTimerHandle;
+	// Keyed by the interactable ObjectId, so an unlock in progress survives a server restart
+	FHMVRGameplayTimerHandle UnlockTimerHandle;
 
-	UFUNCTION()
-	void OnUnlockTimerComplete();
+	// Server — sub-state at BeginPlay, restored by OnSessionReset
+	EMachinerySubState InitialSubState = EMachinerySubState::Locked;
+
+	void SetMachinerySubState(EMachinerySubState NewSubState);
+	void OnInteractableDetailChanged(uint8 SubState, float Health);
 
 	UFUNCTION()
 	void OnInteractableStateChanged(EInteractableState NewState);
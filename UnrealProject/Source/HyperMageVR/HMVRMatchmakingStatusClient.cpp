@@ -0,0 +1,186 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRMatchmakingStatusClient.h"
+#include "HMVRHttpDispatcher.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	bool IsTerminalStatus(const FString& Status)
+	{
+		return Status == TEXT("COMPLETED") || Status == TEXT("FAILED")
+			|| Status == TEXT("TIMED_OUT") || Status == TEXT("CANCELLED");
+	}
+}
+
+void UHMVRMatchmakingStatusClient::BeginDestroy()
+{
+	Stop();
+	Super::BeginDestroy();
+}
+
+void UHMVRMatchmakingStatusClient::Start(const FString& InBaseUrl, const FString& InTicketId,
+                                         const FString& InAuthToken, float TimeoutSeconds)
+{
+	Stop();
+
+	BaseUrl = InBaseUrl;
+	TicketId = InTicketId;
+	AuthToken = InAuthToken;
+	LastStatus.Empty();
+	bLongPoll = true;
+	PollInterval = MinPollInterval;
+	ConsecutiveFailures = 0;
+	RequestsSent = 0;
+	StartTime = FPlatformTime::Seconds();
+	Deadline = StartTime + TimeoutSeconds;
+
+	SendRequest();
+}
+
+void UHMVRMatchmakingStatusClient::Stop()
+{
+	ClearTicker();
+	TicketId.Empty();
+	++Generation;
+}
+
+void UHMVRMatchmakingStatusClient::ClearTicker()
+{
+	if (NextPollHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(NextPollHandle);
+		NextPollHandle.Reset();
+	}
+}
+
+void UHMVRMatchmakingStatusClient::ScheduleNext(float DelaySeconds)
+{
+	ClearTicker();
+	NextPollHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateWeakLambda(this, [this](float) -> bool
+		{
+			NextPollHandle.Reset();
+			SendRequest();
+			return false; // fire once then remove
+		}),
+		DelaySeconds);
+}
+
+void UHMVRMatchmakingStatusClient::SendRequest()
+{
+	if (!IsWatching())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now >= Deadline)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRMatchmakingStatus: ticket %s timed out after %.0fs (%d requests)"),
+			*TicketId, Now - StartTime, RequestsSent);
+		Stop();
+		OnTimedOut.ExecuteIfBound();
+		return;
+	}
+
+	FString Url = FString::Printf(TEXT("%s/matchmaking/status/%s"), *BaseUrl, *TicketId);
+	float RequestTimeout = 15.f;
+	if (bLongPoll)
+	{
+		const int32 WaitSeconds = FMath::Max(1, FMath::FloorToInt(FMath::Min<double>(LongPollWaitSeconds, Deadline - Now)));
+		Url += FString::Printf(TEXT("?wait=%d&since=%s"), WaitSeconds, *FGenericPlatformHttp::UrlEncode(LastStatus));
+		RequestTimeout += WaitSeconds;
+	}
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(Url);
+	HttpRequest->SetVerb(TEXT("GET"));
+	HttpRequest->SetHeader(TEXT("Authorization"), AuthToken);
+	HttpRequest->SetTimeout(RequestTimeout);
+	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UHMVRMatchmakingStatusClient::OnResponse, Generation);
+	FHMVRHttpDispatcher::Get().Submit(HttpRequest, EHMVRHttpPriority::Critical, TEXT("matchmaking-status"));
+
+	RequestSentTime = Now;
+	++RequestsSent;
+}
+
+void UHMVRMatchmakingStatusClient::OnResponse(FHttpRequestPtr /*Request*/, FHttpResponsePtr Response,
+                                              bool bConnectedSuccessfully, uint32 ResponseGeneration)
+{
+	if (ResponseGeneration != Generation || !IsWatching())
+	{
+		return; // stopped or restarted while this was in flight
+	}
+
+	const double RoundTrip = FPlatformTime::Seconds() - RequestSentTime;
+
+	TSharedPtr<FJsonObject> Json;
+	if (bConnectedSuccessfully && Response.IsValid() && Response->GetResponseCode() == 200)
+	{
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+		FJsonSerializer::Deserialize(Reader, Json);
+	}
+
+	FString Status;
+	if (!Json.IsValid() || !Json->TryGetStringField(TEXT("status"), Status))
+	{
+		// Transient — keep watching, but back off and stop trusting long-poll if it keeps failing
+		if (bLongPoll && ++ConsecutiveFailures >= MaxLongPollFailures)
+		{
+			bLongPoll = false;
+			UE_LOG(LogTemp, Warning, TEXT("HMVRMatchmakingStatus: long-poll failing — falling back to adaptive polling"));
+		}
+		PollInterval = FMath::Min(PollInterval * PollBackoff, MaxPollInterval);
+		ScheduleNext(PollInterval);
+		return;
+	}
+
+	ConsecutiveFailures = 0;
+	const bool bChanged = (Status != LastStatus);
+
+	if (bLongPoll && !bChanged && RoundTrip < LongPollIgnoredThreshold)
+	{
+		bLongPoll = false;
+		UE_LOG(LogTemp, Log, TEXT("HMVRMatchmakingStatus: server ignored ?wait — falling back to adaptive polling"));
+	}
+	LastStatus = Status;
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRMatchmakingStatus: %s (%s, %.0f ms round trip, request %d)"),
+		*Status, bLongPoll ? TEXT("long-poll") : TEXT("poll"), RoundTrip * 1000.0, RequestsSent);
+
+	if (IsTerminalStatus(Status))
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRMatchmakingStatus: ticket %s %s after %.1fs with %d requests"),
+			*TicketId, *Status, FPlatformTime::Seconds() - StartTime, RequestsSent);
+		Stop();
+		OnStatus.ExecuteIfBound(Status, Json);
+		return;
+	}
+
+	const uint32 WatchGeneration = Generation;
+	OnStatus.ExecuteIfBound(Status, Json);
+	if (WatchGeneration != Generation)
+	{
+		return; // handler stopped or restarted the watch
+	}
+
+	if (bLongPoll)
+	{
+		SendRequest(); // server holds the next one until something changes
+		return;
+	}
+
+	PollInterval = bChanged ? MinPollInterval : FMath::Min(PollInterval * PollBackoff, MaxPollInterval);
+	if (Status == TEXT("PLACING"))
+	{
+		PollInterval = FMath::Min(PollInterval, PlacingPollInterval);
+	}
+	ScheduleNext(PollInterval);
+}
@@ -0,0 +1,91 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Http.h"
+#include "Containers/Ticker.h"
+#include "HMVRMatchmakingStatusClient.generated.h"
+
+class FJsonObject;
+
+/** Fired for every status response (including unchanged SEARCHING); the JSON is the full response body. */
+DECLARE_DELEGATE_TwoParams(FHMVRMatchmakingStatusEvent, const FString& /*Status*/, const TSharedPtr<FJsonObject>& /*Response*/);
+DECLARE_DELEGATE(FHMVRMatchmakingTimeoutEvent);
+
+/**
+ * Watches one matchmaking ticket until it reaches a terminal state.
+ *
+ * Long-poll first: GET /matchmaking/status/{ticket}?wait=<s>&since=<last status> asks the
+ * Session API to hold the response until the status changes or the wait expires, so a
+ * COMPLETED ticket is seen one round-trip after it happens and a long queue costs one
+ * request per hold period instead of one every 3 s.
+ *
+ * If the server answers immediately with an unchanged status (it ignores ?wait), or long-poll
+ * requests keep failing, the client falls back to adaptive polling: MinPollInterval right after
+ * a status change, backing off by PollBackoff up to MaxPollInterval while nothing moves, and
+ * PlacingPollInterval once the ticket is PLACING (completion is imminent).
+ *
+ * Requests go through FHMVRHttpDispatcher at Critical priority.
+ */
+UCLASS()
+class HYPERMAGEVR_API UHMVRMatchmakingStatusClient : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	/** Begin watching TicketId. Any previous watch is stopped first. */
+	void Start(const FString& BaseUrl, const FString& TicketId, const FString& AuthToken, float TimeoutSeconds = 120.f);
+
+	/** Stop watching; no further events fire. */
+	void Stop();
+
+	bool IsWatching() const { return !TicketId.IsEmpty(); }
+	bool IsLongPolling() const { return bLongPoll; }
+	int32 GetRequestsSent() const { return RequestsSent; }
+
+	FHMVRMatchmakingStatusEvent OnStatus;
+	FHMVRMatchmakingTimeoutEvent OnTimedOut;
+
+	/** Seconds the server is asked to hold each long-poll request. */
+	static constexpr float LongPollWaitSeconds = 20.f;
+
+	static constexpr float MinPollInterval = 0.5f;
+	static constexpr float MaxPollInterval = 4.f;
+	static constexpr float PlacingPollInterval = 0.5f;
+	static constexpr float PollBackoff = 1.5f;
+
+	/** A held request answered faster than this with an unchanged status means the server ignored ?wait. */
+	static constexpr float LongPollIgnoredThreshold = 1.f;
+
+	/** Consecutive long-poll failures before switching to adaptive polling. */
+	static constexpr int32 MaxLongPollFailures = 2;
+
+private:
+	void SendRequest();
+	void OnResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, uint32 Generation);
+	void ScheduleNext(float DelaySeconds);
+	void ClearTicker();
+
+	FString BaseUrl;
+	FString TicketId;
+	FString AuthToken;
+	FString LastStatus;
+
+	bool bLongPoll = true;
+	float PollInterval = MinPollInterval;
+	int32 ConsecutiveFailures = 0;
+	int32 RequestsSent = 0;
+
+	double StartTime = 0.0;
+	double Deadline = 0.0;
+	double RequestSentTime = 0.0;
+
+	/** Bumped by Start()/Stop() so responses from an earlier watch are ignored. */
+	uint32 Generation = 0;
+
+	FTSTicker::FDelegateHandle NextPollHandle;
+};
@@ -0,0 +1,406 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRPlayerRegistry.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+FHMVRPlayerHandle FHMVRPlayerRegistry::Add(APlayerController* Controller, const FString& CognitoId)
+{
+	if (!Controller || ByController.Contains(Controller) || (!CognitoId.IsEmpty() && ByCognitoId.Contains(CognitoId)))
+	{
+		return FHMVRPlayerHandle();
+	}
+
+	const int32 Index = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+	FSlot& Slot = Slots[Index];
+	Slot.bLive = true;
+	Slot.Record = FHMVRPlayerRecord();
+	Slot.Record.Controller = Controller;
+	Slot.ControllerKey = Controller;
+
+	ByController.Add(Slot.ControllerKey, Index);
+	SetKey(ByCognitoId, Slot.Record.CognitoId, CognitoId, Index);
+	++NumPlayers;
+
+	return FHMVRPlayerHandle{ Index, Slot.Generation };
+}
+
+bool FHMVRPlayerRegistry::Remove(FHMVRPlayerHandle Handle)
+{
+	FSlot* Slot = Resolve(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	ByController.Remove(Slot->ControllerKey);
+	SetKey(ByCognitoId, Slot->Record.CognitoId, FString(), Handle.Index);
+	SetKey(ByPlayerSessionId, Slot->Record.PlayerSessionId, FString(), Handle.Index);
+	SetKey(BySessionId, Slot->Record.SessionId, FHMVRId(), Handle.Index);
+
+	Slot->Record = FHMVRPlayerRecord();
+	Slot->ControllerKey = TObjectKey<APlayerController>();
+	Slot->bLive = false;
+	++Slot->Generation;
+	FreeSlots.Add(Handle.Index);
+	--NumPlayers;
+	return true;
+}
+
+void FHMVRPlayerRegistry::Reset()
+{
+	Slots.Reset();
+	FreeSlots.Reset();
+	ByController.Reset();
+	ByCognitoId.Reset();
+	ByPlayerSessionId.Reset();
+	BySessionId.Reset();
+	NumPlayers = 0;
+}
+
+FHMVRPlayerRegistry::FSlot* FHMVRPlayerRegistry::Resolve(FHMVRPlayerHandle Handle)
+{
+	if (!Slots.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+	FSlot& Slot = Slots[Handle.Index];
+	return Slot.bLive && Slot.Generation == Handle.Generation ? &Slot : nullptr;
+}
+
+const FHMVRPlayerRegistry::FSlot* FHMVRPlayerRegistry::Resolve(FHMVRPlayerHandle Handle) const
+{
+	return const_cast<FHMVRPlayerRegistry*>(this)->Resolve(Handle);
+}
+
+const FHMVRPlayerRecord* FHMVRPlayerRegistry::Get(FHMVRPlayerHandle Handle) const
+{
+	const FSlot* Slot = Resolve(Handle);
+	return Slot ? &Slot->Record : nullptr;
+}
+
+template <typename KeyType>
+bool FHMVRPlayerRegistry::SetKey(TMap<KeyType, int32>& Index, KeyType& Field, const KeyType& Value, int32 SlotIndex)
+{
+	if (Field == Value)
+	{
+		return true;
+	}
+	if (!Value.IsEmpty())
+	{
+		const int32* Existing = Index.Find(Value);
+		if (Existing && *Existing != SlotIndex)
+		{
+			return false;
+		}
+	}
+	if (!Field.IsEmpty())
+	{
+		Index.Remove(Field);
+	}
+	Field = Value;
+	if (!Value.IsEmpty())
+	{
+		Index.Add(Value, SlotIndex);
+	}
+	return true;
+}
+
+bool FHMVRPlayerRegistry::SetPlayerSessionId(FHMVRPlayerHandle Handle, const FString& PlayerSessionId)
+{
+	FSlot* Slot = Resolve(Handle);
+	return Slot && SetKey(ByPlayerSessionId, Slot->Record.PlayerSessionId, PlayerSessionId, Handle.Index);
+}
+
+bool FHMVRPlayerRegistry::SetSessionId(FHMVRPlayerHandle Handle, const FHMVRId& SessionId)
+{
+	FSlot* Slot = Resolve(Handle);
+	return Slot && SetKey(BySessionId, Slot->Record.SessionId, SessionId, Handle.Index);
+}
+
+FHMVRPlayerHandle FHMVRPlayerRegistry::MakeHandle(const int32* SlotIndex) const
+{
+	return SlotIndex ? FHMVRPlayerHandle{ *SlotIndex, Slots[*SlotIndex].Generation } : FHMVRPlayerHandle();
+}
+
+FHMVRPlayerHandle FHMVRPlayerRegistry::FindByController(const AController* Controller) const
+{
+	const APlayerController* PC = Cast<const APlayerController>(Controller);
+	return PC ? MakeHandle(ByController.Find(PC)) : FHMVRPlayerHandle();
+}
+
+FHMVRPlayerHandle FHMVRPlayerRegistry::FindByCognitoId(const FString& CognitoId) const
+{
+	return MakeHandle(ByCognitoId.Find(CognitoId));
+}
+
+FHMVRPlayerHandle FHMVRPlayerRegistry::FindByPlayerSessionId(const FString& PlayerSessionId) const
+{
+	return MakeHandle(ByPlayerSessionId.Find(PlayerSessionId));
+}
+
+FHMVRPlayerHandle FHMVRPlayerRegistry::FindBySessionId(const FHMVRId& SessionId) const
+{
+	return MakeHandle(BySessionId.Find(SessionId));
+}
+
+int32 FHMVRPlayerRegistry::Verify() const
+{
+	int32 Problems = 0;
+	auto Report = [&Problems](const TCHAR* What, int32 Index)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRPlayerRegistry: slot %d — %s"), Index, What);
+		++Problems;
+	};
+
+	int32 Live = 0;
+	for (int32 Index = 0; Index < Slots.Num(); ++Index)
+	{
+		const FSlot& Slot = Slots[Index];
+		if (!Slot.bLive)
+		{
+			if (!FreeSlots.Contains(Index))
+			{
+				Report(TEXT("dead slot not on the free list"), Index);
+			}
+			continue;
+		}
+
+		++Live;
+		const FHMVRPlayerRecord& Record = Slot.Record;
+		if (ByController.FindRef(Slot.ControllerKey, INDEX_NONE) != Index)
+		{
+			Report(TEXT("controller index mismatch"), Index);
+		}
+		if (!Record.CognitoId.IsEmpty() && ByCognitoId.FindRef(Record.CognitoId, INDEX_NONE) != Index)
+		{
+			Report(TEXT("Cognito id index mismatch"), Index);
+		}
+		if (!Record.PlayerSessionId.IsEmpty() && ByPlayerSessionId.FindRef(Record.PlayerSessionId, INDEX_NONE) != Index)
+		{
+			Report(TEXT("player session index mismatch"), Index);
+		}
+		if (!Record.SessionId.IsEmpty() && BySessionId.FindRef(Record.SessionId, INDEX_NONE) != Index)
+		{
+			Report(TEXT("session index mismatch"), Index);
+		}
+	}
+
+	if (Live != NumPlayers)
+	{
+		Report(TEXT("player count drifted"), INDEX_NONE);
+	}
+	if (ByController.Num() > NumPlayers || ByCognitoId.Num() > NumPlayers
+		|| ByPlayerSessionId.Num() > NumPlayers || BySessionId.Num() > NumPlayers)
+	{
+		Report(TEXT("an index holds entries for removed players"), INDEX_NONE);
+	}
+	return Problems;
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	int32 CheckRegistry(const TArray<APlayerController*>& Controllers)
+	{
+		int32 Problems = 0;
+		auto Expect = [&Problems](bool bCondition, const TCHAR* What)
+		{
+			if (!bCondition)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("HMVRPlayerRegistry: check failed — %s"), What);
+				++Problems;
+			}
+		};
+
+		FHMVRPlayerRegistry Registry;
+		TArray<FHMVRPlayerHandle> Handles;
+		TArray<FHMVRId> SessionIds;
+		for (int32 i = 0; i < Controllers.Num(); ++i)
+		{
+			const FHMVRPlayerHandle Handle = Registry.Add(Controllers[i], FString::Printf(TEXT("cognito-%d"), i));
+			Registry.SetPlayerSessionId(Handle, FString::Printf(TEXT("psess-%d"), i));
+			Registry.SetSessionId(Handle, SessionIds.Add_GetRef(FHMVRId::Generate()));
+			Handles.Add(Handle);
+		}
+		Expect(Registry.Num() == Controllers.Num(), TEXT("count after adds"));
+
+		for (int32 i = 0; i < Controllers.Num(); ++i)
+		{
+			Expect(Registry.FindByController(Controllers[i]) == Handles[i], TEXT("lookup by controller"));
+			Expect(Registry.FindByCognitoId(FString::Printf(TEXT("cognito-%d"), i)) == Handles[i], TEXT("lookup by Cognito id"));
+			Expect(Registry.FindByPlayerSessionId(FString::Printf(TEXT("psess-%d"), i)) == Handles[i], TEXT("lookup by player session"));
+			Expect(Registry.FindBySessionId(SessionIds[i]) == Handles[i], TEXT("lookup by session"));
+		}
+
+		Expect(!Registry.Add(Controllers[0], TEXT("someone-else")).IsSet(), TEXT("duplicate controller rejected"));
+		if (Controllers.Num() > 1)
+		{
+			Expect(!Registry.SetSessionId(Handles[1], SessionIds[0]), TEXT("session id owned by another player rejected"));
+			Expect(Registry.Get(Handles[1])->SessionId == SessionIds[1], TEXT("rejected key leaves the old one"));
+
+			// Free slot 0 and reuse it for a newcomer
+			Expect(Registry.Remove(Handles[0]), TEXT("remove"));
+			Expect(!Registry.Remove(Handles[0]), TEXT("double remove rejected"));
+			Expect(Registry.Get(Handles[0]) == nullptr, TEXT("stale handle resolves to nothing"));
+			Expect(!Registry.FindByCognitoId(TEXT("cognito-0")).IsSet(), TEXT("removed Cognito id unindexed"));
+			Expect(!Registry.FindByPlayerSessionId(TEXT("psess-0")).IsSet(), TEXT("removed player session unindexed"));
+			Expect(Registry.Num() == Controllers.Num() - 1, TEXT("count after remove"));
+
+			const FHMVRPlayerHandle Reused = Registry.Add(Controllers[0], TEXT("cognito-new"));
+			Expect(Reused.Index == Handles[0].Index && !(Reused == Handles[0]), TEXT("slot reused with a new generation"));
+			Expect(Registry.Get(Handles[0]) == nullptr, TEXT("old handle stays stale after reuse"));
+			Expect(Registry.Add(Controllers[1], TEXT("cognito-dup")).IsSet() == false, TEXT("duplicate add rejected"));
+		}
+
+		Problems += Registry.Verify();
+		return Problems;
+	}
+
+	void RunRegistryBench(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+		const int32 Rounds = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const int32 NumPlayers = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 2, 256) : 15;
+
+		// Stand-in controllers — only their identity is used
+		TArray<APlayerController*> Controllers;
+		FActorSpawnParameters Params;
+		Params.ObjectFlags |= RF_Transient;
+		for (int32 i = 0; i < NumPlayers; ++i)
+		{
+			if (APlayerController* PC = World->SpawnActor<APlayerController>(Params))
+			{
+				Controllers.Add(PC);
+			}
+		}
+		if (Controllers.Num() < 2)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRPlayerRegistry: could not spawn stand-in controllers"));
+			return;
+		}
+
+		int32 Problems = CheckRegistry(Controllers);
+
+		// Churn: each round a quarter of the shard leaves and rejoins, then every player is looked
+		// up the way the game mode does (count, session for a controller, player for a GameLift id)
+		FRandomStream Random(Rounds);
+		const int32 Churn = FMath::Max(1, Controllers.Num() / 4);
+		int64 Ops = 0;
+		int64 Checksum = 0;
+
+		FHMVRPlayerRegistry Registry;
+		TArray<FHMVRPlayerHandle> Handles;
+		Handles.SetNum(Controllers.Num());
+		int32 Serial = 0;
+		auto Join = [&](int32 i)
+		{
+			++Serial;
+			Handles[i] = Registry.Add(Controllers[i], FString::Printf(TEXT("cognito-%d"), Serial));
+			Registry.SetPlayerSessionId(Handles[i], FString::Printf(TEXT("psess-%d"), Serial));
+			Registry.SetSessionId(Handles[i], FHMVRId::Generate());
+		};
+		for (int32 i = 0; i < Controllers.Num(); ++i)
+		{
+			Join(i);
+		}
+
+		const double RegistryStart = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			for (int32 c = 0; c < Churn; ++c)
+			{
+				const int32 i = Random.RandHelper(Controllers.Num());
+				Registry.Remove(Registry.FindByController(Controllers[i]));
+				Join(i);
+				Ops += 2;
+			}
+			for (int32 i = 0; i < Controllers.Num(); ++i)
+			{
+				const FHMVRPlayerRecord* Record = Registry.Get(Registry.FindByController(Controllers[i]));
+				Checksum += Registry.Num() + Registry.FindByPlayerSessionId(Record->PlayerSessionId).Index + static_cast<int64>(Record->SessionId.Lo & 0xF);
+				Ops += 3;
+			}
+		}
+		const double RegistrySeconds = FPlatformTime::Seconds() - RegistryStart;
+		Problems += Registry.Verify();
+
+		// The same workload on the structures the game mode used before: a weak pointer array
+		// recounted on every query, PlayerId → SessionId, and PlayerSessionId → PlayerId scanned
+		// by value to find a player's GameLift session
+		TArray<TWeakObjectPtr<APlayerController>> Connected;
+		TMap<FString, FString> PlayerToSession;
+		TMap<FString, FString> PlayerSessionToPlayer;
+		TArray<FString> PlayerIds;
+		PlayerIds.SetNum(Controllers.Num());
+		Serial = 0;
+		auto LegacyJoin = [&](int32 i)
+		{
+			++Serial;
+			PlayerIds[i] = FString::Printf(TEXT("cognito-%d"), Serial);
+			Connected.Add(Controllers[i]);
+			PlayerToSession.Add(PlayerIds[i], FString::Printf(TEXT("session-%d"), Serial));
+			PlayerSessionToPlayer.Add(FString::Printf(TEXT("psess-%d"), Serial), PlayerIds[i]);
+		};
+		for (int32 i = 0; i < Controllers.Num(); ++i)
+		{
+			LegacyJoin(i);
+		}
+		Random.Reset();
+		int64 LegacyChecksum = 0;
+
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 Round = 0; Round < Rounds; ++Round)
+		{
+			for (int32 c = 0; c < Churn; ++c)
+			{
+				const int32 i = Random.RandHelper(Controllers.Num());
+				Connected.Remove(Controllers[i]);
+				PlayerToSession.Remove(PlayerIds[i]);
+				for (auto It = PlayerSessionToPlayer.CreateIterator(); It; ++It)
+				{
+					if (It.Value() == PlayerIds[i])
+					{
+						It.RemoveCurrent();
+						break;
+					}
+				}
+				LegacyJoin(i);
+			}
+			for (int32 i = 0; i < Controllers.Num(); ++i)
+			{
+				int32 Count = 0;
+				for (const TWeakObjectPtr<APlayerController>& Ptr : Connected)
+				{
+					Count += Ptr.IsValid() ? 1 : 0;
+				}
+				const FString* SessionId = PlayerToSession.Find(PlayerIds[i]);
+				const FString* PlayerSessionId = PlayerSessionToPlayer.FindKey(PlayerIds[i]);
+				LegacyChecksum += Count + (PlayerSessionId ? PlayerSessionId->Len() : 0) + (SessionId ? SessionId->Len() : 0);
+			}
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		for (APlayerController* PC : Controllers)
+		{
+			PC->Destroy();
+		}
+
+		UE_LOG(LogTemp, Log,
+			TEXT("HMVRPlayerRegistry: %d players, %d rounds (%d leave/rejoin per round): registry %.1f ns/op (%.2f ms), previous containers %.2f ms; %d problems [%lld/%lld]"),
+			Controllers.Num(), Rounds, Churn, Ops > 0 ? RegistrySeconds * 1e9 / Ops : 0.0, RegistrySeconds * 1000.0,
+			LegacySeconds * 1000.0, Problems, Checksum, LegacyChecksum);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdPlayerRegistryBench(
+	TEXT("HMVR.Players.RegistryBench"),
+	TEXT("HMVR.Players.RegistryBench [Rounds=1000] [Players=15] — player registry correctness checks, then a join/leave churn timed against the previous containers."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunRegistryBench));
+
+#endif // !UE_BUILD_SHIPPING
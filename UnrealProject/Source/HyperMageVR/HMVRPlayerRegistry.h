@@ -0,0 +1,104 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "HMVRId.h"
+
+class AController;
+class APlayerController;
+
+/** Stable reference to a registry slot; stale once the player is removed (generation mismatch). */
+struct FHMVRPlayerHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	bool operator==(const FHMVRPlayerHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+};
+
+/** Everything the game mode tracks per connected player. */
+struct FHMVRPlayerRecord
+{
+	TWeakObjectPtr<APlayerController> Controller;
+	FString CognitoId;       // JWT sub, AHMVRPlayerState::CognitoPlayerId
+	FString PlayerSessionId; // GameLift player session; empty outside GameLift
+	FHMVRId SessionId;       // USessionManager session
+};
+
+/**
+ * Connected players in one slot array with an index per key — controller, Cognito id,
+ * GameLift player session id and SessionManager session id all resolve to a handle in O(1)
+ * without touching PlayerState. Slots are reused through a free list; the generation
+ * bumps on release so an old handle never resolves to a newcomer. The player count is
+ * maintained on Add/Remove, not recounted.
+ *
+ * Game thread only.
+ */
+class HYPERMAGEVR_API FHMVRPlayerRegistry
+{
+public:
+	/** Register a player. Fails (unset handle) if the controller or Cognito id is already present. */
+	FHMVRPlayerHandle Add(APlayerController* Controller, const FString& CognitoId);
+
+	/** Drop the player and all of their keys. False for a stale handle. */
+	bool Remove(FHMVRPlayerHandle Handle);
+
+	void Reset();
+
+	/** Null for a stale or unset handle. */
+	const FHMVRPlayerRecord* Get(FHMVRPlayerHandle Handle) const;
+
+	// Secondary keys; an empty id clears the key
+	bool SetPlayerSessionId(FHMVRPlayerHandle Handle, const FString& PlayerSessionId);
+	bool SetSessionId(FHMVRPlayerHandle Handle, const FHMVRId& SessionId);
+
+	FHMVRPlayerHandle FindByController(const AController* Controller) const;
+	FHMVRPlayerHandle FindByCognitoId(const FString& CognitoId) const;
+	FHMVRPlayerHandle FindByPlayerSessionId(const FString& PlayerSessionId) const;
+	FHMVRPlayerHandle FindBySessionId(const FHMVRId& SessionId) const;
+
+	int32 Num() const { return NumPlayers; }
+
+	/** Visit live players in slot order. */
+	template <typename FunctorType>
+	void ForEach(FunctorType&& Functor) const
+	{
+		for (int32 Index = 0; Index < Slots.Num(); ++Index)
+		{
+			if (Slots[Index].bLive)
+			{
+				Functor(FHMVRPlayerHandle{ Index, Slots[Index].Generation }, Slots[Index].Record);
+			}
+		}
+	}
+
+	/** Walk every slot and index and check they agree. Logs and returns the number of problems. */
+	int32 Verify() const;
+
+private:
+	struct FSlot
+	{
+		FHMVRPlayerRecord Record;
+		TObjectKey<APlayerController> ControllerKey; // still removable after the controller is destroyed
+		uint32 Generation = 1;
+		bool bLive = false;
+	};
+
+	FSlot* Resolve(FHMVRPlayerHandle Handle);
+	const FSlot* Resolve(FHMVRPlayerHandle Handle) const;
+	template <typename KeyType>
+	static bool SetKey(TMap<KeyType, int32>& Index, KeyType& Field, const KeyType& Value, int32 SlotIndex);
+	FHMVRPlayerHandle MakeHandle(const int32* SlotIndex) const;
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+	int32 NumPlayers = 0;
+
+	TMap<TObjectKey<APlayerController>, int32> ByController;
+	TMap<FString, int32> ByCognitoId;
+	TMap<FString, int32> ByPlayerSessionId;
+	TMap<FHMVRId, int32> BySessionId;
+};
@@ -0,0 +1,813 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRPoseReplicationComponent.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Net/UnrealNetwork.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+static TAutoConsoleVariable<float> CVarPoseSendRateHz(
+	TEXT("hmvr.Pose.SendRateHz"), 72.f,
+	TEXT("VR pose replication: maximum owner → server send rate (match the HMD refresh, 72 or 90). 0 disables sending."));
+
+namespace
+{
+	constexpr double Sqrt2 = 1.4142135623730951;
+
+	/** Resend an unchanged pose this often so receivers can tell a still player from a lost one. */
+	constexpr double IdleHeartbeatSeconds = 1.0;
+
+	/** Lets the send gate fire on the frame closest to the interval instead of beating with it. */
+	constexpr double SendSlackSeconds = 0.002;
+
+	/** Per-sample upward drift allowed on the transit floor, so clock skew cannot pin it. */
+	constexpr double TransitFloorCreep = 0.0005;
+
+	/** A sender time jump beyond this restarts the interpolation buffer. */
+	constexpr double StreamResetSeconds = 5.0;
+
+	void WriteBits(FBitWriter& Writer, uint32 Value, int32 NumBits)
+	{
+		Writer.SerializeBits(&Value, NumBits);
+	}
+
+	uint32 ReadBits(FBitReader& Reader, int32 NumBits)
+	{
+		uint32 Value = 0;
+		Reader.SerializeBits(&Value, NumBits);
+		return Value;
+	}
+
+	void WritePositionDelta(FBitWriter& Writer, int16 Value, int16 Base)
+	{
+		const int32 Delta = static_cast<int32>(Value) - Base;
+		if (Delta == 0)
+		{
+			Writer.WriteBit(0);
+		}
+		else if (Delta >= -128 && Delta < 128)
+		{
+			Writer.WriteBit(1); Writer.WriteBit(0);
+			WriteBits(Writer, static_cast<uint32>(Delta + 128), 8);
+		}
+		else if (Delta >= -2048 && Delta < 2048)
+		{
+			Writer.WriteBit(1); Writer.WriteBit(1); Writer.WriteBit(0);
+			WriteBits(Writer, static_cast<uint32>(Delta + 2048), 12);
+		}
+		else
+		{
+			Writer.WriteBit(1); Writer.WriteBit(1); Writer.WriteBit(1);
+			WriteBits(Writer, static_cast<uint16>(Value), 16);
+		}
+	}
+
+	int16 ReadPositionDelta(FBitReader& Reader, int16 Base)
+	{
+		if (!Reader.ReadBit())
+		{
+			return Base;
+		}
+		if (!Reader.ReadBit())
+		{
+			return static_cast<int16>(Base + static_cast<int32>(ReadBits(Reader, 8)) - 128);
+		}
+		if (!Reader.ReadBit())
+		{
+			return static_cast<int16>(Base + static_cast<int32>(ReadBits(Reader, 12)) - 2048);
+		}
+		return static_cast<int16>(ReadBits(Reader, 16));
+	}
+
+	// Smallest-three layout: [31:30] largest index, then three 10-bit components high to low
+	uint32 RotationIndex(uint32 Packed) { return Packed >> 30; }
+	int32 RotationComponent(uint32 Packed, int32 i) { return static_cast<int32>((Packed >> (20 - 10 * i)) & 1023u); }
+
+	void WriteRotationDelta(FBitWriter& Writer, uint32 Value, uint32 Base)
+	{
+		if (Value == Base)
+		{
+			Writer.WriteBit(0);
+			return;
+		}
+
+		bool bSmall = RotationIndex(Value) == RotationIndex(Base);
+		int32 Deltas[3];
+		for (int32 i = 0; i < 3 && bSmall; ++i)
+		{
+			Deltas[i] = RotationComponent(Value, i) - RotationComponent(Base, i);
+			bSmall = Deltas[i] >= -64 && Deltas[i] < 64;
+		}
+
+		Writer.WriteBit(1);
+		if (bSmall)
+		{
+			Writer.WriteBit(0);
+			for (int32 i = 0; i < 3; ++i)
+			{
+				WriteBits(Writer, static_cast<uint32>(Deltas[i] + 64), 7);
+			}
+		}
+		else
+		{
+			Writer.WriteBit(1);
+			WriteBits(Writer, Value, 32);
+		}
+	}
+
+	uint32 ReadRotationDelta(FBitReader& Reader, uint32 Base)
+	{
+		if (!Reader.ReadBit())
+		{
+			return Base;
+		}
+		if (Reader.ReadBit())
+		{
+			return ReadBits(Reader, 32);
+		}
+
+		uint32 Packed = RotationIndex(Base) << 30;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const int32 Component = FMath::Clamp(RotationComponent(Base, i) + static_cast<int32>(ReadBits(Reader, 7)) - 64, 0, 1023);
+			Packed |= static_cast<uint32>(Component) << (20 - 10 * i);
+		}
+		return Packed;
+	}
+
+	/** Server-side record of the last pose written to one connection. */
+	class FHMVRPoseBaseState : public INetDeltaBaseState
+	{
+	public:
+		FHMVRQuantizedPose Pose;
+		int32 DeltasSinceKeyframe = 0;
+
+		virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+		{
+			return static_cast<FHMVRPoseBaseState*>(OtherState)->Pose.Sequence == Pose.Sequence;
+		}
+	};
+}
+
+// ── Quantization ─────────────────────────────────────────────────────────────
+
+bool FHMVRQuantizedPose::SameValues(const FHMVRQuantizedPose& Other) const
+{
+	return FMemory::Memcmp(Position, Other.Position, sizeof(Position)) == 0
+		&& FMemory::Memcmp(Rotation, Other.Rotation, sizeof(Rotation)) == 0;
+}
+
+FHMVRQuantizedPose FHMVRQuantizedPose::Quantize(const FHMVRPoseSample& Sample, uint16 Sequence, uint16 TimeMs)
+{
+	FHMVRQuantizedPose Pose;
+	Pose.Sequence = Sequence;
+	Pose.TimeMs = TimeMs;
+	for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Pose.Position[Device][Axis] = static_cast<int16>(FMath::Clamp(
+				FMath::RoundToInt(Sample.Position[Device][Axis] / HMVRPose::PositionResolutionCm), -32768, 32767));
+		}
+		Pose.Rotation[Device] = PackRotation(Sample.Rotation[Device]);
+	}
+	return Pose;
+}
+
+FHMVRPoseSample FHMVRQuantizedPose::Dequantize() const
+{
+	FHMVRPoseSample Sample;
+	for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+	{
+		Sample.Position[Device] = FVector(Position[Device][0], Position[Device][1], Position[Device][2]) * HMVRPose::PositionResolutionCm;
+		Sample.Rotation[Device] = UnpackRotation(Rotation[Device]);
+	}
+	return Sample;
+}
+
+uint32 FHMVRQuantizedPose::PackRotation(const FQuat& Rotation)
+{
+	const FQuat Q = Rotation.GetNormalized();
+	const double Components[4] = { Q.X, Q.Y, Q.Z, Q.W };
+
+	int32 Largest = 0;
+	for (int32 i = 1; i < 4; ++i)
+	{
+		if (FMath::Abs(Components[i]) > FMath::Abs(Components[Largest]))
+		{
+			Largest = i;
+		}
+	}
+
+	// q and -q are the same rotation; make the dropped component positive so it can be rebuilt
+	const double Sign = Components[Largest] < 0.0 ? -1.0 : 1.0;
+
+	uint32 Packed = static_cast<uint32>(Largest) << 30;
+	int32 Shift = 20;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (i == Largest)
+		{
+			continue;
+		}
+		// The remaining components lie in [-1/√2, 1/√2]
+		const double Normalized = FMath::Clamp(Components[i] * Sign * Sqrt2, -1.0, 1.0);
+		const uint32 Quantized = static_cast<uint32>(FMath::RoundToInt((Normalized * 0.5 + 0.5) * 1023.0));
+		Packed |= Quantized << Shift;
+		Shift -= 10;
+	}
+	return Packed;
+}
+
+FQuat FHMVRQuantizedPose::UnpackRotation(uint32 Packed)
+{
+	const int32 Largest = static_cast<int32>(RotationIndex(Packed));
+	double Components[4];
+	double SumSquares = 0.0;
+	int32 Field = 0;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		if (i == Largest)
+		{
+			continue;
+		}
+		const double Normalized = RotationComponent(Packed, Field++) / 1023.0 * 2.0 - 1.0;
+		Components[i] = Normalized / Sqrt2;
+		SumSquares += Components[i] * Components[i];
+	}
+	Components[Largest] = FMath::Sqrt(FMath::Max(0.0, 1.0 - SumSquares));
+
+	FQuat Q(Components[0], Components[1], Components[2], Components[3]);
+	Q.Normalize();
+	return Q;
+}
+
+// ── Codec ────────────────────────────────────────────────────────────────────
+
+void FHMVRPoseCodec::Write(FBitWriter& Writer, const FHMVRQuantizedPose& Pose, const FHMVRQuantizedPose* Baseline)
+{
+	WriteBits(Writer, Pose.Sequence, 16);
+	WriteBits(Writer, Pose.TimeMs, 16);
+
+	const uint16 Distance = Baseline ? static_cast<uint16>(Pose.Sequence - Baseline->Sequence) : 0;
+	if (Baseline && (Distance == 0 || Distance >= HMVRPose::HistorySize))
+	{
+		Baseline = nullptr; // out of the receiver's history window
+	}
+
+	Writer.WriteBit(Baseline ? 0 : 1);
+	if (!Baseline)
+	{
+		for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				WriteBits(Writer, static_cast<uint16>(Pose.Position[Device][Axis]), 16);
+			}
+			WriteBits(Writer, Pose.Rotation[Device], 32);
+		}
+		return;
+	}
+
+	WriteBits(Writer, Distance, 6);
+	for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			WritePositionDelta(Writer, Pose.Position[Device][Axis], Baseline->Position[Device][Axis]);
+		}
+		WriteRotationDelta(Writer, Pose.Rotation[Device], Baseline->Rotation[Device]);
+	}
+}
+
+bool FHMVRPoseCodec::Read(FBitReader& Reader, FHMVRQuantizedPose& OutPose,
+	TFunctionRef<const FHMVRQuantizedPose*(uint16)> FindBaseline)
+{
+	OutPose.Sequence = static_cast<uint16>(ReadBits(Reader, 16));
+	OutPose.TimeMs = static_cast<uint16>(ReadBits(Reader, 16));
+
+	if (Reader.ReadBit())
+	{
+		for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				OutPose.Position[Device][Axis] = static_cast<int16>(ReadBits(Reader, 16));
+			}
+			OutPose.Rotation[Device] = ReadBits(Reader, 32);
+		}
+		return !Reader.IsError();
+	}
+
+	const uint16 BaselineSequence = static_cast<uint16>(OutPose.Sequence - ReadBits(Reader, 6));
+	const FHMVRQuantizedPose* Baseline = FindBaseline(BaselineSequence);
+
+	// Decode against zeros when the baseline is missing, purely to consume the bits
+	const FHMVRQuantizedPose Zero;
+	const FHMVRQuantizedPose& Base = Baseline ? *Baseline : Zero;
+	for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+	{
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			OutPose.Position[Device][Axis] = ReadPositionDelta(Reader, Base.Position[Device][Axis]);
+		}
+		OutPose.Rotation[Device] = ReadRotationDelta(Reader, Base.Rotation[Device]);
+	}
+	return Baseline != nullptr && !Reader.IsError();
+}
+
+// ── History ──────────────────────────────────────────────────────────────────
+
+void FHMVRPoseHistory::Add(const FHMVRQuantizedPose& Pose)
+{
+	const int32 Index = Pose.Sequence % HMVRPose::HistorySize;
+	Poses[Index] = Pose;
+	bValid[Index] = true;
+}
+
+const FHMVRQuantizedPose* FHMVRPoseHistory::Find(uint16 Sequence) const
+{
+	const int32 Index = Sequence % HMVRPose::HistorySize;
+	return (bValid[Index] && Poses[Index].Sequence == Sequence) ? &Poses[Index] : nullptr;
+}
+
+void FHMVRPoseHistory::Reset()
+{
+	FMemory::Memzero(bValid, sizeof(bValid));
+}
+
+// ── Interpolation buffer ─────────────────────────────────────────────────────
+
+void FHMVRPoseInterpolationBuffer::AddSample(uint16 SenderTimeMs, const FHMVRPoseSample& Pose, double LocalArrivalTime)
+{
+	double SenderTime = SenderTimeMs / 1000.0;
+	if (LastSenderTime >= 0.0)
+	{
+		// Unwrap the 16-bit millisecond clock relative to the newest sample seen
+		const int16 StepMs = static_cast<int16>(SenderTimeMs - LastTimeMs);
+		SenderTime = LastSenderTime + StepMs / 1000.0;
+		if (FMath::Abs(StepMs / 1000.0) > StreamResetSeconds)
+		{
+			Reset();
+			SenderTime = SenderTimeMs / 1000.0;
+		}
+	}
+
+	const double Transit = LocalArrivalTime - SenderTime;
+	if (LastSenderTime < 0.0)
+	{
+		MinTransit = Transit;
+	}
+	else
+	{
+		MinTransit = FMath::Min(Transit, MinTransit + TransitFloorCreep);
+	}
+	Jitter += (static_cast<float>(Transit - MinTransit) - Jitter) / 16.f;
+
+	if (LastSenderTime < 0.0 || SenderTime > LastSenderTime)
+	{
+		if (LastSenderTime >= 0.0)
+		{
+			SendInterval += (FMath::Clamp(static_cast<float>(SenderTime - LastSenderTime), 1.f / 120.f, 0.5f) - SendInterval) / 16.f;
+		}
+		LastSenderTime = SenderTime;
+		LastTimeMs = SenderTimeMs;
+	}
+
+	if (LastRenderTime > 0.0 && SenderTime <= LastRenderTime)
+	{
+		++LateSamples; // playback has already passed it
+		return;
+	}
+
+	int32 Insert = Samples.Num();
+	while (Insert > 0 && Samples[Insert - 1].SenderTime > SenderTime)
+	{
+		--Insert;
+	}
+	Samples.Insert(FTimedPose{ SenderTime, Pose }, Insert);
+
+	if (Samples.Num() > MaxSamples)
+	{
+		Previous = Samples[0];
+		bHasPrevious = true;
+		Samples.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+}
+
+bool FHMVRPoseInterpolationBuffer::Evaluate(double LocalNow, float DeltaTime, FHMVRPoseSample& OutPose)
+{
+	if (Samples.Num() == 0)
+	{
+		return false;
+	}
+
+	const float TargetDelay = FMath::Clamp(1.5f * SendInterval + 2.f * Jitter, MinPlayoutDelay, MaxPlayoutDelay);
+	PlayoutDelay = FMath::FInterpTo(PlayoutDelay, TargetDelay, DeltaTime, 2.f);
+
+	// Never run playback backwards when the delay shrinks
+	const double RenderTime = FMath::Max(LocalNow - MinTransit - PlayoutDelay, LastRenderTime);
+	LastRenderTime = RenderTime;
+
+	while (Samples.Num() >= 2 && Samples[1].SenderTime <= RenderTime)
+	{
+		Previous = Samples[0];
+		bHasPrevious = true;
+		Samples.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+
+	const FTimedPose& From = Samples[0];
+	if (RenderTime <= From.SenderTime)
+	{
+		OutPose = From.Pose;
+		return true;
+	}
+
+	if (Samples.Num() >= 2)
+	{
+		const FTimedPose& To = Samples[1];
+		const float Alpha = static_cast<float>((RenderTime - From.SenderTime) / FMath::Max(To.SenderTime - From.SenderTime, 1e-4));
+		for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+		{
+			OutPose.Position[Device] = FMath::Lerp(From.Pose.Position[Device], To.Pose.Position[Device], Alpha);
+			OutPose.Rotation[Device] = FQuat::Slerp(From.Pose.Rotation[Device], To.Pose.Rotation[Device], Alpha);
+		}
+		return true;
+	}
+
+	// Starved: carry positions forward briefly, then hold
+	OutPose = From.Pose;
+	if (bHasPrevious && From.SenderTime > Previous.SenderTime)
+	{
+		const double Ahead = FMath::Min(RenderTime - From.SenderTime, static_cast<double>(MaxExtrapolation));
+		const double Span = From.SenderTime - Previous.SenderTime;
+		for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+		{
+			OutPose.Position[Device] += (From.Pose.Position[Device] - Previous.Pose.Position[Device]) * (Ahead / Span);
+		}
+	}
+	return true;
+}
+
+void FHMVRPoseInterpolationBuffer::Reset()
+{
+	Samples.Reset();
+	bHasPrevious = false;
+	LastSenderTime = -1.0;
+	LastRenderTime = 0.0;
+	PlayoutDelay = MaxPlayoutDelay;
+	Jitter = 0.f;
+}
+
+// ── Wire structs ─────────────────────────────────────────────────────────────
+
+bool FHMVRPoseStream::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	if (DeltaParms.GatherGuidReferences || DeltaParms.MoveGuidToUnmapped || DeltaParms.bUpdateUnmappedObjects)
+	{
+		return false; // no object references
+	}
+
+	if (DeltaParms.Writer)
+	{
+		if (!bHasLatest)
+		{
+			return false;
+		}
+
+		const FHMVRPoseBaseState* Old = static_cast<const FHMVRPoseBaseState*>(DeltaParms.OldState);
+		if (Old && Old->Pose.Sequence == Latest.Sequence)
+		{
+			return false; // this connection already has it
+		}
+
+		const bool bDelta = Old && HMVRPose::IsNewer(Latest.Sequence, Old->Pose.Sequence)
+			&& Old->DeltasSinceKeyframe < KeyframeInterval;
+		FHMVRPoseCodec::Write(*DeltaParms.Writer, Latest, bDelta ? &Old->Pose : nullptr);
+
+		TSharedPtr<FHMVRPoseBaseState> NewState = MakeShared<FHMVRPoseBaseState>();
+		NewState->Pose = Latest;
+		NewState->DeltasSinceKeyframe = bDelta ? Old->DeltasSinceKeyframe + 1 : 0;
+		*DeltaParms.NewState = NewState;
+		return true;
+	}
+
+	if (DeltaParms.Reader)
+	{
+		FHMVRQuantizedPose Pose;
+		if (FHMVRPoseCodec::Read(*DeltaParms.Reader, Pose, [this](uint16 Sequence) { return ReceiveHistory.Find(Sequence); }))
+		{
+			ReceiveHistory.Add(Pose);
+			if (Received.Num() >= FHMVRPoseInterpolationBuffer::MaxSamples)
+			{
+				Received.RemoveAt(0, 1, EAllowShrinking::No);
+			}
+			Received.Add(Pose);
+		}
+		else if (!DeltaParms.Reader->IsError())
+		{
+			// Based on a pose that was lost in flight; the server falls back to an acked one
+			++UndecodablePoses;
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool FHMVRPosePacket::NetSerialize(FArchive& Ar, UPackageMap* /*Map*/, bool& bOutSuccess)
+{
+	uint32 Bits = static_cast<uint32>(NumBits);
+	Ar.SerializeIntPacked(Bits);
+	if (Bits > static_cast<uint32>(HMVRPose::MaxEncodedBits))
+	{
+		Ar.SetError();
+		bOutSuccess = false;
+		return false;
+	}
+
+	if (Ar.IsLoading())
+	{
+		NumBits = static_cast<int32>(Bits);
+		Data.SetNumZeroed((NumBits + 7) >> 3);
+	}
+	Ar.SerializeBits(Data.GetData(), NumBits);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+// ── Component ────────────────────────────────────────────────────────────────
+
+UHMVRPoseReplicationComponent::UHMVRPoseReplicationComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	// After the camera and motion controllers have taken this frame's tracking
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	SetIsReplicatedByDefault(true);
+	Tracked.SetNum(HMVRPose::NumDevices);
+}
+
+void UHMVRPoseReplicationComponent::SetTrackedComponents(USceneComponent* Head, USceneComponent* LeftHand, USceneComponent* RightHand)
+{
+	Tracked[HMVRPose::Head] = Head;
+	Tracked[HMVRPose::LeftHand] = LeftHand;
+	Tracked[HMVRPose::RightHand] = RightHand;
+}
+
+void UHMVRPoseReplicationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Dedicated servers only react to ServerSendPose
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UHMVRPoseReplicationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME_CONDITION(UHMVRPoseReplicationComponent, PoseStream, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(UHMVRPoseReplicationComponent, AckedSequence, COND_OwnerOnly);
+}
+
+void UHMVRPoseReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	const double Now = FPlatformTime::Seconds();
+	if (IsLocallyControlledPawn())
+	{
+		TickOwner(Now);
+	}
+	else
+	{
+		TickRemote(Now, DeltaTime);
+	}
+}
+
+bool UHMVRPoseReplicationComponent::IsLocallyControlledPawn() const
+{
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	return Pawn && Pawn->IsLocallyControlled();
+}
+
+FHMVRPoseSample UHMVRPoseReplicationComponent::CaptureLocalPose() const
+{
+	FHMVRPoseSample Sample;
+	for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+	{
+		const USceneComponent* Component = Tracked[Device];
+		Sample.Position[Device] = Component ? Component->GetRelativeLocation() : FVector::ZeroVector;
+		Sample.Rotation[Device] = Component ? Component->GetRelativeRotation().Quaternion() : FQuat::Identity;
+	}
+	return Sample;
+}
+
+void UHMVRPoseReplicationComponent::ApplyPose(const FHMVRPoseSample& Pose)
+{
+	for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+	{
+		if (USceneComponent* Component = Tracked[Device])
+		{
+			Component->SetRelativeLocationAndRotation(Pose.Position[Device], Pose.Rotation[Device]);
+		}
+	}
+}
+
+void UHMVRPoseReplicationComponent::TickOwner(double Now)
+{
+	const float RateHz = CVarPoseSendRateHz.GetValueOnGameThread();
+	if (RateHz <= 0.f || Now - LastSendTime < 1.0 / RateHz - SendSlackSeconds)
+	{
+		return;
+	}
+
+	const uint16 TimeMs = static_cast<uint16>(static_cast<uint64>(Now * 1000.0) & 0xFFFF);
+	const FHMVRQuantizedPose Pose = FHMVRQuantizedPose::Quantize(CaptureLocalPose(), NextSequence, TimeMs);
+	if (bHasSent && Pose.SameValues(LastSent) && Now - LastSendTime < IdleHeartbeatSeconds)
+	{
+		return;
+	}
+
+	LastSendTime = Now;
+	LastSent = Pose;
+	bHasSent = true;
+	if (++NextSequence == 0)
+	{
+		NextSequence = 1; // 0 means "nothing acked"
+	}
+
+	// Listen server host: no upstream hop
+	if (GetOwner()->HasAuthority())
+	{
+		Publish(Pose);
+		return;
+	}
+
+	const FHMVRQuantizedPose* Baseline = AckedSequence != 0 ? SentHistory.Find(AckedSequence) : nullptr;
+	SentHistory.Add(Pose);
+
+	FBitWriter Writer(HMVRPose::MaxEncodedBits, /*AllowResize=*/true);
+	FHMVRPoseCodec::Write(Writer, Pose, Baseline);
+
+	FHMVRPosePacket Packet;
+	Packet.NumBits = static_cast<int32>(Writer.GetNumBits());
+	Packet.Data = *Writer.GetBuffer();
+	ServerSendPose(Packet);
+}
+
+void UHMVRPoseReplicationComponent::TickRemote(double Now, float DeltaTime)
+{
+	for (const FHMVRQuantizedPose& Pose : PoseStream.Received)
+	{
+		Interpolation.AddSample(Pose.TimeMs, Pose.Dequantize(), Now);
+	}
+	PoseStream.Received.Reset();
+
+	FHMVRPoseSample Pose;
+	if (Interpolation.Evaluate(Now, DeltaTime, Pose))
+	{
+		ApplyPose(Pose);
+	}
+}
+
+void UHMVRPoseReplicationComponent::Publish(const FHMVRQuantizedPose& Pose)
+{
+	PoseStream.Latest = Pose;
+	PoseStream.bHasLatest = true;
+}
+
+bool UHMVRPoseReplicationComponent::ServerSendPose_Validate(const FHMVRPosePacket& Packet)
+{
+	return Packet.NumBits > 0 && Packet.NumBits <= HMVRPose::MaxEncodedBits && Packet.Data.Num() * 8 >= Packet.NumBits;
+}
+
+void UHMVRPoseReplicationComponent::ServerSendPose_Implementation(const FHMVRPosePacket& Packet)
+{
+	FBitReader Reader(Packet.Data.GetData(), Packet.NumBits);
+	FHMVRQuantizedPose Pose;
+	if (!FHMVRPoseCodec::Read(Reader, Pose, [this](uint16 Sequence) { return ServerHistory.Find(Sequence); }))
+	{
+		// Baseline already evicted — the owner re-keys once its ack stops advancing
+		return;
+	}
+
+	if (bServerHasPose && !HMVRPose::IsNewer(Pose.Sequence, AckedSequence))
+	{
+		return; // reordered behind a newer pose
+	}
+
+	ServerHistory.Add(Pose);
+	AckedSequence = Pose.Sequence;
+	bServerHasPose = true;
+
+	// Server-side hand/head positions for interaction checks
+	ApplyPose(Pose.Dequantize());
+	Publish(Pose);
+}
+
+// ── Bandwidth benchmark ──────────────────────────────────────────────────────
+
+namespace
+{
+	/** Seated-to-standing play: slow body sway, head looking around, hands reaching. */
+	FHMVRPoseSample SyntheticPose(double T, double Phase, FRandomStream& Noise)
+	{
+		auto Jitter = [&Noise]() { return FVector(Noise.FRandRange(-0.05f, 0.05f), Noise.FRandRange(-0.05f, 0.05f), Noise.FRandRange(-0.05f, 0.05f)); };
+
+		FHMVRPoseSample Pose;
+		Pose.Position[HMVRPose::Head] = FVector(8.0 * FMath::Sin(0.4 * T + Phase), 8.0 * FMath::Cos(0.3 * T + Phase), 165.0 + 3.0 * FMath::Sin(1.8 * T)) + Jitter();
+		Pose.Rotation[HMVRPose::Head] = FRotator(15.0 * FMath::Sin(0.7 * T + Phase), 60.0 * FMath::Sin(0.5 * T + Phase), 0.0).Quaternion();
+
+		for (int32 Side = 0; Side < 2; ++Side)
+		{
+			const double S = Side == 0 ? -1.0 : 1.0;
+			const double P = Phase + Side * 1.3;
+			Pose.Position[HMVRPose::LeftHand + Side] = FVector(
+				35.0 + 20.0 * FMath::Sin(1.2 * T + P),
+				S * (22.0 + 10.0 * FMath::Sin(0.9 * T + P)),
+				110.0 + 25.0 * FMath::Sin(1.5 * T + P)) + Jitter();
+			Pose.Rotation[HMVRPose::LeftHand + Side] = FRotator(40.0 * FMath::Sin(1.1 * T + P), S * 30.0 * FMath::Sin(0.8 * T + P), 50.0 * FMath::Sin(1.4 * T + P)).Quaternion();
+		}
+		return Pose;
+	}
+
+	int64 EncodedBits(const FHMVRQuantizedPose& Pose, const FHMVRQuantizedPose* Baseline)
+	{
+		FBitWriter Writer(HMVRPose::MaxEncodedBits, /*AllowResize=*/true);
+		FHMVRPoseCodec::Write(Writer, Pose, Baseline);
+		return Writer.GetNumBits();
+	}
+
+	// Three FTransforms as float location, rotation and scale
+	constexpr int32 NaiveBitsPerPose = 3 * 10 * 32;
+
+	void RunPoseBandwidthBenchmark(int32 Players, float RttMs)
+	{
+		constexpr double SimulatedSeconds = 10.0;
+
+		for (const double RateHz : { 72.0, 90.0 })
+		{
+			const int32 Frames = FMath::CeilToInt(SimulatedSeconds * RateHz);
+			// The upstream baseline is the pose the server acked one round trip ago
+			const int32 AckLag = FMath::Max(1, FMath::CeilToInt(RttMs / 1000.0 * RateHz));
+
+			FRandomStream Rng(1234);
+			int64 UpBits = 0, DownBits = 0, KeyframeBits = 0;
+			int64 Encoded = 0;
+
+			for (int32 Player = 0; Player < Players; ++Player)
+			{
+				const double Phase = Rng.FRandRange(0.f, 2.f * PI);
+				TArray<FHMVRQuantizedPose> Track;
+				Track.Reserve(Frames);
+				for (int32 Frame = 0; Frame < Frames; ++Frame)
+				{
+					const double T = Frame / RateHz;
+					Track.Add(FHMVRQuantizedPose::Quantize(SyntheticPose(T, Phase, Rng),
+						static_cast<uint16>(Frame + 1), static_cast<uint16>(static_cast<int64>(T * 1000.0) & 0xFFFF)));
+				}
+
+				KeyframeBits = EncodedBits(Track[0], nullptr);
+				for (int32 Frame = 1; Frame < Frames; ++Frame)
+				{
+					const bool bKeyframe = Frame % FHMVRPoseStream::KeyframeInterval == 0;
+					DownBits += EncodedBits(Track[Frame], bKeyframe ? nullptr : &Track[Frame - 1]);
+					UpBits += EncodedBits(Track[Frame], Frame >= AckLag ? &Track[Frame - AckLag] : nullptr);
+					++Encoded;
+				}
+			}
+
+			const double UpPerPose = static_cast<double>(UpBits) / Encoded;
+			const double DownPerPose = static_cast<double>(DownBits) / Encoded;
+			const double ClientUpKbps = UpPerPose * RateHz / 1000.0;
+			const double ClientDownKbps = DownPerPose * RateHz * (Players - 1) / 1000.0;
+			const double ServerEgressKbps = ClientDownKbps * Players;
+			const double NaiveEgressKbps = static_cast<double>(NaiveBitsPerPose) * RateHz * (Players - 1) * Players / 1000.0;
+
+			UE_LOG(LogTemp, Log, TEXT("PoseReplication: %d players @ %.0f Hz, %.0f ms RTT (payload only, excludes packet/bunch headers)"),
+				Players, RateHz, RttMs);
+			UE_LOG(LogTemp, Log, TEXT("PoseReplication:   keyframe %lld bits, upstream delta %.1f bits, downstream delta %.1f bits (3 x FTransform %d bits)"),
+				KeyframeBits, UpPerPose, DownPerPose, NaiveBitsPerPose);
+			UE_LOG(LogTemp, Log, TEXT("PoseReplication:   per client up %.1f kbit/s, down %.1f kbit/s; server egress %.1f kbit/s vs %.1f kbit/s uncompressed (%.1fx)"),
+				ClientUpKbps, ClientDownKbps, ServerEgressKbps, NaiveEgressKbps, NaiveEgressKbps / FMath::Max(ServerEgressKbps, 1e-3));
+		}
+	}
+}
+
+// HMVR.Pose.Bandwidth [Players] [RttMs] — encode 10 s of synthetic head/hand motion per player
+// at 72 and 90 Hz through the real codec and report the resulting pose bandwidth.
+static FAutoConsoleCommand CmdPoseBandwidth(
+	TEXT("HMVR.Pose.Bandwidth"),
+	TEXT("HMVR.Pose.Bandwidth [Players=15] [RttMs=80] — estimate VR pose replication bandwidth at 72/90 Hz."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Players = Args.Num() > 0 ? FMath::Max(2, FCString::Atoi(*Args[0])) : 15;
+		const float RttMs = Args.Num() > 1 ? FMath::Max(0.f, FCString::Atof(*Args[1])) : 80.f;
+		RunPoseBandwidthBenchmark(Players, RttMs);
+	}));
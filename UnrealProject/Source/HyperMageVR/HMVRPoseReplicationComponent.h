@@ -0,0 +1,257 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"
+#include "HMVRPoseReplicationComponent.generated.h"
+
+class FBitWriter;
+class FBitReader;
+
+namespace HMVRPose
+{
+	/** Tracked devices, in wire order. */
+	enum EDevice : int32 { Head = 0, LeftHand, RightHand, NumDevices };
+
+	/** Position quantum in cm. int16 at 1 mm covers ±32.7 m around the pawn origin. */
+	constexpr float PositionResolutionCm = 0.1f;
+
+	/** Received/sent poses kept for baseline lookup; also bounds the baseline distance. */
+	constexpr int32 HistorySize = 64;
+
+	/** Upper bound on an encoded pose, used to validate the upstream RPC. */
+	constexpr int32 MaxEncodedBits = 512;
+
+	/** Wrap-aware "A is newer than B" for 16-bit sequence numbers. */
+	inline bool IsNewer(uint16 A, uint16 B) { return static_cast<int16>(A - B) > 0; }
+}
+
+/** Head and hand poses in pawn-local space (relative to the VR origin). */
+struct FHMVRPoseSample
+{
+	FVector Position[HMVRPose::NumDevices];
+	FQuat Rotation[HMVRPose::NumDevices];
+};
+
+/**
+ * A pose as it travels on the wire: positions as int16 millimetres, rotations as
+ * smallest-three quaternions (2-bit index + 3 × 10 bits). Deltas are taken between
+ * these integers, so decoding is exact and never drifts from the sender.
+ */
+struct FHMVRQuantizedPose
+{
+	uint16 Sequence = 0;
+	/** Sender capture time, milliseconds mod 2^16; the receiver unwraps it. */
+	uint16 TimeMs = 0;
+	int16 Position[HMVRPose::NumDevices][3] = {};
+	uint32 Rotation[HMVRPose::NumDevices] = {};
+
+	bool SameValues(const FHMVRQuantizedPose& Other) const;
+
+	static FHMVRQuantizedPose Quantize(const FHMVRPoseSample& Sample, uint16 Sequence, uint16 TimeMs);
+	FHMVRPoseSample Dequantize() const;
+
+	static uint32 PackRotation(const FQuat& Rotation);
+	static FQuat UnpackRotation(uint32 Packed);
+};
+
+/**
+ * Bit codec shared by the upstream RPC and the downstream property.
+ *
+ * Header: 16-bit sequence, 16-bit time, keyframe bit, 6-bit baseline distance (delta only).
+ * Per device and position axis: 0 = unchanged, 10 + 8-bit delta, 110 + 12-bit delta,
+ * 111 + absolute 16 bits. Per device rotation: 0 = unchanged, 10 + 3 × 7-bit delta
+ * (same largest component), 11 + packed 32 bits. A keyframe writes everything absolute.
+ */
+struct FHMVRPoseCodec
+{
+	/** Baseline may be null (keyframe). Its sequence must be 1..HistorySize-1 behind Pose. */
+	static void Write(FBitWriter& Writer, const FHMVRQuantizedPose& Pose, const FHMVRQuantizedPose* Baseline);
+
+	/**
+	 * Read one pose. FindBaseline(Sequence) returns the pose with that sequence or null.
+	 * Always consumes the full encoding; returns false if the baseline was unavailable or
+	 * the stream was malformed.
+	 */
+	static bool Read(FBitReader& Reader, FHMVRQuantizedPose& OutPose,
+		TFunctionRef<const FHMVRQuantizedPose*(uint16)> FindBaseline);
+};
+
+/** Fixed-size ring of quantized poses indexed by sequence. */
+struct FHMVRPoseHistory
+{
+	void Add(const FHMVRQuantizedPose& Pose);
+	const FHMVRQuantizedPose* Find(uint16 Sequence) const;
+	void Reset();
+
+private:
+	FHMVRQuantizedPose Poses[HMVRPose::HistorySize];
+	bool bValid[HMVRPose::HistorySize] = {};
+};
+
+/**
+ * Jitter buffer for remote poses. Samples are placed on the sender's clock, the one-way
+ * transit floor is tracked, and playback runs PlayoutDelay behind the newest expected
+ * sample — 1.5 send intervals plus twice the measured jitter, clamped. Positions are
+ * lerped and rotations slerped between the bracketing samples; a missing sample is
+ * bridged by a short extrapolation, then the last pose is held.
+ */
+class FHMVRPoseInterpolationBuffer
+{
+public:
+	void AddSample(uint16 SenderTimeMs, const FHMVRPoseSample& Pose, double LocalArrivalTime);
+	bool Evaluate(double LocalNow, float DeltaTime, FHMVRPoseSample& OutPose);
+	void Reset();
+
+	float GetPlayoutDelay() const { return PlayoutDelay; }
+	float GetJitter() const { return Jitter; }
+	int32 GetLateSamples() const { return LateSamples; }
+
+	static constexpr int32 MaxSamples = 32;
+	static constexpr float MinPlayoutDelay = 0.02f;
+	static constexpr float MaxPlayoutDelay = 0.2f;
+	static constexpr float MaxExtrapolation = 0.05f;
+
+private:
+	struct FTimedPose
+	{
+		double SenderTime;
+		FHMVRPoseSample Pose;
+	};
+
+	TArray<FTimedPose> Samples;
+	FTimedPose Previous;
+	bool bHasPrevious = false;
+	uint16 LastTimeMs = 0;
+	double LastSenderTime = -1.0;
+	double MinTransit = 0.0;
+	float Jitter = 0.f;
+	float SendInterval = 1.f / 72.f;
+	float PlayoutDelay = MaxPlayoutDelay;
+	double LastRenderTime = 0.0;
+	int32 LateSamples = 0;
+};
+
+/**
+ * Server → non-owning clients pose stream. Custom delta serialization: every connection has
+ * its own base state (the last pose written to it, reverted by the net driver on loss), so
+ * each client gets a delta against what it already holds. The receiver keeps a history to
+ * resolve the baseline and queues decoded samples for the component to consume.
+ */
+USTRUCT()
+struct FHMVRPoseStream
+{
+	GENERATED_BODY()
+
+	/** Server: newest pose to send. */
+	FHMVRQuantizedPose Latest;
+	bool bHasLatest = false;
+
+	/** Client: decoded poses waiting for the interpolation buffer. */
+	TArray<FHMVRQuantizedPose> Received;
+	FHMVRPoseHistory ReceiveHistory;
+	int32 UndecodablePoses = 0;
+
+	/** Force a keyframe after this many deltas on one connection. */
+	static constexpr int32 KeyframeInterval = 128;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+};
+
+template<>
+struct TStructOpsTypeTraits<FHMVRPoseStream> : public TStructOpsTypeTraitsBase2<FHMVRPoseStream>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+/** Owner → server pose, already bit-packed by FHMVRPoseCodec. */
+USTRUCT()
+struct FHMVRPosePacket
+{
+	GENERATED_BODY()
+
+	TArray<uint8> Data;
+	int32 NumBits = 0;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FHMVRPosePacket> : public TStructOpsTypeTraitsBase2<FHMVRPosePacket>
+{
+	enum { WithNetSerializer = true };
+};
+
+/**
+ * Replicates head and hand poses of a VR pawn.
+ *
+ * The owning client samples the camera and motion controllers (pawn-local) at up to
+ * hmvr.Pose.SendRateHz, quantizes them and sends an unreliable RPC delta-encoded against
+ * the last pose the server acknowledged (AckedSequence, owner-only). The server decodes,
+ * applies the pose to its own components and republishes it through PoseStream, which
+ * every other client decodes against its own acknowledged baseline and plays back through
+ * an FHMVRPoseInterpolationBuffer.
+ *
+ * A keyframe is 273 bits against 960 for three FTransforms; run HMVR.Pose.Bandwidth for
+ * the delta-coded figures at 72/90 Hz.
+ */
+UCLASS(ClassGroup=(HyperMage), meta=(BlueprintSpawnableComponent))
+class HYPERMAGEVR_API UHMVRPoseReplicationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UHMVRPoseReplicationComponent();
+
+	/** Components whose relative transforms are sent (owner) or driven (everyone else). */
+	void SetTrackedComponents(USceneComponent* Head, USceneComponent* LeftHand, USceneComponent* RightHand);
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	const FHMVRPoseInterpolationBuffer& GetInterpolationBuffer() const { return Interpolation; }
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	bool IsLocallyControlledPawn() const;
+	FHMVRPoseSample CaptureLocalPose() const;
+	void ApplyPose(const FHMVRPoseSample& Pose);
+
+	void TickOwner(double Now);
+	void TickRemote(double Now, float DeltaTime);
+
+	/** Server (or listen host): make Pose the newest entry of PoseStream. */
+	void Publish(const FHMVRQuantizedPose& Pose);
+
+	UFUNCTION(Server, Unreliable, WithValidation)
+	void ServerSendPose(const FHMVRPosePacket& Packet);
+
+	/** Indexed by HMVRPose::EDevice. */
+	UPROPERTY()
+	TArray<TObjectPtr<USceneComponent>> Tracked;
+
+	UPROPERTY(Replicated)
+	FHMVRPoseStream PoseStream;
+
+	/** Newest sequence the server has decoded from the owner. */
+	UPROPERTY(Replicated)
+	uint16 AckedSequence = 0;
+
+	// Owner
+	FHMVRPoseHistory SentHistory;
+	FHMVRQuantizedPose LastSent;
+	bool bHasSent = false;
+	uint16 NextSequence = 1;
+	double LastSendTime = 0.0;
+
+	// Server
+	FHMVRPoseHistory ServerHistory;
+	bool bServerHasPose = false;
+
+	// Remote clients
+	FHMVRPoseInterpolationBuffer Interpolation;
+};
@@ -0,0 +1,395 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRPropBatch.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/CollisionProfile.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Net/UnrealNetwork.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld CmdPropsStats(
+	TEXT("HMVR.Props.Stats"),
+	TEXT("Print prop batch, mesh/material group and instance counts, and check every batch's instancer and id lookup."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&AHMVRPropBatch::DumpStats));
+
+// ── Batch actor ──────────────────────────────────────────────────────────────
+
+AHMVRPropBatch::AHMVRPropBatch()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetNetUpdateFrequency(1.f);
+	// Replicated once to each connection, then the channel closes
+	NetDormancy = DORM_DormantAll;
+
+	USceneComponent* Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	Root->SetMobility(EComponentMobility::Static);
+	RootComponent = Root;
+}
+
+void AHMVRPropBatch::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AHMVRPropBatch, Mesh);
+	DOREPLIFETIME(AHMVRPropBatch, Material);
+	DOREPLIFETIME(AHMVRPropBatch, bTinted);
+	DOREPLIFETIME(AHMVRPropBatch, Tint);
+	DOREPLIFETIME(AHMVRPropBatch, Instances);
+}
+
+void AHMVRPropBatch::InitBatch(UStaticMesh* InMesh, UMaterialInterface* InMaterial, const TOptional<FLinearColor>& InTint,
+	TArray<FHMVRPropInstance>&& InInstances, const TArray<FName>& InIds)
+{
+	Mesh = InMesh;
+	Material = InMaterial;
+	bTinted = InTint.IsSet();
+	Tint = InTint.Get(FLinearColor::White);
+	Instances = MoveTemp(InInstances);
+
+	InstanceIds.Reset();
+	InstanceById.Reset();
+	if (InIds.Num() == Instances.Num())
+	{
+		InstanceIds = InIds;
+		for (int32 i = 0; i < InstanceIds.Num(); ++i)
+		{
+			if (!InstanceIds[i].IsNone())
+			{
+				InstanceById.Add(InstanceIds[i], i);
+			}
+		}
+	}
+
+	RebuildInstancer();
+	FlushNetDormancy();
+}
+
+void AHMVRPropBatch::OnRep_Batch()
+{
+	// Every property of the initial bunch lands before the notifies run, so this builds once
+	RebuildInstancer();
+}
+
+void AHMVRPropBatch::RebuildInstancer()
+{
+	if (Instancer)
+	{
+		Instancer->DestroyComponent();
+		Instancer = nullptr;
+	}
+	if (!Mesh || Instances.Num() == 0)
+	{
+		return;
+	}
+
+	// Fill before registering: a registered Static component rejects mesh changes once play has begun
+	Instancer = NewObject<UHierarchicalInstancedStaticMeshComponent>(this, NAME_None, RF_Transient);
+	Instancer->SetMobility(EComponentMobility::Static);
+	Instancer->SetupAttachment(RootComponent);
+	Instancer->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Instancer->SetStaticMesh(Mesh);
+
+	if (Material)
+	{
+		UMaterialInterface* Applied = Material;
+		if (bTinted)
+		{
+			UMaterialInstanceDynamic* Tinted = UMaterialInstanceDynamic::Create(Material, this);
+			Tinted->SetVectorParameterValue(FName("Color"), Tint);
+			Applied = Tinted;
+		}
+		for (int32 Slot = 0; Slot < Mesh->GetStaticMaterials().Num(); ++Slot)
+		{
+			Instancer->SetMaterial(Slot, Applied);
+		}
+	}
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(Instances.Num());
+	for (const FHMVRPropInstance& Instance : Instances)
+	{
+		Transforms.Add(Instance.ToTransform());
+	}
+	Instancer->AddInstances(Transforms, /*bShouldReturnIndices=*/false);
+
+	Instancer->RegisterComponent();
+	AddInstanceComponent(Instancer);
+}
+
+FName AHMVRPropBatch::GetPropId(int32 InstanceIndex) const
+{
+	return InstanceIds.IsValidIndex(InstanceIndex) ? InstanceIds[InstanceIndex] : NAME_None;
+}
+
+bool AHMVRPropBatch::FindProp(UWorld* World, FName PropId, AHMVRPropBatch*& OutBatch, int32& OutInstanceIndex)
+{
+	if (!World || PropId.IsNone())
+	{
+		return false;
+	}
+
+	for (TActorIterator<AHMVRPropBatch> It(World); It; ++It)
+	{
+		if (const int32* Index = It->InstanceById.Find(PropId))
+		{
+			OutBatch = *It;
+			OutInstanceIndex = *Index;
+			return true;
+		}
+	}
+	return false;
+}
+
+void AHMVRPropBatch::DumpStats(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	int32 Batches = 0;
+	int32 Instances = 0;
+	int32 Named = 0;
+	int32 StaticBatches = 0;
+	int32 Problems = 0;
+	TSet<TPair<const UStaticMesh*, const UMaterialInterface*>> Groups;
+
+	for (TActorIterator<AHMVRPropBatch> It(World); It; ++It)
+	{
+		const AHMVRPropBatch* Batch = *It;
+		++Batches;
+		Instances += Batch->Instances.Num();
+		Named += Batch->InstanceById.Num();
+		Groups.Add(TPair<const UStaticMesh*, const UMaterialInterface*>(Batch->Mesh, Batch->Material));
+
+		const UHierarchicalInstancedStaticMeshComponent* Instancer = Batch->Instancer;
+		const int32 Built = Instancer ? Instancer->GetInstanceCount() : 0;
+		if (Instancer && Instancer->Mobility == EComponentMobility::Static)
+		{
+			++StaticBatches;
+		}
+		if (Built != Batch->Instances.Num())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRPropBatch: %s has %d instances built, %d replicated"),
+				*Batch->GetName(), Built, Batch->Instances.Num());
+			++Problems;
+		}
+		for (const TPair<FName, int32>& Entry : Batch->InstanceById)
+		{
+			if (Batch->GetPropId(Entry.Value) != Entry.Key)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("HMVRPropBatch: %s lookup for %s does not round-trip"),
+					*Batch->GetName(), *Entry.Key.ToString());
+				++Problems;
+			}
+		}
+	}
+
+	int32 MeshActors = 0;
+	for (TActorIterator<AStaticMeshActor> It(World); It; ++It)
+	{
+		++MeshActors;
+	}
+
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRPropBatch: %d instances (%d named) in %d batch actors, %d mesh/material groups, %d static; %d AStaticMeshActors remain; %d problems"),
+		Instances, Named, Batches, Groups.Num(), StaticBatches, MeshActors, Problems);
+}
+
+// ── Batcher ──────────────────────────────────────────────────────────────────
+
+namespace
+{
+	struct FPropGroupKey
+	{
+		const UStaticMesh* Mesh;
+		const UMaterialInterface* Material;
+		bool bTinted;
+		FColor Tint;
+
+		explicit FPropGroupKey(const FHMVRPropDesc& Prop)
+			: Mesh(Prop.Mesh)
+			, Material(Prop.Material)
+			, bTinted(Prop.Tint.IsSet())
+			, Tint(Prop.Tint.IsSet() ? Prop.Tint.GetValue().ToFColor(false) : FColor::White)
+		{
+		}
+
+		bool operator==(const FPropGroupKey& Other) const
+		{
+			return Mesh == Other.Mesh && Material == Other.Material && bTinted == Other.bTinted && Tint == Other.Tint;
+		}
+
+		friend uint32 GetTypeHash(const FPropGroupKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.Material));
+			return Key.bTinted ? HashCombine(Hash, GetTypeHash(Key.Tint)) : Hash;
+		}
+	};
+}
+
+void FHMVRPropBatcher::GroupProps(TConstArrayView<FHMVRPropDesc> Props, int32 MaxPerBatch, TArray<FGroup>& OutBatches)
+{
+	OutBatches.Reset();
+	MaxPerBatch = FMath::Max(1, MaxPerBatch);
+
+	// Key → the group's batch that still has room
+	TMap<FPropGroupKey, int32> OpenBatch;
+	for (int32 i = 0; i < Props.Num(); ++i)
+	{
+		if (!Props[i].Mesh || Props[i].bMovable)
+		{
+			continue;
+		}
+
+		int32& BatchIndex = OpenBatch.FindOrAdd(FPropGroupKey(Props[i]), INDEX_NONE);
+		if (BatchIndex == INDEX_NONE || OutBatches[BatchIndex].Members.Num() >= MaxPerBatch)
+		{
+			BatchIndex = OutBatches.AddDefaulted();
+		}
+		OutBatches[BatchIndex].Members.Add(i);
+	}
+}
+
+int32 FHMVRPropBatcher::Build(UWorld* World)
+{
+	if (!World)
+	{
+		Pending.Reset();
+		return 0;
+	}
+
+	const int32 BuiltBefore = BuiltBatches;
+	BeginBuild();
+	while (BuildNext(World))
+	{
+	}
+	return BuiltBatches - BuiltBefore;
+}
+
+int32 FHMVRPropBatcher::BeginBuild()
+{
+	GroupProps(Pending, AHMVRPropBatch::MaxInstancesPerBatch, Groups);
+	Movables.Reset();
+	for (int32 i = 0; i < Pending.Num(); ++i)
+	{
+		if (Pending[i].Mesh && Pending[i].bMovable)
+		{
+			Movables.Add(i);
+		}
+	}
+	NextGroup = 0;
+	BuildSpawned = 0;
+	BuildInstanced = 0;
+	BuildMovables = 0;
+	return Groups.Num() + Movables.Num();
+}
+
+bool FHMVRPropBatcher::BuildNext(UWorld* World)
+{
+	if (!World || !IsBuilding())
+	{
+		EndBuild();
+		return false;
+	}
+
+	if (NextGroup >= Groups.Num())
+	{
+		SpawnMovable(World, Pending[Movables[NextGroup++ - Groups.Num()]]);
+		if (!IsBuilding())
+		{
+			EndBuild();
+			return false;
+		}
+		return true;
+	}
+
+	const FGroup& Group = Groups[NextGroup++];
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AHMVRPropBatch* Batch = World->SpawnActor<AHMVRPropBatch>(FVector::ZeroVector, FRotator::ZeroRotator, Params);
+	if (Batch)
+	{
+		TArray<FHMVRPropInstance> Instances;
+		TArray<FName> Ids;
+		bool bAnyId = false;
+		Instances.Reserve(Group.Members.Num());
+		Ids.Reserve(Group.Members.Num());
+		for (const int32 Member : Group.Members)
+		{
+			const FHMVRPropDesc& Prop = Pending[Member];
+			FHMVRPropInstance& Instance = Instances.AddDefaulted_GetRef();
+			Instance.Location = Prop.Transform.GetLocation();
+			Instance.Rotation = Prop.Transform.Rotator();
+			Instance.Scale = Prop.Transform.GetScale3D();
+			Ids.Add(Prop.Id);
+			bAnyId |= !Prop.Id.IsNone();
+		}
+
+		const FHMVRPropDesc& First = Pending[Group.Members[0]];
+		BuildInstanced += Instances.Num();
+		Batch->InitBatch(First.Mesh, First.Material, First.Tint, MoveTemp(Instances), bAnyId ? Ids : TArray<FName>());
+		++BuildSpawned;
+	}
+
+	if (!IsBuilding())
+	{
+		EndBuild();
+		return false;
+	}
+	return true;
+}
+
+void FHMVRPropBatcher::SpawnMovable(UWorld* World, const FHMVRPropDesc& Prop)
+{
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(Prop.Transform.GetLocation(), Prop.Transform.Rotator(), Params);
+	if (!Actor)
+	{
+		return;
+	}
+
+	Actor->SetMobility(EComponentMobility::Movable);
+	Actor->SetActorScale3D(Prop.Transform.GetScale3D());
+	UStaticMeshComponent* MeshComponent = Actor->GetStaticMeshComponent();
+	MeshComponent->SetStaticMesh(Prop.Mesh);
+	if (Prop.Material)
+	{
+		UMaterialInterface* Applied = Prop.Material;
+		if (Prop.Tint.IsSet())
+		{
+			UMaterialInstanceDynamic* Tinted = UMaterialInstanceDynamic::Create(Prop.Material, Actor);
+			Tinted->SetVectorParameterValue(FName("Color"), Prop.Tint.GetValue());
+			Applied = Tinted;
+		}
+		MeshComponent->SetMaterial(0, Applied);
+	}
+	Actor->SetReplicates(true);
+	++BuildMovables;
+}
+
+void FHMVRPropBatcher::EndBuild()
+{
+	if (Pending.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRPropBatcher: %d props → %d instances in %d batch actors, %d movable actors"),
+			Pending.Num(), BuildInstanced, BuildSpawned, BuildMovables);
+	}
+
+	BuiltInstances += BuildInstanced;
+	BuiltBatches += BuildSpawned;
+	BuiltMovables += BuildMovables;
+	BuildInstanced = 0;
+	BuildSpawned = 0;
+	BuildMovables = 0;
+	Pending.Reset();
+	Groups.Reset();
+	Movables.Reset();
+	NextGroup = 0;
+}
@@ -0,0 +1,169 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/NetSerialization.h"
+#include "HMVRPropBatch.generated.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+class UHierarchicalInstancedStaticMeshComponent;
+
+/** One prop instance as replicated: 0.1 cm location, compressed rotation, 0.01 scale. */
+USTRUCT()
+struct FHMVRPropInstance
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector_NetQuantize10(0.f, 0.f, 0.f);
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FVector_NetQuantize100 Scale = FVector_NetQuantize100(1.f, 1.f, 1.f);
+
+	FTransform ToTransform() const { return FTransform(Rotation, Location, Scale); }
+};
+
+/**
+ * Static props sharing one mesh, material and tint, drawn by a single hierarchical instanced
+ * static mesh component — one scene proxy and one draw per visible cluster instead of one
+ * AStaticMeshActor each.
+ *
+ * The server fills the batch once; the instance list replicates to clients (the actor goes
+ * dormant after that) and both sides build the component from it. The component is created
+ * and filled before it is registered, so it can stay Static mobility even though it is spawned
+ * at runtime. Props named in the ScenePlan keep an id → instance lookup on the server.
+ */
+UCLASS(NotPlaceable, Transient)
+class HYPERMAGEVR_API AHMVRPropBatch : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AHMVRPropBatch();
+
+	/** Instances per batch actor; keeps the replicated array under net.MaxRepArrayMemory. */
+	static constexpr int32 MaxInstancesPerBatch = 512;
+
+	/** Server: set the batch contents and build the component. Ids may be empty or parallel to Instances. */
+	void InitBatch(UStaticMesh* InMesh, UMaterialInterface* InMaterial, const TOptional<FLinearColor>& InTint,
+		TArray<FHMVRPropInstance>&& InInstances, const TArray<FName>& InIds);
+
+	int32 GetInstanceCount() const { return Instances.Num(); }
+	UHierarchicalInstancedStaticMeshComponent* GetInstancer() const { return Instancer; }
+	UStaticMesh* GetMesh() const { return Mesh; }
+	UMaterialInterface* GetMaterial() const { return Material; }
+
+	/** Server: id of the prop at InstanceIndex (e.g. from a hit result's Item), or NAME_None. */
+	FName GetPropId(int32 InstanceIndex) const;
+
+	/** Server: locate a named prop across all batches in World. */
+	static bool FindProp(UWorld* World, FName PropId, AHMVRPropBatch*& OutBatch, int32& OutInstanceIndex);
+
+	/** Log batch, group, instance and remaining static mesh actor counts for World. */
+	static void DumpStats(UWorld* World);
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	UFUNCTION()
+	void OnRep_Batch();
+
+	void RebuildInstancer();
+
+	UPROPERTY(ReplicatedUsing = OnRep_Batch)
+	TObjectPtr<UStaticMesh> Mesh;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Batch)
+	TObjectPtr<UMaterialInterface> Material;
+
+	/** Applied to a "Color" parameter of a per-batch dynamic instance of Material. */
+	UPROPERTY(ReplicatedUsing = OnRep_Batch)
+	bool bTinted = false;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Batch)
+	FLinearColor Tint = FLinearColor::White;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Batch)
+	TArray<FHMVRPropInstance> Instances;
+
+	UPROPERTY()
+	TObjectPtr<UHierarchicalInstancedStaticMeshComponent> Instancer;
+
+	// Server-side lookup
+	TArray<FName> InstanceIds;
+	TMap<FName, int32> InstanceById;
+};
+
+/** A static prop to batch. */
+struct FHMVRPropDesc
+{
+	UStaticMesh* Mesh = nullptr;
+	UMaterialInterface* Material = nullptr;
+	TOptional<FLinearColor> Tint;
+	FTransform Transform;
+	FName Id;
+	/** Moves at runtime: never instanced; Build spawns it as a Movable AStaticMeshActor. */
+	bool bMovable = false;
+};
+
+/**
+ * Collects static props and turns them into AHMVRPropBatch actors: one group per distinct
+ * (mesh, material, tint), split into MaxInstancesPerBatch chunks. Movable props are left out
+ * of the groups and get an AStaticMeshActor each. Grouping is separate from spawning so it can
+ * be exercised without a world, and spawning can go one actor at a time (BeginBuild /
+ * BuildNext) so a caller can spread it over frames.
+ */
+class HYPERMAGEVR_API FHMVRPropBatcher
+{
+public:
+	void Add(const FHMVRPropDesc& Prop) { Pending.Add(Prop); }
+	int32 Num() const { return Pending.Num(); }
+
+	struct FGroup
+	{
+		/** Indices into the input, in input order. */
+		TArray<int32> Members;
+	};
+
+	/** Group Props by (mesh, material, tint) and chunk each group to MaxPerBatch members; props without a mesh or movable are skipped. Deterministic. */
+	static void GroupProps(TConstArrayView<FHMVRPropDesc> Props, int32 MaxPerBatch, TArray<FGroup>& OutBatches);
+
+	/** Server: spawn one batch actor per chunk and one actor per movable prop, and clear the pending list. Returns the batch actors spawned. */
+	int32 Build(UWorld* World);
+
+	/** Server: group the pending props for BuildNext. Returns the number of actors to spawn (batches, then movable props). */
+	int32 BeginBuild();
+
+	/** Server: spawn the next actor planned by BeginBuild. False once none remain (pending list cleared). */
+	bool BuildNext(UWorld* World);
+
+	/** BeginBuild was called and BuildNext has actors left to spawn. */
+	bool IsBuilding() const { return NextGroup < Groups.Num() + Movables.Num(); }
+
+	int32 GetBuiltInstances() const { return BuiltInstances; }
+	int32 GetBuiltBatches() const { return BuiltBatches; }
+	int32 GetBuiltMovables() const { return BuiltMovables; }
+
+private:
+	void SpawnMovable(UWorld* World, const FHMVRPropDesc& Prop);
+	void EndBuild();
+
+	TArray<FHMVRPropDesc> Pending;
+	int32 BuiltInstances = 0;
+	int32 BuiltBatches = 0;
+	int32 BuiltMovables = 0;
+
+	// Current build: NextGroup walks Groups, then Movables (indices into Pending)
+	TArray<FGroup> Groups;
+	TArray<int32> Movables;
+	int32 NextGroup = 0;
+	int32 BuildSpawned = 0;
+	int32 BuildInstanced = 0;
+	int32 BuildMovables = 0;
+};
@@ -0,0 +1,282 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRRetryScheduler.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarHttpRetryBaseMs(
+	TEXT("hmvr.Http.RetryBaseMs"), 500.f,
+	TEXT("Outbound HTTP: back-off ceiling for the first retry; doubles per attempt (full jitter below it)."));
+
+static TAutoConsoleVariable<float> CVarHttpRetryMaxMs(
+	TEXT("hmvr.Http.RetryMaxMs"), 16000.f,
+	TEXT("Outbound HTTP: upper bound on any single back-off ceiling."));
+
+static TAutoConsoleVariable<float> CVarHttpRetryBudgetRatio(
+	TEXT("hmvr.Http.RetryBudgetRatio"), 0.2f,
+	TEXT("Outbound HTTP: retry tokens earned per first attempt, per endpoint (0.2 = at most 20% extra load)."));
+
+static TAutoConsoleVariable<float> CVarHttpRetryBudgetMax(
+	TEXT("hmvr.Http.RetryBudgetMax"), 10.f,
+	TEXT("Outbound HTTP: maximum banked retry tokens per endpoint."));
+
+static TAutoConsoleVariable<int32> CVarHttpBreakerFailureThreshold(
+	TEXT("hmvr.Http.BreakerFailureThreshold"), 5,
+	TEXT("Outbound HTTP: consecutive transient failures that open an endpoint's circuit breaker."));
+
+static TAutoConsoleVariable<float> CVarHttpBreakerCooldownSeconds(
+	TEXT("hmvr.Http.BreakerCooldownSeconds"), 5.f,
+	TEXT("Outbound HTTP: initial open-breaker cooldown; doubles on each failed half-open probe."));
+
+static TAutoConsoleVariable<float> CVarHttpBreakerMaxCooldownSeconds(
+	TEXT("hmvr.Http.BreakerMaxCooldownSeconds"), 60.f,
+	TEXT("Outbound HTTP: upper bound on the open-breaker cooldown."));
+
+namespace
+{
+	constexpr double RetryRateWindowSeconds = 10.0;
+
+	// Budget every endpoint starts with, so a lone request on a fresh endpoint can still retry
+	constexpr double InitialRetryTokens = 3.0;
+
+	const TCHAR* BreakerStateName(EHMVRBreakerState State)
+	{
+		switch (State)
+		{
+		case EHMVRBreakerState::Closed:   return TEXT("closed");
+		case EHMVRBreakerState::Open:     return TEXT("OPEN");
+		case EHMVRBreakerState::HalfOpen: return TEXT("half-open");
+		default:                          return TEXT("?");
+		}
+	}
+}
+
+FHMVRRetryScheduler::FHMVRRetryScheduler()
+	: Wheel(/*TickSeconds=*/0.05, /*NumSlots=*/256) // 12.8 s per revolution
+{
+}
+
+FHMVRRetryScheduler::~FHMVRRetryScheduler()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+bool FHMVRRetryScheduler::IsTransientFailure(bool bConnectedSuccessfully, int32 ResponseCode)
+{
+	return !bConnectedSuccessfully || ResponseCode == 429 || ResponseCode >= 500;
+}
+
+// ── Circuit breaker ──────────────────────────────────────────────────────────
+
+FHMVRRetryScheduler::FEndpointState& FHMVRRetryScheduler::FindOrAddEndpoint(const FString& Endpoint)
+{
+	if (FEndpointState* Existing = Endpoints.Find(Endpoint))
+	{
+		return *Existing;
+	}
+	FEndpointState& State = Endpoints.Add(Endpoint);
+	State.BudgetTokens = InitialRetryTokens;
+	return State;
+}
+
+FHMVRRetryScheduler::EAdmission FHMVRRetryScheduler::Admit(const FString& Endpoint)
+{
+	FEndpointState* State = Endpoints.Find(Endpoint);
+	if (!State || State->State == EHMVRBreakerState::Closed)
+	{
+		return EAdmission::Allow;
+	}
+
+	if (State->State == EHMVRBreakerState::Open)
+	{
+		if (FPlatformTime::Seconds() < State->OpenUntil)
+		{
+			return EAdmission::ShortCircuit;
+		}
+		State->State = EHMVRBreakerState::HalfOpen;
+		UE_LOG(LogTemp, Log, TEXT("RetryScheduler: %s breaker half-open — sending probe"), *Endpoint);
+	}
+
+	// Half-open: exactly one probe at a time
+	if (State->bProbeInFlight)
+	{
+		return EAdmission::Wait;
+	}
+	State->bProbeInFlight = true;
+	return EAdmission::Allow;
+}
+
+double FHMVRRetryScheduler::GetOpenSecondsRemaining(const FString& Endpoint) const
+{
+	const FEndpointState* State = Endpoints.Find(Endpoint);
+	if (!State || State->State != EHMVRBreakerState::Open)
+	{
+		return 0.0;
+	}
+	return FMath::Max(0.0, State->OpenUntil - FPlatformTime::Seconds());
+}
+
+EHMVRBreakerState FHMVRRetryScheduler::GetBreakerState(const FString& Endpoint) const
+{
+	const FEndpointState* State = Endpoints.Find(Endpoint);
+	return State ? State->State : EHMVRBreakerState::Closed;
+}
+
+void FHMVRRetryScheduler::RecordResult(const FString& Endpoint, bool bTransientFailure)
+{
+	FEndpointState& State = FindOrAddEndpoint(Endpoint);
+	const double Now = FPlatformTime::Seconds();
+
+	if (State.State == EHMVRBreakerState::HalfOpen && State.bProbeInFlight)
+	{
+		State.bProbeInFlight = false;
+		if (bTransientFailure)
+		{
+			State.CooldownSeconds = FMath::Min(State.CooldownSeconds * 2.0,
+				static_cast<double>(CVarHttpBreakerMaxCooldownSeconds.GetValueOnGameThread()));
+			Trip(State, Endpoint, Now);
+		}
+		else
+		{
+			State.State = EHMVRBreakerState::Closed;
+			State.ConsecutiveFailures = 0;
+			State.CooldownSeconds = 0.0;
+			UE_LOG(LogTemp, Log, TEXT("RetryScheduler: %s breaker closed"), *Endpoint);
+		}
+		return;
+	}
+
+	if (!bTransientFailure)
+	{
+		State.ConsecutiveFailures = 0;
+		return;
+	}
+
+	// Requests already in flight when the breaker opened still report back; ignore them
+	if (State.State != EHMVRBreakerState::Closed)
+	{
+		return;
+	}
+
+	if (++State.ConsecutiveFailures >= FMath::Max(1, CVarHttpBreakerFailureThreshold.GetValueOnGameThread()))
+	{
+		State.CooldownSeconds = CVarHttpBreakerCooldownSeconds.GetValueOnGameThread();
+		Trip(State, Endpoint, Now);
+	}
+}
+
+void FHMVRRetryScheduler::Trip(FEndpointState& State, const FString& Endpoint, double Now)
+{
+	State.State = EHMVRBreakerState::Open;
+	State.OpenUntil = Now + State.CooldownSeconds;
+	++Stats.BreakerTrips;
+	UE_LOG(LogTemp, Warning, TEXT("RetryScheduler: %s breaker OPEN for %.1fs after %d consecutive failures"),
+		*Endpoint, State.CooldownSeconds, State.ConsecutiveFailures);
+}
+
+// ── Retry budget and scheduling ──────────────────────────────────────────────
+
+void FHMVRRetryScheduler::NoteFirstAttempt(const FString& Endpoint)
+{
+	FEndpointState& State = FindOrAddEndpoint(Endpoint);
+	State.BudgetTokens = FMath::Min(State.BudgetTokens + CVarHttpRetryBudgetRatio.GetValueOnGameThread(),
+		static_cast<double>(CVarHttpRetryBudgetMax.GetValueOnGameThread()));
+}
+
+bool FHMVRRetryScheduler::ScheduleRetry(const FString& Endpoint, int32 Attempt, TFunction<void()> Retry)
+{
+	FEndpointState& State = FindOrAddEndpoint(Endpoint);
+	if (State.BudgetTokens < 1.0)
+	{
+		++Stats.RetriesDeniedByBudget;
+		UE_LOG(LogTemp, Verbose, TEXT("RetryScheduler: %s retry budget exhausted"), *Endpoint);
+		return false;
+	}
+	State.BudgetTokens -= 1.0;
+
+	const double CeilingMs = FMath::Min(
+		static_cast<double>(CVarHttpRetryBaseMs.GetValueOnGameThread()) * FMath::Pow(2.0, static_cast<double>(FMath::Clamp(Attempt, 0, 16))),
+		static_cast<double>(CVarHttpRetryMaxMs.GetValueOnGameThread()));
+	const double DelaySeconds = FMath::FRandRange(0.0, CeilingMs) / 1000.0;
+
+	const double Now = FPlatformTime::Seconds();
+	while (RecentRetryTimes.Num() > 0 && RecentRetryTimes[0] < Now - RetryRateWindowSeconds)
+	{
+		RecentRetryTimes.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+	RecentRetryTimes.Add(Now);
+	++Stats.RetriesScheduled;
+
+	ScheduleAfter(DelaySeconds, MoveTemp(Retry));
+	return true;
+}
+
+void FHMVRRetryScheduler::ScheduleAfter(double DelaySeconds, TFunction<void()> Callback)
+{
+	Wheel.Schedule(FPlatformTime::Seconds(), DelaySeconds, MoveTemp(Callback));
+	EnsureTicker();
+}
+
+void FHMVRRetryScheduler::EnsureTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FHMVRRetryScheduler::Tick));
+	}
+}
+
+bool FHMVRRetryScheduler::Tick(float /*DeltaTime*/)
+{
+	Wheel.Advance(FPlatformTime::Seconds(), [](TFunction<void()>&& Callback)
+	{
+		Callback();
+	});
+
+	if (Wheel.IsEmpty())
+	{
+		TickerHandle.Reset();
+		return false; // re-registered by the next ScheduleAfter
+	}
+	return true;
+}
+
+void FHMVRRetryScheduler::Reset()
+{
+	Wheel.Reset();
+	Endpoints.Empty();
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+// ── Metrics ──────────────────────────────────────────────────────────────────
+
+double FHMVRRetryScheduler::GetRetriesPerSecond() const
+{
+	const double Cutoff = FPlatformTime::Seconds() - RetryRateWindowSeconds;
+	int32 Recent = 0;
+	for (int32 i = RecentRetryTimes.Num() - 1; i >= 0 && RecentRetryTimes[i] >= Cutoff; --i)
+	{
+		++Recent;
+	}
+	return Recent / RetryRateWindowSeconds;
+}
+
+void FHMVRRetryScheduler::DumpStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("RetryScheduler: %.2f retries/s, %d pending, %lld scheduled, %lld denied by budget, %lld short-circuited, %lld breaker trips"),
+		GetRetriesPerSecond(), Wheel.Num(), Stats.RetriesScheduled, Stats.RetriesDeniedByBudget,
+		Stats.ShortCircuited, Stats.BreakerTrips);
+
+	for (const TPair<FString, FEndpointState>& Pair : Endpoints)
+	{
+		UE_LOG(LogTemp, Log, TEXT("RetryScheduler:   %-40s breaker %-9s failures %d budget %.1f"),
+			*Pair.Key, BreakerStateName(Pair.Value.State), Pair.Value.ConsecutiveFailures, Pair.Value.BudgetTokens);
+	}
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HMVRTimingWheel.h"
+
+enum class EHMVRBreakerState : uint8
+{
+	Closed,    // normal operation
+	Open,      // failing — requests are short-circuited until the cooldown elapses
+	HalfOpen   // cooldown elapsed — one probe request decides Closed vs Open
+};
+
+/**
+ * Retry timing, retry budgets and circuit breakers for outbound API traffic.
+ *
+ * Owned by FHMVRHttpDispatcher; callers opt in per request with FHMVRRetryPolicy.
+ *   - Back-off is "full jitter": delay = rand(0, min(RetryMaxMs, RetryBaseMs * 2^attempt)),
+ *     so shards that failed together do not retry together.
+ *   - Every pending retry lives in one THMVRTimingWheel driven by a single FTSTicker.
+ *   - Each endpoint (request host) has a retry budget: first attempts deposit
+ *     hmvr.Http.RetryBudgetRatio tokens, each retry spends one. An outage therefore adds at
+ *     most that fraction of extra load instead of multiplying it by MaxRetries.
+ *   - Each endpoint has a circuit breaker that opens after hmvr.Http.BreakerFailureThreshold
+ *     consecutive transient failures (network error, 429, 5xx) and half-opens after a cooldown
+ *     that doubles on every failed probe.
+ *
+ * Game thread only. Retries/sec and breaker state are printed by HMVR.Http.Stats.
+ */
+class HYPERMAGEVR_API FHMVRRetryScheduler
+{
+public:
+	/** Dispatch decision for a request about to leave the queue. */
+	enum class EAdmission : uint8
+	{
+		Allow,         // send now
+		Wait,          // half-open probe already in flight; leave queued
+		ShortCircuit   // breaker open; do not send
+	};
+
+	struct FStats
+	{
+		int64 RetriesScheduled = 0;
+		int64 RetriesDeniedByBudget = 0;
+		int64 ShortCircuited = 0;
+		int64 BreakerTrips = 0;
+	};
+
+	FHMVRRetryScheduler();
+	~FHMVRRetryScheduler();
+
+	EAdmission Admit(const FString& Endpoint);
+
+	/** Seconds until an open breaker half-opens (0 when not open). */
+	double GetOpenSecondsRemaining(const FString& Endpoint) const;
+
+	EHMVRBreakerState GetBreakerState(const FString& Endpoint) const;
+
+	/** Record a first attempt so the endpoint's retry budget accrues. */
+	void NoteFirstAttempt(const FString& Endpoint);
+
+	/** Feed a completed request into the endpoint's breaker. */
+	void RecordResult(const FString& Endpoint, bool bTransientFailure);
+
+	/**
+	 * Spend retry budget and schedule Retry after a full-jitter back-off for the given
+	 * attempt number (0 = first retry). Returns false when the budget is exhausted.
+	 */
+	bool ScheduleRetry(const FString& Endpoint, int32 Attempt, TFunction<void()> Retry);
+
+	/** Schedule Callback after DelaySeconds without touching any budget. */
+	void ScheduleAfter(double DelaySeconds, TFunction<void()> Callback);
+
+	void NoteShortCircuit() { ++Stats.ShortCircuited; }
+
+	/** Drop all pending retries and breaker state. */
+	void Reset();
+
+	int32 GetNumPendingRetries() const { return Wheel.Num(); }
+	double GetRetriesPerSecond() const;
+
+	const FStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats = FStats(); RecentRetryTimes.Reset(); }
+	void DumpStats() const;
+
+	/** Retry-worthy outcome: network error, HTTP 429 or HTTP 5xx. */
+	static bool IsTransientFailure(bool bConnectedSuccessfully, int32 ResponseCode);
+
+private:
+	struct FEndpointState
+	{
+		EHMVRBreakerState State = EHMVRBreakerState::Closed;
+		int32 ConsecutiveFailures = 0;
+		double OpenUntil = 0.0;
+		double CooldownSeconds = 0.0;
+		bool bProbeInFlight = false;
+		double BudgetTokens = 0.0;
+	};
+
+	FEndpointState& FindOrAddEndpoint(const FString& Endpoint);
+	void Trip(FEndpointState& State, const FString& Endpoint, double Now);
+	void EnsureTicker();
+	bool Tick(float DeltaTime);
+
+	THMVRTimingWheel<TFunction<void()>> Wheel;
+	FTSTicker::FDelegateHandle TickerHandle;
+	TMap<FString, FEndpointState> Endpoints;
+
+	/** Retry timestamps inside the rate window, for retries/sec. */
+	TArray<double> RecentRetryTimes;
+	FStats Stats;
+};
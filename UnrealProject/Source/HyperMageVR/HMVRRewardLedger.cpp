@@ -0,0 +1,702 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRRewardLedger.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Memory/MemoryView.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+static TAutoConsoleVariable<float> CVarLedgerFlushInterval(
+	TEXT("hmvr.Ledger.FlushIntervalSeconds"),
+	0.5f,
+	TEXT("How often pending reward grants are uploaded."));
+
+static TAutoConsoleVariable<int32> CVarLedgerBatchSize(
+	TEXT("hmvr.Ledger.BatchSize"),
+	50,
+	TEXT("Reward grants per POST /player-rewards/batch."));
+
+static TAutoConsoleVariable<float> CVarLedgerBatchTimeout(
+	TEXT("hmvr.Ledger.BatchTimeoutSeconds"),
+	120.f,
+	TEXT("A grant batch with no outcome after this long counts as failed and its grants are queued again."));
+
+static TAutoConsoleVariable<int32> CVarLedgerMaxInFlight(
+	TEXT("hmvr.Ledger.MaxInFlightBatches"),
+	2,
+	TEXT("Grant batches awaiting the Session API before the ledger stops sending more."));
+
+static TAutoConsoleVariable<int32> CVarLedgerCompactAfterAcks(
+	TEXT("hmvr.Ledger.CompactAfterAcks"),
+	5000,
+	TEXT("Rewrite the ledger log with only unacknowledged grants after this many acknowledgements."));
+
+static TAutoConsoleVariable<int32> CVarLedgerMaxAttempts(
+	TEXT("hmvr.Ledger.MaxAttempts"),
+	50,
+	TEXT("Failed batches a grant can be in before it is moved to the dead-letter file (0 = retry forever)."));
+
+static TAutoConsoleVariable<int32> CVarLedgerMaxDedupPairs(
+	TEXT("hmvr.Ledger.MaxDedupPairs"),
+	200000,
+	TEXT("(player, reward) pairs remembered for duplicate refusal before the set is rebuilt from unacknowledged grants."));
+
+static TAutoConsoleVariable<int32> CVarLedgerBloomBits(
+	TEXT("hmvr.Ledger.BloomBits"),
+	1 << 20,
+	TEXT("Bloom filter size in front of the ledger's duplicate set (read at construction; doubled when it fills past 10 bits per grant)."));
+
+namespace
+{
+	constexpr int32 MaxTimedOutBatches = 64;
+
+	enum class ELedgerRecord : uint8
+	{
+		Grant = 1,
+		Ack = 2
+	};
+
+	// [uint32 PayloadSize][uint32 PayloadCrc][payload]
+	template <typename WriteFnType>
+	void AppendRecord(TArray<uint8>& Out, WriteFnType&& WritePayload)
+	{
+		const int32 HeaderAt = Out.Num();
+		Out.AddZeroed(2 * sizeof(uint32));
+		FMemoryWriter Ar(Out);
+		Ar.Seek(Out.Num());
+		WritePayload(Ar);
+
+		const uint32 Size = static_cast<uint32>(Out.Num() - HeaderAt - 2 * sizeof(uint32));
+		const uint32 Crc = FCrc::MemCrc32(Out.GetData() + HeaderAt + 2 * sizeof(uint32), Size);
+		FMemory::Memcpy(Out.GetData() + HeaderAt, &Size, sizeof(uint32));
+		FMemory::Memcpy(Out.GetData() + HeaderAt + sizeof(uint32), &Crc, sizeof(uint32));
+	}
+
+	void AppendGrantRecord(TArray<uint8>& Out, FHMVRId Key, FString PlayerId, FString RewardId, const FDateTime& GrantedAt)
+	{
+		AppendRecord(Out, [&](FArchive& Ar)
+		{
+			uint8 Type = static_cast<uint8>(ELedgerRecord::Grant);
+			int64 Ticks = GrantedAt.GetTicks();
+			Ar << Type << Key.Hi << Key.Lo << PlayerId << RewardId << Ticks;
+		});
+	}
+
+	void AppendAckRecord(TArray<uint8>& Out, FHMVRId Key)
+	{
+		AppendRecord(Out, [&](FArchive& Ar)
+		{
+			uint8 Type = static_cast<uint8>(ELedgerRecord::Ack);
+			Ar << Type << Key.Hi << Key.Lo;
+		});
+	}
+
+	FString DedupKey(const FString& PlayerId, const FString& RewardId)
+	{
+		return PlayerId + TEXT("\n") + RewardId;
+	}
+}
+
+uint64 FHMVRRewardLedger::FDedupKeyFuncs::Hash(const FString& Key)
+{
+	return CityHash64(reinterpret_cast<const char*>(*Key), Key.Len() * sizeof(TCHAR));
+}
+
+FHMVRRewardLedger::FHMVRRewardLedger(const FString& InDirectory)
+	: Directory(InDirectory)
+	, LogPath(FPaths::Combine(InDirectory, TEXT("RewardLedger.log")))
+	, DeadLetterPath(FPaths::Combine(InDirectory, TEXT("RewardLedger.deadletter")))
+	, Bloom(static_cast<uint32>(FMath::Max(1024, CVarLedgerBloomBits.GetValueOnAnyThread())))
+{
+}
+
+FHMVRRewardLedger::~FHMVRRewardLedger()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+FString FHMVRRewardLedger::GetDefaultDirectory(int32 Port)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RewardLedger"), FString::Printf(TEXT("Port_%d"), Port));
+}
+
+bool FHMVRRewardLedger::Open(FString& OutError)
+{
+	check(!LogFile.IsValid());
+	const double StartTime = FPlatformTime::Seconds();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Directory);
+
+	// A crash between compaction's delete and rename leaves only the rewritten copy
+	const FString CompactPath = LogPath + TEXT(".compact");
+	if (!PlatformFile.FileExists(*LogPath) && PlatformFile.FileExists(*CompactPath))
+	{
+		PlatformFile.MoveFile(*LogPath, *CompactPath);
+	}
+
+	TArray<uint8> Data;
+	if (PlatformFile.FileExists(*LogPath) && !FFileHelper::LoadFileToArray(Data, *LogPath))
+	{
+		OutError = FString::Printf(TEXT("Could not read %s"), *LogPath);
+		return false;
+	}
+
+	// Grants minus acks; a torn tail (crash mid-append) ends the replay
+	int64 Offset = 0;
+	int32 Records = 0;
+	while (Offset + 2 * static_cast<int64>(sizeof(uint32)) <= Data.Num())
+	{
+		uint32 Size = 0;
+		uint32 Crc = 0;
+		FMemory::Memcpy(&Size, Data.GetData() + Offset, sizeof(uint32));
+		FMemory::Memcpy(&Crc, Data.GetData() + Offset + sizeof(uint32), sizeof(uint32));
+		const uint8* Payload = Data.GetData() + Offset + 2 * sizeof(uint32);
+		if (Offset + 2 * sizeof(uint32) + Size > static_cast<uint64>(Data.Num()) || FCrc::MemCrc32(Payload, Size) != Crc)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRRewardLedger: Torn record at byte %lld of %s - replay stops there"), Offset, *LogPath);
+			break;
+		}
+
+		FMemoryReaderView Ar(MakeMemoryView(Payload, Size));
+		uint8 Type = 0;
+		FHMVRId Key;
+		Ar << Type << Key.Hi << Key.Lo;
+		if (Type == static_cast<uint8>(ELedgerRecord::Grant))
+		{
+			FEntry Entry;
+			int64 Ticks = 0;
+			Ar << Entry.PlayerId << Entry.RewardId << Ticks;
+			Entry.Key = Key;
+			Entry.GrantedAt = FDateTime(Ticks);
+			if (!Ar.IsError())
+			{
+				Unacked.Add(Key, MoveTemp(Entry));
+			}
+		}
+		else if (Type == static_cast<uint8>(ELedgerRecord::Ack))
+		{
+			Unacked.Remove(Key);
+		}
+
+		Offset += 2 * sizeof(uint32) + Size;
+		++Records;
+	}
+
+	// Upload in grant order under the original keys
+	Unacked.KeySort([](const FHMVRId& A, const FHMVRId& B) { return A < B; });
+	for (const TPair<FHMVRId, FEntry>& Pair : Unacked)
+	{
+		AddDedupKey(Pair.Value.PlayerId, Pair.Value.RewardId);
+		SendQueue.Add(Pair.Key);
+	}
+	Stats.Replayed = Unacked.Num();
+
+	if (!Compact(OutError))
+	{
+		return false;
+	}
+
+	Stats.ReplayMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	if (Records > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HMVRRewardLedger: Replayed %d records from %s - %d grants unacknowledged, re-sending (%.2f ms)"),
+			Records, *LogPath, Unacked.Num(), Stats.ReplayMs);
+	}
+	return true;
+}
+
+void FHMVRRewardLedger::Start(FSendFn InSend)
+{
+	Send = MoveTemp(InSend);
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FHMVRRewardLedger::Tick),
+			FMath::Max(0.01f, CVarLedgerFlushInterval.GetValueOnGameThread()));
+	}
+}
+
+bool FHMVRRewardLedger::Append(const FString& PlayerId, const FString& RewardId)
+{
+	check(IsInGameThread());
+	if (!LogFile.IsValid())
+	{
+		return false;
+	}
+	if (!AddDedupKey(PlayerId, RewardId))
+	{
+		++Stats.Duplicates;
+		return false;
+	}
+
+	FEntry Entry;
+	Entry.Key = FHMVRId::Generate();
+	Entry.PlayerId = PlayerId;
+	Entry.RewardId = RewardId;
+	Entry.GrantedAt = FDateTime::UtcNow();
+
+	// On disk before it counts as granted
+	Scratch.Reset();
+	AppendGrantRecord(Scratch, Entry.Key, PlayerId, RewardId, Entry.GrantedAt);
+	if (!WriteRecords(Scratch))
+	{
+		Granted.Remove(DedupKey(PlayerId, RewardId));
+		return false;
+	}
+
+	SendQueue.Add(Entry.Key);
+	Unacked.Add(Entry.Key, MoveTemp(Entry));
+	++Stats.Appended;
+	return true;
+}
+
+void FHMVRRewardLedger::Flush()
+{
+	SendBatches(true);
+}
+
+bool FHMVRRewardLedger::Tick(float /*DeltaTime*/)
+{
+	ExpireInFlight();
+	SendBatches(false);
+	return true;
+}
+
+void FHMVRRewardLedger::ExpireInFlight()
+{
+	const double Now = FPlatformTime::Seconds();
+	TArray<uint32> Lapsed;
+	for (const TPair<uint32, FInFlightBatch>& Entry : InFlight)
+	{
+		if (Now >= Entry.Value.Deadline)
+		{
+			Lapsed.Add(Entry.Key);
+		}
+	}
+	for (uint32 BatchId : Lapsed)
+	{
+		TimedOut.Add(BatchId, InFlight[BatchId].Keys);
+		++Stats.BatchTimeouts;
+		OnBatchDone(BatchId, EBatchOutcome::Failed);
+	}
+
+	// Batch ids only grow, so the smallest is the oldest
+	while (TimedOut.Num() > MaxTimedOutBatches)
+	{
+		uint32 Oldest = MAX_uint32;
+		for (const TPair<uint32, TArray<FHMVRId>>& Entry : TimedOut)
+		{
+			Oldest = FMath::Min(Oldest, Entry.Key);
+		}
+		TimedOut.Remove(Oldest);
+	}
+}
+
+void FHMVRRewardLedger::SendBatches(bool bIgnoreInFlightCap)
+{
+	check(IsInGameThread());
+	const int32 BatchSize = FMath::Max(1, CVarLedgerBatchSize.GetValueOnGameThread());
+	const int32 MaxInFlight = FMath::Max(1, CVarLedgerMaxInFlight.GetValueOnGameThread());
+
+	while (bIgnoreInFlightCap || InFlight.Num() < MaxInFlight)
+	{
+		TArray<FHMVRId> Keys;
+		FString Body;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Body);
+		Writer->WriteObjectStart();
+		Writer->WriteArrayStart(TEXT("grants"));
+		while (Keys.Num() < BatchSize && SendHead < SendQueue.Num())
+		{
+			const FHMVRId Key = SendQueue[SendHead++];
+			FEntry* Entry = Unacked.Find(Key);
+			if (!Entry || Entry->bInFlight)
+			{
+				continue;
+			}
+			Entry->bInFlight = true;
+			Keys.Add(Key);
+
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("idempotencyKey"), Key.ToString());
+			Writer->WriteValue(TEXT("playerId"), Entry->PlayerId);
+			Writer->WriteValue(TEXT("rewardId"), Entry->RewardId);
+			Writer->WriteValue(TEXT("grantedAt"), Entry->GrantedAt.ToIso8601());
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		// Drop the consumed head of the queue now and then instead of on every pop
+		if (SendHead >= 1024 && SendHead * 2 >= SendQueue.Num())
+		{
+			SendQueue.RemoveAt(0, SendHead, EAllowShrinking::No);
+			SendHead = 0;
+		}
+		if (Keys.Num() == 0)
+		{
+			return;
+		}
+
+		const uint32 BatchId = NextBatchId++;
+		const int32 NumGrants = Keys.Num();
+		FInFlightBatch& Batch = InFlight.Add(BatchId);
+		Batch.Keys = MoveTemp(Keys);
+		Batch.Deadline = FPlatformTime::Seconds() + FMath::Max(1.f, CVarLedgerBatchTimeout.GetValueOnGameThread());
+		++Stats.Batches;
+		Stats.BytesUploaded += FTCHARToUTF8(*Body).Length();
+		Stats.GrantsUploaded += NumGrants;
+
+		TWeakPtr<FHMVRRewardLedger> WeakThis = AsShared();
+		auto OnDone = [WeakThis, BatchId](EBatchOutcome Outcome)
+		{
+			if (TSharedPtr<FHMVRRewardLedger> This = WeakThis.Pin())
+			{
+				This->OnBatchDone(BatchId, Outcome);
+			}
+		};
+		if (!Send || !Send(Body, NumGrants, OnDone))
+		{
+			OnBatchDone(BatchId, EBatchOutcome::Failed);
+			return; // queued again; next tick
+		}
+	}
+}
+
+void FHMVRRewardLedger::OnBatchDone(uint32 BatchId, EBatchOutcome Outcome)
+{
+	FInFlightBatch Batch;
+	if (!InFlight.RemoveAndCopyValue(BatchId, Batch))
+	{
+		// Timed out earlier and its grants were queued again; a late success still lands them
+		TArray<FHMVRId> LateKeys;
+		if (TimedOut.RemoveAndCopyValue(BatchId, LateKeys) && Outcome == EBatchOutcome::Accepted)
+		{
+			LateKeys.RemoveAll([this](const FHMVRId& Key) { return !Unacked.Contains(Key); });
+			Stats.LateAcknowledged += LateKeys.Num();
+			Acknowledge(LateKeys);
+		}
+		return;
+	}
+	const TArray<FHMVRId>& Keys = Batch.Keys;
+
+	if (Outcome == EBatchOutcome::Rejected)
+	{
+		++Stats.BatchFailures;
+		DeadLetter(Keys, TEXT("rejected by the API"));
+		return;
+	}
+	if (Outcome == EBatchOutcome::Failed)
+	{
+		++Stats.BatchFailures;
+		const int32 MaxAttempts = CVarLedgerMaxAttempts.GetValueOnGameThread();
+		TArray<FHMVRId> Exhausted;
+		for (const FHMVRId& Key : Keys)
+		{
+			if (FEntry* Entry = Unacked.Find(Key))
+			{
+				Entry->bInFlight = false;
+				if (MaxAttempts > 0 && ++Entry->Attempts >= MaxAttempts)
+				{
+					Exhausted.Add(Key);
+				}
+				else
+				{
+					SendQueue.Add(Key);
+				}
+			}
+		}
+		UE_LOG(LogTemp, Warning, TEXT("HMVRRewardLedger: Batch of %d grants not accepted - queued again (%d pending)"),
+			Keys.Num() - Exhausted.Num(), Unacked.Num() - Exhausted.Num());
+		if (Exhausted.Num() > 0)
+		{
+			DeadLetter(Exhausted, TEXT("out of attempts"));
+		}
+		return;
+	}
+
+	Acknowledge(Keys);
+}
+
+void FHMVRRewardLedger::Acknowledge(const TArray<FHMVRId>& Keys)
+{
+	if (Keys.Num() == 0)
+	{
+		return;
+	}
+
+	// A key re-sent after a timeout may still be in another batch; that batch finds it gone
+	Scratch.Reset();
+	for (const FHMVRId& Key : Keys)
+	{
+		AppendAckRecord(Scratch, Key);
+		Unacked.Remove(Key);
+	}
+	WriteRecords(Scratch); // a lost ack only means the backend sees the key again and drops it
+	Stats.Acknowledged += Keys.Num();
+	AcksSinceCompact += Keys.Num();
+
+	if (AcksSinceCompact >= FMath::Max(1, CVarLedgerCompactAfterAcks.GetValueOnGameThread()))
+	{
+		FString Error;
+		if (!Compact(Error))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRRewardLedger: Compaction failed: %s"), *Error);
+		}
+	}
+}
+
+void FHMVRRewardLedger::DeadLetter(const TArray<FHMVRId>& Keys, const TCHAR* Reason)
+{
+	// Grant records go to the dead-letter file (replayable by hand: it is a ledger log), then
+	// acks to the log so replay and compaction drop them. Kept in the log if the file cannot be written.
+	TArray<uint8> Records;
+	Scratch.Reset();
+	for (const FHMVRId& Key : Keys)
+	{
+		if (const FEntry* Entry = Unacked.Find(Key))
+		{
+			AppendGrantRecord(Records, Key, Entry->PlayerId, Entry->RewardId, Entry->GrantedAt);
+			AppendAckRecord(Scratch, Key);
+		}
+	}
+	if (Records.Num() == 0)
+	{
+		return;
+	}
+	if (!FFileHelper::SaveArrayToFile(Records, *DeadLetterPath, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRRewardLedger: Could not write %d grants to %s - left in the log"), Keys.Num(), *DeadLetterPath);
+		return;
+	}
+
+	WriteRecords(Scratch);
+	for (const FHMVRId& Key : Keys)
+	{
+		Unacked.Remove(Key);
+	}
+	Stats.DeadLettered += Keys.Num();
+	AcksSinceCompact += Keys.Num();
+	UE_LOG(LogTemp, Error, TEXT("HMVRRewardLedger: %d grants %s - moved to %s (%d pending)"),
+		Keys.Num(), Reason, *DeadLetterPath, Unacked.Num());
+}
+
+bool FHMVRRewardLedger::WriteRecords(const TArray<uint8>& Records)
+{
+	if (!LogFile.IsValid() || !LogFile->Write(Records.GetData(), Records.Num()))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRRewardLedger: Could not append %d bytes to %s"), Records.Num(), *LogPath);
+		return false;
+	}
+	Stats.LogBytes += Records.Num();
+	return true;
+}
+
+bool FHMVRRewardLedger::Compact(FString& OutError)
+{
+	Scratch.Reset();
+	for (const TPair<FHMVRId, FEntry>& Pair : Unacked)
+	{
+		AppendGrantRecord(Scratch, Pair.Key, Pair.Value.PlayerId, Pair.Value.RewardId, Pair.Value.GrantedAt);
+	}
+
+	// Write aside, then swap in, so a crash mid-compaction leaves one complete log
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString CompactPath = LogPath + TEXT(".compact");
+	LogFile.Reset();
+	if (!FFileHelper::SaveArrayToFile(Scratch, *CompactPath)
+		|| (PlatformFile.FileExists(*LogPath) && !PlatformFile.DeleteFile(*LogPath))
+		|| !PlatformFile.MoveFile(*LogPath, *CompactPath))
+	{
+		OutError = FString::Printf(TEXT("Could not rewrite %s"), *LogPath);
+	}
+
+	LogFile.Reset(PlatformFile.OpenWrite(*LogPath, /*bAppend=*/true));
+	if (!LogFile.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Could not open %s for appending"), *LogPath);
+		return false;
+	}
+
+	Stats.LogBytes = LogFile->Size();
+	AcksSinceCompact = 0;
+	++Stats.Compactions;
+	return OutError.IsEmpty();
+}
+
+void FHMVRRewardLedger::ResetDedup()
+{
+	// Unacknowledged pairs stay so a grant still on its way is never appended twice under two keys
+	Granted.Reset();
+	Bloom.Reset();
+	for (const TPair<FHMVRId, FEntry>& Pair : Unacked)
+	{
+		FString Key = DedupKey(Pair.Value.PlayerId, Pair.Value.RewardId);
+		const uint64 Hash = FDedupKeyFuncs::Hash(Key);
+		if (!Granted.ContainsByHash(FDedupKeyFuncs::SetHash(Hash), Key))
+		{
+			Granted.AddByHash(FDedupKeyFuncs::SetHash(Hash), MoveTemp(Key));
+			Bloom.Add(Hash);
+		}
+	}
+	++Stats.DedupResets;
+	UE_LOG(LogTemp, Log, TEXT("HMVRRewardLedger: Duplicate set reached hmvr.Ledger.MaxDedupPairs - rebuilt from %d unacknowledged grants"),
+		Granted.Num());
+}
+
+bool FHMVRRewardLedger::AddDedupKey(const FString& PlayerId, const FString& RewardId)
+{
+	// Never below twice the pending count, or a large backlog would rebuild on every append
+	if (Granted.Num() >= FMath::Max(CVarLedgerMaxDedupPairs.GetValueOnAnyThread(), 2 * Unacked.Num()))
+	{
+		ResetDedup();
+	}
+
+	FString Key = DedupKey(PlayerId, RewardId);
+	const uint64 Hash = FDedupKeyFuncs::Hash(Key);
+	const uint32 SetHash = FDedupKeyFuncs::SetHash(Hash);
+	if (Bloom.MayContain(Hash))
+	{
+		if (Granted.ContainsByHash(SetHash, Key))
+		{
+			return false;
+		}
+		++Stats.BloomFalsePositives;
+		Granted.AddByHash(SetHash, MoveTemp(Key));
+		return true; // the filter already has its bits
+	}
+
+	// Never added, so no probe: with duplicate keys allowed the set just links it in
+	++Stats.BloomNegatives;
+	Granted.AddByHash(SetHash, MoveTemp(Key));
+	Bloom.Add(Hash);
+
+	// Past ~10 bits per key the false-positive rate climbs; rebuild twice the size from the exact set
+	if (static_cast<int64>(Granted.Num()) * 10 > Bloom.GetNumBits())
+	{
+		Bloom = FHMVRBloomFilter(Bloom.GetNumBits() * 2);
+		for (const FString& Existing : Granted)
+		{
+			Bloom.Add(FDedupKeyFuncs::Hash(Existing));
+		}
+	}
+	return true;
+}
+
+void FHMVRRewardLedger::LogStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRRewardLedger: %lld appended, %lld acknowledged, %d pending (%d batches in flight), %lld replayed; %lld duplicates refused; bloom %u bits, %lld admitted by the filter alone, %lld false positives (est. rate %.4f%%); %lld batches (%lld failed, %lld timed out, %lld grants acknowledged late, %lld grants dead-lettered), %d duplicate-set resets, %lld grants / %lld bytes uploaded (%.1f bytes per grant); log %lld bytes, %d compactions"),
+		Stats.Appended, Stats.Acknowledged, Unacked.Num(), InFlight.Num(), Stats.Replayed, Stats.Duplicates,
+		Bloom.GetNumBits(), Stats.BloomNegatives, Stats.BloomFalsePositives, Bloom.EstimateFalsePositiveRate() * 100.0,
+		Stats.Batches, Stats.BatchFailures, Stats.BatchTimeouts, Stats.LateAcknowledged, Stats.DeadLettered, Stats.DedupResets, Stats.GrantsUploaded, Stats.BytesUploaded,
+		Stats.GrantsUploaded > 0 ? static_cast<double>(Stats.BytesUploaded) / Stats.GrantsUploaded : 0.0,
+		Stats.LogBytes, Stats.Compactions);
+}
+
+#if !UE_BUILD_SHIPPING
+// Throughput and wire cost on a private ledger with an in-process sender (no HTTP): grants/sec
+// through Append (dedup + durable append), duplicate refusal, upload bytes per grant, and a
+// crash replay (grants never acknowledged come back under their keys)
+static FAutoConsoleCommandWithArgs CmdLedgerBench(
+	TEXT("HMVR.Ledger.Bench"),
+	TEXT("HMVR.Ledger.Bench [Grants=100000] [RewardsPerPlayer=10] — reward ledger grants/sec, duplicate refusal, upload bytes per grant and replay."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumGrants = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+		const int32 PerPlayer = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+		const FString Directory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RewardLedger"),
+			TEXT("Bench_") + FHMVRId::Generate().ToString().Right(8));
+
+		auto Grant = [PerPlayer](int32 i, FString& OutPlayer, FString& OutReward)
+		{
+			OutPlayer = FString::Printf(TEXT("bench-player-%d"), i / PerPlayer);
+			OutReward = FString::Printf(TEXT("reward-%d"), i % PerPlayer);
+		};
+
+		FString Error;
+		FString PlayerId, RewardId;
+		bool bOk = true;
+		{
+			TSharedRef<FHMVRRewardLedger> Ledger = MakeShared<FHMVRRewardLedger>(Directory);
+			bOk &= Ledger->Open(Error);
+			Ledger->Start([](const FString&, int32, TFunction<void(EBatchOutcome)> OnDone)
+			{
+				OnDone(EBatchOutcome::Accepted);
+				return true;
+			});
+
+			double Start = FPlatformTime::Seconds();
+			int32 Appended = 0;
+			for (int32 i = 0; i < NumGrants; ++i)
+			{
+				Grant(i, PlayerId, RewardId);
+				Appended += Ledger->Append(PlayerId, RewardId) ? 1 : 0;
+			}
+			const double AppendSeconds = FPlatformTime::Seconds() - Start;
+
+			const int32 NumRepeats = FMath::Min(NumGrants, 10000);
+			int32 Refused = 0;
+			Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumRepeats; ++i)
+			{
+				Grant(i, PlayerId, RewardId);
+				Refused += Ledger->Append(PlayerId, RewardId) ? 0 : 1;
+			}
+			const double RepeatSeconds = FPlatformTime::Seconds() - Start;
+
+			Start = FPlatformTime::Seconds();
+			while (Ledger->GetPendingCount() > 0 && Ledger->GetStats().BatchFailures == 0)
+			{
+				Ledger->Flush();
+			}
+			const double UploadSeconds = FPlatformTime::Seconds() - Start;
+
+			bOk &= Appended == NumGrants && Refused == NumRepeats && Ledger->GetPendingCount() == 0;
+			UE_LOG(LogTemp, Log,
+				TEXT("HMVRRewardLedger: Bench %d grants — append %.0f grants/s (%.2f us each), duplicate refusal %.2f us each (%d/%d refused), batch+ack %.0f grants/s, %.1f upload bytes per grant"),
+				NumGrants, NumGrants / FMath::Max(AppendSeconds, 1e-9), AppendSeconds * 1e6 / NumGrants,
+				RepeatSeconds * 1e6 / NumRepeats, Refused, NumRepeats, NumGrants / FMath::Max(UploadSeconds, 1e-9),
+				static_cast<double>(Ledger->GetStats().BytesUploaded) / FMath::Max<int64>(1, Ledger->GetStats().GrantsUploaded));
+			Ledger->LogStats();
+		}
+
+		// Crash replay: grants whose batches never come back must survive a reopen
+		const int32 NumUnacked = FMath::Min(NumGrants, 1000);
+		{
+			TSharedRef<FHMVRRewardLedger> Ledger = MakeShared<FHMVRRewardLedger>(Directory);
+			bOk &= Ledger->Open(Error);
+			Ledger->Start([](const FString&, int32, TFunction<void(EBatchOutcome)>) { return true; }); // never acknowledged
+			for (int32 i = 0; i < NumUnacked; ++i)
+			{
+				Ledger->Append(FString::Printf(TEXT("replay-player-%d"), i), TEXT("reward-0"));
+			}
+			Ledger->Flush();
+		}
+		{
+			TSharedRef<FHMVRRewardLedger> Ledger = MakeShared<FHMVRRewardLedger>(Directory);
+			bOk &= Ledger->Open(Error);
+			const int64 Replayed = Ledger->GetStats().Replayed;
+			const bool bReplayRefuses = !Ledger->Append(TEXT("replay-player-0"), TEXT("reward-0"));
+			bOk &= Replayed == NumUnacked && bReplayRefuses;
+			UE_LOG(LogTemp, Log, TEXT("HMVRRewardLedger: Bench replay — %lld of %d unacknowledged grants replayed in %.2f ms, replayed pair %s"),
+				Replayed, NumUnacked, Ledger->GetStats().ReplayMs, bReplayRefuses ? TEXT("refused") : TEXT("ACCEPTED AGAIN"));
+		}
+
+		IFileManager::Get().DeleteDirectory(*Directory, /*RequireExists=*/false, /*Tree=*/true);
+		UE_LOG(LogTemp, Log, TEXT("HMVRRewardLedger: Bench %s%s"), bOk ? TEXT("PASSED") : TEXT("FAILED"),
+			Error.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(" (%s)"), *Error));
+	}));
+#endif
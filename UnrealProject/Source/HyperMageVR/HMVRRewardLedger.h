@@ -0,0 +1,158 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HMVRBloomFilter.h"
+#include "HMVRId.h"
+
+class IFileHandle;
+
+/**
+ * Append-only ledger of reward grants with exactly-once delivery to the Session API.
+ *
+ * Append() gives each grant an idempotency key (an FHMVRId) and appends a checksummed record to
+ * a log file on local disk before it returns, so the grant survives a process crash. Every
+ * hmvr.Ledger.FlushIntervalSeconds a core ticker uploads pending grants in batches of
+ * hmvr.Ledger.BatchSize (POST /player-rewards/batch, signed, through the Send function). When a
+ * batch is acknowledged an ack record is appended for each key; a failed batch is queued again.
+ * A batch the API rejects outright (a 4xx other than auth and throttling), or whose grants have
+ * failed hmvr.Ledger.MaxAttempts times, is moved to RewardLedger.deadletter in the same record
+ * format and acknowledged in the log, so it neither loops nor holds back compaction.
+ * A batch with no outcome after hmvr.Ledger.BatchTimeoutSeconds counts as failed and its grants
+ * are queued again; if its outcome turns up later and is a success, the grants still pending are
+ * acknowledged then (the backend drops the re-sent keys).
+ * Open() replays the log: grants without an ack are uploaded again under their original keys,
+ * and the backend drops keys it has already applied, so every grant lands once.
+ *
+ * A (player, reward) pair is appended only once per process. The check is a Bloom filter in
+ * front of an exact set keyed by the same hash: a filter negative inserts without probing the
+ * set, and only a filter positive looks the pair up. Past hmvr.Ledger.MaxDedupPairs pairs both
+ * are rebuilt from the unacknowledged grants alone: a pair appended again after that gets a new
+ * key, and the backend's (player, reward) row absorbs the repeat.
+ * The log is rewritten with only unacknowledged grants when it is opened and after
+ * hmvr.Ledger.CompactAfterAcks acknowledgements.
+ */
+class HYPERMAGEVR_API FHMVRRewardLedger : public TSharedFromThis<FHMVRRewardLedger>
+{
+public:
+	enum class EBatchOutcome : uint8
+	{
+		Accepted,
+		Failed,    // transient (network, 429, 5xx, auth); sent again
+		Rejected   // the API refused the batch itself; re-sending cannot help
+	};
+
+	/** Game thread: post one serialised batch; OnDone with the final outcome. */
+	using FSendFn = TFunction<bool(const FString& /*JsonBody*/, int32 /*NumGrants*/, TFunction<void(EBatchOutcome)> /*OnDone*/)>;
+
+	/** The log lives in Directory (one per server process slot; see GetDefaultDirectory) */
+	explicit FHMVRRewardLedger(const FString& InDirectory);
+	~FHMVRRewardLedger();
+
+	/** Saved/RewardLedger/Port_<Port>: a restarted process on the same port replays its predecessor's log */
+	static FString GetDefaultDirectory(int32 Port);
+
+	/** Replay the log (unacknowledged grants become pending), compact it and keep it open for appends. */
+	bool Open(FString& OutError);
+
+	/** Start uploading; call after Open (needs a shared pointer to itself). */
+	void Start(FSendFn InSend);
+
+	/** Game thread. False if the (player, reward) pair is already in the ledger or the log cannot be written. */
+	bool Append(const FString& PlayerId, const FString& RewardId);
+
+	/** Game thread: upload everything pending now, ignoring the in-flight cap. */
+	void Flush();
+
+	int32 GetPendingCount() const { return Unacked.Num(); }
+
+	struct FStats
+	{
+		int64 Appended = 0;
+		int64 Duplicates = 0;
+		int64 BloomNegatives = 0;      // appends admitted by the filter alone
+		int64 BloomFalsePositives = 0; // filter said maybe, exact set said no
+		int64 Replayed = 0;
+		int64 Acknowledged = 0;
+		int64 Batches = 0;
+		int64 BatchFailures = 0;
+		int64 DeadLettered = 0;        // grants moved to the dead-letter file
+		int64 BatchTimeouts = 0;       // batches with no outcome in time (counted in BatchFailures)
+		int64 LateAcknowledged = 0;    // grants acknowledged by a batch that had timed out
+		int32 DedupResets = 0;
+		int64 BytesUploaded = 0;       // request bodies, including re-sent batches
+		int64 GrantsUploaded = 0;
+		int64 LogBytes = 0;
+		int32 Compactions = 0;
+		double ReplayMs = 0.0;
+	};
+	const FStats& GetStats() const { return Stats; }
+	void LogStats() const;
+
+private:
+	struct FEntry
+	{
+		FHMVRId Key;
+		FString PlayerId;
+		FString RewardId;
+		FDateTime GrantedAt;
+		int32 Attempts = 0;            // failed batches this grant was in
+		bool bInFlight = false;
+	};
+
+	// Hash the exact set shares with the Bloom filter, so each append hashes the pair once
+	struct FDedupKeyFuncs : BaseKeyFuncs<FString, FString, /*bInAllowDuplicateKeys=*/true>
+	{
+		static const FString& GetSetKey(const FString& Element) { return Element; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return SetHash(Hash(Key)); }
+		static uint64 Hash(const FString& Key);
+		static uint32 SetHash(uint64 Hash) { return static_cast<uint32>(Hash >> 32); }
+	};
+
+	struct FInFlightBatch
+	{
+		TArray<FHMVRId> Keys;
+		double Deadline = 0.0;
+	};
+
+	bool Tick(float DeltaTime);
+	void SendBatches(bool bIgnoreInFlightCap);
+	void OnBatchDone(uint32 BatchId, EBatchOutcome Outcome);
+	void ExpireInFlight();
+	void Acknowledge(const TArray<FHMVRId>& Keys);
+	void ResetDedup();
+	void DeadLetter(const TArray<FHMVRId>& Keys, const TCHAR* Reason);
+	bool WriteRecords(const TArray<uint8>& Records);
+	bool Compact(FString& OutError);
+	bool AddDedupKey(const FString& PlayerId, const FString& RewardId); // false if already present
+
+	FString Directory;
+	FString LogPath;
+	FString DeadLetterPath;
+	TUniquePtr<IFileHandle> LogFile;
+	FSendFn Send;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	// Unacknowledged grants and their upload order (keys may already be acknowledged; skipped)
+	TMap<FHMVRId, FEntry> Unacked;
+	TArray<FHMVRId> SendQueue;
+	int32 SendHead = 0;
+	TMap<uint32, FInFlightBatch> InFlight;
+	uint32 NextBatchId = 1;
+
+	// Keys of batches that timed out, by batch id, so a late success can still acknowledge them.
+	// Oldest dropped past a fixed count: a completion that never fires must not pin its keys.
+	TMap<uint32, TArray<FHMVRId>> TimedOut;
+
+	// (player, reward) pairs seen by this process. Duplicates are allowed by the key funcs so a
+	// filter negative skips the probe; AddDedupKey never inserts a pair twice.
+	FHMVRBloomFilter Bloom;
+	TSet<FString, FDedupKeyFuncs> Granted;
+
+	int64 AcksSinceCompact = 0;
+	TArray<uint8> Scratch;
+	FStats Stats;
+};
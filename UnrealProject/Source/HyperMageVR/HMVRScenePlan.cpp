@@ -0,0 +1,476 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRScenePlan.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+	/**
+	 * Thin recursive-descent layer over TJsonReader. Each Read* is entered with the reader
+	 * positioned on the value's first token (the notation is passed in) and leaves it on the
+	 * value's last token. Unknown keys and mistyped values are skipped, not errors.
+	 */
+	class FScenePlanReader
+	{
+	public:
+		explicit FScenePlanReader(const FString& Json)
+			: Reader(TJsonReaderFactory<TCHAR>::Create(Json))
+		{
+		}
+
+		bool ReadPlan(FHMVRScenePlan& Plan)
+		{
+			EJsonNotation Notation;
+			if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+			{
+				return Fail(TEXT("root is not an object"));
+			}
+
+			return ReadObject([this, &Plan](EJsonNotation N, const FString& Key)
+			{
+				if (Key == TEXT("id")) return ReadString(N, Plan.Id);
+				if (Key == TEXT("name")) return ReadString(N, Plan.Name);
+				if (Key == TEXT("zones")) return ReadArrayOf(N, EJsonNotation::ObjectStart, [this, &Plan]() { return ReadZone(Plan); });
+				if (Key == TEXT("participant_spawns")) return ReadArrayOf(N, EJsonNotation::ObjectStart, [this, &Plan]() { return ReadSpawn(Plan); });
+				if (Key == TEXT("gm_hooks")) return ReadArrayOf(N, EJsonNotation::ObjectStart, [this, &Plan]() { return ReadHook(Plan); });
+				return Skip(N);
+			});
+		}
+
+		FString Error;
+
+	private:
+		bool ReadZone(FHMVRScenePlan& Plan)
+		{
+			const int32 ZoneIndex = Plan.Zones.AddDefaulted();
+			return ReadObject([this, &Plan, ZoneIndex](EJsonNotation N, const FString& Key)
+			{
+				FHMVRScenePlanZone& Zone = Plan.Zones[ZoneIndex];
+				if (Key == TEXT("id")) return ReadString(N, Zone.Id);
+				if (Key == TEXT("name")) return ReadString(N, Zone.Name);
+				if (Key == TEXT("type")) return ReadString(N, Zone.Type);
+				if (Key == TEXT("bounds"))
+				{
+					return ReadObjectOf(N, [this, &Zone](EJsonNotation BN, const FString& BKey)
+					{
+						if (BKey == TEXT("center")) return ReadVector(BN, Zone.Center);
+						if (BKey == TEXT("extents")) return ReadVector(BN, Zone.Extents);
+						return Skip(BN);
+					});
+				}
+				if (Key == TEXT("interactables")) return ReadArrayOf(N, EJsonNotation::ObjectStart, [this, &Plan, ZoneIndex]() { return ReadInteractable(Plan, ZoneIndex); });
+				if (Key == TEXT("props")) return ReadArrayOf(N, EJsonNotation::ObjectStart, [this, &Plan, ZoneIndex]() { return ReadProp(Plan, ZoneIndex); });
+				return Skip(N);
+			});
+		}
+
+		bool ReadInteractable(FHMVRScenePlan& Plan, int32 ZoneIndex)
+		{
+			FHMVRScenePlanInteractable Entry;
+			Entry.ZoneIndex = ZoneIndex;
+			bool bKnownType = false;
+
+			const bool bOk = ReadObject([this, &Entry, &bKnownType](EJsonNotation N, const FString& Key)
+			{
+				if (Key == TEXT("type"))
+				{
+					FString Type;
+					if (!ReadString(N, Type)) return false;
+					bKnownType = true;
+					if (Type == TEXT("creature")) Entry.Type = EHMVRScenePlanObjectType::Creature;
+					else if (Type == TEXT("machinery")) Entry.Type = EHMVRScenePlanObjectType::Machinery;
+					else if (Type == TEXT("artefact")) Entry.Type = EHMVRScenePlanObjectType::Artefact;
+					else if (Type == TEXT("environmental")) Entry.Type = EHMVRScenePlanObjectType::Environmental;
+					else bKnownType = false;
+					return true;
+				}
+				if (Key == TEXT("id")) return ReadString(N, Entry.Id);
+				if (Key == TEXT("position")) return ReadVector(N, Entry.Position);
+				if (Key == TEXT("behaviour")) return ReadString(N, Entry.Behaviour);
+				if (Key == TEXT("persistent")) return ReadBool(N, Entry.bPersistent);
+				if (Key == TEXT("health")) return ReadFloat(N, Entry.Health);
+				if (Key == TEXT("patrol_radius")) return ReadFloat(N, Entry.PatrolRadius);
+				if (Key == TEXT("trigger_radius")) return ReadFloat(N, Entry.TriggerRadius);
+				if (Key == TEXT("required_key_id")) return ReadString(N, Entry.RequiredKeyId);
+				if (Key == TEXT("artefact_id")) return ReadString(N, Entry.ArtefactId);
+				if (Key == TEXT("model_asset_id")) return ReadString(N, Entry.ModelAssetId);
+				if (Key == TEXT("grants_ability")) return ReadString(N, Entry.GrantsAbility);
+				if (Key == TEXT("audio_profile")) return ReadString(N, Entry.AudioProfile);
+				if (Key == TEXT("loot"))
+				{
+					return ReadArrayOf(N, EJsonNotation::ObjectStart, [this, &Entry]()
+					{
+						FHMVRScenePlanLoot& Loot = Entry.Loot.AddDefaulted_GetRef();
+						return ReadObject([this, &Loot](EJsonNotation LN, const FString& LKey)
+						{
+							if (LKey == TEXT("artefact_id")) return ReadString(LN, Loot.ArtefactId);
+							if (LKey == TEXT("drop_chance")) return ReadFloat(LN, Loot.DropChance);
+							return Skip(LN);
+						});
+					});
+				}
+				return Skip(N);
+			});
+
+			if (!bOk)
+			{
+				return false;
+			}
+			if (!bKnownType || Entry.Id.IsEmpty())
+			{
+				++Plan.SkippedEntries;
+				return true;
+			}
+			Plan.Interactables.Add(MoveTemp(Entry));
+			return true;
+		}
+
+		bool ReadProp(FHMVRScenePlan& Plan, int32 ZoneIndex)
+		{
+			FHMVRScenePlanProp Prop;
+			Prop.ZoneIndex = ZoneIndex;
+			FVector Position = FVector::ZeroVector;
+			FRotator Rotation = FRotator::ZeroRotator;
+			FVector Scale = FVector::OneVector;
+
+			const bool bOk = ReadObject([this, &Prop, &Position, &Rotation, &Scale](EJsonNotation N, const FString& Key)
+			{
+				if (Key == TEXT("id")) return ReadString(N, Prop.Id);
+				if (Key == TEXT("mesh")) return ReadString(N, Prop.Mesh);
+				if (Key == TEXT("material")) return ReadString(N, Prop.Material);
+				if (Key == TEXT("movable")) return ReadBool(N, Prop.bMovable);
+				if (Key == TEXT("position")) return ReadVector(N, Position);
+				if (Key == TEXT("rotation")) return ReadRotator(N, Rotation);
+				if (Key == TEXT("scale"))
+				{
+					// Uniform number or {x,y,z}
+					if (N == EJsonNotation::Number)
+					{
+						Scale = FVector(Reader->GetValueAsNumber());
+						return true;
+					}
+					return ReadVector(N, Scale);
+				}
+				return Skip(N);
+			});
+
+			if (!bOk)
+			{
+				return false;
+			}
+			if (Prop.Mesh.IsEmpty())
+			{
+				++Plan.SkippedEntries;
+				return true;
+			}
+			Prop.Transform = FTransform(Rotation, Position, Scale);
+			Plan.Props.Add(MoveTemp(Prop));
+			return true;
+		}
+
+		bool ReadSpawn(FHMVRScenePlan& Plan)
+		{
+			FHMVRScenePlanSpawn& Spawn = Plan.ParticipantSpawns.AddDefaulted_GetRef();
+			return ReadObject([this, &Spawn](EJsonNotation N, const FString& Key)
+			{
+				if (Key == TEXT("position")) return ReadVector(N, Spawn.Position);
+				if (Key == TEXT("rotation")) return ReadRotator(N, Spawn.Rotation);
+				if (Key == TEXT("role")) return ReadString(N, Spawn.Role);
+				return Skip(N);
+			});
+		}
+
+		bool ReadHook(FHMVRScenePlan& Plan)
+		{
+			FHMVRScenePlanHook& Hook = Plan.GmHooks.AddDefaulted_GetRef();
+			return ReadObject([this, &Hook](EJsonNotation N, const FString& Key)
+			{
+				if (Key == TEXT("id")) return ReadString(N, Hook.Id);
+				if (Key == TEXT("name")) return ReadString(N, Hook.Name);
+				if (Key == TEXT("description")) return ReadString(N, Hook.Description);
+				if (Key == TEXT("is_reversible")) return ReadBool(N, Hook.bIsReversible);
+				if (Key == TEXT("effects"))
+				{
+					return ReadArrayOf(N, EJsonNotation::String, [this, &Hook]()
+					{
+						Hook.Effects.Add(Reader->GetValueAsString());
+						return true;
+					});
+				}
+				return Skip(N);
+			});
+		}
+
+		// ── Primitives ──────────────────────────────────────────────────────────
+
+		/** Reader is on ObjectStart; calls OnField for each member until ObjectEnd. */
+		bool ReadObject(TFunctionRef<bool(EJsonNotation, const FString&)> OnField)
+		{
+			EJsonNotation Notation;
+			while (Reader->ReadNext(Notation))
+			{
+				if (Notation == EJsonNotation::ObjectEnd)
+				{
+					return true;
+				}
+				if (Notation == EJsonNotation::Error)
+				{
+					break;
+				}
+				const FString Key = Reader->GetIdentifier();
+				if (!OnField(Notation, Key))
+				{
+					return false;
+				}
+			}
+			return Fail(TEXT("unterminated object"));
+		}
+
+		/** Like ReadObject, but skips the value when it is not an object. */
+		bool ReadObjectOf(EJsonNotation Notation, TFunctionRef<bool(EJsonNotation, const FString&)> OnField)
+		{
+			return Notation == EJsonNotation::ObjectStart ? ReadObject(OnField) : Skip(Notation);
+		}
+
+		/** Reader is on ArrayStart (else the value is skipped); calls OnElement for each element of ElementNotation. */
+		bool ReadArrayOf(EJsonNotation Notation, EJsonNotation ElementNotation, TFunctionRef<bool()> OnElement)
+		{
+			if (Notation != EJsonNotation::ArrayStart)
+			{
+				return Skip(Notation);
+			}
+
+			EJsonNotation Element;
+			while (Reader->ReadNext(Element))
+			{
+				if (Element == EJsonNotation::ArrayEnd)
+				{
+					return true;
+				}
+				if (Element == EJsonNotation::Error)
+				{
+					break;
+				}
+				if (!(Element == ElementNotation ? OnElement() : Skip(Element)))
+				{
+					return false;
+				}
+			}
+			return Fail(TEXT("unterminated array"));
+		}
+
+		bool ReadString(EJsonNotation Notation, FString& Out)
+		{
+			if (Notation == EJsonNotation::String)
+			{
+				Out = Reader->GetValueAsString();
+				return true;
+			}
+			return Skip(Notation);
+		}
+
+		bool ReadFloat(EJsonNotation Notation, float& Out)
+		{
+			if (Notation == EJsonNotation::Number)
+			{
+				Out = static_cast<float>(Reader->GetValueAsNumber());
+				return true;
+			}
+			return Skip(Notation);
+		}
+
+		bool ReadBool(EJsonNotation Notation, bool& Out)
+		{
+			if (Notation == EJsonNotation::Boolean)
+			{
+				Out = Reader->GetValueAsBoolean();
+				return true;
+			}
+			return Skip(Notation);
+		}
+
+		bool ReadVector(EJsonNotation Notation, FVector& Out)
+		{
+			return ReadObjectOf(Notation, [this, &Out](EJsonNotation N, const FString& Key)
+			{
+				if (N == EJsonNotation::Number && Key.Len() == 1)
+				{
+					const double Value = Reader->GetValueAsNumber();
+					switch (Key[0])
+					{
+					case TEXT('x'): Out.X = Value; return true;
+					case TEXT('y'): Out.Y = Value; return true;
+					case TEXT('z'): Out.Z = Value; return true;
+					default: break;
+					}
+				}
+				return Skip(N);
+			});
+		}
+
+		bool ReadRotator(EJsonNotation Notation, FRotator& Out)
+		{
+			return ReadObjectOf(Notation, [this, &Out](EJsonNotation N, const FString& Key)
+			{
+				if (N == EJsonNotation::Number)
+				{
+					if (Key == TEXT("pitch")) { Out.Pitch = Reader->GetValueAsNumber(); return true; }
+					if (Key == TEXT("yaw")) { Out.Yaw = Reader->GetValueAsNumber(); return true; }
+					if (Key == TEXT("roll")) { Out.Roll = Reader->GetValueAsNumber(); return true; }
+				}
+				return Skip(N);
+			});
+		}
+
+		bool Skip(EJsonNotation Notation)
+		{
+			bool bOk = true;
+			if (Notation == EJsonNotation::ObjectStart)
+			{
+				bOk = Reader->SkipObject();
+			}
+			else if (Notation == EJsonNotation::ArrayStart)
+			{
+				bOk = Reader->SkipArray();
+			}
+			else if (Notation == EJsonNotation::Error)
+			{
+				bOk = false;
+			}
+			return bOk || Fail(TEXT("malformed value"));
+		}
+
+		bool Fail(const TCHAR* What)
+		{
+			if (Error.IsEmpty())
+			{
+				const FString ReaderError = Reader->GetErrorMessage();
+				Error = ReaderError.IsEmpty() ? FString(What) : FString::Printf(TEXT("%s (%s)"), What, *ReaderError);
+			}
+			return false;
+		}
+
+		TSharedRef<TJsonReader<TCHAR>> Reader;
+	};
+}
+
+bool FHMVRScenePlan::Parse(const FString& Json, FHMVRScenePlan& OutPlan, FString& OutError)
+{
+	OutPlan = FHMVRScenePlan();
+	FScenePlanReader PlanReader(Json);
+	if (!PlanReader.ReadPlan(OutPlan))
+	{
+		OutError = PlanReader.Error;
+		return false;
+	}
+	return true;
+}
+
+FString FHMVRScenePlan::MakeSynthetic(int32 Count)
+{
+	static const TCHAR* Types[] = { TEXT("creature"), TEXT("machinery"), TEXT("artefact"), TEXT("environmental") };
+	static const TCHAR* Meshes[] = {
+		TEXT("/Engine/BasicShapes/Cube.Cube"), TEXT("/Engine/BasicShapes/Cylinder.Cylinder"), TEXT("/Engine/BasicShapes/Cone.Cone") };
+
+	// ~100 objects per zone, zones 40 m apart on a grid
+	const int32 NumZones = FMath::Max(1, Count / 100);
+	const int32 ZoneSide = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumZones)));
+	const double ZoneSpacing = 4000.0;
+
+	FString Out;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+
+	auto WriteVector = [&Writer](const TCHAR* Identifier, const FVector& V)
+	{
+		Writer->WriteObjectStart(Identifier);
+		Writer->WriteValue(TEXT("x"), V.X);
+		Writer->WriteValue(TEXT("y"), V.Y);
+		Writer->WriteValue(TEXT("z"), V.Z);
+		Writer->WriteObjectEnd();
+	};
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("id"), FString::Printf(TEXT("synthetic-%d"), Count));
+	Writer->WriteValue(TEXT("name"), FString::Printf(TEXT("Synthetic %d"), Count));
+
+	Writer->WriteArrayStart(TEXT("zones"));
+	int32 Written = 0;
+	int32 PropsWritten = 0;
+	for (int32 Z = 0; Z < NumZones; ++Z)
+	{
+		const FVector Center((Z % ZoneSide) * ZoneSpacing, (Z / ZoneSide) * ZoneSpacing, 0.0);
+		const int32 InZone = (Z == NumZones - 1) ? Count - Written : Count / NumZones;
+
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("id"), FString::Printf(TEXT("zone-%d"), Z));
+		Writer->WriteValue(TEXT("name"), FString::Printf(TEXT("Zone %d"), Z));
+		Writer->WriteValue(TEXT("type"), FString(TEXT("exploration")));
+		Writer->WriteObjectStart(TEXT("bounds"));
+		WriteVector(TEXT("center"), Center);
+		WriteVector(TEXT("extents"), FVector(ZoneSpacing * 0.5, ZoneSpacing * 0.5, 500.0));
+		Writer->WriteObjectEnd();
+
+		const int32 Side = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(InZone))));
+		const double Step = ZoneSpacing * 0.8 / Side;
+		auto GridPoint = [&](int32 i, double Offset)
+		{
+			return Center + FVector((i % Side) * Step - ZoneSpacing * 0.4 + Offset, (i / Side) * Step - ZoneSpacing * 0.4 + Offset, 50.0);
+		};
+
+		Writer->WriteArrayStart(TEXT("interactables"));
+		for (int32 i = 0; i < InZone; ++i, ++Written)
+		{
+			const TCHAR* Type = Types[Written % UE_ARRAY_COUNT(Types)];
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("id"), FString::Printf(TEXT("obj-%d"), Written));
+			Writer->WriteValue(TEXT("type"), FString(Type));
+			WriteVector(TEXT("position"), GridPoint(i, 0.0));
+			Writer->WriteValue(TEXT("behaviour"), FString(TEXT("Synthetic load-test object")));
+			Writer->WriteValue(TEXT("persistent"), false);
+			if (Written % 4 == 0) Writer->WriteValue(TEXT("patrol_radius"), 300.0);
+			if (Written % 4 == 2) Writer->WriteValue(TEXT("artefact_id"), FString::Printf(TEXT("artefact-%d"), Written));
+			if (Written % 4 == 3) Writer->WriteValue(TEXT("trigger_radius"), 250.0);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteArrayStart(TEXT("props"));
+		for (int32 i = 0; i < InZone / 2; ++i, ++PropsWritten)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("mesh"), FString(Meshes[PropsWritten % UE_ARRAY_COUNT(Meshes)]));
+			WriteVector(TEXT("position"), GridPoint(i, Step * 0.5));
+			Writer->WriteValue(TEXT("scale"), 0.5);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("participant_spawns"));
+	for (int32 i = 0; i < 15; ++i)
+	{
+		Writer->WriteObjectStart();
+		WriteVector(TEXT("position"), FVector(-300.0, (i - 7) * 150.0, 100.0));
+		Writer->WriteObjectStart(TEXT("rotation"));
+		Writer->WriteValue(TEXT("pitch"), 0.0);
+		Writer->WriteValue(TEXT("yaw"), 0.0);
+		Writer->WriteValue(TEXT("roll"), 0.0);
+		Writer->WriteObjectEnd();
+		Writer->WriteValue(TEXT("role"), FString(TEXT("player")));
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("gm_hooks"));
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return Out;
+}
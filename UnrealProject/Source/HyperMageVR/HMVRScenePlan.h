@@ -0,0 +1,116 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** ScenePlan interactable types (schema "type"). */
+enum class EHMVRScenePlanObjectType : uint8
+{
+	Creature,
+	Machinery,
+	Artefact,
+	Environmental
+};
+
+struct FHMVRScenePlanLoot
+{
+	FString ArtefactId;
+	float DropChance = 1.f;
+};
+
+struct FHMVRScenePlanInteractable
+{
+	FString Id;
+	EHMVRScenePlanObjectType Type = EHMVRScenePlanObjectType::Creature;
+	FVector Position = FVector::ZeroVector;
+	FString Behaviour;
+	bool bPersistent = false;
+
+	// 0 / empty = keep the class default
+	float Health = 0.f;
+	float PatrolRadius = 0.f;
+	float TriggerRadius = 0.f;
+	FString RequiredKeyId;
+	FString ArtefactId;
+	FString ModelAssetId;
+	FString GrantsAbility;
+	FString AudioProfile;
+	TArray<FHMVRScenePlanLoot> Loot;
+
+	/** Index into FHMVRScenePlan::Zones. */
+	int32 ZoneIndex = INDEX_NONE;
+};
+
+/**
+ * Static scenery. Not part of the authored schema: the content pipeline cooks zone
+ * asset_references into per-zone "props" entries ({mesh, material, position, rotation, scale,
+ * movable}).
+ */
+struct FHMVRScenePlanProp
+{
+	/** Optional; named props can be found again through AHMVRPropBatch::FindProp. */
+	FString Id;
+	FString Mesh;
+	FString Material;
+	FTransform Transform;
+	/** Moves at runtime: spawned as its own actor instead of being instanced. */
+	bool bMovable = false;
+	int32 ZoneIndex = INDEX_NONE;
+};
+
+struct FHMVRScenePlanZone
+{
+	FString Id;
+	FString Name;
+	FString Type;
+	FVector Center = FVector::ZeroVector;
+	FVector Extents = FVector::ZeroVector;
+};
+
+struct FHMVRScenePlanSpawn
+{
+	FVector Position = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FString Role;
+};
+
+struct FHMVRScenePlanHook
+{
+	FString Id;
+	FString Name;
+	FString Description;
+	TArray<FString> Effects;
+	bool bIsReversible = false;
+};
+
+/**
+ * A parsed ScenePlan (Specs/schemas/ScenePlan.schema.json), flattened for spawning:
+ * interactables and props from every zone sit in two contiguous arrays and point back to
+ * their zone by index. Objectives and narrative states are not used by the server and are
+ * skipped without being materialized.
+ */
+struct FHMVRScenePlan
+{
+	FString Id;
+	FString Name;
+
+	TArray<FHMVRScenePlanZone> Zones;
+	TArray<FHMVRScenePlanInteractable> Interactables;
+	TArray<FHMVRScenePlanProp> Props;
+	TArray<FHMVRScenePlanSpawn> ParticipantSpawns;
+	TArray<FHMVRScenePlanHook> GmHooks;
+
+	/** Entries dropped for an unknown type or missing id. */
+	int32 SkippedEntries = 0;
+
+	/**
+	 * Parse Json with a streaming reader — tokens go straight into the arrays above, no DOM is
+	 * built, so a 10k-object plan costs one pass and the final arrays. Safe on any thread.
+	 * Returns false and sets OutError on malformed input.
+	 */
+	static bool Parse(const FString& Json, FHMVRScenePlan& OutPlan, FString& OutError);
+
+	/** Write a plan with Count interactables spread over zones, plus Count / 2 props. For load timing. */
+	static FString MakeSynthetic(int32 Count);
+};
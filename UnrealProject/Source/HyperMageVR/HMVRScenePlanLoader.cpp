@@ -0,0 +1,486 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRScenePlanLoader.h"
+#include "HMVRGameMode.h"
+#include "HMVRInteractableComponent.h"
+#include "HMVRCreature.h"
+#include "HMVRMachinery.h"
+#include "HMVRArtifact.h"
+#include "HMVRActorPool.h"
+#include "HMVREnvironmental.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "HMVRPropBatch.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/SkeletalMesh.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/PlayerStart.h"
+#include "Materials/MaterialInterface.h"
+
+static TAutoConsoleVariable<float> CVarScenePlanSpawnBudgetMs(
+	TEXT("hmvr.ScenePlan.SpawnBudgetMs"), 4.f,
+	TEXT("ScenePlan loader: milliseconds of actor spawning allowed per frame."));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdScenePlanLoad(
+	TEXT("HMVR.ScenePlan.Load"),
+	TEXT("HMVR.ScenePlan.Load <Path> — load a ScenePlan into the current world (server/standalone) and log its timing."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		AHMVRGameMode* GameMode = World ? World->GetAuthGameMode<AHMVRGameMode>() : nullptr;
+		if (Args.Num() < 1 || !GameMode)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HMVRScenePlanLoader: usage HMVR.ScenePlan.Load <Path>, on the server"));
+			return;
+		}
+		GameMode->GetScenePlanLoader()->Load(World, Args[0]);
+	}));
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CmdScenePlanWriteSynthetic(
+	TEXT("HMVR.ScenePlan.WriteSynthetic"),
+	TEXT("HMVR.ScenePlan.WriteSynthetic [Count=1000] — write Saved/ScenePlans/synthetic_<Count>.json for HMVR.ScenePlan.Load."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ScenePlans"), FString::Printf(TEXT("synthetic_%d.json"), Count));
+		if (FFileHelper::SaveStringToFile(FHMVRScenePlan::MakeSynthetic(Count), *Path))
+		{
+			UE_LOG(LogTemp, Log, TEXT("HMVRScenePlanLoader: wrote %s"), *FPaths::ConvertRelativePathToFull(Path));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("HMVRScenePlanLoader: could not write %s"), *Path);
+		}
+	}));
+#endif
+
+void UHMVRScenePlanLoader::BeginDestroy()
+{
+	if (SpawnTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SpawnTickerHandle);
+		SpawnTickerHandle.Reset();
+	}
+	PreloadHandle.Reset();
+	Super::BeginDestroy();
+}
+
+bool UHMVRScenePlanLoader::Load(UWorld* World, const FString& Path)
+{
+	if (IsLoading())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRScenePlanLoader: %s is still loading, ignoring %s"), *PlanPath, *Path);
+		return false;
+	}
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRScenePlanLoader: ScenePlans are spawned by the server"));
+		return false;
+	}
+
+	TargetWorld = World;
+	PlanPath = FPaths::IsRelative(Path) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Path) : Path;
+	Stage = EStage::Parsing;
+	LoadStartTime = FPlatformTime::Seconds();
+	ParseSeconds = 0.0;
+	SpawnFrames = 0;
+	MaxSliceSeconds = 0.0;
+	MaxFrameSeconds = 0.f;
+	FirstFrameSeconds = 0.f;
+	SpawnedActors = 0;
+	PropBatches = 0;
+	PropBatcher = FHMVRPropBatcher();
+	FailedSpawns = 0;
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRScenePlanLoader: loading %s"), *PlanPath);
+
+	// Reading and parsing 10k objects is tens of milliseconds — keep it off the game thread
+	TWeakObjectPtr<UHMVRScenePlanLoader> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, FilePath = PlanPath]()
+	{
+		const double Start = FPlatformTime::Seconds();
+		TSharedPtr<FHMVRScenePlan> Parsed = MakeShared<FHMVRScenePlan>();
+		FString Json;
+		FString Error;
+		if (!FFileHelper::LoadFileToString(Json, *FilePath))
+		{
+			Error = TEXT("could not read file");
+		}
+		else if (!FHMVRScenePlan::Parse(Json, *Parsed, Error))
+		{
+			Parsed.Reset();
+		}
+		const double Seconds = FPlatformTime::Seconds() - Start;
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Parsed, Error, Seconds]()
+		{
+			if (UHMVRScenePlanLoader* This = WeakThis.Get())
+			{
+				This->ParseSeconds = Seconds;
+				This->OnParsed(Parsed, Error);
+			}
+		});
+	});
+	return true;
+}
+
+// ── Stage 1 → 2: parsed, start streaming ─────────────────────────────────────
+
+void UHMVRScenePlanLoader::OnParsed(TSharedPtr<FHMVRScenePlan> Parsed, const FString& Error)
+{
+	if (!Parsed.IsValid() || !Error.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("HMVRScenePlanLoader: %s: %s"), *PlanPath, *Error);
+		Finish(false);
+		return;
+	}
+
+	Plan = MoveTemp(*Parsed);
+	if (Plan.SkippedEntries > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRScenePlanLoader: skipped %d entries with an unknown type, no id or no mesh"),
+			Plan.SkippedEntries);
+	}
+
+	// Everything the spawn stage will touch, so no spawn ever hits a synchronous load
+	TArray<FSoftObjectPath> Paths;
+	UnresolvedAssets = CollectAssetPaths(Plan, Paths);
+
+	if (UnresolvedAssets > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRScenePlanLoader: %d asset ids not found in AssetCatalog; those objects keep their default look"),
+			UnresolvedAssets);
+	}
+
+	Stage = EStage::Preloading;
+	PreloadStartTime = FPlatformTime::Seconds();
+	PreloadAssetCount = Paths.Num();
+	if (Paths.Num() == 0)
+	{
+		OnPreloaded();
+		return;
+	}
+
+	PreloadHandle = StreamableManager.RequestAsyncLoad(Paths,
+		FStreamableDelegate::CreateUObject(this, &UHMVRScenePlanLoader::OnPreloaded),
+		FStreamableManager::AsyncLoadHighPriority, /*bManageActiveHandle=*/false, /*bStartStalled=*/false,
+		TEXT("HMVRScenePlan"));
+}
+
+int32 UHMVRScenePlanLoader::CollectAssetPaths(const FHMVRScenePlan& InPlan, TArray<FSoftObjectPath>& OutPaths) const
+{
+	int32 Unresolved = 0;
+	auto AddAsset = [this, &OutPaths, &Unresolved](const FString& IdOrPath)
+	{
+		if (IdOrPath.IsEmpty())
+		{
+			return;
+		}
+		const FSoftObjectPath Path = ResolveAsset(IdOrPath);
+		if (Path.IsNull())
+		{
+			++Unresolved;
+		}
+		else if (!Path.ResolveObject())
+		{
+			OutPaths.AddUnique(Path);
+		}
+	};
+
+	bool bTypeUsed[4] = {};
+	for (const FHMVRScenePlanInteractable& Entry : InPlan.Interactables)
+	{
+		bTypeUsed[static_cast<int32>(Entry.Type)] = true;
+		AddAsset(Entry.ModelAssetId);
+	}
+	for (const FHMVRScenePlanProp& Prop : InPlan.Props)
+	{
+		AddAsset(Prop.Mesh);
+		AddAsset(Prop.Material);
+	}
+	const TSoftClassPtr<AActor>* Classes[] = { &CreatureClass, &MachineryClass, &ArtefactClass, &EnvironmentalClass };
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Classes); ++i)
+	{
+		if (bTypeUsed[i] && !Classes[i]->IsNull() && !Classes[i]->Get())
+		{
+			OutPaths.AddUnique(Classes[i]->ToSoftObjectPath());
+		}
+	}
+	return Unresolved;
+}
+
+// ── Stage 2 → 3: assets resident, spawn in slices ────────────────────────────
+
+void UHMVRScenePlanLoader::OnPreloaded()
+{
+	if (!TargetWorld.IsValid())
+	{
+		Finish(false);
+		return;
+	}
+
+	// Classes are resident now; park spares for later waves alongside the scene's own spawns
+	if (UHMVRActorPoolSubsystem* Pool = TargetWorld->GetSubsystem<UHMVRActorPoolSubsystem>())
+	{
+		Pool->PrewarmInteractables(ResolveClass(EHMVRScenePlanObjectType::Creature), ResolveClass(EHMVRScenePlanObjectType::Artefact));
+	}
+
+	Stage = EStage::Spawning;
+	SpawnStartTime = FPlatformTime::Seconds();
+	NextSpawnIndex = 0;
+	SpawnTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHMVRScenePlanLoader::SpawnTick));
+}
+
+bool UHMVRScenePlanLoader::SpawnTick(float DeltaTime)
+{
+	if (!TargetWorld.IsValid() || TargetWorld->bIsTearingDown)
+	{
+		SpawnTickerHandle.Reset();
+		Finish(false);
+		return false;
+	}
+
+	// One frame after the last batch: record how long that frame took, then report
+	if (Stage == EStage::FirstFrame)
+	{
+		FirstFrameSeconds = DeltaTime;
+		SpawnTickerHandle.Reset();
+		Finish(true);
+		return false;
+	}
+
+	if (SpawnFrames > 0)
+	{
+		MaxFrameSeconds = FMath::Max(MaxFrameSeconds, DeltaTime);
+	}
+	++SpawnFrames;
+
+	const int32 NumSpawns = Plan.ParticipantSpawns.Num();
+	const int32 NumInteractables = Plan.Interactables.Num();
+	const int32 Total = NumSpawns + NumInteractables + Plan.Props.Num();
+
+	const double Start = FPlatformTime::Seconds();
+	const double Budget = FMath::Max(0.1f, CVarScenePlanSpawnBudgetMs.GetValueOnGameThread()) / 1000.0;
+
+	// Props are only collected as they come up; once the last one is in they are grouped, and
+	// each batch actor is then one more unit of work under the same budget.
+	// At least one unit per frame so a tiny budget still makes progress.
+	do
+	{
+		if (NextSpawnIndex < Total)
+		{
+			const int32 Index = NextSpawnIndex++;
+			if (Index < NumSpawns)
+			{
+				SpawnParticipantStart(Plan.ParticipantSpawns[Index]);
+			}
+			else if (Index < NumSpawns + NumInteractables)
+			{
+				SpawnInteractable(Plan.Interactables[Index - NumSpawns]);
+			}
+			else
+			{
+				SpawnProp(Plan.Props[Index - NumSpawns - NumInteractables]);
+			}
+
+			if (NextSpawnIndex == Total)
+			{
+				PropBatcher.BeginBuild();
+			}
+		}
+		else if (PropBatcher.IsBuilding())
+		{
+			PropBatcher.BuildNext(TargetWorld.Get());
+		}
+		else
+		{
+			break;
+		}
+	}
+	while (FPlatformTime::Seconds() - Start < Budget);
+
+	MaxSliceSeconds = FMath::Max(MaxSliceSeconds, FPlatformTime::Seconds() - Start);
+	PropBatches = PropBatcher.GetBuiltBatches();
+
+	if (NextSpawnIndex >= Total && !PropBatcher.IsBuilding())
+	{
+		SpawnEndTime = FPlatformTime::Seconds();
+		Stage = EStage::FirstFrame;
+	}
+	return true;
+}
+
+void UHMVRScenePlanLoader::SpawnParticipantStart(const FHMVRScenePlanSpawn& Spawn)
+{
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	APlayerStart* Start = TargetWorld->SpawnActor<APlayerStart>(Spawn.Position, Spawn.Rotation, Params);
+	if (!Start)
+	{
+		++FailedSpawns;
+		return;
+	}
+	// FindPlayerStart matches the ?Name= travel option against this tag
+	if (!Spawn.Role.IsEmpty())
+	{
+		Start->PlayerStartTag = FName(*Spawn.Role);
+	}
+	++SpawnedActors;
+}
+
+void UHMVRScenePlanLoader::SpawnInteractable(const FHMVRScenePlanInteractable& Entry)
+{
+	UClass* Class = ResolveClass(Entry.Type);
+	const FTransform Transform(Entry.Position);
+	AActor* Actor = Class ? TargetWorld->SpawnActorDeferred<AActor>(Class, Transform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn) : nullptr;
+	if (!Actor)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HMVRScenePlanLoader: could not spawn %s"), *Entry.Id);
+		++FailedSpawns;
+		return;
+	}
+
+	UHMVRInteractableComponent* Interactable = Actor->FindComponentByClass<UHMVRInteractableComponent>();
+	if (Interactable)
+	{
+		Interactable->ObjectId = Entry.Id;
+		Interactable->bPersistent = Entry.bPersistent;
+	}
+
+	// Per-type fields, before BeginPlay reads them
+	if (AHMVRCreature* Creature = Cast<AHMVRCreature>(Actor))
+	{
+		if (Entry.Health > 0.f) Creature->MaxHealth = Entry.Health;
+		if (Entry.PatrolRadius > 0.f) Creature->PatrolRadius = Entry.PatrolRadius;
+	}
+	else if (AHMVRMachinery* Machinery = Cast<AHMVRMachinery>(Actor))
+	{
+		if (!Entry.RequiredKeyId.IsEmpty())
+		{
+			Machinery->bRequiresKey = true;
+			Machinery->RequiredKeyId = Entry.RequiredKeyId;
+		}
+		if (Entry.TriggerRadius > 0.f) Machinery->InteractionSphere->SetSphereRadius(Entry.TriggerRadius);
+	}
+	else if (AHMVRArtifact* Artifact = Cast<AHMVRArtifact>(Actor))
+	{
+		if (!Entry.ArtefactId.IsEmpty()) Artifact->ArtifactId = Entry.ArtefactId;
+		if (!Entry.GrantsAbility.IsEmpty())
+		{
+			Artifact->bGrantsAbility = true;
+			Artifact->AbilityId = Entry.GrantsAbility;
+		}
+	}
+	else if (AHMVREnvironmental* Environmental = Cast<AHMVREnvironmental>(Actor))
+	{
+		if (Entry.TriggerRadius > 0.f) Environmental->TriggerRadius = Entry.TriggerRadius;
+	}
+
+	if (!Entry.ModelAssetId.IsEmpty())
+	{
+		UObject* Model = ResolveAsset(Entry.ModelAssetId).ResolveObject();
+		if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(Model))
+		{
+			if (UStaticMeshComponent* MeshComponent = Actor->FindComponentByClass<UStaticMeshComponent>())
+			{
+				MeshComponent->SetStaticMesh(StaticMesh);
+			}
+		}
+		else if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(Model))
+		{
+			if (USkeletalMeshComponent* MeshComponent = Actor->FindComponentByClass<USkeletalMeshComponent>())
+			{
+				MeshComponent->SetSkeletalMeshAsset(SkeletalMesh);
+			}
+		}
+	}
+
+	Actor->FinishSpawning(Transform);
+	++SpawnedActors;
+
+	if (Interactable)
+	{
+		OnInteractableSpawned.Broadcast(Interactable);
+	}
+}
+
+void UHMVRScenePlanLoader::SpawnProp(const FHMVRScenePlanProp& Prop)
+{
+	FHMVRPropDesc Desc;
+	Desc.Mesh = Cast<UStaticMesh>(ResolveAsset(Prop.Mesh).ResolveObject());
+	if (!Desc.Mesh)
+	{
+		++FailedSpawns;
+		return;
+	}
+	Desc.Material = Cast<UMaterialInterface>(ResolveAsset(Prop.Material).ResolveObject());
+	Desc.Transform = Prop.Transform;
+	Desc.bMovable = Prop.bMovable;
+	Desc.Id = Prop.Id.IsEmpty() ? NAME_None : FName(*Prop.Id);
+	PropBatcher.Add(Desc);
+}
+
+// ── Done ─────────────────────────────────────────────────────────────────────
+
+void UHMVRScenePlanLoader::Finish(bool bSuccess)
+{
+	const bool bSpawned = Stage == EStage::FirstFrame;
+	Stage = EStage::Idle;
+	PreloadHandle.Reset(); // spawned actors hold their own references now
+
+	if (bSuccess && bSpawned)
+	{
+		const double Now = FPlatformTime::Seconds();
+		UE_LOG(LogTemp, Log,
+			TEXT("ScenePlan: %s — %d interactables, %d props, %d starts, %d zones; %d actors spawned, props instanced into %d batch actors, %d failed"),
+			*Plan.Name, Plan.Interactables.Num(), Plan.Props.Num(), Plan.ParticipantSpawns.Num(), Plan.Zones.Num(),
+			SpawnedActors, PropBatches, FailedSpawns);
+		UE_LOG(LogTemp, Log,
+			TEXT("ScenePlan: read+parse %.1f ms (worker) | preload %d assets %.1f ms | spawn %.1f ms over %d frames, max slice %.2f ms, max frame %.1f ms, first frame after %.1f ms | total %.2f s, %.2f s after process start"),
+			ParseSeconds * 1000.0, PreloadAssetCount, (SpawnStartTime - PreloadStartTime) * 1000.0,
+			(SpawnEndTime - SpawnStartTime) * 1000.0, SpawnFrames, MaxSliceSeconds * 1000.0,
+			MaxFrameSeconds * 1000.0, FirstFrameSeconds * 1000.0, Now - LoadStartTime, Now - GStartTime);
+	}
+
+	OnLoaded.Broadcast(bSuccess);
+}
+
+// ── Resolution ───────────────────────────────────────────────────────────────
+
+FSoftObjectPath UHMVRScenePlanLoader::ResolveAsset(const FString& IdOrPath) const
+{
+	if (IdOrPath.IsEmpty())
+	{
+		return FSoftObjectPath();
+	}
+	if (IdOrPath.StartsWith(TEXT("/")))
+	{
+		return FSoftObjectPath(IdOrPath);
+	}
+	const FSoftObjectPath* Found = AssetCatalog.Find(IdOrPath);
+	return Found ? *Found : FSoftObjectPath();
+}
+
+UClass* UHMVRScenePlanLoader::ResolveClass(EHMVRScenePlanObjectType Type) const
+{
+	// Native classes unless DefaultGame.ini points at Blueprint subclasses
+	switch (Type)
+	{
+	case EHMVRScenePlanObjectType::Creature:
+		return CreatureClass.IsNull() ? AHMVRCreature::StaticClass() : CreatureClass.Get();
+	case EHMVRScenePlanObjectType::Machinery:
+		return MachineryClass.IsNull() ? AHMVRMachinery::StaticClass() : MachineryClass.Get();
+	case EHMVRScenePlanObjectType::Artefact:
+		return ArtefactClass.IsNull() ? AHMVRArtifact::StaticClass() : ArtefactClass.Get();
+	case EHMVRScenePlanObjectType::Environmental:
+		return EnvironmentalClass.IsNull() ? AHMVREnvironmental::StaticClass() : EnvironmentalClass.Get();
+	}
+	return nullptr;
+}
@@ -0,0 +1,124 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "UObject/SoftObjectPath.h"
+#include "Engine/StreamableManager.h"
+#include "Containers/Ticker.h"
+#include "HMVRScenePlan.h"
+#include "HMVRPropBatch.h"
+#include "HMVRScenePlanLoader.generated.h"
+
+class UHMVRInteractableComponent;
+class UStaticMesh;
+class UMaterialInterface;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnScenePlanInteractableSpawned, UHMVRInteractableComponent*);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnScenePlanLoaded, bool /*bSuccess*/);
+
+/**
+ * Builds the world from a ScenePlan instead of hand-placed level content.
+ *
+ * Load() runs in three stages, none of which blocks a frame for long:
+ *   1. read + parse on a worker thread (FHMVRScenePlan::Parse, streaming, no DOM);
+ *   2. async load of every class, mesh and material the plan references;
+ *   3. spawn in time-sliced batches from a core ticker, at most hmvr.ScenePlan.SpawnBudgetMs
+ *      of spawning per frame — participant starts first, then interactables; props are
+ *      collected, then instanced by an FHMVRPropBatcher one batch actor at a time in the
+ *      same budget.
+ *
+ * Interactables are spawned deferred so ObjectId, persistence and the per-type fields are in
+ * place before BeginPlay; each one is then handed to OnInteractableSpawned (the game mode's
+ * registry). A "ScenePlan:" summary with parse/preload/spawn times, frames used, the worst
+ * slice and frame, and seconds since process start is logged when the last batch lands.
+ *
+ * Server/standalone only — spawned actors replicate to clients as usual.
+ */
+UCLASS(Config = Game)
+class HYPERMAGEVR_API UHMVRScenePlanLoader : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	/** Start loading the plan at Path (absolute, or relative to the project dir). False if busy or the world is a client. */
+	bool Load(UWorld* World, const FString& Path);
+
+	bool IsLoading() const { return Stage != EStage::Idle; }
+
+	/** Classes, meshes and materials InPlan needs that are not resident yet. Returns how many ids AssetCatalog could not resolve. */
+	int32 CollectAssetPaths(const FHMVRScenePlan& InPlan, TArray<FSoftObjectPath>& OutPaths) const;
+
+	/** The last plan parsed (empty until stage 1 completes). */
+	const FHMVRScenePlan& GetPlan() const { return Plan; }
+
+	FOnScenePlanInteractableSpawned OnInteractableSpawned;
+	FOnScenePlanLoaded OnLoaded;
+
+	/** Plan loaded at startup when neither ?ScenePlan= nor -ScenePlan= is given. Empty = none. */
+	UPROPERTY(Config)
+	FString ScenePlanPath;
+
+	// Actor class per interactable type; unset = the native HMVR class
+	UPROPERTY(Config)
+	TSoftClassPtr<AActor> CreatureClass;
+
+	UPROPERTY(Config)
+	TSoftClassPtr<AActor> MachineryClass;
+
+	UPROPERTY(Config)
+	TSoftClassPtr<AActor> ArtefactClass;
+
+	UPROPERTY(Config)
+	TSoftClassPtr<AActor> EnvironmentalClass;
+
+	/** model_asset_id / prop mesh ids that are not object paths ("/Game/...") resolve through here. */
+	UPROPERTY(Config)
+	TMap<FString, FSoftObjectPath> AssetCatalog;
+
+private:
+	enum class EStage : uint8 { Idle, Parsing, Preloading, Spawning, FirstFrame };
+
+	void OnParsed(TSharedPtr<FHMVRScenePlan> Parsed, const FString& Error);
+	void OnPreloaded();
+	bool SpawnTick(float DeltaTime);
+	void Finish(bool bSuccess);
+
+	void SpawnParticipantStart(const FHMVRScenePlanSpawn& Spawn);
+	void SpawnInteractable(const FHMVRScenePlanInteractable& Entry);
+	void SpawnProp(const FHMVRScenePlanProp& Prop);
+
+	FSoftObjectPath ResolveAsset(const FString& IdOrPath) const;
+	UClass* ResolveClass(EHMVRScenePlanObjectType Type) const;
+
+	TWeakObjectPtr<UWorld> TargetWorld;
+	FString PlanPath;
+	FHMVRScenePlan Plan;
+	EStage Stage = EStage::Idle;
+
+	FStreamableManager StreamableManager;
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	int32 PreloadAssetCount = 0;
+	int32 UnresolvedAssets = 0;
+
+	FTSTicker::FDelegateHandle SpawnTickerHandle;
+	int32 NextSpawnIndex = 0;
+	FHMVRPropBatcher PropBatcher;
+	int32 SpawnedActors = 0;
+	int32 PropBatches = 0;
+	int32 FailedSpawns = 0;
+
+	// Timing (FPlatformTime::Seconds)
+	double LoadStartTime = 0.0;
+	double ParseSeconds = 0.0;
+	double PreloadStartTime = 0.0;
+	double SpawnStartTime = 0.0;
+	double SpawnEndTime = 0.0;
+	int32 SpawnFrames = 0;
+	double MaxSliceSeconds = 0.0;
+	float MaxFrameSeconds = 0.f;
+	float FirstFrameSeconds = 0.f;
+};
@@ -0,0 +1,110 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRServerPolicy.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/ArchiveCountMem.h"
+
+static FAutoConsoleCommandWithWorld CmdServerTickAudit(
+	TEXT("HMVR.Server.TickAudit"),
+	TEXT("Log actors per class with bytes per actor and every enabled actor and component tick, then the totals."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&HMVRServerPolicy::LogTickAudit));
+
+namespace
+{
+	bool IsTicking(const FTickFunction& TickFunction)
+	{
+		return TickFunction.IsTickFunctionRegistered() && TickFunction.IsTickFunctionEnabled();
+	}
+
+	struct FClassAudit
+	{
+		int32 Actors = 0;
+		int32 TickingActors = 0;
+		int32 Components = 0;
+		int64 Bytes = 0;
+		TMap<FName, int32> TickingComponents; // component class -> enabled ticks
+		int32 ThrottledTicks = 0;             // enabled ticks with a tick interval
+	};
+}
+
+void HMVRServerPolicy::LogTickAudit(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	TMap<FName, FClassAudit> ByClass;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		FClassAudit& Audit = ByClass.FindOrAdd(Actor->GetClass()->GetFName());
+		++Audit.Actors;
+		Audit.Bytes += FArchiveCountMem(Actor).GetMax();
+		if (IsTicking(Actor->PrimaryActorTick))
+		{
+			++Audit.TickingActors;
+			Audit.ThrottledTicks += Actor->PrimaryActorTick.TickInterval > 0.f ? 1 : 0;
+		}
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (!Component)
+			{
+				continue;
+			}
+			++Audit.Components;
+			Audit.Bytes += FArchiveCountMem(Component).GetMax();
+			if (IsTicking(Component->PrimaryComponentTick))
+			{
+				++Audit.TickingComponents.FindOrAdd(Component->GetClass()->GetFName());
+				Audit.ThrottledTicks += Component->PrimaryComponentTick.TickInterval > 0.f ? 1 : 0;
+			}
+		}
+	}
+
+	// Heaviest classes first
+	ByClass.ValueSort([](const FClassAudit& A, const FClassAudit& B) { return A.Bytes > B.Bytes; });
+
+	const TCHAR* NetMode = World->GetNetMode() == NM_DedicatedServer ? TEXT("dedicated server")
+		: World->GetNetMode() == NM_ListenServer ? TEXT("listen server")
+		: World->GetNetMode() == NM_Client ? TEXT("client") : TEXT("standalone");
+	UE_LOG(LogTemp, Log, TEXT("HMVRServerPolicy: tick audit (%s, cosmetics %s)"),
+		NetMode, WantsCosmetics() ? TEXT("created") : TEXT("stripped"));
+
+	int32 TotalActors = 0;
+	int32 TotalComponents = 0;
+	int32 TotalActorTicks = 0;
+	int32 TotalComponentTicks = 0;
+	int32 TotalThrottled = 0;
+	int64 TotalBytes = 0;
+	for (const TPair<FName, FClassAudit>& Pair : ByClass)
+	{
+		const FClassAudit& Audit = Pair.Value;
+		int32 ComponentTicks = 0;
+		FString TickingList;
+		for (const TPair<FName, int32>& Ticking : Audit.TickingComponents)
+		{
+			ComponentTicks += Ticking.Value;
+			TickingList += FString::Printf(TEXT("%s%s x%d"), TickingList.IsEmpty() ? TEXT("") : TEXT(", "), *Ticking.Key.ToString(), Ticking.Value);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("HMVRServerPolicy:   %-40s x%-4d %7.1f KB/actor  components %-4d ticks: actor %d, components %d%s%s"),
+			*Pair.Key.ToString(), Audit.Actors, Audit.Bytes / 1024.0 / Audit.Actors, Audit.Components,
+			Audit.TickingActors, ComponentTicks, TickingList.IsEmpty() ? TEXT("") : TEXT(" — "), *TickingList);
+
+		TotalActors += Audit.Actors;
+		TotalComponents += Audit.Components;
+		TotalActorTicks += Audit.TickingActors;
+		TotalComponentTicks += ComponentTicks;
+		TotalThrottled += Audit.ThrottledTicks;
+		TotalBytes += Audit.Bytes;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("HMVRServerPolicy: %d actors, %d components, %.1f KB (%.1f KB/actor); %d tick functions enabled (%d actor, %d component, %d with a tick interval)"),
+		TotalActors, TotalComponents, TotalBytes / 1024.0, TotalActors > 0 ? TotalBytes / 1024.0 / TotalActors : 0.0,
+		TotalActorTicks + TotalComponentTicks, TotalActorTicks, TotalComponentTicks, TotalThrottled);
+}
@@ -0,0 +1,33 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+namespace HMVRServerPolicy
+{
+	/**
+	 * Whether presentation-only components (cosmetic movement, post-process, sounds) run. False on
+	 * the dedicated server. Constructors create those components under #if !UE_SERVER only, so the
+	 * class default object is the same in every binary that loads the same Blueprints; a game
+	 * binary started with -server destroys them in BeginPlay instead. They are optional
+	 * (CreateOptionalDefaultSubobject), so callers null-check them.
+	 */
+	inline bool WantsCosmetics()
+	{
+#if UE_SERVER
+		return false;
+#else
+		return !IsRunningDedicatedServer();
+#endif
+	}
+
+	/**
+	 * Log every actor class in World with instance count, approximate bytes per actor (actor plus
+	 * its components) and the actor and component tick functions that are registered and enabled,
+	 * then the totals. Console: HMVR.Server.TickAudit.
+	 */
+	HYPERMAGEVR_API void LogTickAudit(UWorld* World);
+}
@@ -0,0 +1,349 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "HMVRSessionSnapshot.h"
+#include "RewardSystem.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<int32> CVarSnapshotEnabled(
+	TEXT("hmvr.Snapshot.Enabled"),
+	1,
+	TEXT("Snapshot session and reward state to local disk and recover it after a crash (read at InitGame)."));
+
+static TAutoConsoleVariable<float> CVarSnapshotInterval(
+	TEXT("hmvr.Snapshot.IntervalSeconds"),
+	1.f,
+	TEXT("How often changed sessions and rewards are collected and written to the snapshot."));
+
+namespace
+{
+	constexpr uint32 SnapshotMagic = 0x53534D48; // "HMSS"
+	constexpr uint32 SnapshotVersion = 1;
+
+	struct FSnapshotHeader
+	{
+		uint32 Magic = SnapshotMagic;
+		uint32 Version = SnapshotVersion;
+		uint64 Sequence = 0;
+		int64 WrittenAtTicks = 0;
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+	};
+	static_assert(sizeof(FSnapshotHeader) == 32, "Snapshot header layout is part of the file format");
+
+	void SerializeSession(FArchive& Ar, FPlayerSession& Session)
+	{
+		uint8 State = static_cast<uint8>(Session.State);
+		Ar << Session.SessionId.Hi << Session.SessionId.Lo;
+		Ar << Session.PlayerId << Session.ShardId << State;
+		Ar << Session.StartTime << Session.EndTime << Session.EventCount << Session.Rewards << Session.TTL;
+		Session.State = static_cast<ESessionState>(State);
+	}
+
+	// Header and CRC checked; false for a missing, torn or foreign file
+	bool ReadBuffer(const FString& Path, FSnapshotHeader& OutHeader, FHMVRSessionSnapshot::FRecovered* OutRecovered)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		const int64 FileSize = PlatformFile.FileSize(*Path);
+		if (FileSize < static_cast<int64>(sizeof(FSnapshotHeader)))
+		{
+			return false;
+		}
+
+		TUniquePtr<IMappedFileHandle> Mapped(PlatformFile.OpenMapped(*Path));
+		TUniquePtr<IMappedFileRegion> Region(Mapped ? Mapped->MapRegion(0, FileSize) : nullptr);
+		if (!Region)
+		{
+			return false;
+		}
+
+		const uint8* Data = Region->GetMappedPtr();
+		FMemory::Memcpy(&OutHeader, Data, sizeof(FSnapshotHeader));
+		if (OutHeader.Magic != SnapshotMagic || OutHeader.Version != SnapshotVersion
+			|| static_cast<int64>(sizeof(FSnapshotHeader)) + OutHeader.PayloadSize > FileSize)
+		{
+			return false;
+		}
+
+		const uint8* Payload = Data + sizeof(FSnapshotHeader);
+		if (FCrc::MemCrc32(Payload, OutHeader.PayloadSize) != OutHeader.PayloadCrc)
+		{
+			return false;
+		}
+		if (!OutRecovered)
+		{
+			return true;
+		}
+
+		FMemoryReaderView Ar(MakeMemoryView(Payload, OutHeader.PayloadSize));
+		int32 NumSessions = 0;
+		Ar << NumSessions;
+		for (int32 i = 0; i < NumSessions && !Ar.IsError(); ++i)
+		{
+			SerializeSession(Ar, OutRecovered->Sessions.AddDefaulted_GetRef());
+		}
+		int32 NumPlayers = 0;
+		Ar << NumPlayers;
+		for (int32 i = 0; i < NumPlayers && !Ar.IsError(); ++i)
+		{
+			FString PlayerId;
+			TArray<FString> Rewards;
+			Ar << PlayerId << Rewards;
+			OutRecovered->PlayerRewards.Add(MoveTemp(PlayerId), MoveTemp(Rewards));
+		}
+		if (Ar.IsError())
+		{
+			OutRecovered->Sessions.Reset();
+			OutRecovered->PlayerRewards.Reset();
+			return false;
+		}
+
+		OutRecovered->Sequence = OutHeader.Sequence;
+		OutRecovered->WrittenAt = FDateTime(OutHeader.WrittenAtTicks);
+		return true;
+	}
+}
+
+FHMVRSessionSnapshot::FHMVRSessionSnapshot(const FString& InDirectory)
+	: Directory(InDirectory)
+	, Writer(MakeShared<FWriter, ESPMode::ThreadSafe>())
+{
+	Writer->Paths[0] = FPaths::Combine(Directory, TEXT("SessionSnapshot_A.bin"));
+	Writer->Paths[1] = FPaths::Combine(Directory, TEXT("SessionSnapshot_B.bin"));
+}
+
+FHMVRSessionSnapshot::~FHMVRSessionSnapshot()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+bool FHMVRSessionSnapshot::IsEnabled()
+{
+	return CVarSnapshotEnabled.GetValueOnGameThread() != 0;
+}
+
+FString FHMVRSessionSnapshot::GetDefaultDirectory(int32 Port)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SessionSnapshots"), FString::Printf(TEXT("Port_%d"), Port));
+}
+
+bool FHMVRSessionSnapshot::Recover(FRecovered& OutRecovered, FString& OutError)
+{
+	check(!TickerHandle.IsValid());
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Headers first, then parse only the newer valid buffer
+	int32 Newest = INDEX_NONE;
+	uint64 NewestSequence = 0;
+	for (int32 i = 0; i < 2; ++i)
+	{
+		FSnapshotHeader Header;
+		if (ReadBuffer(Writer->Paths[i], Header, nullptr) && Header.Sequence > NewestSequence)
+		{
+			Newest = i;
+			NewestSequence = Header.Sequence;
+		}
+	}
+	if (Newest == INDEX_NONE)
+	{
+		OutError = FString::Printf(TEXT("No valid snapshot in %s"), *Directory);
+		return false;
+	}
+
+	FSnapshotHeader Header;
+	if (!ReadBuffer(Writer->Paths[Newest], Header, &OutRecovered))
+	{
+		OutError = FString::Printf(TEXT("Snapshot %s changed or is corrupt"), *Writer->Paths[Newest]);
+		return false;
+	}
+
+	// Continue the sequence so the first write goes to the other buffer
+	Writer->NextSequence = OutRecovered.Sequence + 1;
+
+	Stats.RecoverMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	Stats.RecoveredSessions = OutRecovered.Sessions.Num();
+	return true;
+}
+
+void FHMVRSessionSnapshot::Start(USessionManager* InSessionManager, URewardSystem* InRewardSystem)
+{
+	SessionManager = InSessionManager;
+	RewardSystem = InRewardSystem;
+	if (InSessionManager)
+	{
+		InSessionManager->SetDirtyTracking(true);
+	}
+	if (InRewardSystem)
+	{
+		InRewardSystem->SetDirtyTracking(true);
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FHMVRSessionSnapshot::Tick),
+			FMath::Max(0.05f, CVarSnapshotInterval.GetValueOnGameThread()));
+	}
+}
+
+bool FHMVRSessionSnapshot::Tick(float /*DeltaTime*/)
+{
+	if (bWriteInFlight)
+	{
+		++Stats.SkippedBusy; // changes keep accumulating in the sources
+		return true;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	FDelta Delta;
+	if (USessionManager* Sessions = SessionManager.Get())
+	{
+		Sessions->ConsumeDirty(Delta.ChangedSessions, Delta.RemovedSessions);
+	}
+	if (URewardSystem* Rewards = RewardSystem.Get())
+	{
+		Rewards->ConsumeDirty(Delta.ChangedRewards, Delta.RemovedRewards);
+	}
+
+	const int32 NumDirty = Delta.ChangedSessions.Num() + Delta.RemovedSessions.Num()
+		+ Delta.ChangedRewards.Num() + Delta.RemovedRewards.Num();
+	if (NumDirty == 0)
+	{
+		return true; // the last image still holds
+	}
+
+	Stats.LastDirty = NumDirty;
+	Stats.LastCollectMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	Stats.MaxCollectMs = FMath::Max(Stats.MaxCollectMs, Stats.LastCollectMs);
+	Stats.TotalCollectMs += Stats.LastCollectMs;
+	bWriteInFlight = true;
+
+	TWeakPtr<FHMVRSessionSnapshot> WeakThis = AsShared();
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Writer = Writer, Delta = MoveTemp(Delta)]() mutable
+	{
+		FWriteResult Result = Writer->Write(MoveTemp(Delta));
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Result = MoveTemp(Result)]()
+		{
+			if (TSharedPtr<FHMVRSessionSnapshot> This = WeakThis.Pin())
+			{
+				This->OnWriteDone(Result);
+			}
+		});
+	});
+	return true;
+}
+
+FHMVRSessionSnapshot::FWriteResult FHMVRSessionSnapshot::FWriter::Write(FDelta&& Delta)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (FPlayerSession& Session : Delta.ChangedSessions)
+	{
+		Sessions.Add(Session.SessionId, MoveTemp(Session));
+	}
+	for (const FHMVRId& SessionId : Delta.RemovedSessions)
+	{
+		Sessions.Remove(SessionId);
+	}
+	for (TPair<FString, TArray<FString>>& Player : Delta.ChangedRewards)
+	{
+		PlayerRewards.Add(MoveTemp(Player.Key), MoveTemp(Player.Value));
+	}
+	for (const FString& PlayerId : Delta.RemovedRewards)
+	{
+		PlayerRewards.Remove(PlayerId);
+	}
+
+	// Whole image into the buffer the previous write did not use
+	FSnapshotHeader Header;
+	Header.Sequence = NextSequence;
+	Header.WrittenAtTicks = FDateTime::UtcNow().GetTicks();
+
+	Buffer.Reset();
+	Buffer.AddZeroed(sizeof(FSnapshotHeader));
+	FMemoryWriter Ar(Buffer);
+	Ar.Seek(sizeof(FSnapshotHeader));
+	int32 NumSessions = Sessions.Num();
+	Ar << NumSessions;
+	for (TPair<FHMVRId, FPlayerSession>& Pair : Sessions)
+	{
+		SerializeSession(Ar, Pair.Value);
+	}
+	int32 NumPlayers = PlayerRewards.Num();
+	Ar << NumPlayers;
+	for (TPair<FString, TArray<FString>>& Pair : PlayerRewards)
+	{
+		Ar << Pair.Key << Pair.Value;
+	}
+
+	Header.PayloadSize = static_cast<uint32>(Buffer.Num() - sizeof(FSnapshotHeader));
+	Header.PayloadCrc = FCrc::MemCrc32(Buffer.GetData() + sizeof(FSnapshotHeader), Header.PayloadSize);
+	FMemory::Memcpy(Buffer.GetData(), &Header, sizeof(FSnapshotHeader));
+
+	FWriteResult Result;
+	Result.Sequence = Header.Sequence;
+	Result.Bytes = Buffer.Num();
+	Result.Sessions = NumSessions;
+	Result.Players = NumPlayers;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString& Path = Paths[Header.Sequence & 1];
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+	TUniquePtr<IFileHandle> File(PlatformFile.OpenWrite(*Path));
+	if (!File)
+	{
+		Result.Error = FString::Printf(TEXT("Could not open %s for writing"), *Path);
+	}
+	else if (!File->Write(Buffer.GetData(), Buffer.Num()) || !File->Flush(/*bFullFlush=*/true))
+	{
+		Result.Error = FString::Printf(TEXT("Could not write %lld bytes to %s"), Result.Bytes, *Path);
+	}
+	else
+	{
+		// A failed write keeps its sequence, so the retry lands in the same (already torn) buffer
+		// and the other one stays the newest valid snapshot
+		Result.bWritten = true;
+		++NextSequence;
+	}
+
+	Result.WriteMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	return Result;
+}
+
+void FHMVRSessionSnapshot::OnWriteDone(const FWriteResult& Result)
+{
+	bWriteInFlight = false;
+	Stats.LastWriteMs = Result.WriteMs;
+	if (!Result.bWritten)
+	{
+		++Stats.WriteFailures;
+		UE_LOG(LogTemp, Warning, TEXT("HMVRSessionSnapshot: Snapshot %llu not written: %s"), Result.Sequence, *Result.Error);
+		return;
+	}
+
+	++Stats.Snapshots;
+	Stats.LastBytes = Result.Bytes;
+	Stats.Sessions = Result.Sessions;
+	Stats.Players = Result.Players;
+	Stats.Sequence = Result.Sequence;
+	UE_LOG(LogTemp, Verbose, TEXT("HMVRSessionSnapshot: Wrote snapshot %llu (%d sessions, %d players, %lld bytes) — collect %.3f ms, write %.2f ms"),
+		Result.Sequence, Result.Sessions, Result.Players, Result.Bytes, Stats.LastCollectMs, Result.WriteMs);
+}
+
+void FHMVRSessionSnapshot::LogStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("HMVRSessionSnapshot: %lld snapshots (last %llu: %d sessions, %d players, %lld bytes) in %s; game thread collect last %.3f ms (%d records), avg %.3f ms, max %.3f ms; last write %.2f ms off-thread; %lld ticks skipped busy, %lld write failures; recovered %d sessions in %.2f ms"),
+		Stats.Snapshots, Stats.Sequence, Stats.Sessions, Stats.Players, Stats.LastBytes, *Directory,
+		Stats.LastCollectMs, Stats.LastDirty, Stats.TotalCollectMs / FMath::Max<int64>(1, Stats.Snapshots + Stats.WriteFailures), Stats.MaxCollectMs,
+		Stats.LastWriteMs, Stats.SkippedBusy, Stats.WriteFailures, Stats.RecoveredSessions, Stats.RecoverMs);
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "SessionManager.h"
+
+class URewardSystem;
+
+/**
+ * Crash-safe snapshot of session and reward state on local disk.
+ *
+ * USessionManager and URewardSystem only mark which records changed. Every
+ * hmvr.Snapshot.IntervalSeconds a core ticker copies those records out (the only game-thread
+ * cost, reported as the collect time) and hands them to a thread-pool writer, which folds them
+ * into its own image of the state and writes the whole image to one of two buffer files,
+ * alternating. Each buffer carries a sequence number and a payload CRC, so a crash mid-write
+ * leaves the other buffer as the newest valid snapshot. At most one write is in flight; changes
+ * made meanwhile are coalesced into the next one.
+ *
+ * On startup Recover() maps both buffers read-only and returns the newest valid one; the game
+ * mode re-inserts those sessions as ENDED and sends their summaries again.
+ */
+class HYPERMAGEVR_API FHMVRSessionSnapshot : public TSharedFromThis<FHMVRSessionSnapshot>
+{
+public:
+	/** Buffers live in Directory (one per server process slot; see GetDefaultDirectory) */
+	explicit FHMVRSessionSnapshot(const FString& InDirectory);
+	~FHMVRSessionSnapshot();
+
+	/** hmvr.Snapshot.Enabled */
+	static bool IsEnabled();
+
+	/** Saved/SessionSnapshots/Port_<Port>: a restarted process on the same port finds its predecessor's state */
+	static FString GetDefaultDirectory(int32 Port);
+
+	struct FRecovered
+	{
+		TArray<FPlayerSession> Sessions;
+		TMap<FString, TArray<FString>> PlayerRewards;
+		uint64 Sequence = 0;
+		FDateTime WrittenAt;
+	};
+
+	/** Load the newest valid buffer. False when there is none (first run) or neither is readable. Call before Start. */
+	bool Recover(FRecovered& OutRecovered, FString& OutError);
+
+	/** Turn on dirty tracking in both sources and start the snapshot ticker */
+	void Start(USessionManager* InSessionManager, URewardSystem* InRewardSystem);
+
+	struct FStats
+	{
+		int64 Snapshots = 0;
+		int64 SkippedBusy = 0;     // ticks that found the previous write still running
+		int64 WriteFailures = 0;
+		int32 LastDirty = 0;       // records copied by the last collect
+		double LastCollectMs = 0.0; // game thread
+		double MaxCollectMs = 0.0;
+		double TotalCollectMs = 0.0;
+		double LastWriteMs = 0.0;   // writer thread
+		int64 LastBytes = 0;
+		int32 Sessions = 0;        // in the last image written
+		int32 Players = 0;
+		uint64 Sequence = 0;
+		double RecoverMs = 0.0;
+		int32 RecoveredSessions = 0;
+	};
+	const FStats& GetStats() const { return Stats; }
+	void LogStats() const;
+
+private:
+	struct FDelta
+	{
+		TArray<FPlayerSession> ChangedSessions;
+		TArray<FHMVRId> RemovedSessions;
+		TArray<TPair<FString, TArray<FString>>> ChangedRewards;
+		TArray<FString> RemovedRewards;
+	};
+
+	struct FWriteResult
+	{
+		bool bWritten = false;
+		uint64 Sequence = 0;
+		double WriteMs = 0.0;
+		int64 Bytes = 0;
+		int32 Sessions = 0;
+		int32 Players = 0;
+		FString Error;
+	};
+
+	// Owned by whichever thread-pool task is writing (one at a time)
+	struct FWriter
+	{
+		FString Paths[2];
+		uint64 NextSequence = 1;
+		TMap<FHMVRId, FPlayerSession> Sessions;
+		TMap<FString, TArray<FString>> PlayerRewards;
+		TArray<uint8> Buffer;
+
+		FWriteResult Write(FDelta&& Delta);
+	};
+
+	bool Tick(float DeltaTime);
+	void OnWriteDone(const FWriteResult& Result);
+
+	FString Directory;
+	TSharedRef<FWriter, ESPMode::ThreadSafe> Writer;
+	TWeakObjectPtr<USessionManager> SessionManager;
+	TWeakObjectPtr<URewardSystem> RewardSystem;
+	FTSTicker::FDelegateHandle TickerHandle;
+	bool bWriteInFlight = false;
+	FStats Stats;
+};
@@ -0,0 +1,420 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Single-level hashed timing wheel.
+ *
+ * Schedule() and expiry are O(1) amortised regardless of how many timers are pending,
+ * which is the point: hundreds of outstanding retries cost one ticker, not one FTSTicker
+ * delegate each. Delays longer than one revolution (NumSlots * TickSeconds) wrap and carry
+ * a round counter. Resolution is TickSeconds; an item never fires early.
+ *
+ * Not thread-safe. The owner drives it by calling Advance() with a monotonic clock.
+ */
+template<typename ItemType>
+class THMVRTimingWheel
+{
+public:
+	explicit THMVRTimingWheel(double InTickSeconds = 0.05, int32 InNumSlots = 256)
+		: TickSeconds(FMath::Max(InTickSeconds, 0.001))
+	{
+		Slots.SetNum(FMath::Max(InNumSlots, 1));
+	}
+
+	/** Schedule Item to expire DelaySeconds after Now (same clock as Advance). */
+	void Schedule(double Now, double DelaySeconds, ItemType Item)
+	{
+		if (StartTime < 0.0)
+		{
+			StartTime = Now;
+		}
+		if (Count == 0)
+		{
+			// Idle wheels are not advanced; catch up so the delay is measured from Now
+			CurrentTick = FMath::Max(CurrentTick, ToTick(Now));
+		}
+
+		const uint64 DueTick = static_cast<uint64>(FMath::CeilToDouble(FMath::Max(0.0, Now + DelaySeconds - StartTime) / TickSeconds));
+		const uint64 Ticks = DueTick > CurrentTick ? DueTick - CurrentTick : 1;
+		const uint64 NumSlots = static_cast<uint64>(Slots.Num());
+
+		FEntry& Entry = Slots[static_cast<int32>((CurrentTick + Ticks) % NumSlots)].AddDefaulted_GetRef();
+		Entry.Rounds = static_cast<uint32>((Ticks - 1) / NumSlots);
+		Entry.Item = MoveTemp(Item);
+		++Count;
+	}
+
+	/**
+	 * Move the wheel forward to Now and hand every expired item to OnExpired(ItemType&&).
+	 * Items scheduled from inside OnExpired land relative to the new position.
+	 */
+	template<typename FuncType>
+	void Advance(double Now, FuncType&& OnExpired)
+	{
+		if (StartTime < 0.0)
+		{
+			StartTime = Now;
+			return;
+		}
+
+		const uint64 TargetTick = ToTick(Now);
+		TArray<ItemType> Expired;
+
+		while (CurrentTick < TargetTick)
+		{
+			++CurrentTick;
+			TArray<FEntry>& Slot = Slots[static_cast<int32>(CurrentTick % static_cast<uint64>(Slots.Num()))];
+			for (int32 i = Slot.Num() - 1; i >= 0; --i)
+			{
+				if (Slot[i].Rounds == 0)
+				{
+					Expired.Add(MoveTemp(Slot[i].Item));
+					Slot.RemoveAtSwap(i, 1, EAllowShrinking::No);
+					--Count;
+				}
+				else
+				{
+					--Slot[i].Rounds;
+				}
+			}
+
+			if (Count == 0)
+			{
+				CurrentTick = TargetTick; // nothing left to visit
+			}
+		}
+
+		for (ItemType& Item : Expired)
+		{
+			OnExpired(MoveTemp(Item));
+		}
+	}
+
+	void Reset()
+	{
+		for (TArray<FEntry>& Slot : Slots)
+		{
+			Slot.Reset();
+		}
+		Count = 0;
+	}
+
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+	double GetTickSeconds() const { return TickSeconds; }
+
+private:
+	uint64 ToTick(double Now) const
+	{
+		return static_cast<uint64>(FMath::Max(0.0, Now - StartTime) / TickSeconds);
+	}
+
+	struct FEntry
+	{
+		uint32 Rounds = 0;
+		ItemType Item;
+	};
+
+	TArray<TArray<FEntry>> Slots;
+	double TickSeconds;
+	double StartTime = -1.0;
+	uint64 CurrentTick = 0;
+	int32 Count = 0;
+};
+
+/**
+ * Hierarchical timing wheel with handles: NumLevels wheels of NumSlots slots each, level L
+ * covering NumSlots^(L+1) ticks. An item goes into the lowest level its delay fits and is
+ * cascaded one level down when the wheel reaches its slot, so Schedule() and Cancel() are O(1)
+ * (intrusive lists over a node pool — no searching, no heap) and Advance() costs one slot visit
+ * per tick plus the items that move. With the default 10 ms tick the top level reaches ~46 h;
+ * longer delays park in the top level and are re-linked when it comes round.
+ *
+ * Advance() hands every item that expired during the call to the callback as one batch, in
+ * due order. Handles are generation-checked, so cancelling one that already fired is a no-op.
+ *
+ * Not thread-safe. The owner drives it by calling Advance() with a monotonic clock.
+ */
+template<typename ItemType>
+class THMVRHierarchicalTimingWheel
+{
+public:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr int32 NumLevels = 4;
+
+	explicit THMVRHierarchicalTimingWheel(double InTickSeconds = 0.01)
+		: TickSeconds(FMath::Max(InTickSeconds, 0.001))
+	{
+		for (int32& Head : Heads)
+		{
+			Head = INDEX_NONE;
+		}
+	}
+
+	/** Schedule Item to expire DelaySeconds after Now (same clock as Advance). Never zero. */
+	uint64 Schedule(double Now, double DelaySeconds, ItemType Item)
+	{
+		if (StartTime < 0.0)
+		{
+			StartTime = Now;
+		}
+		if (Count == 0)
+		{
+			// Idle wheels are not advanced; catch up so the delay is measured from Now
+			CurrentTick = FMath::Max(CurrentTick, ToTick(Now));
+		}
+
+		const uint64 DueTick = static_cast<uint64>(FMath::CeilToDouble(FMath::Max(0.0, Now + DelaySeconds - StartTime) / TickSeconds));
+
+		int32 Index;
+		if (FreeList.Num() > 0)
+		{
+			Index = FreeList.Pop(EAllowShrinking::No);
+		}
+		else
+		{
+			Index = Nodes.AddDefaulted();
+		}
+		FNode& Node = Nodes[Index];
+		Node.Item = MoveTemp(Item);
+		Node.DueTick = FMath::Max(DueTick, CurrentTick + 1);
+		Link(Index);
+		++Count;
+		return MakeHandle(Index, Node.Generation);
+	}
+
+	/** Drop a pending item. False if Handle already fired, was cancelled or is zero. */
+	bool Cancel(uint64 Handle)
+	{
+		const int32 Index = FindPending(Handle);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+		Unlink(Index);
+		Free(Index);
+		return true;
+	}
+
+	bool IsPending(uint64 Handle) const { return FindPending(Handle) != INDEX_NONE; }
+
+	/** The item behind a pending handle, or null */
+	const ItemType* Find(uint64 Handle) const
+	{
+		const int32 Index = FindPending(Handle);
+		return Index != INDEX_NONE ? &Nodes[Index].Item : nullptr;
+	}
+
+	/** Seconds from Now until a pending handle expires (0 if it is due or not pending). */
+	double GetRemainingSeconds(double Now, uint64 Handle) const
+	{
+		const int32 Index = FindPending(Handle);
+		return Index != INDEX_NONE ? DueSeconds(Nodes[Index]) - Now : 0.0;
+	}
+
+	/** Visit every pending item with the seconds left until it expires, measured from Now. */
+	template<typename FuncType>
+	void ForEachPending(double Now, FuncType&& Visit) const
+	{
+		for (const FNode& Node : Nodes)
+		{
+			if (Node.Slot != INDEX_NONE)
+			{
+				Visit(Node.Item, FMath::Max(0.0, DueSeconds(Node) - Now));
+			}
+		}
+	}
+
+	/**
+	 * Move the wheel forward to Now and hand every expired item to OnExpired(TArray<ItemType>&)
+	 * in one batch. The handles are already released when it runs, so it may schedule and cancel.
+	 */
+	template<typename FuncType>
+	void Advance(double Now, FuncType&& OnExpired)
+	{
+		if (StartTime < 0.0)
+		{
+			StartTime = Now;
+			return;
+		}
+
+		const uint64 TargetTick = ToTick(Now);
+		Expired.Reset();
+
+		while (CurrentTick < TargetTick && Count > 0)
+		{
+			++CurrentTick;
+
+			// Highest wrapped level first, so what it drops into a lower slot due now is cascaded too
+			for (int32 Level = NumLevels - 1; Level > 0; --Level)
+			{
+				const int32 Shift = SlotBits * Level;
+				if ((CurrentTick & ((uint64(1) << Shift) - 1)) == 0)
+				{
+					Cascade(Level * NumSlots + static_cast<int32>((CurrentTick >> Shift) & (NumSlots - 1)));
+				}
+			}
+
+			int32 Index = DetachSlot(static_cast<int32>(CurrentTick & (NumSlots - 1)));
+			while (Index != INDEX_NONE)
+			{
+				const int32 Next = Nodes[Index].Next;
+				if (Nodes[Index].DueTick <= CurrentTick)
+				{
+					Expired.Add(MoveTemp(Nodes[Index].Item));
+					Free(Index);
+				}
+				else
+				{
+					Link(Index); // parked beyond the top level's reach
+				}
+				Index = Next;
+			}
+		}
+		CurrentTick = FMath::Max(CurrentTick, TargetTick); // nothing left to visit
+
+		if (Expired.Num() > 0)
+		{
+			OnExpired(Expired);
+		}
+	}
+
+	void Reset()
+	{
+		for (int32& Head : Heads)
+		{
+			Head = INDEX_NONE;
+		}
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			if (Nodes[Index].Slot != INDEX_NONE)
+			{
+				Free(Index);
+			}
+		}
+		Count = 0;
+	}
+
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+	double GetTickSeconds() const { return TickSeconds; }
+
+private:
+	struct FNode
+	{
+		ItemType Item;
+		uint64 DueTick = 0;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Slot = INDEX_NONE;   // Level * NumSlots + index; INDEX_NONE when free
+		uint32 Generation = 1;
+	};
+
+	static uint64 MakeHandle(int32 Index, uint32 Generation)
+	{
+		return (static_cast<uint64>(Generation) << 32) | static_cast<uint32>(Index + 1);
+	}
+
+	int32 FindPending(uint64 Handle) const
+	{
+		const int32 Index = static_cast<int32>(static_cast<uint32>(Handle)) - 1;
+		if (!Nodes.IsValidIndex(Index))
+		{
+			return INDEX_NONE;
+		}
+		const FNode& Node = Nodes[Index];
+		return Node.Slot != INDEX_NONE && Node.Generation == static_cast<uint32>(Handle >> 32) ? Index : INDEX_NONE;
+	}
+
+	uint64 ToTick(double Now) const
+	{
+		return static_cast<uint64>(FMath::Max(0.0, Now - StartTime) / TickSeconds);
+	}
+
+	double DueSeconds(const FNode& Node) const
+	{
+		return StartTime + static_cast<double>(Node.DueTick) * TickSeconds;
+	}
+
+	/** Into the lowest level whose span covers the distance to DueTick (DueTick >= CurrentTick). */
+	void Link(int32 Index)
+	{
+		FNode& Node = Nodes[Index];
+		const uint64 Span = uint64(1) << (SlotBits * NumLevels);
+		const uint64 Delta = Node.DueTick - CurrentTick;
+		const uint64 DueTick = Delta < Span ? Node.DueTick : CurrentTick + Span - 1;
+
+		int32 Level = 0;
+		while (Level < NumLevels - 1 && (DueTick - CurrentTick) >= (uint64(1) << (SlotBits * (Level + 1))))
+		{
+			++Level;
+		}
+		Node.Slot = Level * NumSlots + static_cast<int32>((DueTick >> (SlotBits * Level)) & (NumSlots - 1));
+		Node.Prev = INDEX_NONE;
+		Node.Next = Heads[Node.Slot];
+		if (Node.Next != INDEX_NONE)
+		{
+			Nodes[Node.Next].Prev = Index;
+		}
+		Heads[Node.Slot] = Index;
+	}
+
+	void Unlink(int32 Index)
+	{
+		FNode& Node = Nodes[Index];
+		if (Node.Prev != INDEX_NONE)
+		{
+			Nodes[Node.Prev].Next = Node.Next;
+		}
+		else
+		{
+			Heads[Node.Slot] = Node.Next;
+		}
+		if (Node.Next != INDEX_NONE)
+		{
+			Nodes[Node.Next].Prev = Node.Prev;
+		}
+	}
+
+	/** Empty Slot and return its old list (still chained through Next). */
+	int32 DetachSlot(int32 Slot)
+	{
+		const int32 First = Heads[Slot];
+		Heads[Slot] = INDEX_NONE;
+		return First;
+	}
+
+	void Cascade(int32 Slot)
+	{
+		int32 Index = DetachSlot(Slot);
+		while (Index != INDEX_NONE)
+		{
+			const int32 Next = Nodes[Index].Next;
+			Link(Index);
+			Index = Next;
+		}
+	}
+
+	void Free(int32 Index)
+	{
+		FNode& Node = Nodes[Index];
+		Node.Item = ItemType();
+		Node.Slot = INDEX_NONE;
+		++Node.Generation;
+		FreeList.Add(Index);
+		--Count;
+	}
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeList;
+	TArray<ItemType> Expired;
+	int32 Heads[NumLevels * NumSlots];
+	double TickSeconds;
+	double StartTime = -1.0;
+	uint64 CurrentTick = 0;
+	int32 Count = 0;
+};
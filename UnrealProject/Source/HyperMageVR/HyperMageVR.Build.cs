@@ -40,9 +40,23 @@ public class HyperMageVR : ModuleRules
 			"Slate",
 			"SlateCore",
 			"Json",
-			"JsonUtilities"
+			"JsonUtilities",
+			"AssetRegistry",
+			"Sockets",
+			"NetCore"
 		});
 
+		// Local Session/World-State API stand-in (-LocalApiStub) — never compiled into Shipping
+		if (Target.Configuration != UnrealTargetConfiguration.Shipping)
+		{
+			PrivateDependencyModuleNames.Add("HTTPServer");
+			PublicDefinitions.Add("WITH_HMVR_API_STUB=1");
+		}
+		else
+		{
+			PublicDefinitions.Add("WITH_HMVR_API_STUB=0");
+		}
+
 		// VR-specific modules + Android manifest patch
 		if (Target.Platform == UnrealTargetPlatform.Android)
 		{
@@ -2,6 +2,8 @@
 
 #include "HyperMageVR.h"
 #include "Modules/ModuleManager.h"
+#include "HMVRHttpDispatcher.h"
+#include "HMVRLocalApiStub.h"
 
 IMPLEMENT_PRIMARY_GAME_MODULE(FHyperMageVRModule, HyperMageVR, "HyperMageVR");
 
@@ -14,5 +16,9 @@ void FHyperMageVRModule::StartupModule()
 void FHyperMageVRModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module
+	FHMVRHttpDispatcher::Get().Shutdown();
+#if WITH_HMVR_API_STUB
+	FHMVRLocalApiStub::Get().Stop();
+#endif
 	UE_LOG(LogTemp, Log, TEXT("HyperMageVR module shutdown"));
 }
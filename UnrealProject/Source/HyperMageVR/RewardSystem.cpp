@@ -1,11 +1,153 @@
 // Copyright 2026 HyperMage. All Rights Reserved.
 
 #include "RewardSystem.h"
+#include "SessionAPIClient.h"
+#include "HMVRRewardLedger.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
 #include "Dom/JsonObject.h"
+#include "HMVRApiEndpoints.h"
+#include "HMVRId.h"
+#include "HAL/IConsoleManager.h"
+#include "Containers/Ticker.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+static TAutoConsoleVariable<int32> CVarRewardsPrefetchMaxAttempts(
+	TEXT("hmvr.Rewards.PrefetchMaxAttempts"),
+	5,
+	TEXT("Fetches of a player's reward inventory before giving up until the player joins again."));
+
+static TAutoConsoleVariable<float> CVarRewardsPrefetchRetrySeconds(
+	TEXT("hmvr.Rewards.PrefetchRetrySeconds"),
+	1.f,
+	TEXT("Delay before the first inventory fetch retry; doubled per attempt, capped at 30 s."));
+
+#if !UE_BUILD_SHIPPING
+// Against the local stub (-LocalApiStub; latency via hmvr.Stub.LatencyMs / LatencyJitterMs):
+// seed each player's backend inventory, prefetch it into a fresh reward system as admission
+// would, then check duplicate protection runs from memory
+static FAutoConsoleCommandWithArgs CmdRewardsPrefetchTest(
+	TEXT("HMVR.Rewards.PrefetchTest"),
+	TEXT("HMVR.Rewards.PrefetchTest [Players=20] [RewardsPerPlayer=2] — seed, prefetch and check reward inventories against the Session API (local stub)."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString Endpoint = FHMVRApiEndpoints::GetSessionApiUrl();
+		if (Endpoint.IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("RewardSystem: PrefetchTest needs a Session API endpoint - run with -LocalApiStub"));
+			return;
+		}
+
+		struct FTest
+		{
+			TStrongObjectPtr<USessionAPIClient> Client;
+			TStrongObjectPtr<URewardSystem> Rewards;
+			TArray<FString> PlayerIds;
+			TArray<FString> Seeded;
+			FString Unseeded;
+			int32 SeedsOutstanding = 0;
+			int32 SeedFailures = 0;
+			double PrefetchStart = 0.0;
+			double Deadline = 0.0;
+		};
+		TSharedRef<FTest> Test = MakeShared<FTest>();
+		Test->Client.Reset(NewObject<USessionAPIClient>(GetTransientPackage()));
+		Test->Client->SetEndpointURL(Endpoint);
+		Test->Client->SetAwsRegion(FHMVRApiEndpoints::GetAwsRegion());
+		Test->Rewards.Reset(NewObject<URewardSystem>(GetTransientPackage()));
+		if (!Test->Rewards->Initialize())
+		{
+			return;
+		}
+
+		const int32 NumPlayers = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 20;
+		const TArray<FRewardCatalogEntry>& Catalog = Test->Rewards->GetCatalog().Rewards;
+		const int32 NumSeeded = FMath::Clamp(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 2, 1, FMath::Max(1, Catalog.Num() - 1));
+		if (Catalog.Num() < 2)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("RewardSystem: PrefetchTest needs at least two catalog rewards"));
+			return;
+		}
+		for (int32 i = 0; i < NumSeeded; ++i)
+		{
+			Test->Seeded.Add(Catalog[i].Id);
+		}
+		Test->Unseeded = Catalog[NumSeeded].Id;
+
+		// Fresh players per run so the stub's inventories from earlier runs do not interfere
+		const FString RunTag = FHMVRId::Generate().ToString().Right(8);
+		for (int32 i = 0; i < NumPlayers; ++i)
+		{
+			Test->PlayerIds.Add(FString::Printf(TEXT("prefetch-%s-%d"), *RunTag, i));
+		}
+
+		auto Check = [Test]()
+		{
+			URewardSystem* Rewards = Test->Rewards.Get();
+			int32 Loaded = 0, Missing = 0, DuplicatesAllowed = 0, NewRejected = 0;
+			for (const FString& PlayerId : Test->PlayerIds)
+			{
+				Loaded += Rewards->IsInventoryLoaded(PlayerId) ? 1 : 0;
+				for (const FString& RewardId : Test->Seeded)
+				{
+					Missing += Rewards->HasReward(PlayerId, RewardId) ? 0 : 1;
+				}
+				DuplicatesAllowed += Rewards->GrantReward(PlayerId, Test->Seeded[0]).bSuccess ? 1 : 0;
+				NewRejected += Rewards->GrantReward(PlayerId, Test->Unseeded).bSuccess ? 0 : 1;
+			}
+
+			const bool bPassed = Loaded == Test->PlayerIds.Num() && Missing == 0 && DuplicatesAllowed == 0 && NewRejected == 0 && Test->SeedFailures == 0;
+			UE_LOG(LogTemp, Log,
+				TEXT("RewardSystem: PrefetchTest %s — %d/%d inventories loaded in %.1f ms, %d seeded rewards missing, %d duplicate grants allowed, %d new grants rejected, %d seed writes failed"),
+				bPassed ? TEXT("PASSED") : TEXT("FAILED"), Loaded, Test->PlayerIds.Num(),
+				(FPlatformTime::Seconds() - Test->PrefetchStart) * 1000.0, Missing, DuplicatesAllowed, NewRejected, Test->SeedFailures);
+			Rewards->LogInventoryStats();
+		};
+
+		auto Prefetch = [Test, Check]()
+		{
+			Test->PrefetchStart = FPlatformTime::Seconds();
+			Test->Deadline = Test->PrefetchStart + 30.0;
+			Test->Rewards->SetApiClient(Test->Client.Get());
+			for (const FString& PlayerId : Test->PlayerIds)
+			{
+				Test->Rewards->PrefetchPlayerRewards(PlayerId);
+			}
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Test, Check](float)
+			{
+				for (const FString& PlayerId : Test->PlayerIds)
+				{
+					if (!Test->Rewards->IsInventoryLoaded(PlayerId) && FPlatformTime::Seconds() < Test->Deadline)
+					{
+						return true;
+					}
+				}
+				Check();
+				return false;
+			}));
+		};
+
+		// Seed through the same write-through endpoint the game uses
+		Test->SeedsOutstanding = NumPlayers * NumSeeded;
+		for (const FString& PlayerId : Test->PlayerIds)
+		{
+			for (const FString& RewardId : Test->Seeded)
+			{
+				Test->Client->SendRewardGrant(PlayerId, RewardId, [Test, Prefetch](bool bAcknowledged)
+				{
+					Test->SeedFailures += bAcknowledged ? 0 : 1;
+					if (--Test->SeedsOutstanding == 0)
+					{
+						Prefetch();
+					}
+				});
+			}
+		}
+	}));
+#endif
 
 bool URewardSystem::Initialize()
 {
@@ -31,15 +173,7 @@ bool URewardSystem::IsValidRewardId(const FString& RewardId) const
 	}
 
 	// Check if reward ID exists in catalog
-	for (const FRewardCatalogEntry& Entry : Catalog.Rewards)
-	{
-		if (Entry.Id == RewardId)
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return CatalogIndex.Contains(RewardId);
 }
 
 FRewardGrantResult URewardSystem::GrantReward(const FString& PlayerId, const FString& RewardId)
@@ -67,7 +201,8 @@ FRewardGrantResult URewardSystem::GrantReward(const FString& PlayerId, const FSt
 	}
 
 	// Validate reward ID against catalog (Requirement 5.3, 15.2, 15.3)
-	if (!IsValidRewardId(RewardId))
+	const int32* Bit = CatalogIndex.Find(RewardId);
+	if (!Bit)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("RewardSystem: Invalid reward ID: %s"), *RewardId);
 		return FRewardGrantResult::Failure(
@@ -77,11 +212,15 @@ FRewardGrantResult URewardSystem::GrantReward(const FString& PlayerId, const FSt
 		);
 	}
 
-	// Get or create player rewards array
-	TArray<FString>& Rewards = PlayerRewards.FindOrAdd(PlayerId);
+	// Get or create the player's inventory (normally prefetched at admission)
+	FPlayerRewardInventory& Inventory = FindOrAddInventory(PlayerId);
+	if (!Inventory.bLoaded)
+	{
+		++InventoryStats.GrantsBeforeLoaded;
+	}
 
 	// Check if reward already granted
-	if (Rewards.Contains(RewardId))
+	if (Inventory.Owned[*Bit])
 	{
 		UE_LOG(LogTemp, Warning, TEXT("RewardSystem: Reward '%s' already granted to player %s"), 
 			*RewardId, *PlayerId);
@@ -94,39 +233,294 @@ FRewardGrantResult URewardSystem::GrantReward(const FString& PlayerId, const FSt
 
 	// Grant reward (store as boolean flag with string identifier)
 	// Requirement 5.2, 15.4: Store as boolean flag with string identifier
-	Rewards.Add(RewardId);
+	Inventory.Owned[*Bit] = true;
+	MarkDirty(PlayerId);
 
 	UE_LOG(LogTemp, Log, TEXT("RewardSystem: Granted reward '%s' to player %s (total: %d)"),
-		*RewardId, *PlayerId, Rewards.Num());
+		*RewardId, *PlayerId, Inventory.Owned.CountSetBits());
 
-	// In production, this would:
-	// 1. Store in DynamoDB PlayerRewards table (no TTL - persistent)
-	// 2. Partition key = PlayerId, Sort key = RewardId
-	// 3. Value = true (boolean flag)
+	// Write through to the DynamoDB PlayerRewards table (no TTL - persistent; partition key =
+	// PlayerId, sort key = RewardId) without waiting on it
+	if (TSharedPtr<FHMVRRewardLedger> Ledger = RewardLedger.Pin())
+	{
+		++InventoryStats.WriteThroughSent;
+		if (!Ledger->Append(PlayerId, RewardId))
+		{
+			++InventoryStats.WriteThroughFailed;
+			UE_LOG(LogTemp, Warning, TEXT("RewardSystem: Grant of '%s' to player %s not added to the reward ledger - the session summary still carries it"),
+				*RewardId, *PlayerId);
+		}
+	}
+	else if (USessionAPIClient* Client = ApiClient.Get())
+	{
+		TWeakObjectPtr<URewardSystem> WeakThis(this);
+		++InventoryStats.WriteThroughSent;
+		Client->SendRewardGrant(PlayerId, RewardId, [WeakThis, PlayerId, RewardId](bool bAcknowledged)
+		{
+			if (!bAcknowledged && WeakThis.IsValid())
+			{
+				++WeakThis->InventoryStats.WriteThroughFailed;
+				UE_LOG(LogTemp, Warning, TEXT("RewardSystem: Grant of '%s' to player %s not written through - the session summary still carries it"),
+					*RewardId, *PlayerId);
+			}
+		});
+	}
 
 	return FRewardGrantResult::Success(RewardId);
 }
 
 TArray<FString> URewardSystem::GetPlayerRewards(const FString& PlayerId) const
 {
-	const TArray<FString>* Rewards = PlayerRewards.Find(PlayerId);
-	if (Rewards)
+	const FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId);
+	if (Inventory)
 	{
-		return *Rewards;
+		return ToRewardIds(Inventory->Owned);
 	}
 	return TArray<FString>();
 }
 
 bool URewardSystem::HasReward(const FString& PlayerId, const FString& RewardId) const
 {
-	const TArray<FString>* Rewards = PlayerRewards.Find(PlayerId);
-	if (Rewards)
+	const FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId);
+	const int32* Bit = CatalogIndex.Find(RewardId);
+	if (Inventory && Bit && Inventory->Owned.IsValidIndex(*Bit))
 	{
-		return Rewards->Contains(RewardId);
+		return Inventory->Owned[*Bit];
 	}
 	return false;
 }
 
+void URewardSystem::SetApiClient(USessionAPIClient* InApiClient)
+{
+	ApiClient = InApiClient;
+}
+
+void URewardSystem::SetRewardLedger(const TSharedPtr<FHMVRRewardLedger>& InLedger)
+{
+	RewardLedger = InLedger;
+}
+
+void URewardSystem::PrefetchPlayerRewards(const FString& PlayerId)
+{
+	USessionAPIClient* Client = ApiClient.Get();
+	if (PlayerId.IsEmpty() || !Client)
+	{
+		return;
+	}
+
+	FPlayerRewardInventory& Inventory = FindOrAddInventory(PlayerId);
+	if (Inventory.bLoading)
+	{
+		return;
+	}
+	Inventory.bLoading = true;
+	Inventory.FetchAttempts = 0;
+	Inventory.RequestedAt = FPlatformTime::Seconds();
+	StartInventoryFetch(PlayerId);
+}
+
+void URewardSystem::StartInventoryFetch(const FString& PlayerId)
+{
+	USessionAPIClient* Client = ApiClient.Get();
+	FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId);
+	if (!Inventory)
+	{
+		return;
+	}
+	if (!Client)
+	{
+		Inventory->bLoading = false;
+		return;
+	}
+	++Inventory->FetchAttempts;
+	++InventoryStats.Fetches;
+
+	TWeakObjectPtr<URewardSystem> WeakThis(this);
+	Client->FetchPlayerRewards(PlayerId, [WeakThis, PlayerId](bool bLoaded, const TArray<FString>& RewardIds)
+	{
+		if (URewardSystem* This = WeakThis.Get())
+		{
+			This->OnInventoryFetched(PlayerId, bLoaded, RewardIds);
+		}
+	});
+}
+
+bool URewardSystem::IsInventoryLoaded(const FString& PlayerId) const
+{
+	const FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId);
+	return Inventory && Inventory->bLoaded;
+}
+
+bool URewardSystem::IsInventoryRequested(const FString& PlayerId) const
+{
+	const FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId);
+	return Inventory && (Inventory->bLoaded || Inventory->bLoading);
+}
+
+void URewardSystem::OnInventoryFetched(const FString& PlayerId, bool bLoaded, const TArray<FString>& RewardIds)
+{
+	FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId);
+	if (!Inventory)
+	{
+		return;
+	}
+
+	const double Seconds = FPlatformTime::Seconds() - Inventory->RequestedAt;
+	if (!bLoaded)
+	{
+		++InventoryStats.FetchFailures;
+		if (Inventory->FetchAttempts < CVarRewardsPrefetchMaxAttempts.GetValueOnGameThread())
+		{
+			// Still counts as requested while the retry waits, so joins do not stack fetches
+			const float Delay = FMath::Min(30.f, CVarRewardsPrefetchRetrySeconds.GetValueOnGameThread()
+				* static_cast<float>(1 << FMath::Min(Inventory->FetchAttempts - 1, 5)));
+			Inventory->bRetryPending = true;
+			++InventoryStats.FetchRetries;
+			UE_LOG(LogTemp, Warning, TEXT("RewardSystem: Could not load the reward inventory of player %s - retrying in %.1f s (attempt %d)"),
+				*PlayerId, Delay, Inventory->FetchAttempts);
+
+			TWeakObjectPtr<URewardSystem> WeakThis(this);
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakThis, PlayerId](float)
+			{
+				URewardSystem* This = WeakThis.Get();
+				FPlayerRewardInventory* Pending = This ? This->PlayerRewards.Find(PlayerId) : nullptr;
+				if (Pending && Pending->bRetryPending) // not evicted and re-requested meanwhile
+				{
+					Pending->bRetryPending = false;
+					This->StartInventoryFetch(PlayerId);
+				}
+				return false;
+			}), Delay);
+			return;
+		}
+
+		Inventory->bLoading = false;
+		UE_LOG(LogTemp, Warning, TEXT("RewardSystem: Could not load the reward inventory of player %s after %d attempts - duplicate checks use this session's grants only until they join again"),
+			*PlayerId, Inventory->FetchAttempts);
+		return;
+	}
+	Inventory->bLoading = false;
+
+	// Merge: grants made while the fetch was in flight stay set
+	int32 Known = 0;
+	for (const FString& RewardId : RewardIds)
+	{
+		if (const int32* Bit = CatalogIndex.Find(RewardId))
+		{
+			Inventory->Owned[*Bit] = true;
+			++Known;
+		}
+		else
+		{
+			++InventoryStats.UnknownRewardIds;
+		}
+	}
+	Inventory->bLoaded = true;
+	++InventoryStats.Loaded;
+	InventoryStats.TotalFetchSeconds += Seconds;
+	InventoryStats.MaxFetchSeconds = FMath::Max(InventoryStats.MaxFetchSeconds, Seconds);
+	if (Known > 0)
+	{
+		MarkDirty(PlayerId);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("RewardSystem: Loaded reward inventory of player %s - %d rewards in %.1f ms"),
+		*PlayerId, Known, Seconds * 1000.0);
+}
+
+FPlayerRewardInventory& URewardSystem::FindOrAddInventory(const FString& PlayerId)
+{
+	FPlayerRewardInventory& Inventory = PlayerRewards.FindOrAdd(PlayerId);
+	if (Inventory.Owned.Num() < Catalog.Rewards.Num())
+	{
+		Inventory.Owned.Add(false, Catalog.Rewards.Num() - Inventory.Owned.Num());
+	}
+	return Inventory;
+}
+
+TArray<FString> URewardSystem::ToRewardIds(const TBitArray<>& Owned) const
+{
+	TArray<FString> RewardIds;
+	for (TConstSetBitIterator<> It(Owned); It; ++It)
+	{
+		if (Catalog.Rewards.IsValidIndex(It.GetIndex()))
+		{
+			RewardIds.Add(Catalog.Rewards[It.GetIndex()].Id);
+		}
+	}
+	return RewardIds;
+}
+
+void URewardSystem::LogInventoryStats() const
+{
+	UE_LOG(LogTemp, Log,
+		TEXT("RewardSystem: %d inventories cached; %lld fetches, %lld loaded (avg %.1f ms, max %.1f ms), %lld failed (%lld retried), %lld unknown reward ids; %lld grants before the inventory loaded; %lld grants written through, %lld failed"),
+		PlayerRewards.Num(), InventoryStats.Fetches, InventoryStats.Loaded,
+		InventoryStats.Loaded > 0 ? InventoryStats.TotalFetchSeconds * 1000.0 / InventoryStats.Loaded : 0.0,
+		InventoryStats.MaxFetchSeconds * 1000.0, InventoryStats.FetchFailures, InventoryStats.FetchRetries, InventoryStats.UnknownRewardIds,
+		InventoryStats.GrantsBeforeLoaded, InventoryStats.WriteThroughSent, InventoryStats.WriteThroughFailed);
+}
+
+void URewardSystem::RestorePlayerRewards(const FString& PlayerId, const TArray<FString>& RewardIds)
+{
+	if (PlayerId.IsEmpty() || RewardIds.Num() == 0)
+	{
+		return;
+	}
+
+	FPlayerRewardInventory& Inventory = FindOrAddInventory(PlayerId);
+	for (const FString& RewardId : RewardIds)
+	{
+		if (const int32* Bit = CatalogIndex.Find(RewardId))
+		{
+			Inventory.Owned[*Bit] = true;
+		}
+	}
+	MarkDirty(PlayerId);
+}
+
+void URewardSystem::EvictPlayerRewards(const FString& PlayerId)
+{
+	if (PlayerRewards.Remove(PlayerId) > 0)
+	{
+		MarkDirty(PlayerId);
+	}
+}
+
+void URewardSystem::EvictAllPlayerRewards()
+{
+	for (const TPair<FString, FPlayerRewardInventory>& Pair : PlayerRewards)
+	{
+		MarkDirty(Pair.Key);
+	}
+	PlayerRewards.Reset();
+}
+
+void URewardSystem::SetDirtyTracking(bool bEnable)
+{
+	bTrackDirty = bEnable;
+	if (!bEnable)
+	{
+		DirtyPlayers.Empty();
+	}
+}
+
+void URewardSystem::ConsumeDirty(TArray<TPair<FString, TArray<FString>>>& OutChanged, TArray<FString>& OutRemoved)
+{
+	for (const FString& PlayerId : DirtyPlayers)
+	{
+		if (const FPlayerRewardInventory* Inventory = PlayerRewards.Find(PlayerId))
+		{
+			OutChanged.Emplace(PlayerId, ToRewardIds(Inventory->Owned));
+		}
+		else
+		{
+			OutRemoved.Add(PlayerId);
+		}
+	}
+	DirtyPlayers.Reset();
+}
+
 bool URewardSystem::LoadCatalogFromFile(const FString& FilePath)
 {
 	// Read JSON file
@@ -210,6 +604,13 @@ bool URewardSystem::ParseCatalogJson(const FString& JsonString)
 		Catalog.Rewards.Add(Entry);
 	}
 
+	// Bit positions for player inventories; a duplicated id keeps its first position
+	CatalogIndex.Reset();
+	for (int32 Index = 0; Index < Catalog.Rewards.Num(); ++Index)
+	{
+		CatalogIndex.FindOrAdd(Catalog.Rewards[Index].Id, Index);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("RewardSystem: Parsed %d rewards from catalog (version: %s)"),
 		Catalog.Rewards.Num(), *Catalog.Version);
 
@@ -6,6 +6,9 @@
 #include "UObject/NoExportTypes.h"
 #include "RewardSystem.generated.h"
 
+class USessionAPIClient;
+class FHMVRRewardLedger;
+
 /**
  * Reward catalog entry
  */
@@ -97,9 +100,29 @@ struct FRewardGrantResult
 	}
 };
 
+/**
+ * One player's granted rewards: a bit per catalog entry (catalog order)
+ */
+struct FPlayerRewardInventory
+{
+	TBitArray<> Owned;
+	bool bLoaded = false;   // the backend's inventory has been merged in
+	bool bLoading = false;  // a fetch is in flight or waiting to be retried
+	bool bRetryPending = false;
+	int32 FetchAttempts = 0;
+	double RequestedAt = 0.0;
+};
+
 /**
  * Reward System
  * Implements reward granting with catalog validation (Requirement 5.2, 5.3, 15.1-15.5)
+ *
+ * Each player's inventory is prefetched from the Session API when their join is admitted
+ * (PrefetchPlayerRewards) and cached as a bitset over the catalog, so HasReward and
+ * GrantReward only touch memory. Grants are written through to the backend in the background:
+ * through the durable, batched FHMVRRewardLedger when one is set (SetRewardLedger), otherwise
+ * one request per grant (SetApiClient). A grant made before the fetch lands is kept and merged with it; duplicate
+ * protection for that window falls back to the backend's idempotent write.
  */
 UCLASS()
 class HYPERMAGEVR_API URewardSystem : public UObject
@@ -149,6 +172,44 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Rewards")
 	bool HasReward(const FString& PlayerId, const FString& RewardId) const;
 
+	/** Where inventories are fetched from and grants written through; without one both stay local */
+	void SetApiClient(USessionAPIClient* InApiClient);
+
+	/** Route grant write-through via this ledger (exactly-once, batched) instead of per-grant requests */
+	void SetRewardLedger(const TSharedPtr<FHMVRRewardLedger>& InLedger);
+
+	/**
+	 * Start loading a player's inventory from the backend (no-op while a fetch is in flight).
+	 * A failed fetch is retried with exponential backoff up to hmvr.Rewards.PrefetchMaxAttempts;
+	 * after that the inventory counts as not requested, so the next join fetches it again.
+	 * @param PlayerId The player ID
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Rewards")
+	void PrefetchPlayerRewards(const FString& PlayerId);
+
+	/** True once the backend's inventory for the player is in memory */
+	UFUNCTION(BlueprintCallable, Category = "Rewards")
+	bool IsInventoryLoaded(const FString& PlayerId) const;
+
+	/** True if an inventory is cached or being fetched for the player */
+	bool IsInventoryRequested(const FString& PlayerId) const;
+
+	struct FInventoryStats
+	{
+		int64 Fetches = 0;
+		int64 Loaded = 0;
+		int64 FetchFailures = 0;
+		int64 FetchRetries = 0;
+		int64 UnknownRewardIds = 0;     // fetched ids not in the catalog
+		int64 GrantsBeforeLoaded = 0;
+		int64 WriteThroughSent = 0;
+		int64 WriteThroughFailed = 0;
+		double TotalFetchSeconds = 0.0;
+		double MaxFetchSeconds = 0.0;
+	};
+	const FInventoryStats& GetInventoryStats() const { return InventoryStats; }
+	void LogInventoryStats() const;
+
 	/**
 	 * Get the reward catalog
 	 * @return The reward catalog
@@ -163,22 +224,56 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Rewards")
 	bool IsCatalogLoaded() const { return bCatalogLoaded; }
 
+	/**
+	 * Merge rewards recovered from a crash snapshot into a player's set
+	 * @param PlayerId The player ID
+	 * @param RewardIds Reward IDs the player held
+	 */
+	void RestorePlayerRewards(const FString& PlayerId, const TArray<FString>& RewardIds);
+
+	/** Drop a player's cached inventory once their session is over; it is fetched again if they return */
+	void EvictPlayerRewards(const FString& PlayerId);
+
+	/** Drop every cached inventory (the game session ended) */
+	void EvictAllPlayerRewards();
+
+	/** Snapshot support: remember which players' rewards change (off by default) */
+	void SetDirtyTracking(bool bEnable);
+
+	/** Players whose rewards changed since the last call, with their full reward sets, and players evicted since */
+	void ConsumeDirty(TArray<TPair<FString, TArray<FString>>>& OutChanged, TArray<FString>& OutRemoved);
+
 protected:
 	// Reward catalog
 	UPROPERTY()
 	FRewardCatalog Catalog;
 
-	// Player rewards (PlayerId -> Set of RewardIds)
-	// In production, this would be stored in DynamoDB PlayerRewards table
-	// Not UPROPERTY — nested containers (TMap<FString, TArray<FString>>) are not supported by UHT
-	TMap<FString, TArray<FString>> PlayerRewards;
+	// Reward id -> bit index in FPlayerRewardInventory::Owned
+	TMap<FString, int32> CatalogIndex;
+
+	// Player rewards (PlayerId -> inventory), cached from the DynamoDB PlayerRewards table
+	TMap<FString, FPlayerRewardInventory> PlayerRewards;
+
+	TWeakObjectPtr<USessionAPIClient> ApiClient;
+	TWeakPtr<FHMVRRewardLedger> RewardLedger;
+	FInventoryStats InventoryStats;
 
 	// Catalog loading status
 	bool bCatalogLoaded = false;
 
+	// Players changed since the last snapshot collect
+	TSet<FString> DirtyPlayers;
+	bool bTrackDirty = false;
+
 	// Load catalog from JSON file
 	bool LoadCatalogFromFile(const FString& FilePath);
 
 	// Parse catalog JSON
 	bool ParseCatalogJson(const FString& JsonString);
+
+	FPlayerRewardInventory& FindOrAddInventory(const FString& PlayerId);
+	void StartInventoryFetch(const FString& PlayerId);
+	void OnInventoryFetched(const FString& PlayerId, bool bLoaded, const TArray<FString>& RewardIds);
+	TArray<FString> ToRewardIds(const TBitArray<>& Owned) const;
+	void MarkDirty(const FString& PlayerId) { if (bTrackDirty) { DirtyPlayers.Add(PlayerId); } }
 };
@@ -2,29 +2,60 @@
 
 #include "SessionAPIClient.h"
 #include "AwsSigV4.h"
+#include "HMVRHttpDispatcher.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
-#include "Containers/Ticker.h"
+
+namespace
+{
+	TSharedRef<FJsonObject> InteractionEventToJson(const FInteractionEvent& Event)
+	{
+		TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+		Body->SetStringField(TEXT("eventId"),   Event.EventId.ToString());
+		Body->SetStringField(TEXT("playerId"),  Event.PlayerId);
+		Body->SetStringField(TEXT("eventType"), Event.EventType);
+		Body->SetStringField(TEXT("timestamp"), Event.Timestamp.ToIso8601());
+		Body->SetNumberField(TEXT("ttl"),       static_cast<double>(Event.TTL));
+
+		TSharedRef<FJsonObject> DataObj = MakeShared<FJsonObject>();
+		for (const auto& Pair : Event.Data)
+		{
+			DataObj->SetStringField(Pair.Key, Pair.Value);
+		}
+		Body->SetObjectField(TEXT("data"), DataObj);
+		return Body;
+	}
+}
 
 // ── Public interface ─────────────────────────────────────────────────────────
 
 bool USessionAPIClient::SendSessionSummary(const FPlayerSessionSummary& Summary)
+{
+	return SendSessionSummary(Summary, nullptr);
+}
+
+bool USessionAPIClient::SendSessionSummary(const FPlayerSessionSummary& Summary, TFunction<void(bool)> OnAcknowledged)
 {
 	if (EndpointURL.IsEmpty())
 	{
 		UE_LOG(LogTemp, Log,
 			TEXT("SessionAPIClient (no endpoint): session %s player %s rewards %d — not sent"),
-			*Summary.SessionId, *Summary.PlayerId, Summary.Rewards.Num());
+			*Summary.SessionId.ToString(), *Summary.PlayerId, Summary.Rewards.Num());
+		if (OnAcknowledged)
+		{
+			OnAcknowledged(true);
+		}
 		return true;
 	}
 
 	TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
 	Body->SetStringField(TEXT("playerId"),  Summary.PlayerId);
-	Body->SetStringField(TEXT("sessionId"), Summary.SessionId);
+	Body->SetStringField(TEXT("sessionId"), Summary.SessionId.ToString());
 
 	TArray<TSharedPtr<FJsonValue>> RewardsArray;
 	for (const FString& RewardId : Summary.Rewards)
@@ -38,7 +69,7 @@ bool USessionAPIClient::SendSessionSummary(const FPlayerSessionSummary& Summary)
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
 	FJsonSerializer::Serialize(Body, Writer);
 
-	return PostSigned(TEXT("/session-summary"), BodyString);
+	return PostSigned(TEXT("/session-summary"), BodyString, EHMVRHttpPriority::Summary, MoveTemp(OnAcknowledged));
 }
 
 bool USessionAPIClient::SendInteractionEvent(const FInteractionEvent& Event)
@@ -47,29 +78,144 @@ bool USessionAPIClient::SendInteractionEvent(const FInteractionEvent& Event)
 	{
 		UE_LOG(LogTemp, Verbose,
 			TEXT("SessionAPIClient (no endpoint): event %s player %s type %s — not sent"),
-			*Event.EventId, *Event.PlayerId, *Event.EventType);
+			*Event.EventId.ToString(), *Event.PlayerId, *Event.EventType);
 		return true;
 	}
 
-	TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
-	Body->SetStringField(TEXT("eventId"),   Event.EventId);
-	Body->SetStringField(TEXT("playerId"),  Event.PlayerId);
-	Body->SetStringField(TEXT("eventType"), Event.EventType);
-	Body->SetStringField(TEXT("timestamp"), Event.Timestamp.ToIso8601());
-	Body->SetNumberField(TEXT("ttl"),       static_cast<double>(Event.TTL));
+	FString BodyString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
+	FJsonSerializer::Serialize(InteractionEventToJson(Event), Writer);
+
+	return PostSigned(TEXT("/interaction-events"), BodyString, EHMVRHttpPriority::Telemetry);
+}
+
+bool USessionAPIClient::SendInteractionEventBatch(const FString& JsonBody, int32 NumEvents, TFunction<void(bool)> OnAcknowledged)
+{
+	if (EndpointURL.IsEmpty())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SessionAPIClient (no endpoint): %d interaction events — not sent"), NumEvents);
+		if (OnAcknowledged)
+		{
+			OnAcknowledged(true);
+		}
+		return true;
+	}
 
-	TSharedRef<FJsonObject> DataObj = MakeShared<FJsonObject>();
-	for (const auto& Pair : Event.Data)
+	return PostSigned(TEXT("/interaction-events"), JsonBody, EHMVRHttpPriority::Telemetry, MoveTemp(OnAcknowledged));
+}
+
+bool USessionAPIClient::FetchPlayerRewards(const FString& PlayerId, TFunction<void(bool, const TArray<FString>&)> OnLoaded)
+{
+	if (EndpointURL.IsEmpty())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SessionAPIClient (no endpoint): rewards of player %s — nothing to fetch"), *PlayerId);
+		OnLoaded(true, TArray<FString>());
+		return true;
+	}
+
+	const FString Path = TEXT("/player-rewards/") + FGenericPlatformHttp::UrlEncode(PlayerId);
+	SubmitSigned(TEXT("GET"), Path, FString(), EHMVRHttpPriority::Critical,
+		[Path, OnLoaded = MoveTemp(OnLoaded)](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+		{
+			TArray<FString> RewardIds;
+			const int32 Code = bSuccess && Response.IsValid() ? Response->GetResponseCode() : 0;
+			if (Code == 404)
+			{
+				OnLoaded(true, RewardIds); // nothing granted yet
+				return;
+			}
+
+			TSharedPtr<FJsonObject> Json;
+			const TArray<TSharedPtr<FJsonValue>>* Rewards = nullptr;
+			if (Code == 200)
+			{
+				TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+				if (FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid() && Json->TryGetArrayField(TEXT("rewards"), Rewards))
+				{
+					for (const TSharedPtr<FJsonValue>& Value : *Rewards)
+					{
+						RewardIds.Add(Value->AsString());
+					}
+					OnLoaded(true, RewardIds);
+					return;
+				}
+			}
+
+			UE_LOG(LogTemp, Warning, TEXT("SessionAPIClient: GET %s — %s"), *Path,
+				Code == 0 ? TEXT("network error or circuit open") : *FString::Printf(TEXT("HTTP %d"), Code));
+			OnLoaded(false, RewardIds);
+		});
+	return true;
+}
+
+bool USessionAPIClient::SendRewardGrant(const FString& PlayerId, const FString& RewardId, TFunction<void(bool)> OnAcknowledged)
+{
+	if (EndpointURL.IsEmpty())
 	{
-		DataObj->SetStringField(Pair.Key, Pair.Value);
+		UE_LOG(LogTemp, Verbose, TEXT("SessionAPIClient (no endpoint): grant %s to player %s — not sent"), *RewardId, *PlayerId);
+		if (OnAcknowledged)
+		{
+			OnAcknowledged(true);
+		}
+		return true;
 	}
-	Body->SetObjectField(TEXT("data"), DataObj);
+
+	TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+	Body->SetStringField(TEXT("playerId"), PlayerId);
+	Body->SetStringField(TEXT("rewardId"), RewardId);
+	Body->SetStringField(TEXT("grantedAt"), FDateTime::UtcNow().ToIso8601());
 
 	FString BodyString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
 	FJsonSerializer::Serialize(Body, Writer);
 
-	return PostSigned(TEXT("/interaction-events"), BodyString);
+	return PostSigned(TEXT("/player-rewards"), BodyString, EHMVRHttpPriority::Summary, MoveTemp(OnAcknowledged));
+}
+
+bool USessionAPIClient::SendRewardGrantBatch(const FString& JsonBody, int32 NumGrants, TFunction<void(bool, bool)> OnDone)
+{
+	if (EndpointURL.IsEmpty())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SessionAPIClient (no endpoint): %d reward grants — not sent"), NumGrants);
+		if (OnDone)
+		{
+			OnDone(true, false);
+		}
+		return true;
+	}
+
+	const FString Path = TEXT("/player-rewards/batch");
+	SubmitSigned(TEXT("POST"), Path, JsonBody, EHMVRHttpPriority::Summary,
+		[this, Path, OnDone = MoveTemp(OnDone)](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+		{
+			const bool bAccepted = OnPostComplete(Request, Response, bSuccess, Path);
+			const int32 Code = bSuccess && Response.IsValid() ? Response->GetResponseCode() : 0;
+			const bool bRejected = !bAccepted && Code >= 400 && Code < 500
+				&& Code != 401 && Code != 403 && Code != 408 && Code != 429;
+			if (OnDone)
+			{
+				OnDone(bAccepted, bRejected);
+			}
+		});
+	return true;
+}
+
+FString USessionAPIClient::SerializeInteractionEvents(const TArray<FInteractionEvent>& Events)
+{
+	TArray<TSharedPtr<FJsonValue>> EventsArray;
+	EventsArray.Reserve(Events.Num());
+	for (const FInteractionEvent& Event : Events)
+	{
+		EventsArray.Add(MakeShared<FJsonValueObject>(InteractionEventToJson(Event)));
+	}
+
+	TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+	Body->SetArrayField(TEXT("events"), EventsArray);
+
+	FString BodyString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
+	FJsonSerializer::Serialize(Body, Writer);
+	return BodyString;
 }
 
 void USessionAPIClient::SetEndpointURL(const FString& URL)
@@ -80,17 +226,38 @@ void USessionAPIClient::SetEndpointURL(const FString& URL)
 
 // ── Private helpers ──────────────────────────────────────────────────────────
 
-bool USessionAPIClient::PostSigned(const FString& Path, const FString& JsonBody, int32 Attempt)
+bool USessionAPIClient::PostSigned(const FString& Path, const FString& JsonBody, EHMVRHttpPriority Priority,
+	TFunction<void(bool)> OnDone)
+{
+	SubmitSigned(TEXT("POST"), Path, JsonBody, Priority,
+		[this, Path = FString(Path), OnDone = MoveTemp(OnDone)](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+		{
+			const bool bAccepted = OnPostComplete(Request, Response, bSuccess, Path);
+			if (OnDone)
+			{
+				OnDone(bAccepted);
+			}
+		});
+
+	UE_LOG(LogTemp, Log, TEXT("SessionAPIClient: POST %s queued"), *Path);
+	return true;
+}
+
+void USessionAPIClient::SubmitSigned(const TCHAR* Verb, const FString& Path, const FString& JsonBody, EHMVRHttpPriority Priority,
+	TFunction<void(FHttpRequestPtr, FHttpResponsePtr, bool)> OnComplete)
 {
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetURL(EndpointURL + Path);
-	HttpRequest->SetVerb(TEXT("POST"));
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	HttpRequest->SetVerb(Verb);
 
-	FTCHARToUTF8 Conv(*JsonBody);
 	TArray<uint8> BodyBytes;
-	BodyBytes.Append(reinterpret_cast<const uint8*>(Conv.Get()), Conv.Length());
-	HttpRequest->SetContent(BodyBytes);
+	if (!JsonBody.IsEmpty())
+	{
+		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		FTCHARToUTF8 Conv(*JsonBody);
+		BodyBytes.Append(reinterpret_cast<const uint8*>(Conv.Get()), Conv.Length());
+		HttpRequest->SetContent(BodyBytes);
+	}
 
 	if (!FAwsSigV4::SignRequest(HttpRequest, BodyBytes, AwsRegion, TEXT("execute-api")))
 	{
@@ -98,75 +265,42 @@ bool USessionAPIClient::PostSigned(const FString& Path, const FString& JsonBody,
 			TEXT("SessionAPIClient: SigV4 signing failed for %s — sending unsigned (will likely get 403)"), *Path);
 	}
 
-	FString CapturedPath = Path;
-	FString CapturedBody = JsonBody;
-	HttpRequest->OnProcessRequestComplete().BindUObject(
-		this, &USessionAPIClient::OnPostComplete, CapturedPath, CapturedBody, Attempt);
-	HttpRequest->ProcessRequest();
-
-	if (Attempt == 0)
+	// Retries go back through the dispatcher on a fresh request; re-sign so x-amz-date stays current
+	FHMVRRetryPolicy RetryPolicy;
+	RetryPolicy.MaxRetries = MaxRetries;
+	RetryPolicy.PrepareRetry = [Region = AwsRegion](const FHttpRequestRef& Retry)
 	{
-		UE_LOG(LogTemp, Log, TEXT("SessionAPIClient: POST %s dispatched"), *Path);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Log, TEXT("SessionAPIClient: POST %s retry attempt %d/%d"), *Path, Attempt, MaxRetries);
-	}
-	return true;
+		FAwsSigV4::SignRequest(Retry, Retry->GetContent(), Region, TEXT("execute-api"));
+	};
+
+	HttpRequest->OnProcessRequestComplete().BindWeakLambda(this, MoveTemp(OnComplete));
+	FHMVRHttpDispatcher::Get().Submit(HttpRequest, Priority, FString(), MoveTemp(RetryPolicy));
 }
 
-void USessionAPIClient::OnPostComplete(FHttpRequestPtr /*Request*/, FHttpResponsePtr Response,
-                                        bool bSuccess, FString Path, FString Body, int32 Attempt)
+bool USessionAPIClient::OnPostComplete(FHttpRequestPtr /*Request*/, FHttpResponsePtr Response,
+                                        bool bSuccess, const FString& Path)
 {
-	bool bShouldRetry = false;
-
+	// Called once with the final outcome — FHMVRHttpDispatcher has already retried transient failures
 	if (!bSuccess || !Response.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SessionAPIClient: POST %s — network error (attempt %d)"), *Path, Attempt + 1);
-		bShouldRetry = true;
+		UE_LOG(LogTemp, Error, TEXT("SessionAPIClient: POST %s — network error, circuit open or dropped under back-pressure, giving up"), *Path);
+		return false;
 	}
-	else
+
+	const int32 Code = Response->GetResponseCode();
+	if (Code == 200 || Code == 201)
 	{
-		int32 Code = Response->GetResponseCode();
-		if (Code == 200 || Code == 201)
-		{
-			UE_LOG(LogTemp, Log, TEXT("SessionAPIClient: POST %s — success (%d)"), *Path, Code);
-			return;
-		}
-		else if (Code >= 500)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("SessionAPIClient: POST %s — server error %d (attempt %d)"),
-				*Path, Code, Attempt + 1);
-			bShouldRetry = true;
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("SessionAPIClient: POST %s — HTTP %d: %s"),
-				*Path, Code, *Response->GetContentAsString());
-		}
+		UE_LOG(LogTemp, Log, TEXT("SessionAPIClient: POST %s — success (%d)"), *Path, Code);
+		return true;
 	}
-
-	if (bShouldRetry && Attempt < MaxRetries)
+	else if (Code == 429 || Code >= 500)
 	{
-		const float Delay = static_cast<float>(1 << Attempt); // 1 s, 2 s, 4 s
-		UE_LOG(LogTemp, Log, TEXT("SessionAPIClient: Retrying POST %s in %.0fs (%d/%d)"),
-			*Path, Delay, Attempt + 1, MaxRetries);
-
-		FString CapturedPath = Path;
-		FString CapturedBody = Body;
-		const int32 NextAttempt = Attempt + 1;
-
-		FTSTicker::GetCoreTicker().AddTicker(
-			FTickerDelegate::CreateWeakLambda(this, [this, CapturedPath, CapturedBody, NextAttempt](float) -> bool
-			{
-				PostSigned(CapturedPath, CapturedBody, NextAttempt);
-				return false; // fire once then remove
-			}),
-			Delay
-		);
+		UE_LOG(LogTemp, Error, TEXT("SessionAPIClient: POST %s — server error %d, giving up"), *Path, Code);
 	}
-	else if (bShouldRetry)
+	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("SessionAPIClient: POST %s — giving up after %d retries"), *Path, MaxRetries);
+		UE_LOG(LogTemp, Warning, TEXT("SessionAPIClient: POST %s — HTTP %d: %s"),
+			*Path, Code, *Response->GetContentAsString());
 	}
+	return false;
 }
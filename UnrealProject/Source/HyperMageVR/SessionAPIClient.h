@@ -6,18 +6,25 @@
 #include "UObject/NoExportTypes.h"
 #include "Http.h"
 #include "SessionManager.h"
+#include "HMVRHttpDispatcher.h"
 #include "SessionAPIClient.generated.h"
 
 /**
  * Session API Client
- * Posts session summaries and interaction events to the Session API.
+ * Posts session summaries and interaction events to the Session API, and reads and writes
+ * through player reward inventories (GET/POST /player-rewards).
  *
  * When EndpointURL is empty the client logs but does not transmit (safe for local testing).
  * When EndpointURL is set, requests are signed with SigV4 using instance credentials
  * (AWS_ACCESS_KEY_ID / AWS_SECRET_ACCESS_KEY / AWS_SESSION_TOKEN env vars set by GameLift).
  *
- * Failed requests (5xx or network error) are retried up to MaxRetries times with
- * exponential back-off (1 s, 2 s, 4 s). Client errors (4xx) are not retried.
+ * Requests go through FHMVRHttpDispatcher: inventory fetches at Critical priority (a joining
+ * player waits on them), summaries and reward grants at Summary priority, interaction events
+ * at Telemetry priority (dropped first when the outbound queue backs up).
+ *
+ * Failed requests (network error, 429 or 5xx) are retried up to MaxRetries times by the
+ * dispatcher's shared retry scheduler (full-jitter back-off, per-endpoint retry budget and
+ * circuit breaker), re-signed on each attempt. Client errors (4xx) are not retried.
  */
 UCLASS()
 class HYPERMAGEVR_API USessionAPIClient : public UObject
@@ -32,6 +39,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Session API")
 	bool SendSessionSummary(const FPlayerSessionSummary& Summary);
 
+	/**
+	 * As above; OnAcknowledged(true) once the Session API accepts the summary (immediately when
+	 * there is no endpoint), OnAcknowledged(false) when it is finally rejected or undeliverable.
+	 */
+	bool SendSessionSummary(const FPlayerSessionSummary& Summary, TFunction<void(bool /*bAcknowledged*/)> OnAcknowledged);
+
 	/**
 	 * Send an interaction event to Session API (fire-and-forget, async).
 	 * @return true if dispatched (or mock-logged)
@@ -39,6 +52,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Session API")
 	bool SendInteractionEvent(const FInteractionEvent& Event);
 
+	/**
+	 * Post a body built by SerializeInteractionEvents (FHMVREventStream's sender). OnAcknowledged
+	 * as for SendSessionSummary.
+	 */
+	bool SendInteractionEventBatch(const FString& JsonBody, int32 NumEvents, TFunction<void(bool /*bAcknowledged*/)> OnAcknowledged);
+
+	/**
+	 * Fetch a player's granted reward ids (GET /player-rewards/{playerId}). OnLoaded(true, Ids)
+	 * with an empty list when there is no endpoint or the player has none; OnLoaded(false) on failure.
+	 */
+	bool FetchPlayerRewards(const FString& PlayerId, TFunction<void(bool /*bLoaded*/, const TArray<FString>& /*RewardIds*/)> OnLoaded);
+
+	/** Write one grant through to the player's inventory (POST /player-rewards; idempotent). */
+	bool SendRewardGrant(const FString& PlayerId, const FString& RewardId, TFunction<void(bool /*bAcknowledged*/)> OnAcknowledged = nullptr);
+
+	/**
+	 * Post a batch built by FHMVRRewardLedger (POST /player-rewards/batch). Each grant carries an
+	 * idempotencyKey the backend deduplicates on, so re-sending a batch is safe. bRejected is set
+	 * when the API refused the batch with a 4xx that re-sending will not fix (not 401/403/408/429).
+	 */
+	bool SendRewardGrantBatch(const FString& JsonBody, int32 NumGrants, TFunction<void(bool /*bAcknowledged*/, bool /*bRejected*/)> OnDone);
+
+	/** {"events":[...]} for POST /interaction-events. Thread-safe. */
+	static FString SerializeInteractionEvents(const TArray<FInteractionEvent>& Events);
+
 	/** Set the Session API base URL. Passing a non-empty URL disables mock mode. */
 	UFUNCTION(BlueprintCallable, Category = "Session API")
 	void SetEndpointURL(const FString& URL);
@@ -50,7 +88,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Session API")
 	void SetAwsRegion(const FString& Region) { AwsRegion = Region; }
 
-	/** Maximum number of retry attempts on 5xx / network error (1 s → 2 s → 4 s back-off). */
+	/** Maximum number of retry attempts on 429 / 5xx / network error. */
 	static constexpr int32 MaxRetries = 3;
 
 protected:
@@ -61,9 +99,14 @@ protected:
 	FString AwsRegion = TEXT("eu-west-1");
 
 private:
-	/** Dispatch a signed POST; retries on transient failure up to MaxRetries. */
-	bool PostSigned(const FString& Path, const FString& JsonBody, int32 Attempt = 0);
+	/** Queue a signed POST on FHMVRHttpDispatcher; retries on transient failure up to MaxRetries. */
+	bool PostSigned(const FString& Path, const FString& JsonBody, EHMVRHttpPriority Priority,
+		TFunction<void(bool)> OnDone = nullptr);
+
+	/** Sign and queue any verb; OnComplete gets the final outcome after the dispatcher's retries. */
+	void SubmitSigned(const TCHAR* Verb, const FString& Path, const FString& JsonBody, EHMVRHttpPriority Priority,
+		TFunction<void(FHttpRequestPtr, FHttpResponsePtr, bool)> OnComplete);
 
-	void OnPostComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess,
-	                    FString Path, FString Body, int32 Attempt);
+	/** Logs the final outcome; true on 200/201. */
+	bool OnPostComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, const FString& Path);
 };
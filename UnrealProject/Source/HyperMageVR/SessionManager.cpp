@@ -1,45 +1,161 @@
 // Copyright 2026 HyperMage. All Rights Reserved.
 
 #include "SessionManager.h"
+#include "HMVREventStream.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/Package.h"
+
+static TAutoConsoleVariable<float> CVarSessionCreatedTimeout(
+	TEXT("hmvr.Session.CreatedTimeoutSeconds"),
+	60.f,
+	TEXT("A session still CREATED (never started) after this long expires."));
+
+static TAutoConsoleVariable<float> CVarSessionEndedRetention(
+	TEXT("hmvr.Session.EndedRetentionSeconds"),
+	300.f,
+	TEXT("An ENDED session whose summary the Session API has not acknowledged expires after this long."));
+
+static TAutoConsoleVariable<float> CVarSessionSummaryRetry(
+	TEXT("hmvr.Session.SummaryRetrySeconds"),
+	10.f,
+	TEXT("First re-send of an unacknowledged session summary; the delay doubles each time until the session expires (0 = no re-sends)."));
+
+static TAutoConsoleVariable<int32> CVarSessionMaxSessions(
+	TEXT("hmvr.Session.MaxSessions"),
+	256,
+	TEXT("Sessions held in memory before the oldest ENDED one is expired to make room."));
+
+#if !UE_BUILD_SHIPPING
+// Churn: Joins players each join, get an event and a reward, and leave. UnackedPercent of the
+// summaries are never acknowledged and have to age out through EXPIRED. Runs on a private
+// manager with a manual clock (one second per join) so TTLs elapse without waiting.
+static FAutoConsoleCommandWithArgs CmdSessionChurnTest(
+	TEXT("HMVR.Session.ChurnTest"),
+	TEXT("HMVR.Session.ChurnTest [Joins=100000] [UnackedPercent=10] — simulate join/leave churn and report session memory high-water marks."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Joins = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100000;
+		const int32 UnackedPercent = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 0, 100) : 10;
+
+		USessionManager* Manager = NewObject<USessionManager>(GetTransientPackage(), NAME_None, RF_Transient);
+		double Clock = 1.0;
+		Manager->SetManualClock(Clock);
+
+		const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+		uint64 PeakUsed = UsedBefore;
+		SIZE_T PeakAllocated = 0;
+		const double StartTime = FPlatformTime::Seconds();
+
+		TMap<FString, FString> EventData;
+		EventData.Add(TEXT("action"), TEXT("churn"));
+
+		// Per-transition logging would dominate the run (and the expiry warnings are expected)
+		const ELogVerbosity::Type PreviousVerbosity = LogTemp.GetVerbosity();
+		LogTemp.SetVerbosity(ELogVerbosity::Error);
+		for (int32 i = 0; i < Joins; ++i)
+		{
+			const FPlayerSession Session = Manager->CreateSession(FString::Printf(TEXT("churn-player-%d"), i), TEXT("churn-shard"));
+			Manager->StartSession(Session.SessionId);
+			Manager->TrackEvent(Session.SessionId, TEXT("player_join"), EventData);
+			Manager->AddReward(Session.SessionId, TEXT("churn-reward"));
+			Manager->EndSession(Session.SessionId);
+			Manager->DiscardSessionState(Session.SessionId);
+			if (i % 100 >= UnackedPercent)
+			{
+				Manager->AcknowledgeSummary(Session.SessionId);
+			}
+
+			Clock += 1.0;
+			Manager->SetManualClock(Clock);
+			Manager->TickExpiry(Clock);
+
+			if ((i & 1023) == 0)
+			{
+				PeakAllocated = FMath::Max(PeakAllocated, Manager->GetAllocatedSize());
+				PeakUsed = FMath::Max(PeakUsed, FPlatformMemory::GetStats().UsedPhysical);
+			}
+		}
+
+		LogTemp.SetVerbosity(PreviousVerbosity);
+
+		const USessionManager::FLifecycleStats& Stats = Manager->GetLifecycleStats();
+		UE_LOG(LogTemp, Log,
+			TEXT("SessionManager: ChurnTest %d joins (%d%% unacknowledged) in %.2f s — %d sessions held at end, peak %d (cap %d); session heap peak %.1f KB, end %.1f KB; process used physical +%.1f MB peak"),
+			Joins, UnackedPercent, FPlatformTime::Seconds() - StartTime, Manager->GetSessionCount(), Stats.PeakSessions,
+			CVarSessionMaxSessions.GetValueOnGameThread(), PeakAllocated / 1024.0, Manager->GetAllocatedSize() / 1024.0,
+			(PeakUsed - FMath::Min(PeakUsed, UsedBefore)) / (1024.0 * 1024.0));
+		UE_LOG(LogTemp, Log, TEXT("SessionManager: ChurnTest lifecycle — created %lld, acknowledged %lld, summaries re-sent %lld, expired %lld (%lld for the cap), events not streamed %lld"),
+			Stats.Created, Stats.Acknowledged, Stats.SummaryResends, Stats.Expired, Stats.ExpiredForCap, Stats.EventsNotStreamed);
+
+		Manager->MarkAsGarbage();
+	}));
+#endif
+
+void USessionManager::BeginDestroy()
+{
+	if (ExpiryTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ExpiryTickerHandle);
+		ExpiryTickerHandle.Reset();
+	}
+	Super::BeginDestroy();
+}
 
 FPlayerSession USessionManager::CreateSession(const FString& PlayerId, const FString& ShardId)
 {
 	FPlayerSession NewSession;
-	NewSession.SessionId = FGuid::NewGuid().ToString();
+	NewSession.SessionId = FHMVRId::Generate();
 	NewSession.PlayerId = PlayerId;
 	NewSession.ShardId = ShardId;
 	NewSession.State = ESessionState::CREATED;
 	NewSession.StartTime = FDateTime::UtcNow();
 	NewSession.TTL = 0; // TTL set when session ends
 
+	// Stay under the cap by expiring the longest-ended session; active players are never dropped
+	const int32 MaxSessions = FMath::Max(1, CVarSessionMaxSessions.GetValueOnGameThread());
+	while (ActiveSessions.Num() >= MaxSessions && ExpireOldestEnded())
+	{
+		++LifecycleStats.ExpiredForCap;
+	}
+	if (ActiveSessions.Num() >= MaxSessions)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: %d sessions held (cap %d) and none ended — over the cap"),
+			ActiveSessions.Num(), MaxSessions);
+	}
+
 	// Store in active sessions
 	ActiveSessions.Add(NewSession.SessionId, NewSession);
+	ScheduleExpiry(NewSession.SessionId, ESessionState::CREATED, CVarSessionCreatedTimeout.GetValueOnGameThread());
+	MarkDirty(NewSession.SessionId);
+	++LifecycleStats.Created;
+	LifecycleStats.PeakSessions = FMath::Max(LifecycleStats.PeakSessions, ActiveSessions.Num());
 
 	UE_LOG(LogTemp, Log, TEXT("SessionManager: Created session %s for player %s in shard %s"),
-		*NewSession.SessionId, *PlayerId, *ShardId);
+		*NewSession.SessionId.ToString(), *PlayerId, *ShardId);
 
 	return NewSession;
 }
 
-bool USessionManager::StartSession(const FString& SessionId)
+bool USessionManager::StartSession(const FHMVRId& SessionId)
 {
 	// Transition CREATED → ACTIVE
 	if (TransitionState(SessionId, ESessionState::CREATED, ESessionState::ACTIVE))
 	{
-		UE_LOG(LogTemp, Log, TEXT("SessionManager: Started session %s"), *SessionId);
+		UE_LOG(LogTemp, Log, TEXT("SessionManager: Started session %s"), *SessionId.ToString());
 		return true;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("SessionManager: Failed to start session %s - invalid state"), *SessionId);
+	UE_LOG(LogTemp, Warning, TEXT("SessionManager: Failed to start session %s - invalid state"), *SessionId.ToString());
 	return false;
 }
 
-bool USessionManager::EndSession(const FString& SessionId)
+bool USessionManager::EndSession(const FHMVRId& SessionId)
 {
 	// Transition ACTIVE → ENDED
 	if (!TransitionState(SessionId, ESessionState::ACTIVE, ESessionState::ENDED))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Failed to end session %s - invalid state"), *SessionId);
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Failed to end session %s - invalid state"), *SessionId.ToString());
 		return false;
 	}
 
@@ -50,25 +166,22 @@ bool USessionManager::EndSession(const FString& SessionId)
 		Session->EndTime = FDateTime::UtcNow();
 		Session->TTL = CalculateTTLFromTime(Session->EndTime);
 
-		// Set TTL on all events
-		for (FInteractionEvent& Event : Session->Events)
-		{
-			Event.TTL = Session->TTL;
-		}
-
 		UE_LOG(LogTemp, Log, TEXT("SessionManager: Ended session %s - TTL set to %lld"), 
-			*SessionId, Session->TTL);
+			*SessionId.ToString(), Session->TTL);
 	}
 
+	// Held until the summary is acknowledged, or this long
+	ScheduleEndedDeadlines(SessionId);
+
 	return true;
 }
 
-void USessionManager::TrackEvent(const FString& SessionId, const FString& EventType, const TMap<FString, FString>& EventData)
+void USessionManager::TrackEvent(const FHMVRId& SessionId, const FString& EventType, const TMap<FString, FString>& EventData)
 {
 	FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (!Session)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot track event - session %s not found"), *SessionId);
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot track event - session %s not found"), *SessionId.ToString());
 		return;
 	}
 
@@ -76,32 +189,37 @@ void USessionManager::TrackEvent(const FString& SessionId, const FString& EventT
 	if (Session->State != ESessionState::ACTIVE)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot track event - session %s not active (state: %d)"), 
-			*SessionId, (int32)Session->State);
+			*SessionId.ToString(), (int32)Session->State);
 		return;
 	}
 
 	// Create event
 	FInteractionEvent Event;
-	Event.EventId = FGuid::NewGuid().ToString();
+	Event.EventId = FHMVRId::Generate();
 	Event.Timestamp = FDateTime::UtcNow();
 	Event.PlayerId = Session->PlayerId;
 	Event.EventType = EventType;
 	Event.Data = EventData;
-	Event.TTL = 0; // TTL set when session ends
+	Event.TTL = CalculateTTLFromTime(Event.Timestamp); // sent now, so 72 hours from the event
 
-	// Add to session
-	Session->Events.Add(Event);
+	// Stream it; nothing is kept with the session but the count
+	++Session->EventCount;
+	const TSharedPtr<FHMVREventStream> Stream = EventStream.Pin();
+	if (!Stream || !Stream->Push(MoveTemp(Event)))
+	{
+		++LifecycleStats.EventsNotStreamed;
+	}
 
 	UE_LOG(LogTemp, Verbose, TEXT("SessionManager: Tracked event '%s' for session %s (total events: %d)"),
-		*EventType, *SessionId, Session->Events.Num());
+		*EventType, *SessionId.ToString(), Session->EventCount);
 }
 
-void USessionManager::AddReward(const FString& SessionId, const FString& RewardId)
+void USessionManager::AddReward(const FHMVRId& SessionId, const FString& RewardId)
 {
 	FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (!Session)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot add reward - session %s not found"), *SessionId);
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot add reward - session %s not found"), *SessionId.ToString());
 		return;
 	}
 
@@ -109,25 +227,26 @@ void USessionManager::AddReward(const FString& SessionId, const FString& RewardI
 	if (Session->Rewards.Contains(RewardId))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Reward '%s' already granted in session %s"), 
-			*RewardId, *SessionId);
+			*RewardId, *SessionId.ToString());
 		return;
 	}
 
 	// Add reward
 	Session->Rewards.Add(RewardId);
+	MarkDirty(SessionId);
 
 	UE_LOG(LogTemp, Log, TEXT("SessionManager: Added reward '%s' to session %s (total rewards: %d)"),
-		*RewardId, *SessionId, Session->Rewards.Num());
+		*RewardId, *SessionId.ToString(), Session->Rewards.Num());
 }
 
-FPlayerSessionSummary USessionManager::GenerateSessionSummary(const FString& SessionId)
+FPlayerSessionSummary USessionManager::GenerateSessionSummary(const FHMVRId& SessionId)
 {
 	FPlayerSessionSummary Summary;
 
 	const FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (!Session)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot generate summary - session %s not found"), *SessionId);
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot generate summary - session %s not found"), *SessionId.ToString());
 		return Summary;
 	}
 
@@ -139,36 +258,224 @@ FPlayerSessionSummary USessionManager::GenerateSessionSummary(const FString& Ses
 	Summary.SessionEndTime = Session->EndTime;
 
 	UE_LOG(LogTemp, Log, TEXT("SessionManager: Generated summary for session %s - %d rewards"),
-		*SessionId, Summary.Rewards.Num());
+		*SessionId.ToString(), Summary.Rewards.Num());
 
 	return Summary;
 }
 
-void USessionManager::DiscardSessionState(const FString& SessionId)
+void USessionManager::DiscardSessionState(const FHMVRId& SessionId)
 {
 	FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (!Session)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot discard state - session %s not found"), *SessionId);
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Cannot discard state - session %s not found"), *SessionId.ToString());
 		return;
 	}
 
-	// Discard all gameplay state (events, positions, etc.)
+	// Discard all gameplay state (positions, etc.); events were streamed as they happened.
 	// Keep only rewards for persistence
-	int32 EventCount = Session->Events.Num();
-	Session->Events.Empty();
+	UE_LOG(LogTemp, Log, TEXT("SessionManager: Discarded state of session %s (%d events streamed) - rewards preserved (%d)"),
+		*SessionId.ToString(), Session->EventCount, Session->Rewards.Num());
+
+	// The session itself goes once its summary is acknowledged (AcknowledgeSummary) or its
+	// retention lapses; DynamoDB TTL deletes the persisted copy after 72 hours
+}
+
+void USessionManager::AcknowledgeSummary(const FHMVRId& SessionId)
+{
+	const FPlayerSession* Session = ActiveSessions.Find(SessionId);
+	if (!Session || Session->State != ESessionState::ENDED)
+	{
+		// Already expired, or acknowledged before EndSession (not expected)
+		UE_LOG(LogTemp, Verbose, TEXT("SessionManager: Summary acknowledged for session %s, which is not ENDED"), *SessionId.ToString());
+		return;
+	}
+
+	ActiveSessions.Remove(SessionId);
+	MarkDirty(SessionId);
+	++LifecycleStats.Acknowledged;
+	UE_LOG(LogTemp, Verbose, TEXT("SessionManager: Evicted session %s - summary acknowledged"), *SessionId.ToString());
+}
+
+bool USessionManager::ExpireSession(const FHMVRId& SessionId)
+{
+	const FPlayerSession* Session = ActiveSessions.Find(SessionId);
+	if (!Session)
+	{
+		return false;
+	}
+
+	const ESessionState FromState = Session->State;
+	if (FromState != ESessionState::CREATED && FromState != ESessionState::ENDED)
+	{
+		return false;
+	}
+	if (FromState == ESessionState::ENDED && Session->Rewards.Num() > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Session %s expired before its summary was acknowledged - %d rewards not confirmed"),
+			*SessionId.ToString(), Session->Rewards.Num());
+	}
 
-	UE_LOG(LogTemp, Log, TEXT("SessionManager: Discarded %d events from session %s - rewards preserved (%d)"),
-		EventCount, *SessionId, Session->Rewards.Num());
+	TransitionState(SessionId, FromState, ESessionState::EXPIRED);
+	ActiveSessions.Remove(SessionId);
+	MarkDirty(SessionId);
+	++LifecycleStats.Expired;
+	return true;
+}
 
-	// In production, this is where we would:
-	// 1. Generate PlayerSessionSummary
-	// 2. Send summary to Session API
-	// 3. Remove session from ActiveSessions
-	// 4. DynamoDB TTL will auto-delete after 72 hours
+bool USessionManager::RestoreSession(const FPlayerSession& Session)
+{
+	if (Session.SessionId.IsEmpty() || ActiveSessions.Contains(Session.SessionId))
+	{
+		return false;
+	}
+
+	FPlayerSession& Restored = ActiveSessions.Add(Session.SessionId, Session);
+	if (Restored.State != ESessionState::ENDED)
+	{
+		Restored.State = ESessionState::ENDED;
+		Restored.EndTime = FDateTime::UtcNow();
+		Restored.TTL = CalculateTTLFromTime(Restored.EndTime);
+	}
+	ScheduleEndedDeadlines(Restored.SessionId);
+	MarkDirty(Restored.SessionId);
+	LifecycleStats.PeakSessions = FMath::Max(LifecycleStats.PeakSessions, ActiveSessions.Num());
+
+	UE_LOG(LogTemp, Log, TEXT("SessionManager: Restored session %s for player %s - %d rewards awaiting acknowledgement"),
+		*Restored.SessionId.ToString(), *Restored.PlayerId, Restored.Rewards.Num());
+	return true;
+}
+
+void USessionManager::SetDirtyTracking(bool bEnable)
+{
+	bTrackDirty = bEnable;
+	if (!bEnable)
+	{
+		DirtySessions.Empty();
+	}
+}
+
+void USessionManager::ConsumeDirty(TArray<FPlayerSession>& OutChanged, TArray<FHMVRId>& OutRemoved)
+{
+	for (const FHMVRId& SessionId : DirtySessions)
+	{
+		if (const FPlayerSession* Session = ActiveSessions.Find(SessionId))
+		{
+			OutChanged.Add(*Session);
+		}
+		else
+		{
+			OutRemoved.Add(SessionId);
+		}
+	}
+	DirtySessions.Reset();
+}
+
+void USessionManager::TickExpiry(double Now)
+{
+	ExpiryWheel.Advance(Now, [this](FSessionExpiry&& Due)
+	{
+		// Stale if the session moved on (started, ended, acknowledged) since this was scheduled
+		const FPlayerSession* Session = ActiveSessions.Find(Due.SessionId);
+		if (!Session || Session->State != Due.State)
+		{
+			return;
+		}
+		if (Due.ResendDelay <= 0.f)
+		{
+			ExpireSession(Due.SessionId);
+		}
+		else if (OnSummaryResend)
+		{
+			++LifecycleStats.SummaryResends;
+			UE_LOG(LogTemp, Log, TEXT("SessionManager: Summary of session %s not acknowledged yet - sending it again"),
+				*Due.SessionId.ToString());
+			ScheduleSummaryResend(Due.SessionId, Due.ResendDelay * 2.f, Due.SinceEnded);
+			OnSummaryResend(GenerateSessionSummary(Due.SessionId));
+		}
+	});
+}
+
+SIZE_T USessionManager::GetAllocatedSize() const
+{
+	SIZE_T Size = ActiveSessions.GetAllocatedSize();
+	for (const TPair<FHMVRId, FPlayerSession>& Pair : ActiveSessions)
+	{
+		const FPlayerSession& Session = Pair.Value;
+		Size += Session.PlayerId.GetAllocatedSize() + Session.ShardId.GetAllocatedSize();
+		Size += Session.Rewards.GetAllocatedSize();
+		for (const FString& RewardId : Session.Rewards)
+		{
+			Size += RewardId.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+void USessionManager::ScheduleExpiry(const FHMVRId& SessionId, ESessionState State, float DelaySeconds)
+{
+	FSessionExpiry Expiry;
+	Expiry.SessionId = SessionId;
+	Expiry.State = State;
+	ExpiryWheel.Schedule(GetNow(), FMath::Max(1.f, DelaySeconds), MoveTemp(Expiry));
+
+	if (!ExpiryTickerHandle.IsValid() && ManualClock < 0.0)
+	{
+		ExpiryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &USessionManager::TickExpiryTicker), 1.0f);
+	}
+}
+
+void USessionManager::ScheduleEndedDeadlines(const FHMVRId& SessionId)
+{
+	ScheduleExpiry(SessionId, ESessionState::ENDED, CVarSessionEndedRetention.GetValueOnGameThread());
+	ScheduleSummaryResend(SessionId, CVarSessionSummaryRetry.GetValueOnGameThread(), 0.f);
+}
+
+void USessionManager::ScheduleSummaryResend(const FHMVRId& SessionId, float Delay, float SinceEnded)
+{
+	// Only while the re-send still lands before the session expires; once acknowledged the
+	// pending entry finds the session gone and does nothing
+	if (Delay <= 0.f || SinceEnded + Delay >= CVarSessionEndedRetention.GetValueOnGameThread())
+	{
+		return;
+	}
+	FSessionExpiry Resend;
+	Resend.SessionId = SessionId;
+	Resend.State = ESessionState::ENDED;
+	Resend.ResendDelay = Delay;
+	Resend.SinceEnded = SinceEnded + Delay;
+	ExpiryWheel.Schedule(GetNow(), Delay, MoveTemp(Resend));
+}
+
+bool USessionManager::TickExpiryTicker(float /*DeltaTime*/)
+{
+	TickExpiry(GetNow());
+	if (ExpiryWheel.IsEmpty())
+	{
+		ExpiryTickerHandle.Reset();
+		return false; // re-registered by the next ScheduleExpiry
+	}
+	return true;
+}
+
+bool USessionManager::ExpireOldestEnded()
+{
+	const FHMVRId* Oldest = nullptr;
+	FDateTime OldestEnd = FDateTime::MaxValue();
+	for (const TPair<FHMVRId, FPlayerSession>& Pair : ActiveSessions)
+	{
+		if (Pair.Value.State == ESessionState::ENDED && Pair.Value.EndTime < OldestEnd)
+		{
+			Oldest = &Pair.Key;
+			OldestEnd = Pair.Value.EndTime;
+		}
+	}
+	// Copy: ExpireSession removes the entry the key lives in
+	return Oldest && ExpireSession(FHMVRId(*Oldest));
 }
 
-bool USessionManager::GetSession(const FString& SessionId, FPlayerSession& OutSession) const
+bool USessionManager::GetSession(const FHMVRId& SessionId, FPlayerSession& OutSession) const
 {
 	const FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (Session)
@@ -179,7 +486,7 @@ bool USessionManager::GetSession(const FString& SessionId, FPlayerSession& OutSe
 	return false;
 }
 
-ESessionState USessionManager::GetSessionState(const FString& SessionId) const
+ESessionState USessionManager::GetSessionState(const FHMVRId& SessionId) const
 {
 	const FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (Session)
@@ -206,7 +513,7 @@ int64 USessionManager::CalculateTTLFromTime(const FDateTime& FromTime)
 	return UnixTimestamp;
 }
 
-bool USessionManager::TransitionState(const FString& SessionId, ESessionState FromState, ESessionState ToState)
+bool USessionManager::TransitionState(const FHMVRId& SessionId, ESessionState FromState, ESessionState ToState)
 {
 	FPlayerSession* Session = ActiveSessions.Find(SessionId);
 	if (!Session)
@@ -218,15 +525,16 @@ bool USessionManager::TransitionState(const FString& SessionId, ESessionState Fr
 	if (Session->State != FromState)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("SessionManager: Invalid state transition for session %s - expected %d, got %d"),
-			*SessionId, (int32)FromState, (int32)Session->State);
+			*SessionId.ToString(), (int32)FromState, (int32)Session->State);
 		return false;
 	}
 
 	// Perform transition
 	Session->State = ToState;
+	MarkDirty(SessionId);
 
 	UE_LOG(LogTemp, Log, TEXT("SessionManager: Session %s transitioned from %d to %d"),
-		*SessionId, (int32)FromState, (int32)ToState);
+		*SessionId.ToString(), (int32)FromState, (int32)ToState);
 
 	return true;
 }
@@ -4,8 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
+#include "HMVRTimingWheel.h"
+#include "HMVRId.h"
 #include "SessionManager.generated.h"
 
+class FHMVREventStream;
+
 /**
  * Session state enum (Requirement 5.6)
  */
@@ -27,7 +32,7 @@ struct FInteractionEvent
 	GENERATED_BODY()
 
 	UPROPERTY(BlueprintReadOnly)
-	FString EventId;
+	FHMVRId EventId;
 
 	UPROPERTY(BlueprintReadOnly)
 	FDateTime Timestamp;
@@ -44,11 +49,10 @@ struct FInteractionEvent
 	UPROPERTY(BlueprintReadOnly)
 	int64 TTL; // Unix timestamp for DynamoDB TTL (72 hours after session end)
 
+	// Cheap to construct (ring cells, batches); TrackEvent assigns the id and timestamp
 	FInteractionEvent()
-		: Timestamp(FDateTime::UtcNow())
-		, TTL(0)
+		: TTL(0)
 	{
-		EventId = FGuid::NewGuid().ToString();
 	}
 };
 
@@ -61,7 +65,7 @@ struct FPlayerSession
 	GENERATED_BODY()
 
 	UPROPERTY(BlueprintReadOnly)
-	FString SessionId;
+	FHMVRId SessionId;
 
 	UPROPERTY(BlueprintReadOnly)
 	FString PlayerId;
@@ -78,8 +82,9 @@ struct FPlayerSession
 	UPROPERTY(BlueprintReadOnly)
 	FDateTime EndTime;
 
+	// Events are streamed as they happen (FHMVREventStream); only the count stays with the session
 	UPROPERTY(BlueprintReadOnly)
-	TArray<FInteractionEvent> Events;
+	int32 EventCount = 0;
 
 	UPROPERTY(BlueprintReadOnly)
 	TArray<FString> Rewards; // Reward IDs from catalog
@@ -87,12 +92,11 @@ struct FPlayerSession
 	UPROPERTY(BlueprintReadOnly)
 	int64 TTL; // Unix timestamp for DynamoDB TTL (72 hours after session end)
 
+	// CreateSession assigns the id and start time
 	FPlayerSession()
 		: State(ESessionState::CREATED)
-		, StartTime(FDateTime::UtcNow())
 		, TTL(0)
 	{
-		SessionId = FGuid::NewGuid().ToString();
 	}
 };
 
@@ -105,7 +109,7 @@ struct FPlayerSessionSummary
 	GENERATED_BODY()
 
 	UPROPERTY(BlueprintReadOnly)
-	FString SessionId;
+	FHMVRId SessionId;
 
 	UPROPERTY(BlueprintReadOnly)
 	FString PlayerId;
@@ -129,6 +133,19 @@ struct FPlayerSessionSummary
 /**
  * Session Manager
  * Implements ephemeral session logic (Requirement 5.1, 5.5, 5.6, 5.7)
+ *
+ * Lifecycle: CREATED → ACTIVE → ENDED → evicted once the Session API acknowledges the
+ * summary (AcknowledgeSummary). Sessions that stall — CREATED but never started within
+ * hmvr.Session.CreatedTimeoutSeconds, or ENDED without an acknowledgement within
+ * hmvr.Session.EndedRetentionSeconds — move to EXPIRED and are evicted. Until then an
+ * unacknowledged summary is handed to OnSummaryResend after hmvr.Session.SummaryRetrySeconds,
+ * the delay doubling each time, so a Session API outage shorter than the retention loses no
+ * rewards. Deadlines and resends live in one timing wheel driven by a 1 s ticker that only
+ * runs while something is pending.
+ *
+ * Memory is bounded: at hmvr.Session.MaxSessions the oldest ENDED session is expired to make
+ * room. Interaction events are not held per session: TrackEvent hands them to the event
+ * stream (SetEventStream). Evicted sessions read as EXPIRED through GetSessionState.
  */
 UCLASS()
 class HYPERMAGEVR_API USessionManager : public UObject
@@ -136,6 +153,8 @@ class HYPERMAGEVR_API USessionManager : public UObject
 	GENERATED_BODY()
 
 public:
+	virtual void BeginDestroy() override;
+
 	/**
 	 * Create a new session (state: CREATED)
 	 * @param PlayerId The player ID
@@ -151,7 +170,7 @@ public:
 	 * @return True if successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	bool StartSession(const FString& SessionId);
+	bool StartSession(const FHMVRId& SessionId);
 
 	/**
 	 * End a session (transition ACTIVE → ENDED)
@@ -159,16 +178,22 @@ public:
 	 * @return True if successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	bool EndSession(const FString& SessionId);
+	bool EndSession(const FHMVRId& SessionId);
+
+	/** Game thread: send this ENDED session's summary again (its acknowledgement is still outstanding) */
+	TFunction<void(const FPlayerSessionSummary&)> OnSummaryResend;
+
+	/** Where TrackEvent sends events; without one they are counted and discarded */
+	void SetEventStream(const TSharedPtr<FHMVREventStream>& InEventStream) { EventStream = InEventStream; }
 
 	/**
-	 * Track a player event during session
+	 * Track a player event during session (streamed to the Session API, not kept)
 	 * @param SessionId The session ID
 	 * @param EventType The event type
 	 * @param EventData The event data
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	void TrackEvent(const FString& SessionId, const FString& EventType, const TMap<FString, FString>& EventData);
+	void TrackEvent(const FHMVRId& SessionId, const FString& EventType, const TMap<FString, FString>& EventData);
 
 	/**
 	 * Add a reward to a session
@@ -176,7 +201,7 @@ public:
 	 * @param RewardId The reward ID
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	void AddReward(const FString& SessionId, const FString& RewardId);
+	void AddReward(const FHMVRId& SessionId, const FString& RewardId);
 
 	/**
 	 * Generate session summary (for persistence)
@@ -184,14 +209,68 @@ public:
 	 * @return The session summary
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	FPlayerSessionSummary GenerateSessionSummary(const FString& SessionId);
+	FPlayerSessionSummary GenerateSessionSummary(const FHMVRId& SessionId);
 
 	/**
 	 * Discard session gameplay state (keeps only rewards)
 	 * @param SessionId The session ID
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	void DiscardSessionState(const FString& SessionId);
+	void DiscardSessionState(const FHMVRId& SessionId);
+
+	/**
+	 * The Session API has the summary; evict the ENDED session
+	 * @param SessionId The session ID
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	void AcknowledgeSummary(const FHMVRId& SessionId);
+
+	/**
+	 * Expire a session (transition CREATED/ENDED → EXPIRED) and evict it. Active sessions do not expire.
+	 * @param SessionId The session ID
+	 * @return True if the session expired
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	bool ExpireSession(const FHMVRId& SessionId);
+
+	/**
+	 * Re-insert a session recovered from a crash snapshot. Its player is gone, so it comes back
+	 * ENDED (ended now if it was still running) and waits for its summary to be acknowledged.
+	 * @param Session The recovered session
+	 * @return False if the id is empty or already held
+	 */
+	bool RestoreSession(const FPlayerSession& Session);
+
+	/** Snapshot support: remember which sessions change (off by default) */
+	void SetDirtyTracking(bool bEnable);
+
+	/** Sessions changed since the last call: copies of those still held, ids of those evicted */
+	void ConsumeDirty(TArray<FPlayerSession>& OutChanged, TArray<FHMVRId>& OutRemoved);
+
+	/** Sessions held in memory (any state) */
+	UFUNCTION(BlueprintCallable, Category = "Session")
+	int32 GetSessionCount() const { return ActiveSessions.Num(); }
+
+	/** Heap held by the session map, including per-session strings and rewards */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Run due expiries up to Now (FPlatformTime::Seconds, or the manual clock) */
+	void TickExpiry(double Now);
+
+	/** Testing: drive deadlines from Now instead of the platform clock (negative = platform clock) */
+	void SetManualClock(double Now) { ManualClock = Now; }
+
+	struct FLifecycleStats
+	{
+		int64 Created = 0;
+		int64 Acknowledged = 0;
+		int64 SummaryResends = 0;
+		int64 Expired = 0;
+		int64 ExpiredForCap = 0;
+		int64 EventsNotStreamed = 0; // no event stream attached, or its ring was full
+		int32 PeakSessions = 0;
+	};
+	const FLifecycleStats& GetLifecycleStats() const { return LifecycleStats; }
 
 	/**
 	 * Get session by ID
@@ -200,7 +279,7 @@ public:
 	 * @return True if found
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	bool GetSession(const FString& SessionId, FPlayerSession& OutSession) const;
+	bool GetSession(const FHMVRId& SessionId, FPlayerSession& OutSession) const;
 
 	/**
 	 * Get session state
@@ -208,7 +287,7 @@ public:
 	 * @return The session state
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Session")
-	ESessionState GetSessionState(const FString& SessionId) const;
+	ESessionState GetSessionState(const FHMVRId& SessionId) const;
 
 	/**
 	 * Calculate TTL timestamp (72 hours from now)
@@ -228,8 +307,37 @@ public:
 protected:
 	// Active sessions (in-memory, ephemeral)
 	UPROPERTY()
-	TMap<FString, FPlayerSession> ActiveSessions;
+	TMap<FHMVRId, FPlayerSession> ActiveSessions;
 
 	// Helper to transition session state
-	bool TransitionState(const FString& SessionId, ESessionState FromState, ESessionState ToState);
+	bool TransitionState(const FHMVRId& SessionId, ESessionState FromState, ESessionState ToState);
+
+private:
+	// Fires if the session is still in State when it comes due; later transitions make it stale.
+	// With a ResendDelay it re-sends the summary (and schedules the next, doubled) instead of expiring.
+	struct FSessionExpiry
+	{
+		FHMVRId SessionId;
+		ESessionState State = ESessionState::CREATED;
+		float ResendDelay = 0.f;
+		float SinceEnded = 0.f;
+	};
+
+	double GetNow() const { return ManualClock >= 0.0 ? ManualClock : FPlatformTime::Seconds(); }
+	void ScheduleExpiry(const FHMVRId& SessionId, ESessionState State, float DelaySeconds);
+	void ScheduleEndedDeadlines(const FHMVRId& SessionId);
+	void ScheduleSummaryResend(const FHMVRId& SessionId, float Delay, float SinceEnded);
+	bool TickExpiryTicker(float DeltaTime);
+	bool ExpireOldestEnded();
+	void MarkDirty(const FHMVRId& SessionId) { if (bTrackDirty) { DirtySessions.Add(SessionId); } }
+
+	THMVRTimingWheel<FSessionExpiry> ExpiryWheel { /*TickSeconds=*/1.0, /*NumSlots=*/512 };
+	FTSTicker::FDelegateHandle ExpiryTickerHandle;
+	double ManualClock = -1.0;
+	TWeakPtr<FHMVREventStream> EventStream; // owned by the game mode
+	FLifecycleStats LifecycleStats;
+
+	// Changed since the last snapshot collect; event counts alone do not mark a session
+	TSet<FHMVRId> DirtySessions;
+	bool bTrackDirty = false;
 };
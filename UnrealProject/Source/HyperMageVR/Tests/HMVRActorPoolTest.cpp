@@ -0,0 +1,100 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HMVRActorPool.h"
+#include "HMVRArtifact.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRActorPoolTest, "HyperMageVR.Pool.ActorPool",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRActorPoolTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* MaxParkedVar = IConsoleManager::Get().FindConsoleVariable(TEXT("hmvr.Pool.MaxParkedPerClass"));
+	if (!TestNotNull(TEXT("hmvr.Pool.MaxParkedPerClass exists"), MaxParkedVar))
+	{
+		return false;
+	}
+	const FString PreviousMaxParked = MaxParkedVar->GetString();
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Test world"), World))
+	{
+		return false;
+	}
+	UHMVRActorPoolSubsystem* Pool = World->GetSubsystem<UHMVRActorPoolSubsystem>();
+	if (!TestNotNull(TEXT("Pool subsystem"), Pool))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	const TSubclassOf<AActor> ArtifactClass = AHMVRArtifact::StaticClass();
+	const FTransform First(FVector(100.f, 0.f, 0.f));
+	const FTransform Second(FVector(0.f, 200.f, 0.f));
+	int32 Configured = 0;
+	auto Configure = [&Configured](AActor*) { ++Configured; };
+
+	// Empty pool: spawned, configured, live
+	AActor* Spawned = Pool->Acquire(ArtifactClass, First, Configure);
+	if (!TestNotNull(TEXT("Acquire spawns when nothing is parked"), Spawned))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+	TestEqual(TEXT("Configure runs for a fresh spawn"), Configured, 1);
+	TestTrue(TEXT("Fresh actor is live"), Pool->IsLive(Spawned));
+	TestFalse(TEXT("Fresh actor is not parked"), Pool->IsParked(Spawned));
+
+	// Release parks it: hidden, no collision, counted
+	TestTrue(TEXT("Release parks a poolable actor"), Pool->Release(Spawned));
+	TestTrue(TEXT("Parked"), Pool->IsParked(Spawned));
+	TestFalse(TEXT("No longer live"), Pool->IsLive(Spawned));
+	TestTrue(TEXT("Parked actor is hidden"), Spawned->IsHidden());
+	TestFalse(TEXT("Parked actor has no collision"), Spawned->GetActorEnableCollision());
+	TestEqual(TEXT("One parked"), Pool->GetParkedCount(ArtifactClass), 1);
+	TestFalse(TEXT("Releasing a parked actor again is refused"), Pool->Release(Spawned));
+	TestEqual(TEXT("Still one parked"), Pool->GetParkedCount(ArtifactClass), 1);
+
+	// Acquire reuses the same actor at the new transform
+	AActor* Reused = Pool->Acquire(ArtifactClass, Second, Configure);
+	TestTrue(TEXT("Acquire hands out the parked actor"), Reused == Spawned);
+	TestEqual(TEXT("Configure runs for a reused actor"), Configured, 2);
+	TestTrue(TEXT("Moved to the new transform"), Reused && Reused->GetActorLocation().Equals(Second.GetLocation()));
+	TestFalse(TEXT("Woken actor is visible"), Reused && Reused->IsHidden());
+	TestEqual(TEXT("Nothing parked"), Pool->GetParkedCount(ArtifactClass), 0);
+
+	// Per-class cap: beyond it a released actor is destroyed
+	MaxParkedVar->Set(1, ECVF_SetByCode);
+	AActor* Extra = Pool->Acquire(ArtifactClass, First);
+	TestTrue(TEXT("First release under the cap parks"), Pool->Release(Reused));
+	TestFalse(TEXT("Release over the cap destroys"), Pool->Release(Extra));
+	TestFalse(TEXT("Destroyed actor is gone"), IsValid(Extra));
+	MaxParkedVar->Set(*PreviousMaxParked, ECVF_SetByCode);
+
+	// A parked actor destroyed from outside is skipped, not handed out
+	Reused->Destroy();
+	AActor* Replacement = Pool->Acquire(ArtifactClass, First);
+	TestTrue(TEXT("Destroyed parked actor is skipped"), IsValid(Replacement) && Replacement != Reused);
+
+	// Classes without IHMVRPooledActor are destroyed on release
+	AActor* Plain = Pool->Acquire(AActor::StaticClass(), First);
+	TestNotNull(TEXT("Any actor class can be acquired"), Plain);
+	TestFalse(TEXT("Non-poolable actor is not parked"), Pool->Release(Plain));
+	TestFalse(TEXT("Non-poolable actor is destroyed"), IsValid(Plain));
+
+	// ReleaseAll parks everything still handed out
+	AActor* Another = Pool->Acquire(ArtifactClass, Second);
+	TestEqual(TEXT("ReleaseAll parks every live actor"), Pool->ReleaseAll(), 2);
+	TestTrue(TEXT("Both parked"), Pool->IsParked(Replacement) && Pool->IsParked(Another));
+	TestEqual(TEXT("Two parked"), Pool->GetParkedCount(ArtifactClass), 2);
+
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
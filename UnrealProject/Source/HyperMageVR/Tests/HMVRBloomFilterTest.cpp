@@ -0,0 +1,64 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Hash/CityHash.h"
+#include "HMVRBloomFilter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	uint64 TestHash(int32 Value)
+	{
+		return CityHash64(reinterpret_cast<const char*>(&Value), sizeof(Value));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRBloomFilterTest, "HyperMageVR.Containers.BloomFilter",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRBloomFilterTest::RunTest(const FString& Parameters)
+{
+	// Bit count rounds up to a power of two, never below one word
+	TestEqual(TEXT("Bits round up to a power of two"), FHMVRBloomFilter(1000).GetNumBits(), 1024u);
+	TestEqual(TEXT("At least 64 bits"), FHMVRBloomFilter(1).GetNumBits(), 64u);
+
+	// ~10 bits per key with 7 probes: under 1% expected false positives
+	constexpr int32 NumKeys = 10000;
+	FHMVRBloomFilter Bloom(NumKeys * 10);
+	for (int32 i = 0; i < NumKeys; ++i)
+	{
+		Bloom.Add(TestHash(i));
+	}
+	TestEqual(TEXT("Counts every add"), Bloom.GetNumAdded(), static_cast<int64>(NumKeys));
+
+	int32 Missed = 0;
+	for (int32 i = 0; i < NumKeys; ++i)
+	{
+		Missed += Bloom.MayContain(TestHash(i)) ? 0 : 1;
+	}
+	TestEqual(TEXT("Never misses an added key"), Missed, 0);
+
+	int32 FalsePositives = 0;
+	for (int32 i = NumKeys; i < 2 * NumKeys; ++i)
+	{
+		FalsePositives += Bloom.MayContain(TestHash(i)) ? 1 : 0;
+	}
+	const double Measured = static_cast<double>(FalsePositives) / NumKeys;
+	const double Estimated = Bloom.EstimateFalsePositiveRate();
+	TestTrue(FString::Printf(TEXT("False-positive rate %.4f stays near the estimate %.4f"), Measured, Estimated),
+		Measured < FMath::Max(0.01, Estimated * 3.0));
+
+	Bloom.Reset();
+	TestEqual(TEXT("Reset clears the count"), Bloom.GetNumAdded(), static_cast<int64>(0));
+	int32 AfterReset = 0;
+	for (int32 i = 0; i < NumKeys; ++i)
+	{
+		AfterReset += Bloom.MayContain(TestHash(i)) ? 1 : 0;
+	}
+	TestEqual(TEXT("Reset clears every bit"), AfterReset, 0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HMVRBoundedRing.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRBoundedRingTest, "HyperMageVR.Containers.BoundedRing",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRBoundedRingTest::RunTest(const FString& Parameters)
+{
+	// One thread: capacity, full and empty, order across many wraps
+	{
+		THMVRBoundedRing<int32> Ring(5);
+		TestEqual(TEXT("Capacity rounds up to a power of two"), static_cast<int32>(Ring.GetCapacity()), 8);
+		TestEqual(TEXT("Smallest capacity is two"), static_cast<int32>(THMVRBoundedRing<int32>(0).GetCapacity()), 2);
+
+		int32 Popped = -1;
+		TestFalse(TEXT("Empty ring refuses a pop"), Ring.TryPop(Popped));
+		for (int32 i = 0; i < 8; ++i)
+		{
+			TestTrue(TEXT("Push while there is room"), Ring.TryPush(int32(i)));
+		}
+		TestEqual(TEXT("Full"), Ring.ApproxNum(), 8);
+
+		int32 Refused = 99;
+		TestFalse(TEXT("Full ring refuses a push"), Ring.TryPush(MoveTemp(Refused)));
+		TestEqual(TEXT("Refused item is left with the caller"), Refused, 99);
+
+		bool bInOrder = true;
+		int32 Next = 0;
+		int32 Pushed = 8;
+		for (int32 Round = 0; Round < 1000; ++Round)
+		{
+			// Pop three, push three, so the indices wrap many times over
+			for (int32 i = 0; i < 3; ++i)
+			{
+				bInOrder &= Ring.TryPop(Popped) && Popped == Next++;
+			}
+			for (int32 i = 0; i < 3; ++i)
+			{
+				bInOrder &= Ring.TryPush(int32(Pushed++));
+			}
+		}
+		while (Ring.TryPop(Popped))
+		{
+			bInOrder &= Popped == Next++;
+		}
+		TestTrue(TEXT("First in, first out across wraps"), bInOrder);
+		TestEqual(TEXT("Everything pushed was popped"), Next, Pushed);
+		TestEqual(TEXT("Empty again"), Ring.ApproxNum(), 0);
+	}
+
+	// Move-only items are moved in and out, not copied
+	{
+		THMVRBoundedRing<TUniquePtr<int32>> Ring(2);
+		TestTrue(TEXT("Push a unique pointer"), Ring.TryPush(MakeUnique<int32>(7)));
+		TUniquePtr<int32> Out;
+		if (TestTrue(TEXT("Pop it back"), Ring.TryPop(Out)) && TestNotNull(TEXT("Popped pointer"), Out.Get()))
+		{
+			TestEqual(TEXT("Same value"), *Out, 7);
+		}
+	}
+
+	// Several producers, one consumer: every item exactly once, each producer's items in order
+	{
+		constexpr int32 Producers = 4;
+		constexpr int32 PerProducer = 50000;
+		THMVRBoundedRing<int32> Ring(256);
+		std::atomic<bool> bGaveUp { false };
+
+		TArray<TFuture<void>> Futures;
+		for (int32 Producer = 0; Producer < Producers; ++Producer)
+		{
+			Futures.Add(Async(EAsyncExecution::Thread, [&Ring, &bGaveUp, Producer]()
+			{
+				for (int32 i = 0; i < PerProducer && !bGaveUp.load(); ++i)
+				{
+					int32 Item = Producer * PerProducer + i;
+					while (!Ring.TryPush(MoveTemp(Item)) && !bGaveUp.load())
+					{
+						FPlatformProcess::Yield();
+					}
+				}
+			}));
+		}
+
+		TArray<int32> NextPerProducer;
+		NextPerProducer.Init(0, Producers);
+		bool bOrdered = true;
+		int32 Received = 0;
+		const double GiveUpAt = FPlatformTime::Seconds() + 30.0;
+		while (Received < Producers * PerProducer && FPlatformTime::Seconds() < GiveUpAt)
+		{
+			int32 Item = 0;
+			if (!Ring.TryPop(Item))
+			{
+				FPlatformProcess::Yield();
+				continue;
+			}
+			const int32 Producer = Item / PerProducer;
+			bOrdered &= Producer >= 0 && Producer < Producers && Item % PerProducer == NextPerProducer[Producer]++;
+			++Received;
+		}
+		bGaveUp = Received < Producers * PerProducer; // lets blocked producers finish
+		for (TFuture<void>& Future : Futures)
+		{
+			Future.Wait();
+		}
+
+		TestEqual(TEXT("Every item received"), Received, Producers * PerProducer);
+		TestTrue(TEXT("Each producer's items arrive once and in order"), bOrdered);
+		int32 Leftover = 0;
+		TestFalse(TEXT("Nothing left over"), !bGaveUp && Ring.TryPop(Leftover));
+	}
+
+	return true;
+}
+
+#endif
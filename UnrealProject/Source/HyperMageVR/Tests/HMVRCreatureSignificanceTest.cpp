@@ -0,0 +1,85 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "HMVRCreatureSignificance.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRCreatureSignificanceTest, "HyperMageVR.Creatures.Significance",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRCreatureSignificanceTest::RunTest(const FString& Parameters)
+{
+	// Pin the thresholds so the test does not depend on the shipped defaults
+	const TCHAR* const Names[] = {
+		TEXT("hmvr.Significance.NearDistance"),
+		TEXT("hmvr.Significance.MidDistance"),
+		TEXT("hmvr.Significance.FarDistance"),
+		TEXT("hmvr.Significance.Hysteresis"),
+	};
+	const TCHAR* const Values[] = { TEXT("1000"), TEXT("2000"), TEXT("4000"), TEXT("0.1") };
+	IConsoleVariable* Vars[UE_ARRAY_COUNT(Names)] = {};
+	FString Previous[UE_ARRAY_COUNT(Names)];
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Names); ++i)
+	{
+		Vars[i] = IConsoleManager::Get().FindConsoleVariable(Names[i]);
+		if (!TestNotNull(FString::Printf(TEXT("%s exists"), Names[i]), Vars[i]))
+		{
+			return false;
+		}
+	}
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Names); ++i)
+	{
+		Previous[i] = Vars[i]->GetString();
+		Vars[i]->Set(Values[i], ECVF_SetByCode);
+	}
+
+	using ETier = EHMVRSignificance;
+	auto Choose = [](ETier Current, float Distance)
+	{
+		return static_cast<int32>(UHMVRCreatureSignificanceSubsystem::ChooseTier(Current, Distance * Distance));
+	};
+	auto Tier = [](ETier Value) { return static_cast<int32>(Value); };
+
+	// Promotion happens at the threshold
+	{
+		TestEqual(TEXT("Medium at Near becomes High"), Choose(ETier::Medium, 1000.f), Tier(ETier::High));
+		TestEqual(TEXT("Low at Mid becomes Medium"), Choose(ETier::Low, 2000.f), Tier(ETier::Medium));
+		TestEqual(TEXT("Dormant wakes at Far"), Choose(ETier::Dormant, 4000.f), Tier(ETier::Low));
+		TestEqual(TEXT("Dormant next to a player jumps straight to High"), Choose(ETier::Dormant, 10.f), Tier(ETier::High));
+	}
+
+	// Demotion waits for the hysteresis margin
+	{
+		TestEqual(TEXT("High just past Near stays High"), Choose(ETier::High, 1050.f), Tier(ETier::High));
+		TestEqual(TEXT("High past Near + 10% drops to Medium"), Choose(ETier::High, 1150.f), Tier(ETier::Medium));
+		TestEqual(TEXT("Medium just past Mid stays Medium"), Choose(ETier::Medium, 2150.f), Tier(ETier::Medium));
+		TestEqual(TEXT("Low just past Far stays Low"), Choose(ETier::Low, 4300.f), Tier(ETier::Low));
+		TestEqual(TEXT("Low past Far + 10% goes Dormant"), Choose(ETier::Low, 4500.f), Tier(ETier::Dormant));
+		TestEqual(TEXT("High inside Far's band lands on Low, not Dormant"), Choose(ETier::High, 4300.f), Tier(ETier::Low));
+		TestEqual(TEXT("High far away drops several tiers at once"), Choose(ETier::High, 10000.f), Tier(ETier::Dormant));
+	}
+
+	// Steady inside a band
+	{
+		TestEqual(TEXT("Medium between Near and Mid stays Medium"), Choose(ETier::Medium, 1500.f), Tier(ETier::Medium));
+		TestEqual(TEXT("Nobody at all is Dormant"), static_cast<int32>(UHMVRCreatureSignificanceSubsystem::ChooseTier(ETier::Dormant, MAX_flt)),
+			Tier(ETier::Dormant));
+	}
+
+	// No hysteresis: demote right past the threshold
+	{
+		Vars[3]->Set(TEXT("0"), ECVF_SetByCode);
+		TestEqual(TEXT("High just past Near drops without hysteresis"), Choose(ETier::High, 1001.f), Tier(ETier::Medium));
+	}
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Names); ++i)
+	{
+		Vars[i]->Set(*Previous[i], ECVF_SetByCode);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,104 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "HMVRId.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRIdTest, "HyperMageVR.Ids.HMVRId",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRIdTest::RunTest(const FString& Parameters)
+{
+	// Hex form
+	{
+		FHMVRId Known;
+		Known.Hi = 0x0123456789abcdefull;
+		Known.Lo = 0xfedcba9876543210ull;
+		TestEqual(TEXT("Hi first, lowercase, zero padded"), Known.ToString(), FString(TEXT("0123456789abcdeffedcba9876543210")));
+		TestEqual(TEXT("Empty id formats as an empty string"), FHMVRId().ToString(), FString());
+
+		FHMVRId Parsed;
+		TestTrue(TEXT("Parse its own output"), FHMVRId::Parse(Known.ToString(), Parsed) && Parsed == Known);
+		TestTrue(TEXT("Parse accepts uppercase"), FHMVRId::Parse(TEXT("0123456789ABCDEFFEDCBA9876543210"), Parsed) && Parsed == Known);
+
+		const FHMVRId Before = Parsed;
+		TestFalse(TEXT("Too short"), FHMVRId::Parse(TEXT("0123456789abcdef"), Parsed));
+		TestFalse(TEXT("Too long"), FHMVRId::Parse(Known.ToString() + TEXT("0"), Parsed));
+		TestFalse(TEXT("Not hex"), FHMVRId::Parse(TEXT("0123456789abcdeffedcba987654321g"), Parsed));
+		TestFalse(TEXT("GUID form is not an id"), FHMVRId::Parse(FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens), Parsed));
+		TestTrue(TEXT("Failed parse leaves the output alone"), Parsed == Before);
+	}
+
+	// Layout: time and shard in Hi
+	{
+		const uint16 PreviousShard = FHMVRId::Generate().GetShard();
+		FHMVRId::SetShard(0xBEEF);
+		const int64 NowMs = static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+		const FHMVRId Id = FHMVRId::Generate();
+		FHMVRId::SetShard(PreviousShard);
+
+		TestFalse(TEXT("Generated ids are never empty"), Id.IsEmpty());
+		TestEqual(TEXT("Shard in the low 16 bits of Hi"), static_cast<int32>(Id.GetShard()), 0xBEEF);
+		TestTrue(TEXT("Timestamp is the wall clock"), FMath::Abs(Id.GetUnixMilliseconds() - NowMs) < 5000);
+	}
+
+	// Order: generation order, operator< and hex order agree
+	{
+		constexpr int32 Count = 10000;
+		TArray<FHMVRId> Ids;
+		Ids.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Ids.Add(FHMVRId::Generate());
+		}
+		bool bIncreasing = true;
+		bool bHexAgrees = true;
+		for (int32 i = 1; i < Count; ++i)
+		{
+			bIncreasing &= Ids[i - 1] < Ids[i];
+			bHexAgrees &= Ids[i - 1].ToString() < Ids[i].ToString();
+		}
+		TestTrue(TEXT("Ids from one thread strictly increase"), bIncreasing);
+		TestTrue(TEXT("Hex strings sort like the ids"), bHexAgrees);
+	}
+
+	// Uniqueness across threads
+	{
+		constexpr int32 Threads = 4;
+		constexpr int32 PerThread = 20000;
+		TArray<TArray<FHMVRId>> PerThreadIds;
+		PerThreadIds.SetNum(Threads);
+		TArray<TFuture<void>> Futures;
+		for (int32 Thread = 0; Thread < Threads; ++Thread)
+		{
+			TArray<FHMVRId>* Out = &PerThreadIds[Thread];
+			Futures.Add(Async(EAsyncExecution::Thread, [Out]()
+			{
+				Out->Reserve(PerThread);
+				for (int32 i = 0; i < PerThread; ++i)
+				{
+					Out->Add(FHMVRId::Generate());
+				}
+			}));
+		}
+		for (TFuture<void>& Future : Futures)
+		{
+			Future.Wait();
+		}
+
+		TSet<FHMVRId> Seen;
+		Seen.Reserve(Threads * PerThread);
+		for (const TArray<FHMVRId>& Ids : PerThreadIds)
+		{
+			Seen.Append(Ids);
+		}
+		TestEqual(TEXT("No id generated twice across threads"), Seen.Num(), Threads * PerThread);
+	}
+
+	return true;
+}
+
+#endif
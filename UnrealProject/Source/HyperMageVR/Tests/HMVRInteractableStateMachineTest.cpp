@@ -0,0 +1,213 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Engine/World.h"
+#include "HMVRCreature.h"
+#include "HMVRMachinery.h"
+#include "HMVRInteractableStateMachine.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	using EState = EInteractableState;
+	using EEvent = EHMVRInteractableEvent;
+
+	/**
+	 * What the owners did before the tables, written out from their old hand-coded handlers.
+	 * False where the old code could never see Event in that state (a timer that only runs in
+	 * one sub-state), so the table is free to do anything there.
+	 */
+	bool LegacyTransition(FName Machine, EState& State, uint8& SubState, EEvent Event)
+	{
+		if (Machine == TEXT("Creature"))
+		{
+			const bool bAlive = State != EState::Resolved;
+			switch (Event)
+			{
+			case EEvent::Approach:        // OnPlayerApproach, out of attack range
+				if (bAlive) { State = EState::Alert; SubState = static_cast<uint8>(ECreatureSubState::Chase); }
+				break;
+			case EEvent::ApproachInRange: // OnPlayerApproach, within AttackRadius
+				if (bAlive) { State = EState::Alert; SubState = static_cast<uint8>(ECreatureSubState::Attack); }
+				break;
+			case EEvent::Leave:           // OnDetectionOverlapEnd
+				if (State == EState::Alert) { State = EState::Idle; SubState = static_cast<uint8>(ECreatureSubState::Patrol); }
+				break;
+			case EEvent::Damage:          // OnDamageReceived, still alive
+				if (bAlive) { State = EState::Active; SubState = static_cast<uint8>(ECreatureSubState::Attack); }
+				break;
+			case EEvent::Killed:          // OnDamageReceived: Active + Attack, then Resolved
+				if (bAlive) { State = EState::Resolved; SubState = static_cast<uint8>(ECreatureSubState::Attack); }
+				break;
+			default:                      // interact was turned into an approach by the owner
+				break;
+			}
+			return true;
+		}
+		if (Machine == TEXT("Machinery"))
+		{
+			const bool bLocked = SubState == static_cast<uint8>(EMachinerySubState::Locked);
+			switch (Event)
+			{
+			case EEvent::Approach:
+				if (bLocked) { State = EState::Alert; }
+				break;
+			case EEvent::Interact:
+				if (bLocked) { State = EState::Active; SubState = static_cast<uint8>(EMachinerySubState::Unlocking); }
+				break;
+			case EEvent::TimerDone:       // OnUnlockTimerComplete; the timer only runs while unlocking
+				if (SubState != static_cast<uint8>(EMachinerySubState::Unlocking)) { return false; }
+				State = EState::Resolved;
+				SubState = static_cast<uint8>(EMachinerySubState::Open);
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+		if (Machine == TEXT("Environmental"))
+		{
+			switch (Event)
+			{
+			case EEvent::Interact:        // Trigger (approach and overlap also trigger); bOneShot is the owner's
+				if (State != EState::Resolved) { State = EState::Active; }
+				break;
+			case EEvent::TimerDone:       // OnSequenceComplete; the sequence only runs while Active
+				if (State != EState::Active) { return false; }
+				State = EState::Resolved;
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+		if (Machine == TEXT("Artefact"))
+		{
+			switch (Event)
+			{
+			case EEvent::Approach:
+				if (State != EState::Resolved) { State = EState::Alert; }
+				break;
+			case EEvent::Interact:        // OnCollected
+				if (State != EState::Resolved) { State = EState::Resolved; }
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+		return false;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRInteractableStateMachineTest, "HyperMageVR.Interactables.StateMachine",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRInteractableStateMachineTest::RunTest(const FString& Parameters)
+{
+	const FString Path = FPaths::Combine(FPaths::ProjectContentDir(), TEXT("Data"), TEXT("InteractableStateMachines.json"));
+	FString Json;
+	if (!TestTrue(TEXT("Shipped state machine file is readable"), FFileHelper::LoadFileToString(Json, *Path)))
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Test world"), World))
+	{
+		return false;
+	}
+	UHMVRInteractableStateMachineSubsystem* StateMachines = World->GetSubsystem<UHMVRInteractableStateMachineSubsystem>();
+	if (!TestNotNull(TEXT("State machine subsystem"), StateMachines))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	FString Error;
+	const bool bLoaded = StateMachines->LoadDefinitions(Json, Error);
+	if (!TestTrue(FString::Printf(TEXT("Shipped file compiles%s%s"), Error.IsEmpty() ? TEXT("") : TEXT(": "), *Error), bLoaded))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	struct FMachineCase
+	{
+		const TCHAR* Name;
+		int32 NumSubStates;
+	};
+	const FMachineCase Cases[] = {
+		{ TEXT("Creature"), 3 },
+		{ TEXT("Machinery"), 3 },
+		{ TEXT("Environmental"), 1 },
+		{ TEXT("Artefact"), 1 },
+	};
+	const UEnum* StateEnum = StaticEnum<EInteractableState>();
+	const UEnum* EventEnum = StaticEnum<EHMVRInteractableEvent>();
+
+	for (const FMachineCase& Case : Cases)
+	{
+		const FName Machine(Case.Name);
+		if (!TestTrue(FString::Printf(TEXT("'%s' is defined"), Case.Name), StateMachines->HasMachine(Machine)))
+		{
+			continue;
+		}
+		const int32 Slot = StateMachines->Register(nullptr, Machine, EState::Idle, 0);
+
+		// Every (state, sub-state, event) cell against what the owner used to do
+		for (int32 StateIndex = 0; StateIndex <= static_cast<int32>(EState::Resolved); ++StateIndex)
+		{
+			for (int32 SubIndex = 0; SubIndex < Case.NumSubStates; ++SubIndex)
+			{
+				for (int32 EventIndex = 0; EventIndex < static_cast<int32>(EEvent::Num); ++EventIndex)
+				{
+					const EState FromState = static_cast<EState>(StateIndex);
+					const EEvent Event = static_cast<EEvent>(EventIndex);
+					EState Expected = FromState;
+					uint8 ExpectedSub = static_cast<uint8>(SubIndex);
+					if (!LegacyTransition(Machine, Expected, ExpectedSub, Event))
+					{
+						continue;
+					}
+
+					StateMachines->SyncState(Slot, FromState, static_cast<uint8>(SubIndex));
+					StateMachines->RaiseEvent(Slot, Event);
+					StateMachines->ProcessEvents();
+
+					EState Actual = FromState;
+					uint8 ActualSub = 0;
+					StateMachines->GetState(Slot, Actual, ActualSub);
+					const FString Cell = FString::Printf(TEXT("%s %s/%d + %s"), Case.Name,
+						*StateEnum->GetNameStringByValue(StateIndex), SubIndex, *EventEnum->GetNameStringByValue(EventIndex));
+					TestEqual(Cell + TEXT(": state"), static_cast<int32>(Actual), static_cast<int32>(Expected));
+					TestEqual(Cell + TEXT(": sub-state"), static_cast<int32>(ActualSub), static_cast<int32>(ExpectedSub));
+				}
+			}
+		}
+		StateMachines->Unregister(Slot);
+	}
+
+	// Events are deferred: the state only moves when the pass runs
+	{
+		const int32 Slot = StateMachines->Register(nullptr, TEXT("Artefact"), EState::Idle, 0);
+		StateMachines->RaiseEvent(Slot, EEvent::Interact);
+		EState State = EState::Idle;
+		uint8 SubState = 0;
+		StateMachines->GetState(Slot, State, SubState);
+		TestEqual(TEXT("Unchanged until the pass"), static_cast<int32>(State), static_cast<int32>(EState::Idle));
+		StateMachines->ProcessEvents();
+		StateMachines->GetState(Slot, State, SubState);
+		TestEqual(TEXT("Applied by the pass"), static_cast<int32>(State), static_cast<int32>(EState::Resolved));
+		StateMachines->Unregister(Slot);
+	}
+
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
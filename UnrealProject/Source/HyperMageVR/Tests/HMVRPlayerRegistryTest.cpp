@@ -0,0 +1,98 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HMVRPlayerRegistry.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRPlayerRegistryTest, "HyperMageVR.Players.Registry",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRPlayerRegistryTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("Test world"), World))
+	{
+		return false;
+	}
+
+	// Stand-in controllers — only their identity is used
+	FActorSpawnParameters Params;
+	Params.ObjectFlags |= RF_Transient;
+	APlayerController* A = World->SpawnActor<APlayerController>(Params);
+	APlayerController* B = World->SpawnActor<APlayerController>(Params);
+	APlayerController* C = World->SpawnActor<APlayerController>(Params);
+	if (!TestNotNull(TEXT("Controller A"), A) || !TestNotNull(TEXT("Controller B"), B) || !TestNotNull(TEXT("Controller C"), C))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	FHMVRPlayerRegistry Registry;
+	const FHMVRPlayerHandle HandleA = Registry.Add(A, TEXT("cognito-a"));
+	const FHMVRPlayerHandle HandleB = Registry.Add(B, TEXT("cognito-b"));
+	TestTrue(TEXT("Add registers a new player"), HandleA.IsSet() && HandleB.IsSet());
+	TestEqual(TEXT("Count follows Add"), Registry.Num(), 2);
+
+	// A controller or Cognito id already present is refused (PostLogin's reconnect path relies on this)
+	TestFalse(TEXT("Same controller refused"), Registry.Add(A, TEXT("cognito-other")).IsSet());
+	TestFalse(TEXT("Same Cognito id on another controller refused"), Registry.Add(C, TEXT("cognito-a")).IsSet());
+	TestFalse(TEXT("Null controller refused"), Registry.Add(nullptr, TEXT("cognito-null")).IsSet());
+	TestEqual(TEXT("Refused adds leave the count alone"), Registry.Num(), 2);
+
+	// Every key resolves to the same handle
+	const FHMVRId SessionA = FHMVRId::Generate();
+	TestTrue(TEXT("Set player session id"), Registry.SetPlayerSessionId(HandleA, TEXT("psess-a")));
+	TestTrue(TEXT("Set session id"), Registry.SetSessionId(HandleA, SessionA));
+	TestTrue(TEXT("Find by controller"), Registry.FindByController(A) == HandleA);
+	TestTrue(TEXT("Find by Cognito id"), Registry.FindByCognitoId(TEXT("cognito-a")) == HandleA);
+	TestTrue(TEXT("Find by player session id"), Registry.FindByPlayerSessionId(TEXT("psess-a")) == HandleA);
+	TestTrue(TEXT("Find by session id"), Registry.FindBySessionId(SessionA) == HandleA);
+
+	// An empty id clears the key
+	Registry.SetPlayerSessionId(HandleA, FString());
+	TestFalse(TEXT("Cleared player session id no longer resolves"), Registry.FindByPlayerSessionId(TEXT("psess-a")).IsSet());
+	Registry.SetPlayerSessionId(HandleA, TEXT("psess-a"));
+
+	// Remove drops every key; the old handle goes stale even when the slot is reused
+	TestTrue(TEXT("Remove a live player"), Registry.Remove(HandleA));
+	TestFalse(TEXT("Remove twice fails"), Registry.Remove(HandleA));
+	TestNull(TEXT("Stale handle resolves to nothing"), Registry.Get(HandleA));
+	TestFalse(TEXT("Controller key dropped"), Registry.FindByController(A).IsSet());
+	TestFalse(TEXT("Cognito key dropped"), Registry.FindByCognitoId(TEXT("cognito-a")).IsSet());
+	TestFalse(TEXT("Player session key dropped"), Registry.FindByPlayerSessionId(TEXT("psess-a")).IsSet());
+	TestFalse(TEXT("Session key dropped"), Registry.FindBySessionId(SessionA).IsSet());
+
+	const FHMVRPlayerHandle HandleC = Registry.Add(C, TEXT("cognito-a"));
+	TestTrue(TEXT("A freed Cognito id can register again"), HandleC.IsSet());
+	TestEqual(TEXT("Freed slot is reused"), HandleC.Index, HandleA.Index);
+	TestFalse(TEXT("Reused slot has a new generation"), HandleC == HandleA);
+	TestNull(TEXT("Old handle does not resolve to the newcomer"), Registry.Get(HandleA));
+	if (const FHMVRPlayerRecord* Record = Registry.Get(HandleC))
+	{
+		TestTrue(TEXT("Newcomer starts without the old player's keys"), Record->PlayerSessionId.IsEmpty() && Record->SessionId.IsEmpty());
+	}
+
+	// Reconnect replacement as PostLogin does it: remove the stale record, register the new controller
+	Registry.Remove(Registry.FindByCognitoId(TEXT("cognito-b")));
+	const FHMVRPlayerHandle Replaced = Registry.Add(A, TEXT("cognito-b"));
+	TestTrue(TEXT("Reconnecting controller takes over the Cognito id"), Registry.FindByCognitoId(TEXT("cognito-b")) == Replaced);
+	TestFalse(TEXT("Stale controller no longer registered"), Registry.FindByController(B).IsSet());
+
+	int32 Visited = 0;
+	Registry.ForEach([&Visited](FHMVRPlayerHandle, const FHMVRPlayerRecord&) { ++Visited; });
+	TestEqual(TEXT("ForEach visits live players only"), Visited, Registry.Num());
+	TestEqual(TEXT("Indexes agree with the slots"), Registry.Verify(), 0);
+
+	Registry.Reset();
+	TestEqual(TEXT("Reset empties the registry"), Registry.Num(), 0);
+	TestFalse(TEXT("Reset drops the keys"), Registry.FindByCognitoId(TEXT("cognito-b")).IsSet());
+
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,147 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "HMVRPoseReplicationComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRPoseCodecTest, "HyperMageVR.Pose.Codec",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRPoseCodecTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(0x5EED);
+	auto RandomSample = [&Random]()
+	{
+		FHMVRPoseSample Sample;
+		for (int32 Device = 0; Device < HMVRPose::NumDevices; ++Device)
+		{
+			Sample.Position[Device] = Random.GetUnitVector() * Random.FRandRange(0.f, 200.f);
+			Sample.Rotation[Device] = FQuat(Random.GetUnitVector(), Random.FRandRange(-PI, PI));
+		}
+		return Sample;
+	};
+
+	// Smallest-three rotations: within half a degree, q and -q alike
+	{
+		double WorstRadians = 0.0;
+		for (int32 i = 0; i < 2000; ++i)
+		{
+			FQuat Original(Random.GetUnitVector(), Random.FRandRange(-PI, PI));
+			if (i & 1)
+			{
+				Original = FQuat(-Original.X, -Original.Y, -Original.Z, -Original.W);
+			}
+			const FQuat Unpacked = FHMVRQuantizedPose::UnpackRotation(FHMVRQuantizedPose::PackRotation(Original));
+			WorstRadians = FMath::Max(WorstRadians, static_cast<double>(Unpacked.AngularDistance(Original)));
+		}
+		TestTrue(FString::Printf(TEXT("Rotation error %.4f rad stays under 0.01"), WorstRadians), WorstRadians < 0.01);
+		TestTrue(TEXT("Identity survives"),
+			FHMVRQuantizedPose::UnpackRotation(FHMVRQuantizedPose::PackRotation(FQuat::Identity)).Equals(FQuat::Identity, 1e-3));
+	}
+
+	// Positions: 1 mm quanta, clamped to the int16 range
+	{
+		FHMVRPoseSample Sample = RandomSample();
+		Sample.Position[HMVRPose::RightHand] = FVector(5000.f, -5000.f, 0.f);
+		const FHMVRQuantizedPose Pose = FHMVRQuantizedPose::Quantize(Sample, 7, 1234);
+		const FHMVRPoseSample Restored = Pose.Dequantize();
+
+		TestEqual(TEXT("Sequence kept"), static_cast<int32>(Pose.Sequence), 7);
+		TestEqual(TEXT("Time kept"), static_cast<int32>(Pose.TimeMs), 1234);
+		for (int32 Device = HMVRPose::Head; Device < HMVRPose::RightHand; ++Device)
+		{
+			TestTrue(TEXT("Within half a millimetre"),
+				Restored.Position[Device].Equals(Sample.Position[Device], HMVRPose::PositionResolutionCm * 0.5f + 1e-3f));
+		}
+		TestEqual(TEXT("Clamped high"), static_cast<int32>(Pose.Position[HMVRPose::RightHand][0]), 32767);
+		TestEqual(TEXT("Clamped low"), static_cast<int32>(Pose.Position[HMVRPose::RightHand][1]), -32768);
+	}
+
+	// Codec: keyframes and deltas decode to exactly what was encoded
+	{
+		auto RoundTrip = [](const FHMVRQuantizedPose& Pose, const FHMVRQuantizedPose* Baseline,
+			const FHMVRPoseHistory& History, FHMVRQuantizedPose& OutPose, int64& OutBits)
+		{
+			FBitWriter Writer(HMVRPose::MaxEncodedBits, true);
+			FHMVRPoseCodec::Write(Writer, Pose, Baseline);
+			OutBits = Writer.GetNumBits();
+			FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+			const bool bRead = FHMVRPoseCodec::Read(Reader, OutPose,
+				[&History](uint16 Sequence) { return History.Find(Sequence); });
+			return bRead && Reader.AtEnd();
+		};
+
+		FHMVRPoseHistory History;
+		const FHMVRQuantizedPose Base = FHMVRQuantizedPose::Quantize(RandomSample(), 65534, 100);
+
+		FHMVRQuantizedPose Decoded;
+		int64 KeyframeBits = 0;
+		TestTrue(TEXT("Keyframe reads without a baseline"), RoundTrip(Base, nullptr, History, Decoded, KeyframeBits));
+		TestTrue(TEXT("Keyframe is exact"), Decoded.SameValues(Base) && Decoded.Sequence == Base.Sequence && Decoded.TimeMs == Base.TimeMs);
+		TestTrue(TEXT("Keyframe fits the RPC bound"), KeyframeBits <= HMVRPose::MaxEncodedBits);
+		History.Add(Base);
+
+		// Small moves, one jump past the 12-bit range and one rotation swapping its largest component
+		FHMVRQuantizedPose Next = Base;
+		Next.Sequence = 2; // wraps past 65535
+		Next.TimeMs = 140;
+		Next.Position[HMVRPose::Head][0] += 3;
+		Next.Position[HMVRPose::LeftHand][1] -= 300;
+		Next.Position[HMVRPose::RightHand][2] = static_cast<int16>(Next.Position[HMVRPose::RightHand][2] > 0 ? -20000 : 20000);
+		Next.Rotation[HMVRPose::Head] = FHMVRQuantizedPose::PackRotation(
+			FHMVRQuantizedPose::UnpackRotation(Base.Rotation[HMVRPose::Head]) * FQuat(FVector::UpVector, 0.02f));
+		Next.Rotation[HMVRPose::LeftHand] = FHMVRQuantizedPose::PackRotation(FQuat(FVector::ForwardVector, 0.1f));
+		Next.Rotation[HMVRPose::RightHand] = FHMVRQuantizedPose::PackRotation(FQuat(FVector::RightVector, PI - 0.1f));
+
+		int64 DeltaBits = 0;
+		TestTrue(TEXT("Delta reads against the history"), RoundTrip(Next, &Base, History, Decoded, DeltaBits));
+		TestTrue(TEXT("Delta is exact"), Decoded.SameValues(Next) && Decoded.Sequence == Next.Sequence);
+		TestTrue(TEXT("Delta is smaller than a keyframe"), DeltaBits < KeyframeBits);
+
+		FHMVRQuantizedPose Still = Base;
+		Still.Sequence = 3;
+		int64 StillBits = 0;
+		TestTrue(TEXT("Unchanged pose reads"), RoundTrip(Still, &Base, History, Decoded, StillBits));
+		TestTrue(TEXT("Unchanged pose costs the header plus a bit per field"), StillBits == 33 + 6 + HMVRPose::NumDevices * 4);
+
+		FHMVRPoseHistory Empty;
+		TestFalse(TEXT("Missing baseline is reported"), RoundTrip(Next, &Base, Empty, Decoded, DeltaBits));
+
+		FHMVRQuantizedPose TooFar = Base;
+		TooFar.Sequence = static_cast<uint16>(Base.Sequence + HMVRPose::HistorySize);
+		TestTrue(TEXT("Baseline beyond the history falls back to a keyframe"), RoundTrip(TooFar, &Base, Empty, Decoded, DeltaBits));
+		TestTrue(TEXT("Fallback keyframe is exact"), Decoded.SameValues(TooFar));
+	}
+
+	// History: indexed by sequence, a newer pose evicts the one sharing its slot
+	{
+		FHMVRPoseHistory History;
+		FHMVRQuantizedPose Pose;
+		Pose.Sequence = 10;
+		History.Add(Pose);
+		TestNotNull(TEXT("Found by sequence"), History.Find(10));
+		Pose.Sequence = 10 + HMVRPose::HistorySize;
+		History.Add(Pose);
+		TestNull(TEXT("Evicted by a pose in the same slot"), History.Find(10));
+		TestNotNull(TEXT("Newer pose found"), History.Find(10 + HMVRPose::HistorySize));
+		History.Reset();
+		TestNull(TEXT("Reset clears it"), History.Find(10 + HMVRPose::HistorySize));
+	}
+
+	// Sequence order across the 16-bit wrap
+	{
+		TestTrue(TEXT("1 is newer than 65535"), HMVRPose::IsNewer(1, 65535));
+		TestFalse(TEXT("65535 is older than 1"), HMVRPose::IsNewer(65535, 1));
+		TestFalse(TEXT("Equal is not newer"), HMVRPose::IsNewer(5, 5));
+		TestTrue(TEXT("Plain order"), HMVRPose::IsNewer(6, 5));
+	}
+
+	return true;
+}
+
+#endif
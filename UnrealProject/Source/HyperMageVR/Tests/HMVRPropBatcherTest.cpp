@@ -0,0 +1,133 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "UObject/Package.h"
+#include "HMVRPropBatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRPropBatcherTest, "HyperMageVR.Props.Batcher",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRPropBatcherTest::RunTest(const FString& Parameters)
+{
+	// Grouping only compares pointers; the assets are never rendered
+	UStaticMesh* Rock = NewObject<UStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	UStaticMesh* Tree = NewObject<UStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	UMaterialInterface* Moss = NewObject<UMaterialInstanceConstant>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	auto MakeProp = [](UStaticMesh* Mesh, UMaterialInterface* Material, float X)
+	{
+		FHMVRPropDesc Prop;
+		Prop.Mesh = Mesh;
+		Prop.Material = Material;
+		Prop.Transform = FTransform(FVector(X, 0.f, 0.f));
+		return Prop;
+	};
+
+	// Mesh and material both split groups; members keep input order
+	{
+		TArray<FHMVRPropDesc> Props;
+		Props.Add(MakeProp(Rock, nullptr, 0.f));  // 0: rock
+		Props.Add(MakeProp(Tree, nullptr, 1.f));  // 1: tree
+		Props.Add(MakeProp(Rock, Moss, 2.f));     // 2: mossy rock
+		Props.Add(MakeProp(Rock, nullptr, 3.f));  // 3: rock
+		Props.Add(MakeProp(Tree, nullptr, 4.f));  // 4: tree
+		Props.Add(MakeProp(nullptr, Moss, 5.f));  // 5: no mesh — skipped
+
+		TArray<FHMVRPropBatcher::FGroup> Groups;
+		FHMVRPropBatcher::GroupProps(Props, 512, Groups);
+		if (TestEqual(TEXT("One group per mesh/material"), Groups.Num(), 3))
+		{
+			TestTrue(TEXT("Rocks grouped"), Groups[0].Members == TArray<int32>({ 0, 3 }));
+			TestTrue(TEXT("Trees grouped"), Groups[1].Members == TArray<int32>({ 1, 4 }));
+			TestTrue(TEXT("Material splits the rock group"), Groups[2].Members == TArray<int32>({ 2 }));
+		}
+	}
+
+	// Tint is part of the key
+	{
+		TArray<FHMVRPropDesc> Props;
+		Props.Add(MakeProp(Rock, Moss, 0.f));
+		Props.Add(MakeProp(Rock, Moss, 1.f));
+		Props[1].Tint = FLinearColor::Red;
+		Props.Add(MakeProp(Rock, Moss, 2.f));
+		Props[2].Tint = FLinearColor::Red;
+
+		TArray<FHMVRPropBatcher::FGroup> Groups;
+		FHMVRPropBatcher::GroupProps(Props, 512, Groups);
+		TestEqual(TEXT("Tinted and untinted props split"), Groups.Num(), 2);
+	}
+
+	// Each group is chunked to the batch cap, filling one chunk before opening the next
+	{
+		TArray<FHMVRPropDesc> Props;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			Props.Add(MakeProp(i % 2 == 0 ? Rock : Tree, nullptr, static_cast<float>(i)));
+		}
+
+		TArray<FHMVRPropBatcher::FGroup> Groups;
+		FHMVRPropBatcher::GroupProps(Props, 2, Groups);
+		TestEqual(TEXT("Five rocks and five trees in chunks of two"), Groups.Num(), 6);
+		int32 Members = 0;
+		for (const FHMVRPropBatcher::FGroup& Group : Groups)
+		{
+			TestTrue(TEXT("Chunk within the cap"), Group.Members.Num() >= 1 && Group.Members.Num() <= 2);
+			Members += Group.Members.Num();
+		}
+		TestEqual(TEXT("Every prop lands in exactly one chunk"), Members, Props.Num());
+
+		TArray<FHMVRPropBatcher::FGroup> Again;
+		FHMVRPropBatcher::GroupProps(Props, 2, Again);
+		bool bSame = Again.Num() == Groups.Num();
+		for (int32 i = 0; bSame && i < Groups.Num(); ++i)
+		{
+			bSame = Again[i].Members == Groups[i].Members;
+		}
+		TestTrue(TEXT("Grouping is deterministic"), bSame);
+
+		TArray<FHMVRPropBatcher::FGroup> Capped;
+		FHMVRPropBatcher::GroupProps(Props, 0, Capped);
+		TestEqual(TEXT("A cap below one is treated as one"), Capped.Num(), Props.Num());
+	}
+
+	// Movable props are never instanced
+	{
+		TArray<FHMVRPropDesc> Props;
+		Props.Add(MakeProp(Rock, nullptr, 0.f));
+		Props.Add(MakeProp(Rock, nullptr, 1.f));
+		Props[1].bMovable = true;
+		Props.Add(MakeProp(Rock, nullptr, 2.f));
+		Props.Add(MakeProp(Tree, nullptr, 3.f));
+		Props[3].bMovable = true;
+
+		TArray<FHMVRPropBatcher::FGroup> Groups;
+		FHMVRPropBatcher::GroupProps(Props, 512, Groups);
+		if (TestEqual(TEXT("Only the static rocks are grouped"), Groups.Num(), 1))
+		{
+			TestTrue(TEXT("Movable rock left out"), Groups[0].Members == TArray<int32>({ 0, 2 }));
+		}
+
+		FHMVRPropBatcher Batcher;
+		for (const FHMVRPropDesc& Prop : Props)
+		{
+			Batcher.Add(Prop);
+		}
+		TestEqual(TEXT("One batch actor plus one actor per movable prop"), Batcher.BeginBuild(), 3);
+		TestTrue(TEXT("Build pending"), Batcher.IsBuilding());
+		TestFalse(TEXT("No world: the build ends"), Batcher.BuildNext(nullptr));
+		TestFalse(TEXT("Build ended"), Batcher.IsBuilding());
+		TestEqual(TEXT("Pending list cleared"), Batcher.Num(), 0);
+	}
+
+	Rock->MarkAsGarbage();
+	Tree->MarkAsGarbage();
+	Moss->MarkAsGarbage();
+	return true;
+}
+
+#endif
@@ -0,0 +1,156 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HMVRTimingWheel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHMVRTimingWheelTest, "HyperMageVR.Containers.TimingWheel",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHMVRTimingWheelTest::RunTest(const FString& Parameters)
+{
+	// Single level: 1 s ticks, 8 slots, so anything past 8 s wraps and carries rounds
+	{
+		THMVRTimingWheel<int32> Wheel(1.0, 8);
+		TArray<TPair<int32, double>> Fired;
+		double Clock = 100.0;
+		auto AdvanceTo = [&Wheel, &Fired, &Clock](double Now)
+		{
+			Clock = Now;
+			Wheel.Advance(Now, [&Fired, &Clock](int32&& Item)
+			{
+				Fired.Emplace(Item, Clock);
+			});
+		};
+
+		Wheel.Schedule(Clock, 3.0, 3);
+		Wheel.Schedule(Clock, 0.0, 0);   // still waits one tick
+		Wheel.Schedule(Clock, 20.0, 20); // two and a half revolutions
+		TestEqual(TEXT("Three pending"), Wheel.Num(), 3);
+
+		for (double t = 100.5; t <= 125.0; t += 0.5)
+		{
+			AdvanceTo(t);
+		}
+
+		if (TestEqual(TEXT("Every item fired once"), Fired.Num(), 3))
+		{
+			TestEqual(TEXT("Zero delay fires first"), Fired[0].Key, 0);
+			TestEqual(TEXT("Then the 3 s item"), Fired[1].Key, 3);
+			TestEqual(TEXT("The wrapped item last"), Fired[2].Key, 20);
+			TestTrue(TEXT("3 s item never early"), Fired[1].Value >= 103.0 && Fired[1].Value <= 104.0);
+			TestTrue(TEXT("Wrapped item waits out its rounds"), Fired[2].Value >= 120.0 && Fired[2].Value <= 121.0);
+		}
+		TestTrue(TEXT("Empty once everything fired"), Wheel.IsEmpty());
+
+		// Rescheduling from inside the callback lands relative to the new position
+		Fired.Reset();
+		Wheel.Schedule(Clock, 2.0, 1);
+		int32 Chained = 0;
+		for (double t = Clock + 1.0; t <= Clock + 10.0 && Chained < 3; t += 1.0)
+		{
+			Wheel.Advance(t, [&Wheel, &Chained, t](int32&& Item)
+			{
+				++Chained;
+				if (Item < 3)
+				{
+					Wheel.Schedule(t, 2.0, Item + 1);
+				}
+			});
+		}
+		TestEqual(TEXT("Items scheduled from the callback fire too"), Chained, 3);
+
+		// An idle wheel measures a new delay from the time it is scheduled, not from its last advance
+		Fired.Reset();
+		Wheel.Schedule(1000.0, 2.0, 7);
+		AdvanceTo(1001.0);
+		TestEqual(TEXT("Idle catch-up: not due after 1 s"), Fired.Num(), 0);
+		AdvanceTo(1002.0);
+		TestEqual(TEXT("Idle catch-up: due after 2 s"), Fired.Num(), 1);
+	}
+
+	// Hierarchical: 10 ms ticks, 64 slots per level
+	{
+		THMVRHierarchicalTimingWheel<int32> Wheel(0.01);
+		const double Start = 10.0;
+		Wheel.Advance(Start, [](TArray<int32>&) {});
+
+		const uint64 Soon = Wheel.Schedule(Start, 0.25, 1);   // level 0
+		const uint64 Later = Wheel.Schedule(Start, 5.0, 2);   // level 1
+		const uint64 Cancelled = Wheel.Schedule(Start, 1.0, 3);
+		const uint64 Far = Wheel.Schedule(Start, 3000.0, 4);  // top level, cascaded down
+		TestTrue(TEXT("Handles are never zero"), Soon != 0 && Later != 0 && Cancelled != 0 && Far != 0);
+		TestEqual(TEXT("Four pending"), Wheel.Num(), 4);
+
+		TestTrue(TEXT("Cancel a pending item"), Wheel.Cancel(Cancelled));
+		TestFalse(TEXT("Cancel twice is a no-op"), Wheel.Cancel(Cancelled));
+		TestFalse(TEXT("Cancelled handle no longer pending"), Wheel.IsPending(Cancelled));
+		TestNull(TEXT("Nothing behind a cancelled handle"), Wheel.Find(Cancelled));
+		TestTrue(TEXT("Remaining time of a pending item"),
+			FMath::IsNearlyEqual(Wheel.GetRemainingSeconds(Start, Later), 5.0, 0.011));
+
+		int32 Visited = 0;
+		Wheel.ForEachPending(Start + 1.0, [this, &Visited](const int32&, double Remaining)
+		{
+			++Visited;
+			TestTrue(TEXT("ForEachPending reports time left from Now"), Remaining >= 0.0);
+		});
+		TestEqual(TEXT("ForEachPending skips cancelled items"), Visited, 3);
+
+		TArray<int32> Order;
+		TArray<double> FiredAt;
+		for (double t = Start + 0.1; t <= Start + 3001.0; t += (t < Start + 10.0 ? 0.1 : 50.0))
+		{
+			Wheel.Advance(t, [&Order, &FiredAt, t](TArray<int32>& Batch)
+			{
+				for (int32 Item : Batch)
+				{
+					Order.Add(Item);
+					FiredAt.Add(t);
+				}
+			});
+		}
+		if (TestEqual(TEXT("Cancelled item never fires"), Order.Num(), 3))
+		{
+			TestTrue(TEXT("Fired in due order"), Order == TArray<int32>({ 1, 2, 4 }));
+			TestTrue(TEXT("Level 0 item not early"), FiredAt[0] >= Start + 0.25);
+			TestTrue(TEXT("Level 1 item not early"), FiredAt[1] >= Start + 5.0);
+			TestTrue(TEXT("Cascaded item not early"), FiredAt[2] >= Start + 3000.0);
+		}
+		TestFalse(TEXT("Fired handle is stale"), Wheel.IsPending(Soon));
+		TestFalse(TEXT("Cancelling a fired handle is a no-op"), Wheel.Cancel(Far));
+
+		// Everything due in one advance comes back as one batch, earliest first
+		const double Now = Start + 4000.0;
+		Wheel.Schedule(Now, 0.5, 20);
+		Wheel.Schedule(Now, 0.1, 10);
+		Wheel.Schedule(Now, 0.3, 30);
+		TArray<int32> Batched;
+		int32 Calls = 0;
+		Wheel.Advance(Now + 1.0, [&Batched, &Calls](TArray<int32>& Batch)
+		{
+			++Calls;
+			Batched.Append(Batch);
+		});
+		TestEqual(TEXT("One callback per advance"), Calls, 1);
+		TestTrue(TEXT("Batch in due order"), Batched == TArray<int32>({ 10, 30, 20 }));
+
+		// A freed slot is reused under a new generation; the old handle stays dead
+		const uint64 First = Wheel.Schedule(Now + 1.0, 1.0, 1);
+		Wheel.Cancel(First);
+		const uint64 Reused = Wheel.Schedule(Now + 1.0, 1.0, 2);
+		TestTrue(TEXT("New handle differs"), Reused != First);
+		TestFalse(TEXT("Old handle does not reach the new item"), Wheel.IsPending(First));
+		TestTrue(TEXT("New handle pending"), Wheel.IsPending(Reused));
+
+		Wheel.Reset();
+		TestTrue(TEXT("Reset empties the wheel"), Wheel.IsEmpty());
+		TestFalse(TEXT("Reset invalidates handles"), Wheel.IsPending(Reused));
+	}
+
+	return true;
+}
+
+#endif
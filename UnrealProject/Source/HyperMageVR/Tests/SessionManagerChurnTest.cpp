@@ -0,0 +1,167 @@
+// Copyright 2026 HyperMage. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+#include "SessionManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Sets a cvar for the test and puts the previous value back afterwards
+	struct FScopedCVarFloat
+	{
+		IConsoleVariable* Var;
+		FString Previous;
+
+		FScopedCVarFloat(const TCHAR* Name, float Value)
+			: Var(IConsoleManager::Get().FindConsoleVariable(Name))
+		{
+			if (Var)
+			{
+				Previous = Var->GetString();
+				Var->Set(Value, ECVF_SetByCode);
+			}
+		}
+
+		~FScopedCVarFloat()
+		{
+			if (Var)
+			{
+				Var->Set(*Previous, ECVF_SetByCode);
+			}
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSessionManagerChurnTest, "HyperMageVR.Session.Churn",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSessionManagerChurnTest::RunTest(const FString& Parameters)
+{
+	constexpr float Retention = 300.f;
+	constexpr float RetryDelay = 10.f;
+	const FScopedCVarFloat RetentionVar(TEXT("hmvr.Session.EndedRetentionSeconds"), Retention);
+	const FScopedCVarFloat RetryVar(TEXT("hmvr.Session.SummaryRetrySeconds"), RetryDelay);
+	const IConsoleVariable* MaxSessionsVar = IConsoleManager::Get().FindConsoleVariable(TEXT("hmvr.Session.MaxSessions"));
+	if (!TestNotNull(TEXT("hmvr.Session.MaxSessions exists"), MaxSessionsVar))
+	{
+		return false;
+	}
+
+	USessionManager* Manager = NewObject<USessionManager>(GetTransientPackage(), NAME_None, RF_Transient);
+	double Clock = 1.0;
+	Manager->SetManualClock(Clock);
+
+	// The Session API is "down" for the first summary of every 10th session. Half of those come
+	// back on the first re-send; the rest never do.
+	struct FResendLog
+	{
+		TArray<double> Times;
+		double EndedAt = 0.0;
+	};
+	TMap<FHMVRId, FResendLog> Resends;
+	TSet<FHMVRId> AckOnResend;
+	TArray<FHMVRId> PendingAcks;
+	Manager->OnSummaryResend = [&Resends, &AckOnResend, &PendingAcks, &Clock](const FPlayerSessionSummary& Summary)
+	{
+		Resends.FindOrAdd(Summary.SessionId).Times.Add(Clock);
+		if (AckOnResend.Contains(Summary.SessionId))
+		{
+			PendingAcks.Add(Summary.SessionId); // the HTTP response arrives after the tick
+		}
+	};
+
+	const ELogVerbosity::Type PreviousVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Error);
+
+	constexpr int32 Joins = 2000;
+	TArray<FHMVRId> NeverAcked;
+	for (int32 i = 0; i < Joins; ++i)
+	{
+		const FPlayerSession Session = Manager->CreateSession(FString::Printf(TEXT("churn-player-%d"), i), TEXT("churn-shard"));
+		Manager->StartSession(Session.SessionId);
+		Manager->AddReward(Session.SessionId, TEXT("churn-reward"));
+		Manager->EndSession(Session.SessionId);
+		Manager->DiscardSessionState(Session.SessionId);
+
+		if (i % 10 != 0)
+		{
+			Manager->AcknowledgeSummary(Session.SessionId);
+		}
+		else
+		{
+			Resends.FindOrAdd(Session.SessionId).EndedAt = Clock;
+			if (i % 20 == 0)
+			{
+				AckOnResend.Add(Session.SessionId);
+			}
+			else
+			{
+				NeverAcked.Add(Session.SessionId);
+			}
+		}
+
+		Clock += 1.0;
+		Manager->SetManualClock(Clock);
+		Manager->TickExpiry(Clock);
+		for (const FHMVRId& SessionId : PendingAcks)
+		{
+			Manager->AcknowledgeSummary(SessionId);
+		}
+		PendingAcks.Reset();
+	}
+
+	// Let every remaining deadline pass
+	for (int32 Step = 0; Step <= static_cast<int32>(Retention) + 1; ++Step)
+	{
+		Clock += 1.0;
+		Manager->SetManualClock(Clock);
+		Manager->TickExpiry(Clock);
+		for (const FHMVRId& SessionId : PendingAcks)
+		{
+			Manager->AcknowledgeSummary(SessionId);
+		}
+		PendingAcks.Reset();
+	}
+
+	LogTemp.SetVerbosity(PreviousVerbosity);
+
+	// Re-sends at 10, 30, 70 and 150 s after the end; the next (310 s) would be past the retention
+	for (const FHMVRId& SessionId : AckOnResend)
+	{
+		const FResendLog& Entry = Resends.FindChecked(SessionId);
+		TestEqual(TEXT("Summary acknowledged on the first re-send is not sent again"), Entry.Times.Num(), 1);
+	}
+	for (const FHMVRId& SessionId : NeverAcked)
+	{
+		const FResendLog& Entry = Resends.FindChecked(SessionId);
+		TestEqual(TEXT("Unacknowledged summary is re-sent with backoff until expiry"), Entry.Times.Num(), 4);
+		for (int32 i = 0; i < Entry.Times.Num(); ++i)
+		{
+			TestTrue(TEXT("Re-sends happen before the session expires"), Entry.Times[i] - Entry.EndedAt < Retention);
+			if (i > 0)
+			{
+				TestTrue(TEXT("Re-send delay backs off"),
+					Entry.Times[i] - Entry.Times[i - 1] > (i > 1 ? Entry.Times[i - 1] - Entry.Times[i - 2] : Entry.Times[0] - Entry.EndedAt));
+			}
+		}
+	}
+
+	const USessionManager::FLifecycleStats& Stats = Manager->GetLifecycleStats();
+	TestEqual(TEXT("Every session was created"), Stats.Created, static_cast<int64>(Joins));
+	TestEqual(TEXT("Acknowledged, first time or on a re-send"), Stats.Acknowledged, static_cast<int64>(Joins - NeverAcked.Num()));
+	TestEqual(TEXT("Only never-acknowledged sessions expire"), Stats.Expired, static_cast<int64>(NeverAcked.Num()));
+	TestEqual(TEXT("Re-sends counted"), Stats.SummaryResends, static_cast<int64>(AckOnResend.Num() + NeverAcked.Num() * 4));
+	TestEqual(TEXT("Nothing expired for the cap"), Stats.ExpiredForCap, static_cast<int64>(0));
+	TestTrue(TEXT("Held sessions stay under the cap"), Stats.PeakSessions <= MaxSessionsVar->GetInt());
+	TestEqual(TEXT("Nothing held once every deadline has passed"), Manager->GetSessionCount(), 0);
+
+	Manager->OnSummaryResend = nullptr;
+	Manager->MarkAsGarbage();
+	return true;
+}
+
+#endif
@@ -1,6 +1,8 @@
 // Copyright 2026 HyperMage. All Rights Reserved.
 
 #include "VRPawn.h"
+#include "HMVRPoseReplicationComponent.h"
+#include "HMVRServerPolicy.h"
 #include "Camera/CameraComponent.h"
 #include "MotionControllerComponent.h"
 #include "Components/PostProcessComponent.h"
@@ -14,7 +16,8 @@
 
 AVRPawn::AVRPawn()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Tick only drives the comfort vignette and the local snap-turn cooldown
+	PrimaryActorTick.bCanEverTick = !UE_SERVER;
 	bReplicates = true;
 	SetReplicateMovement(true);
 
@@ -36,15 +39,44 @@ AVRPawn::AVRPawn()
 	RightController->SetupAttachment(VROrigin);
 	RightController->MotionSource = FName("Right");
 
+#if !UE_SERVER
 	// Create Comfort Vignette Post Process
-	ComfortVignettePostProcess = CreateDefaultSubobject<UPostProcessComponent>(TEXT("ComfortVignette"));
-	ComfortVignettePostProcess->SetupAttachment(VRCamera);
-	ComfortVignettePostProcess->bEnabled = true;
-	ComfortVignettePostProcess->bUnbound = true;
+	ComfortVignettePostProcess = CreateOptionalDefaultSubobject<UPostProcessComponent>(TEXT("ComfortVignette"));
+	if (ComfortVignettePostProcess)
+	{
+		ComfortVignettePostProcess->SetupAttachment(VRCamera);
+		ComfortVignettePostProcess->bEnabled = true;
+		ComfortVignettePostProcess->bUnbound = true;
+	}
+#else
+	// No devices to poll on the dedicated server
+	LeftController->PrimaryComponentTick.bStartWithTickEnabled = false;
+	RightController->PrimaryComponentTick.bStartWithTickEnabled = false;
+#endif
+
+	// Head and hand pose replication (the actor transform alone carries neither)
+	PoseReplication = CreateDefaultSubobject<UHMVRPoseReplicationComponent>(TEXT("PoseReplication"));
 }
 
 void AVRPawn::BeginPlay()
 {
+	// Before Super so the component has its targets when it begins play
+	PoseReplication->SetTrackedComponents(VRCamera, LeftController, RightController);
+
+	if (!HMVRServerPolicy::WantsCosmetics())
+	{
+		// A game binary running as the dedicated server: no view to post-process and no devices
+		// to poll; the camera and controllers only carry the poses PoseReplication writes into them
+		if (ComfortVignettePostProcess)
+		{
+			ComfortVignettePostProcess->DestroyComponent();
+			ComfortVignettePostProcess = nullptr;
+		}
+		SetActorTickEnabled(false);
+		LeftController->SetComponentTickEnabled(false);
+		RightController->SetComponentTickEnabled(false);
+	}
+
 	Super::BeginPlay();
 
 	// Setup Enhanced Input
@@ -61,13 +93,9 @@ void AVRPawn::BeginPlay()
 	}
 
 	// Initialize comfort vignette
-	if (bComfortVignetteEnabled)
-	{
-		ComfortVignettePostProcess->bEnabled = true;
-	}
-	else
+	if (ComfortVignettePostProcess)
 	{
-		ComfortVignettePostProcess->bEnabled = false;
+		ComfortVignettePostProcess->bEnabled = bComfortVignetteEnabled;
 	}
 }
 
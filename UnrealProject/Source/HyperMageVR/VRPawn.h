@@ -13,6 +13,7 @@ class UMotionControllerComponent;
 class UInputMappingContext;
 class UInputAction;
 class UPostProcessComponent;
+class UHMVRPoseReplicationComponent;
 
 /**
  * VR comfort settings for motion sickness reduction
@@ -62,9 +63,14 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR")
 	TObjectPtr<UMotionControllerComponent> RightController;
 
+	// Not created in the server build; destroyed at BeginPlay on a -server game binary (HMVRServerPolicy::WantsCosmetics)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR")
 	TObjectPtr<UPostProcessComponent> ComfortVignettePostProcess;
 
+	// Replicates head and hand poses to the other players
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR")
+	TObjectPtr<UHMVRPoseReplicationComponent> PoseReplication;
+
 	// Enhanced Input
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	TObjectPtr<UInputMappingContext> VRMappingContext;